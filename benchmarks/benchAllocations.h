@@ -0,0 +1,103 @@
+/*
+ * benchAllocations.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef BENCHALLOCATIONS_H_
+#define BENCHALLOCATIONS_H_
+
+#include "compileConfig.h"
+
+#include <stddef.h>
+
+// Counts heap allocations and bytes of living blocks of the benchmark.
+// core::irrAllocator uses malloc, so allocations are counted below operator
+// new. Replacing malloc is supported by glibc only. Counters are not
+// atomic, measure allocations of one thread. Include it in one translation
+// unit.
+
+#ifdef __GLIBC__
+#define IRRGAME_COUNT_ALLOCATIONS
+#include <malloc.h>
+#endif
+
+namespace irrgame
+{
+	namespace benchmarks
+	{
+		//! Count of malloc, calloc and realloc calls
+		u32 AllocationCount = 0;
+
+		//! Usable bytes of blocks, which are not freed yet
+		size_t AllocatedSize = 0;
+
+		//! Returns count of allocations since start of program
+		inline u32 getAllocationCount()
+		{
+			return AllocationCount;
+		}
+
+		//! Returns bytes of living heap blocks, including unused tails
+		inline size_t getAllocatedSize()
+		{
+			return AllocatedSize;
+		}
+
+	}  // namespace benchmarks
+}  // namespace irrgame
+
+#ifdef IRRGAME_COUNT_ALLOCATIONS
+extern "C"
+{
+	void* __libc_malloc(size_t size);
+	void* __libc_calloc(size_t count, size_t size);
+	void* __libc_realloc(void* ptr, size_t size);
+	void __libc_free(void* ptr);
+
+	void* malloc(size_t size) __THROW
+	{
+		void* result = __libc_malloc(size);
+
+		++irrgame::benchmarks::AllocationCount;
+		irrgame::benchmarks::AllocatedSize += malloc_usable_size(result);
+
+		return result;
+	}
+
+	void* calloc(size_t count, size_t size) __THROW
+	{
+		void* result = __libc_calloc(count, size);
+
+		++irrgame::benchmarks::AllocationCount;
+		irrgame::benchmarks::AllocatedSize += malloc_usable_size(result);
+
+		return result;
+	}
+
+	void* realloc(void* ptr, size_t size) __THROW
+	{
+		irrgame::benchmarks::AllocatedSize -= malloc_usable_size(ptr);
+
+		void* result = __libc_realloc(ptr, size);
+
+		++irrgame::benchmarks::AllocationCount;
+
+		// zero size frees block, block is kept if reallocation fails
+		if (result || size)
+			irrgame::benchmarks::AllocatedSize += malloc_usable_size(
+					result ? result : ptr);
+
+		return result;
+	}
+
+	void free(void* ptr) __THROW
+	{
+		irrgame::benchmarks::AllocatedSize -= malloc_usable_size(ptr);
+		__libc_free(ptr);
+	}
+}
+#endif
+
+#endif /* BENCHALLOCATIONS_H_ */
@@ -0,0 +1,78 @@
+/*
+ * benchUtils.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef BENCHUTILS_H_
+#define BENCHUTILS_H_
+
+#include "compileConfig.h"
+#include "testUtils.h"
+
+#include <time.h>
+
+namespace irrgame
+{
+	namespace benchmarks
+	{
+		//! Returns monotonic time in nanoseconds
+		inline u64 getTimeNs()
+		{
+			timespec time;
+			clock_gettime(CLOCK_MONOTONIC, &time);
+
+			return (u64) time.tv_sec * 1000000000ULL + time.tv_nsec;
+		}
+
+		//! Measures best of several runs, it is the least disturbed by
+		//! other processes
+		class CBenchTimer
+		{
+			public:
+
+				//! Default constructor
+				CBenchTimer() :
+						Start(0), Best(0)
+				{
+				}
+
+				//! Starts run
+				void start()
+				{
+					Start = getTimeNs();
+				}
+
+				//! Ends run
+				void stop()
+				{
+					const u64 time = getTimeNs() - Start;
+
+					if (!Best || time < Best)
+						Best = time;
+				}
+
+				//! Returns time of best run in nanoseconds
+				u64 getBestNs() const
+				{
+					return Best;
+				}
+
+			private:
+
+				u64 Start;
+				u64 Best;
+		};
+
+		//! Prevents compiler from removing computation of value
+		template<class T>
+		inline void keep(const T& value)
+		{
+			__asm__ __volatile__("" : : "g"(&value) : "memory");
+		}
+
+	}  // namespace benchmarks
+}  // namespace irrgame
+
+#endif /* BENCHUTILS_H_ */
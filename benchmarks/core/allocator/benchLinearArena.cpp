@@ -0,0 +1,290 @@
+/*
+ * benchLinearArena.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Time and malloc calls of allocation heavy frame: event payloads, job
+// lists and temporary vertex arrays, which are built and thrown away every
+// frame. Heap frame uses new and irrAllocator, arena frame uses LinearArena
+// which is reset at the end of frame. Also time of single allocation of
+// mixed size from arena and from malloc.
+
+#include "core/allocator/LinearArena.h"
+#include "core/allocator/LinearArenaAllocator.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+#include "benchAllocations.h"
+
+#include <stdlib.h>
+
+using namespace irrgame;
+
+namespace
+{
+	const u32 Frames = 200;
+	const u32 Payloads = 2000;
+	const u32 JobLists = 50;
+	const u32 Meshes = 20;
+
+	//! Event payload of varying size
+	struct SPayload
+	{
+		public:
+			u32 Type;
+			u32 Size;
+			u8 Data[1];
+	};
+
+	//! Job of blit list
+	struct SJob
+	{
+		public:
+			void* Source;
+			void* Destination;
+			u32 Width;
+			u32 Height;
+	};
+
+	//! Vertex of temporary mesh
+	struct SVertex
+	{
+		public:
+			f32 Position[3];
+			f32 Normal[3];
+			f32 TCoords[2];
+	};
+
+	//! Uses heap for everything
+	class CHeapFrame
+	{
+		public:
+
+			u32 run(u32 frame)
+			{
+				u32 result = 0;
+
+				core::array<SPayload*> payloads;
+
+				for (u32 i = 0; i < Payloads; ++i)
+				{
+					const u32 size = 16 + (i + frame) % 64 * 4;
+
+					SPayload* payload = (SPayload*) new u8[sizeof(SPayload)
+							+ size];
+					payload->Type = i;
+					payload->Size = size;
+					payload->Data[0] = (u8) i;
+
+					payloads.pushBack(payload);
+				}
+
+				for (u32 i = 0; i < JobLists; ++i)
+				{
+					core::array<SJob> jobs;
+
+					for (u32 k = 0; k < 64; ++k)
+					{
+						SJob job =
+						{ 0, 0, k, i };
+						jobs.pushBack(job);
+					}
+
+					result += jobs.size();
+				}
+
+				for (u32 i = 0; i < Meshes; ++i)
+				{
+					core::array<SVertex> vertices;
+
+					for (u32 k = 0; k < 1000 + i * 50; ++k)
+					{
+						SVertex vertex =
+						{
+						{ (f32) k, 0, 0 },
+						{ 0, 1, 0 },
+						{ 0, 0 } };
+						vertices.pushBack(vertex);
+					}
+
+					result += vertices.size();
+				}
+
+				for (u32 i = 0; i < payloads.size(); ++i)
+				{
+					result += payloads[i]->Size;
+					delete[] (u8*) payloads[i];
+				}
+
+				return result;
+			}
+	};
+
+	typedef core::array<SPayload*, threads::NullLock,
+			core::LinearArenaAllocator<SPayload*> > arena_payload_array;
+
+	typedef core::array<SJob, threads::NullLock,
+			core::LinearArenaAllocator<SJob> > arena_job_array;
+
+	typedef core::array<SVertex, threads::NullLock,
+			core::LinearArenaAllocator<SVertex> > arena_vertex_array;
+
+	//! Takes all transient memory from arena
+	class CArenaFrame
+	{
+		public:
+
+			u32 run(u32 frame)
+			{
+				u32 result = 0;
+
+				{
+					arena_payload_array payloads(Arena);
+
+					for (u32 i = 0; i < Payloads; ++i)
+					{
+						const u32 size = 16 + (i + frame) % 64 * 4;
+
+						SPayload* payload = (SPayload*) Arena.allocate(
+								sizeof(SPayload) + size, 8);
+						payload->Type = i;
+						payload->Size = size;
+						payload->Data[0] = (u8) i;
+
+						payloads.pushBack(payload);
+					}
+
+					for (u32 i = 0; i < JobLists; ++i)
+					{
+						arena_job_array jobs(Arena);
+
+						for (u32 k = 0; k < 64; ++k)
+						{
+							SJob job =
+							{ 0, 0, k, i };
+							jobs.pushBack(job);
+						}
+
+						result += jobs.size();
+					}
+
+					for (u32 i = 0; i < Meshes; ++i)
+					{
+						arena_vertex_array vertices(Arena);
+
+						for (u32 k = 0; k < 1000 + i * 50; ++k)
+						{
+							SVertex vertex =
+							{
+							{ (f32) k, 0, 0 },
+							{ 0, 1, 0 },
+							{ 0, 0 } };
+							vertices.pushBack(vertex);
+						}
+
+						result += vertices.size();
+					}
+
+					// payloads are not freed one by one
+					for (u32 i = 0; i < payloads.size(); ++i)
+						result += payloads[i]->Size;
+				}
+
+				Arena.reset();
+
+				return result;
+			}
+
+		private:
+
+			core::LinearArena Arena;
+	};
+
+	void measureAllocations()
+	{
+		const u32 count = 5000;
+
+		core::array<void*> blocks;
+		blocks.setUsed(count);
+
+		core::LinearArena arena;
+		benchmarks::CBenchTimer arenaTimer;
+		benchmarks::CBenchTimer mallocTimer;
+
+		for (u32 frame = 0; frame < Frames; ++frame)
+		{
+			arenaTimer.start();
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				blocks[i] = arena.allocate(16 + i % 64 * 4);
+				*(u8*) blocks[i] = 1;
+			}
+
+			arena.reset();
+
+			arenaTimer.stop();
+
+			mallocTimer.start();
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				blocks[i] = malloc(16 + i % 64 * 4);
+				*(u8*) blocks[i] = 1;
+			}
+
+			for (u32 i = 0; i < count; ++i)
+				free(blocks[i]);
+
+			mallocTimer.stop();
+		}
+
+		printf("single allocation: arena %.1f ns, malloc and free %.1f ns\n",
+				(double) arenaTimer.getBestNs() / count,
+				(double) mallocTimer.getBestNs() / count);
+	}
+
+	template<class TFrame>
+	void measure(const c8* name)
+	{
+		TFrame frames;
+
+		// first frames warm up heap and merge chunks of arena
+		for (u32 i = 0; i < 3; ++i)
+			benchmarks::keep(frames.run(i));
+
+		benchmarks::CBenchTimer timer;
+		const u32 before = benchmarks::getAllocationCount();
+
+		for (u32 i = 0; i < Frames; ++i)
+		{
+			timer.start();
+			benchmarks::keep(frames.run(i));
+			timer.stop();
+		}
+
+		const u32 allocations = benchmarks::getAllocationCount() - before;
+
+		printf("%-6s frame: %8.1f us, %8.1f malloc calls\n", name,
+				timer.getBestNs() / 1e3, (double) allocations / Frames);
+	}
+}
+
+int main()
+{
+#ifndef IRRGAME_COUNT_ALLOCATIONS
+	printf("allocations are counted with glibc only\n");
+#endif
+
+	printf("%u payloads, %u job lists, %u meshes per frame\n", Payloads,
+			JobLists, Meshes);
+
+	measure<CHeapFrame>("heap");
+	measure<CArenaFrame>("arena");
+
+	measureAllocations();
+
+	return 0;
+}
@@ -0,0 +1,166 @@
+/*
+ * benchSlabAllocator.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Millions of random allocations and frees per second of 1..256 byte
+// blocks from SharedSlabAllocator and from malloc with 1, 2, 4 and 8
+// threads, and time of list and map node churn, which is served by slabs.
+
+#include "core/allocator/SharedSlabAllocator.h"
+#include "core/collections/list/list.h"
+#include "core/collections/map/map.h"
+#include "threads/irrgameThread.h"
+
+#include "benchUtils.h"
+
+#include <stdlib.h>
+
+using namespace irrgame;
+
+namespace
+{
+	const u32 Operations = 1000000;
+	const u32 Slots = 512;
+	const s32 Runs = 3;
+
+	class CStress
+	{
+		public:
+
+			CStress(bool slab) :
+					Slab(slab)
+			{
+			}
+
+			s32 run(void* /* arg */)
+			{
+				core::SharedSlabAllocator& slab =
+						core::SharedSlabAllocator::getInstance();
+
+				void* blocks[Slots];
+				u32 sizes[Slots];
+
+				for (u32 i = 0; i < Slots; ++i)
+					blocks[i] = 0;
+
+				tests::CTestRandom random((u32) (size_t) blocks);
+
+				for (u32 i = 0; i < Operations; ++i)
+				{
+					const u32 index = random.next(Slots);
+
+					if (blocks[index])
+					{
+						if (Slab)
+							slab.deallocate(blocks[index], sizes[index]);
+						else
+							free(blocks[index]);
+
+						blocks[index] = 0;
+					}
+					else
+					{
+						sizes[index] = 1 + random.next(256);
+						blocks[index] = Slab ? slab.allocate(sizes[index])
+								: malloc(sizes[index]);
+
+						*(u8*) blocks[index] = 1;
+					}
+				}
+
+				for (u32 i = 0; i < Slots; ++i)
+				{
+					if (!blocks[i])
+						continue;
+
+					if (Slab)
+						slab.deallocate(blocks[i], sizes[i]);
+					else
+						free(blocks[i]);
+				}
+
+				return 0;
+			}
+
+		private:
+
+			bool Slab;
+	};
+
+	//! Returns millions of operations per second
+	double measureStress(bool slab, u32 threads)
+	{
+		CStress stress(slab);
+
+		threads::delegateThreadCallback callback;
+		callback += NewDelegate(&stress, &CStress::run);
+
+		benchmarks::CBenchTimer timer;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			timer.start();
+			tests::runThreads(&callback, threads);
+			timer.stop();
+		}
+
+		return (double) Operations * threads / timer.getBestNs() * 1e3;
+	}
+
+	void measureContainers()
+	{
+		const u32 count = 100000;
+
+		benchmarks::CBenchTimer list;
+		benchmarks::CBenchTimer map;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			core::list<u32> values;
+
+			list.start();
+
+			for (u32 i = 0; i < count; ++i)
+				values.pushBack(i);
+
+			values.clear();
+
+			list.stop();
+
+			core::map<u32, u32> nodes;
+
+			map.start();
+
+			for (u32 i = 0; i < count; ++i)
+				nodes.insert(i * 2654435761u, i);
+
+			nodes.clear();
+
+			map.stop();
+		}
+
+		printf("list node %.1f ns, map node %.1f ns\n",
+				(double) list.getBestNs() / count,
+				(double) map.getBestNs() / count);
+	}
+}
+
+int main()
+{
+	printf("Mops/s of random allocate and free\n");
+
+	for (u32 threads = 1; threads <= 8; threads *= 2)
+	{
+		const double slab = measureStress(true, threads);
+		const double heap = measureStress(false, threads);
+
+		printf("%u threads: slab %6.1f malloc %6.1f\n", threads, slab, heap);
+	}
+
+	measureContainers();
+
+	return 0;
+}
@@ -0,0 +1,147 @@
+/*
+ * benchArray.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Time of growing 1M vertex array of vertex3dTangents, which is relocated
+// by realloc, against same vertex with own copy constructor, which is
+// relocated element by element, and time of inserts and erases at front of
+// u16 index array.
+
+#include "core/collections/array.h"
+#include "video/vertex/vertex3dTangents.h"
+
+#include "benchUtils.h"
+
+using namespace irrgame;
+
+namespace
+{
+	const u32 Vertices = 1000000;
+	const s32 Runs = 5;
+
+	//! Vertex which is not trivially copyable
+	class CCopiedVertex: public video::vertex3dTangents
+	{
+		public:
+
+			CCopiedVertex()
+			{
+			}
+
+			CCopiedVertex(const video::vertex3dTangents& other) :
+					video::vertex3dTangents(other)
+			{
+			}
+
+			CCopiedVertex(const CCopiedVertex& other) :
+					video::vertex3dTangents(other)
+			{
+			}
+
+			CCopiedVertex& operator=(const CCopiedVertex& other)
+			{
+				video::vertex3dTangents::operator=(other);
+				return *this;
+			}
+	};
+
+	template<class T>
+	void measureGrowth(const c8* name)
+	{
+		benchmarks::CBenchTimer timer;
+		video::vertex3dTangents vertex(1, 2, 3);
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			timer.start();
+
+			core::array<T> vertices;
+
+			for (u32 i = 0; i < Vertices; ++i)
+			{
+				vertex.Pos.X = (f32) i;
+				vertices.pushBack(T(vertex));
+			}
+
+			benchmarks::keep(vertices[Vertices / 2]);
+
+			timer.stop();
+		}
+
+		printf("%-36s %8.1f ms\n", name, timer.getBestNs() / 1e6);
+	}
+
+#if __cplusplus >= 201103L
+	void measureEmplace()
+	{
+		benchmarks::CBenchTimer timer;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			timer.start();
+
+			core::array<video::vertex3dTangents> vertices;
+
+			for (u32 i = 0; i < Vertices; ++i)
+				vertices.emplaceBack((f32) i, 2.f, 3.f);
+
+			benchmarks::keep(vertices[Vertices / 2]);
+
+			timer.stop();
+		}
+
+		printf("%-36s %8.1f ms\n", "vertex3dTangents emplaceBack",
+				timer.getBestNs() / 1e6);
+	}
+#endif
+
+	void measureIndices()
+	{
+		const u32 count = 20000;
+
+		benchmarks::CBenchTimer insert;
+		benchmarks::CBenchTimer erase;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			core::array<u16> indices;
+
+			insert.start();
+
+			for (u32 i = 0; i < count; ++i)
+				indices.insert((u16) i, 0);
+
+			insert.stop();
+
+			erase.start();
+
+			for (u32 i = 0; i < count; ++i)
+				indices.erase(0);
+
+			erase.stop();
+		}
+
+		printf("u16 indices, %u at front: insert %.1f ns erase %.1f ns\n",
+				count, (double) insert.getBestNs() / count,
+				(double) erase.getBestNs() / count);
+	}
+}
+
+int main()
+{
+	printf("grow %u vertices by pushBack\n", Vertices);
+
+	measureGrowth<video::vertex3dTangents>("vertex3dTangents");
+	measureGrowth<CCopiedVertex>("vertex with own copy constructor");
+
+#if __cplusplus >= 201103L
+	measureEmplace();
+#endif
+
+	measureIndices();
+
+	return 0;
+}
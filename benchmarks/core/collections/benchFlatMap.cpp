@@ -0,0 +1,187 @@
+/*
+ * benchFlatMap.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Nanoseconds per lookup of flatmap, core::map and hashmap with 16 to 262k
+// random integer keys, half of lookups miss, microseconds of building
+// flatmap by append against inserting into core::map, and lookups of 64
+// string keys as in enum literal tables.
+
+#include "core/collections/flatmap/flatmap.h"
+#include "core/collections/hashmap/hashmap.h"
+#include "core/collections/map/map.h"
+#include "core/collections/stringc.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+
+using namespace irrgame;
+
+namespace
+{
+	const u32 Lookups = 4000000;
+	const u32 QueryMask = 4095;
+	const s32 Runs = 3;
+
+	//! Returns nanoseconds per lookup of queries
+	template<class TMap>
+	double measureLookup(const TMap& map, const core::array<s32>& queries)
+	{
+		benchmarks::CBenchTimer timer;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			s64 sum = 0;
+
+			timer.start();
+
+			for (u32 i = 0; i < Lookups; ++i)
+			{
+				typename TMap::Node* node = map.find(queries[i & QueryMask]);
+				sum += node ? node->getValue() : 0;
+			}
+
+			timer.stop();
+
+			benchmarks::keep(sum);
+		}
+
+		return (double) timer.getBestNs() / Lookups;
+	}
+
+	void measureIntegers(u32 count)
+	{
+		tests::CTestRandom random;
+		core::array<s32> keys;
+		keys.reallocate(count);
+
+		core::flatmap<s32, s32> flat;
+		core::map<s32, s32> tree;
+		core::hashmap<s32, s32> hash;
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			const s32 key = random.next();
+
+			keys.pushBack(key);
+			flat.append(key, i);
+			tree.insert(key, i);
+			hash.insert(key, i);
+		}
+
+		flat.build();
+
+		core::array<s32> queries;
+
+		for (u32 i = 0; i <= QueryMask; ++i)
+			queries.pushBack(i & 1 ? keys[random.next(count)] : random.next());
+
+		const double flatFind = measureLookup(flat, queries);
+		const double treeFind = measureLookup(tree, queries);
+		const double hashFind = measureLookup(hash, queries);
+
+		benchmarks::CBenchTimer flatBuild;
+		benchmarks::CBenchTimer treeBuild;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			flatBuild.start();
+
+			{
+				core::flatmap<s32, s32> built;
+
+				for (u32 i = 0; i < count; ++i)
+					built.append(keys[i], i);
+
+				built.build();
+			}
+
+			flatBuild.stop();
+
+			treeBuild.start();
+
+			{
+				core::map<s32, s32> built;
+
+				for (u32 i = 0; i < count; ++i)
+					built.insert(keys[i], i);
+			}
+
+			treeBuild.stop();
+		}
+
+		printf("%6u keys: flatmap %6.1f map %6.1f hashmap %6.1f ns,"
+				" build flatmap %8.1f map %8.1f us\n", count, flatFind,
+				treeFind, hashFind, flatBuild.getBestNs() / 1e3,
+				treeBuild.getBestNs() / 1e3);
+	}
+
+	void measureStrings()
+	{
+		const u32 count = 64;
+
+		tests::CTestRandom random;
+		core::array<core::stringc> keys;
+
+		core::flatmap<core::stringc, s32> flat;
+		core::map<core::stringc, s32> tree;
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			core::stringc key("EnumLiteral_");
+			key += random.next(100000);
+
+			keys.pushBack(key);
+			flat.append(key, i);
+			tree.insert(key, i);
+		}
+
+		flat.build();
+
+		benchmarks::CBenchTimer flatFind;
+		benchmarks::CBenchTimer treeFind;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			u32 sum = 0;
+
+			flatFind.start();
+
+			for (u32 i = 0; i < Lookups; ++i)
+				sum += flat.find(keys[i % count]) ? 1 : 0;
+
+			flatFind.stop();
+
+			treeFind.start();
+
+			for (u32 i = 0; i < Lookups; ++i)
+				sum += tree.find(keys[i % count]) ? 1 : 0;
+
+			treeFind.stop();
+
+			benchmarks::keep(sum);
+		}
+
+		printf("%u string keys: flatmap %.1f map %.1f ns\n", count,
+				(double) flatFind.getBestNs() / Lookups,
+				(double) treeFind.getBestNs() / Lookups);
+	}
+}
+
+int main()
+{
+	const u32 counts[] =
+	{ 16, 128, 1024, 16384, 262144 };
+
+	printf("ns per lookup, half of lookups miss\n");
+
+	for (u32 i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+		measureIntegers(counts[i]);
+
+	measureStrings();
+
+	return 0;
+}
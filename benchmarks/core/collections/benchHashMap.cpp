@@ -0,0 +1,154 @@
+/*
+ * benchHashMap.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Nanoseconds per insert, successful find and missing find of hashmap and
+// core::map with 1k, 100k and 10M scrambled integer keys, and of hashmap
+// with string keys.
+
+#include "core/collections/hashmap/hashmap.h"
+#include "core/collections/map/map.h"
+#include "core/collections/stringc.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+
+using namespace irrgame;
+
+namespace
+{
+	//! Scrambles sequential numbers, so keys are not inserted in order
+	inline u32 getKey(u32 index)
+	{
+		return index * 2654435761u;
+	}
+
+	//! Returns runs count, which keeps time of big tables reasonable
+	s32 getRuns(u32 count)
+	{
+		return count > 1000000 ? 1 : 5;
+	}
+
+	template<class TMap>
+	void measure(const c8* name, u32 count)
+	{
+		benchmarks::CBenchTimer insert;
+		benchmarks::CBenchTimer find;
+		benchmarks::CBenchTimer missing;
+
+		for (s32 run = 0; run < getRuns(count); ++run)
+		{
+			TMap* map = new TMap();
+
+			insert.start();
+
+			for (u32 i = 0; i < count; ++i)
+				map->insert(getKey(i), i);
+
+			insert.stop();
+
+			u32 sum = 0;
+
+			find.start();
+
+			for (u32 i = 0; i < count; ++i)
+				sum += map->find(getKey(i))->getValue();
+
+			find.stop();
+
+			missing.start();
+
+			for (u32 i = count; i < count * 2; ++i)
+				sum += map->find(getKey(i)) ? 1 : 0;
+
+			missing.stop();
+
+			benchmarks::keep(sum);
+
+			delete map;
+		}
+
+		printf("%-8s %8u keys: insert %6.1f find %6.1f missing %6.1f\n", name,
+				count, (double) insert.getBestNs() / count,
+				(double) find.getBestNs() / count,
+				(double) missing.getBestNs() / count);
+	}
+
+	void measureStrings(u32 count)
+	{
+		core::array<core::stringc> keys;
+		keys.reallocate(count);
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			core::stringc key("node");
+			key += getKey(i);
+			keys.pushBack(key);
+		}
+
+		benchmarks::CBenchTimer insert;
+		benchmarks::CBenchTimer find;
+		benchmarks::CBenchTimer treeFind;
+
+		for (s32 run = 0; run < getRuns(count); ++run)
+		{
+			core::hashmap<core::stringc, u32> hash;
+			core::map<core::stringc, u32> tree;
+
+			insert.start();
+
+			for (u32 i = 0; i < count; ++i)
+				hash.insert(keys[i], i);
+
+			insert.stop();
+
+			for (u32 i = 0; i < count; ++i)
+				tree.insert(keys[i], i);
+
+			u32 sum = 0;
+
+			find.start();
+
+			for (u32 i = 0; i < count; ++i)
+				sum += hash.find(keys[i])->getValue();
+
+			find.stop();
+
+			treeFind.start();
+
+			for (u32 i = 0; i < count; ++i)
+				sum += tree.find(keys[i])->getValue();
+
+			treeFind.stop();
+
+			benchmarks::keep(sum);
+		}
+
+		printf("string   %8u keys: insert %6.1f find %6.1f, map find %6.1f\n",
+				count, (double) insert.getBestNs() / count,
+				(double) find.getBestNs() / count,
+				(double) treeFind.getBestNs() / count);
+	}
+}
+
+int main()
+{
+	const u32 counts[] =
+	{ 1000, 100000, 10000000 };
+
+	printf("ns per key\n");
+
+	for (u32 i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+	{
+		measure<core::hashmap<u32, u32> >("hashmap", counts[i]);
+		measure<core::map<u32, u32> >("map", counts[i]);
+	}
+
+	measureStrings(1000);
+	measureStrings(100000);
+
+	return 0;
+}
@@ -0,0 +1,184 @@
+/*
+ * benchInternedString.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Loads a scene of 20000 attribute sets with 16 named attributes twice from
+// memory and prints load time, new heap bytes per attribute, strings and
+// bytes of the intern pool, which must not grow on second load, and
+// nanoseconds per findAttribute by text and by interned handle. Second load
+// gets less heap, small blocks freed by first one are kept by slabs.
+
+#include "core/collections/InternedString.h"
+#include "core/collections/SharedStringPool.h"
+#include "core/collections/array.h"
+#include "io/serialize/IAttributes.h"
+#include "io/xml/IXMLReader.h"
+#include "io/IReadFile.h"
+
+#include "benchUtils.h"
+#include "benchAllocations.h"
+
+#include <string.h>
+
+using namespace irrgame;
+using namespace irrgame::io;
+
+namespace
+{
+	const u32 Sets = 20000;
+	const u32 AttributesPerSet = 16;
+	const s32 LookupRuns = 4;
+
+	const c8* const Names[AttributesPerSet] =
+	{ "Name", "Id", "Position", "Rotation", "Scale", "Visible", "Mesh",
+			"Material", "Speed", "Health", "Armor", "Team", "AutomaticCulling",
+			"DebugDataVisible", "IsDebugObject", "ReadOnlyMaterials" };
+
+	const c8* const Types[AttributesPerSet] =
+	{ "string", "int", "vector3d", "vector3d", "vector3d", "bool", "string",
+			"string", "float", "int", "float", "int", "string", "int",
+			"bool", "bool" };
+
+	const c8* const Values[AttributesPerSet] =
+	{ "node", "7", "1, 2, 3", "0, 90, 0", "1, 1, 1", "true", "mesh.obj",
+			"material", "1.5", "100", "0.25", "2", "box", "0", "false",
+			"false" };
+
+	void write(core::array<c8>& text, const c8* value)
+	{
+		for (const c8* c = value; *c; ++c)
+			text.pushBack(*c);
+	}
+
+	void createScene(core::array<c8>& text)
+	{
+		write(text, "<?xml version=\"1.0\"?>\n<scene>\n");
+
+		for (u32 i = 0; i < Sets; ++i)
+		{
+			write(text, "<attributes>\n");
+
+			for (u32 k = 0; k < AttributesPerSet; ++k)
+			{
+				write(text, "<");
+				write(text, Types[k]);
+				write(text, " name=\"");
+				write(text, Names[k]);
+				write(text, "\" value=\"");
+				write(text, Values[k]);
+				write(text, "\"/>\n");
+			}
+
+			write(text, "</attributes>\n");
+		}
+
+		write(text, "</scene>\n");
+	}
+
+	//! Reads all attribute sets of scene
+	u32 load(core::array<c8>& text, IAttributes** sets)
+	{
+		c8* memory = new c8[text.size()];
+		memcpy(memory, text.pointer(), text.size());
+
+		IReadFile* file = createMemoryReadFile(memory, text.size(),
+				"scene.xml", true);
+		IXMLReader* reader = createXMLReader(file);
+		file->drop();
+
+		u32 count = 0;
+
+		while (reader->read())
+		{
+			if (reader->getNodeType() == EXNT_ELEMENT
+					&& !strcmp(reader->getNodeName(), "attributes"))
+			{
+				sets[count] = createAttributes();
+				sets[count]->read(reader, true);
+				++count;
+			}
+		}
+
+		reader->drop();
+
+		return count;
+	}
+
+	//! Returns nanoseconds per lookup of all names in all sets
+	template<class TName>
+	double measureLookup(IAttributes** sets, u32 count, const TName* names)
+	{
+		benchmarks::CBenchTimer timer;
+
+		for (s32 run = 0; run < LookupRuns; ++run)
+		{
+			s32 sum = 0;
+
+			timer.start();
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				for (u32 k = 0; k < AttributesPerSet; ++k)
+					sum += sets[i]->findAttribute(names[k]);
+			}
+
+			timer.stop();
+
+			benchmarks::keep(sum);
+		}
+
+		return (double) timer.getBestNs() / (count * AttributesPerSet);
+	}
+}
+
+int main()
+{
+	core::array<c8> text;
+	createScene(text);
+
+	core::SharedStringPool& pool = core::SharedStringPool::getInstance();
+
+	core::InternedString handles[AttributesPerSet];
+
+	for (u32 k = 0; k < AttributesPerSet; ++k)
+		handles[k] = Names[k];
+
+	IAttributes** sets = new IAttributes*[Sets];
+
+	for (s32 pass = 0; pass < 2; ++pass)
+	{
+		const size_t heap = benchmarks::getAllocatedSize();
+		const u64 start = benchmarks::getTimeNs();
+
+		const u32 count = load(text, sets);
+
+		const double ms = (benchmarks::getTimeNs() - start) / 1e6;
+		const size_t used = benchmarks::getAllocatedSize() - heap;
+
+		printf("load %u: %u sets in %.1f ms", pass + 1, count, ms);
+
+#ifdef IRRGAME_COUNT_ALLOCATIONS
+		printf(", %.1f new heap bytes per attribute",
+				(double) used / (count * AttributesPerSet));
+#else
+		benchmarks::keep(used);
+#endif
+
+		printf(", pool %u strings %u bytes\n", pool.getStringsCount(),
+				(u32) pool.getUsedSize());
+
+		printf("findAttribute by text %.1f ns, by handle %.1f ns\n",
+				measureLookup(sets, count, Names),
+				measureLookup(sets, count, handles));
+
+		for (u32 i = 0; i < count; ++i)
+			sets[i]->drop();
+	}
+
+	delete[] sets;
+
+	return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * benchLeafNode.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Milliseconds per full traversal of a random tree of 100k leaf nodes by
+// recursion over getChildren, by traverse and by iterating an array filled
+// once by getSubtree, and share of nodes, which keep children inline.
+
+#include "core/collections/ILeafNode.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+
+using namespace irrgame;
+
+namespace
+{
+	const u32 Nodes = 100000;
+	const s32 Runs = 10;
+
+	class CNode: public core::ILeafNode<CNode>
+	{
+		public:
+
+			CNode(CNode* parent, u32 value) :
+					core::ILeafNode<CNode>(parent), Value(value)
+			{
+			}
+
+		public:
+
+			u32 Value;
+	};
+
+	//! Sums values of visited nodes
+	struct SSumVisitor
+	{
+		public:
+			u64 Sum;
+
+			bool operator()(CNode* node)
+			{
+				Sum += node->Value;
+				return true;
+			}
+	};
+
+	u64 sumRecursive(const CNode* node)
+	{
+		u64 result = node->Value;
+
+		const CNode::ChildrenArray& children = node->getChildren();
+
+		for (CNode::ChildrenArray::ConstIterator it = children.begin();
+				it != children.end(); ++it)
+			result += sumRecursive(*it);
+
+		return result;
+	}
+}
+
+int main()
+{
+	tests::CTestRandom random;
+
+	// parent of each node is one of nodes created before
+	core::array<CNode*> nodes;
+	nodes.reallocate(Nodes);
+	nodes.pushBack(new CNode(0, 0));
+
+	for (u32 i = 1; i < Nodes; ++i)
+	{
+		nodes.pushBack(new CNode(nodes[random.next(i)], i));
+		nodes.getLast()->drop();
+	}
+
+	u32 inlined = 0;
+
+	for (u32 i = 0; i < Nodes; ++i)
+	{
+		if (nodes[i]->getChildrenCount() <= IRR_LEAF_NODE_INLINE_CHILDREN)
+			++inlined;
+	}
+
+	CNode* root = nodes[0];
+
+	benchmarks::CBenchTimer recursive;
+	benchmarks::CBenchTimer traverse;
+	benchmarks::CBenchTimer flat;
+
+	core::array<CNode*> subtree;
+	root->getSubtree(subtree);
+
+	for (s32 run = 0; run < Runs; ++run)
+	{
+		recursive.start();
+		benchmarks::keep(sumRecursive(root));
+		recursive.stop();
+
+		SSumVisitor visitor;
+		visitor.Sum = 0;
+
+		traverse.start();
+		root->traverse(visitor);
+		traverse.stop();
+
+		benchmarks::keep(visitor.Sum);
+
+		u64 sum = 0;
+
+		flat.start();
+
+		for (u32 i = 0; i < subtree.size(); ++i)
+			sum += subtree[i]->Value;
+
+		flat.stop();
+
+		benchmarks::keep(sum);
+	}
+
+	printf("%u nodes, %.1f%% keep children inline\n", subtree.size(),
+			100.0 * inlined / Nodes);
+	printf("ms per traversal: recursive %.2f traverse %.2f flat %.2f\n",
+			recursive.getBestNs() / 1e6, traverse.getBestNs() / 1e6,
+			flat.getBestNs() / 1e6);
+
+	root->drop();
+
+	return 0;
+}
@@ -0,0 +1,201 @@
+/*
+ * benchLockPolicy.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Nanoseconds of pushBack and operator[] of array, list, map and stringc
+// with default threads::NullLock against threads::MonitorLock, which all
+// collections used before, and heap allocations made by construction of one
+// empty collection with each lock. Reads of list use first 16 nodes, because
+// its operator[] walks from head. Strings grow by 20k characters, because
+// every append reallocates.
+
+#include "core/irrgamecollections.h"
+#include "threads/lock/MonitorLock.h"
+
+#include "benchUtils.h"
+#include "benchAllocations.h"
+
+using namespace irrgame;
+
+namespace
+{
+	const u32 Count = 1000000;
+	const u32 MapCount = 100000;
+	const u32 StringCount = 20000;
+	const u32 Instances = 1000;
+	const s32 Runs = 10;
+
+	//! Pushes and reads elements of array
+	template<class TLock>
+	void runArray(benchmarks::CBenchTimer& push, benchmarks::CBenchTimer& read)
+	{
+		core::array<u32, TLock> values;
+
+		push.start();
+
+		for (u32 i = 0; i < Count; ++i)
+			values.pushBack(i);
+
+		push.stop();
+
+		u32 sum = 0;
+
+		read.start();
+
+		for (u32 i = 0; i < Count; ++i)
+			sum += values[i];
+
+		read.stop();
+
+		benchmarks::keep(sum);
+	}
+
+	//! Pushes elements of list, reads first nodes
+	template<class TLock>
+	void runList(benchmarks::CBenchTimer& push, benchmarks::CBenchTimer& read)
+	{
+		core::list<u32, TLock> values;
+
+		push.start();
+
+		for (u32 i = 0; i < Count; ++i)
+			values.pushBack(i);
+
+		push.stop();
+
+		u32 sum = 0;
+
+		read.start();
+
+		for (u32 i = 0; i < Count; ++i)
+			sum += values[i & 15];
+
+		read.stop();
+
+		benchmarks::keep(sum);
+	}
+
+	//! Inserts and reads nodes of map
+	template<class TLock>
+	void runMap(benchmarks::CBenchTimer& push, benchmarks::CBenchTimer& read)
+	{
+		core::map<u32, u32, TLock> values;
+
+		push.start();
+
+		for (u32 i = 0; i < MapCount; ++i)
+			values.insert(i * 2654435761u, i);
+
+		push.stop();
+
+		u32 sum = 0;
+
+		read.start();
+
+		for (u32 i = 0; i < MapCount; ++i)
+			sum += values[i * 2654435761u];
+
+		read.stop();
+
+		benchmarks::keep(sum);
+	}
+
+	//! Appends and reads characters of string
+	template<class TLock>
+	void runString(benchmarks::CBenchTimer& push, benchmarks::CBenchTimer& read)
+	{
+		core::string<TLock> text;
+
+		push.start();
+
+		for (u32 i = 0; i < StringCount; ++i)
+			text.append((c8) ('a' + (i & 15)));
+
+		push.stop();
+
+		u32 sum = 0;
+
+		read.start();
+
+		for (u32 i = 0; i < StringCount; ++i)
+			sum += text[i];
+
+		read.stop();
+
+		benchmarks::keep(sum);
+	}
+
+	//! Returns heap allocations per constructed empty collection
+	template<class T>
+	double measureConstruction()
+	{
+		const u32 before = benchmarks::getAllocationCount();
+
+		for (u32 i = 0; i < Instances; ++i)
+		{
+			T collection;
+			benchmarks::keep(collection);
+		}
+
+		return (double) (benchmarks::getAllocationCount() - before) / Instances;
+	}
+
+	typedef void (*TRun)(benchmarks::CBenchTimer& push,
+			benchmarks::CBenchTimer& read);
+
+	//! Prints best times per operation and allocations per collection.
+	//! Runs of both locks alternate, so they find heap in same state.
+	void measure(const c8* name, TRun null, TRun monitor, u32 count,
+			double nullAllocations, double monitorAllocations)
+	{
+		benchmarks::CBenchTimer nullPush;
+		benchmarks::CBenchTimer nullRead;
+		benchmarks::CBenchTimer monitorPush;
+		benchmarks::CBenchTimer monitorRead;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			null(nullPush, nullRead);
+			monitor(monitorPush, monitorRead);
+		}
+
+		printf("%-8s %9.1f %9.1f %9.1f %9.1f %9.2f %9.2f\n", name,
+				(double) nullPush.getBestNs() / count,
+				(double) monitorPush.getBestNs() / count,
+				(double) nullRead.getBestNs() / count,
+				(double) monitorRead.getBestNs() / count, nullAllocations,
+				monitorAllocations);
+	}
+
+	typedef core::map<u32, u32, threads::NullLock> null_map;
+	typedef core::map<u32, u32, threads::MonitorLock> monitor_map;
+}
+
+int main()
+{
+	printf("%-8s %9s %9s %9s %9s %9s %9s\n", "", "push", "push", "[]", "[]",
+			"allocs", "allocs");
+	printf("%-8s %9s %9s %9s %9s %9s %9s\n", "ns", "null", "monitor", "null",
+			"monitor", "null", "monitor");
+
+	measure("array", runArray<threads::NullLock>,
+			runArray<threads::MonitorLock>, Count,
+			measureConstruction<core::array<u32, threads::NullLock> >(),
+			measureConstruction<core::array<u32, threads::MonitorLock> >());
+	measure("list", runList<threads::NullLock>,
+			runList<threads::MonitorLock>, Count,
+			measureConstruction<core::list<u32, threads::NullLock> >(),
+			measureConstruction<core::list<u32, threads::MonitorLock> >());
+	measure("map", runMap<threads::NullLock>, runMap<threads::MonitorLock>,
+			MapCount, measureConstruction<null_map>(),
+			measureConstruction<monitor_map>());
+	measure("stringc", runString<threads::NullLock>,
+			runString<threads::MonitorLock>, StringCount,
+			measureConstruction<core::stringc>(),
+			measureConstruction<core::stringcSync>());
+
+	return 0;
+}
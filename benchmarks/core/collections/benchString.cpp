@@ -0,0 +1,257 @@
+/*
+ * benchString.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Heap allocations and time of stringc in typical workloads: short names,
+// which are stored inline, long file names, filling of attributes and
+// reading of attributes from XML scene description.
+
+#include "core/collections/stringc.h"
+#include "core/collections/array.h"
+#include "io/serialize/IAttributes.h"
+#include "io/xml/IXMLReader.h"
+#include "io/IReadFile.h"
+
+#include "benchUtils.h"
+#include "benchAllocations.h"
+
+#include <string.h>
+
+using namespace irrgame;
+
+namespace
+{
+	const u32 Count = 100000;
+	const s32 Runs = 5;
+
+	const c8* const Names[] =
+	{ "Name", "Id", "Position", "Rotation", "Scale", "Visible", "Mesh",
+			"Material", "Speed", "Health", "Team", "AutomaticCulling" };
+
+	const c8* const Types[] =
+	{ "string", "int", "vector3d", "vector3d", "vector3d", "bool", "string",
+			"string", "float", "int", "int", "enum" };
+
+	const c8* const Values[] =
+	{ "node", "7", "1.5, 2, -3", "0, 90, 0", "1, 1, 1", "true",
+			"media/models/characters/soldier.b3d", "bark", "1.25", "100", "2",
+			"box" };
+
+	const u32 AttributeCount = sizeof(Names) / sizeof(Names[0]);
+
+	//! Measures workload, prints time and allocations per item
+	class CMeasure
+	{
+		public:
+
+			CMeasure() :
+					Allocations(0)
+			{
+			}
+
+			void start()
+			{
+				Before = benchmarks::getAllocationCount();
+				Timer.start();
+			}
+
+			void stop()
+			{
+				Timer.stop();
+				Allocations = benchmarks::getAllocationCount() - Before;
+			}
+
+			void print(const c8* name, u32 items) const
+			{
+				printf("%-32s %8.1f ns %8.2f allocations\n", name,
+						(double) Timer.getBestNs() / items,
+						(double) Allocations / items);
+			}
+
+		private:
+
+			benchmarks::CBenchTimer Timer;
+			u32 Before;
+			u32 Allocations;
+	};
+
+	//! Creates, copies and destroys strings
+	void measureStrings(const c8* name, const c8* text)
+	{
+		CMeasure measure;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			u32 sum = 0;
+
+			measure.start();
+
+			for (u32 i = 0; i < Count; ++i)
+			{
+				core::stringc value(text);
+				core::stringc copy(value);
+				sum += copy.size();
+			}
+
+			measure.stop();
+
+			benchmarks::keep(sum);
+		}
+
+		measure.print(name, Count);
+	}
+
+	//! Fills array, which moves strings on growth
+	void measureArray(const c8* name, const c8* text)
+	{
+		CMeasure measure;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			core::array<core::stringc> values;
+			const core::stringc value(text);
+
+			measure.start();
+
+			for (u32 i = 0; i < Count; ++i)
+				values.pushBack(value);
+
+			measure.stop();
+
+			benchmarks::keep(values.size());
+		}
+
+		measure.print(name, Count);
+	}
+
+	void measureAttributes()
+	{
+		const u32 objects = Count / AttributeCount;
+
+		CMeasure measure;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			u32 sum = 0;
+
+			measure.start();
+
+			for (u32 i = 0; i < objects; ++i)
+			{
+				io::IAttributes* attributes = io::createAttributes();
+
+				for (u32 k = 0; k < AttributeCount; ++k)
+					attributes->addString(Names[k], Values[k]);
+
+				for (u32 k = 0; k < AttributeCount; ++k)
+					sum += attributes->getAttributeAsString(Names[k]).size();
+
+				attributes->drop();
+			}
+
+			measure.stop();
+
+			benchmarks::keep(sum);
+		}
+
+		measure.print("attributes add and get", objects * AttributeCount);
+	}
+
+	void write(core::array<c8>& text, const c8* value)
+	{
+		while (*value)
+			text.pushBack(*value++);
+	}
+
+	void measureXML()
+	{
+		const u32 objects = Count / AttributeCount;
+
+		core::array<c8> text;
+		write(text, "<?xml version=\"1.0\"?>\n<scene>\n");
+
+		for (u32 i = 0; i < objects; ++i)
+		{
+			write(text, "<attributes>\n");
+
+			for (u32 k = 0; k < AttributeCount; ++k)
+			{
+				write(text, "\t<");
+				write(text, Types[k]);
+				write(text, " name=\"");
+				write(text, Names[k]);
+				write(text, "\" value=\"");
+				write(text, Values[k]);
+				write(text, "\"/>\n");
+			}
+
+			write(text, "</attributes>\n");
+		}
+
+		write(text, "</scene>\n");
+
+		core::array<io::IAttributes*> attributes;
+		attributes.reallocate(objects);
+
+		CMeasure measure;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			c8* memory = new c8[text.size()];
+			memcpy(memory, text.pointer(), text.size());
+
+			io::IReadFile* file = io::createMemoryReadFile(memory, text.size(),
+					"scene.xml", true);
+
+			measure.start();
+
+			io::IXMLReader* reader = io::createXMLReader(file);
+
+			while (reader->read())
+			{
+				if (reader->getNodeType() == io::EXNT_ELEMENT
+						&& !strcmp(reader->getNodeName(), "attributes"))
+				{
+					io::IAttributes* object = io::createAttributes();
+					object->read(reader, true);
+					attributes.pushBack(object);
+				}
+			}
+
+			reader->drop();
+
+			measure.stop();
+
+			file->drop();
+
+			for (u32 i = 0; i < attributes.size(); ++i)
+				attributes[i]->drop();
+
+			attributes.clear();
+		}
+
+		measure.print("attributes read from XML", objects * AttributeCount);
+	}
+}
+
+int main()
+{
+#ifndef IRRGAME_COUNT_ALLOCATIONS
+	printf("allocations are counted with glibc only\n");
+#endif
+
+	printf("per string or attribute\n");
+
+	measureStrings("short string, copy", "Position");
+	measureStrings("long string, copy", "media/models/soldier.b3d");
+	measureArray("short string, array growth", "Position");
+	measureArray("long string, array growth", "media/models/soldier.b3d");
+
+	measureAttributes();
+	measureXML();
+
+	return 0;
+}
@@ -0,0 +1,131 @@
+/*
+ * benchReferenceCounted.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Throughput of grab and drop pairs on one object in one thread and in 8
+// threads, and cost of deletion by drop against dropDeferred.
+
+#include "core/engine/IReferenceCounted.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+
+using namespace irrgame;
+
+namespace
+{
+	const s32 Iterations = 2000000;
+	const s32 Objects = 100000;
+	const s32 Runs = 5;
+
+	//! Object without own data
+	class CCounted: public IReferenceCounted
+	{
+	};
+
+	//! Grabs and drops shared object
+	class CGrabber
+	{
+		public:
+
+			CGrabber(const IReferenceCounted* object) :
+					Object(object)
+			{
+			}
+
+			s32 run(void*)
+			{
+				for (s32 i = 0; i < Iterations; ++i)
+				{
+					Object->grab();
+					Object->drop();
+				}
+
+				return 0;
+			}
+
+		private:
+
+			const IReferenceCounted* Object;
+	};
+
+	//! Prints millions of grab and drop pairs per second in count threads
+	void measureThreads(u32 count)
+	{
+		CCounted* object = new CCounted();
+		CGrabber grabber(object);
+
+		threads::delegateThreadCallback callback;
+		callback += NewDelegate(&grabber, &CGrabber::run);
+
+		benchmarks::CBenchTimer timer;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			timer.start();
+
+			if (count == 1)
+				grabber.run(0);
+			else
+				tests::runThreads(&callback, count);
+
+			timer.stop();
+		}
+
+		printf("grab/drop, %u threads: %8.1f M pairs/s\n", count,
+				(double) Iterations * count * 1000.0 / timer.getBestNs());
+
+		object->drop();
+	}
+
+	//! Prints nanoseconds per deleted object
+	void measureRelease()
+	{
+		core::array<CCounted*> objects;
+		objects.setUsed(Objects);
+
+		benchmarks::CBenchTimer drop;
+		benchmarks::CBenchTimer deferred;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			for (s32 i = 0; i < Objects; ++i)
+				objects[i] = new CCounted();
+
+			drop.start();
+
+			for (s32 i = 0; i < Objects; ++i)
+				objects[i]->drop();
+
+			drop.stop();
+
+			for (s32 i = 0; i < Objects; ++i)
+				objects[i] = new CCounted();
+
+			deferred.start();
+
+			for (s32 i = 0; i < Objects; ++i)
+				objects[i]->dropDeferred();
+
+			benchmarks::keep(IReferenceCounted::flushDeferredDrops());
+
+			deferred.stop();
+		}
+
+		printf("release, ns per object: drop %6.2f dropDeferred %6.2f\n",
+				(double) drop.getBestNs() / Objects,
+				(double) deferred.getBestNs() / Objects);
+	}
+}
+
+int main()
+{
+	measureThreads(1);
+	measureThreads(8);
+	measureRelease();
+
+	return 0;
+}
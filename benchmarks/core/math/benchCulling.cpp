@@ -0,0 +1,154 @@
+/*
+ * benchCulling.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Nanoseconds per box of SharedCulling against loops over aabbox3d.
+
+#include "core/math/SharedCulling.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+
+using namespace irrgame;
+using namespace irrgame::core;
+
+namespace
+{
+	const s32 Runs = 20;
+
+	//! Returns true if box overlaps other one on every axis
+	bool overlaps(const aabbox3df& box, const aabbox3df& other)
+	{
+		return other.MinEdge.X <= box.MaxEdge.X
+				&& other.MinEdge.Y <= box.MaxEdge.Y
+				&& other.MinEdge.Z <= box.MaxEdge.Z
+				&& other.MaxEdge.X >= box.MinEdge.X
+				&& other.MaxEdge.Y >= box.MinEdge.Y
+				&& other.MaxEdge.Z >= box.MinEdge.Z;
+	}
+
+	void measure(u32 count)
+	{
+		SharedCulling& culling = SharedCulling::getInstance();
+		tests::CTestRandom random;
+
+		aabbox3darray boxes;
+		array<aabbox3df> plain;
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			const vector3df center(random.nextFloat(-100, 100),
+					random.nextFloat(-100, 100), random.nextFloat(-100, 100));
+			const vector3df extent(random.nextFloat(0, 7),
+					random.nextFloat(0, 7), random.nextFloat(0, 7));
+
+			const aabbox3df box(center - extent, center + extent);
+
+			boxes.pushBack(box);
+			plain.pushBack(box);
+		}
+
+		plane3df planes[6];
+
+		for (u32 i = 0; i < 6; ++i)
+		{
+			vector3df normal(random.nextFloat(-1, 1), random.nextFloat(-1, 1),
+					random.nextFloat(-1, 1));
+			normal.normalize();
+
+			planes[i].Normal = normal;
+			planes[i].D = -random.nextFloat(20, 60);
+		}
+
+		const aabbox3df region(vector3df(-30, -30, -30),
+				vector3df(30, 30, 30));
+
+		array<u32> mask;
+		mask.setUsed(culling.getMaskSize(count));
+
+		array<u8> visible;
+		visible.setUsed(count);
+
+		benchmarks::CBenchTimer loopFrustum;
+		benchmarks::CBenchTimer serialFrustum;
+		benchmarks::CBenchTimer parallelFrustum;
+		benchmarks::CBenchTimer loopBox;
+		benchmarks::CBenchTimer serialBox;
+		benchmarks::CBenchTimer parallelBox;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			loopFrustum.start();
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				bool inside = true;
+
+				for (u32 k = 0; k < 6 && inside; ++k)
+					inside = plain[i].classifyPlaneRelation(planes[k])
+							!= ISREL3D_FRONT;
+
+				visible[i] = inside;
+			}
+
+			loopFrustum.stop();
+			benchmarks::keep(visible[count / 2]);
+
+			loopBox.start();
+
+			for (u32 i = 0; i < count; ++i)
+				visible[i] = overlaps(region, plain[i]);
+
+			loopBox.stop();
+			benchmarks::keep(visible[count / 2]);
+
+			culling.setParallelThreshold(0xFFFFFFFF);
+
+			serialFrustum.start();
+			culling.cullFrustum(boxes, planes, 6, mask.pointer());
+			serialFrustum.stop();
+
+			serialBox.start();
+			culling.cullBox(boxes, region, mask.pointer());
+			serialBox.stop();
+
+			culling.setParallelThreshold(0);
+
+			parallelFrustum.start();
+			culling.cullFrustum(boxes, planes, 6, mask.pointer());
+			parallelFrustum.stop();
+
+			parallelBox.start();
+			culling.cullBox(boxes, region, mask.pointer());
+			parallelBox.stop();
+
+			benchmarks::keep(mask[0]);
+		}
+
+		culling.setParallelThreshold(IRR_PARALLEL_CULLING_THRESHOLD);
+
+		printf("%7u boxes, frustum: loop %6.2f serial %6.2f parallel %6.2f\n",
+				count, (double) loopFrustum.getBestNs() / count,
+				(double) serialFrustum.getBestNs() / count,
+				(double) parallelFrustum.getBestNs() / count);
+
+		printf("%7u boxes, box:     loop %6.2f serial %6.2f parallel %6.2f\n",
+				count, (double) loopBox.getBestNs() / count,
+				(double) serialBox.getBestNs() / count,
+				(double) parallelBox.getBestNs() / count);
+	}
+}
+
+int main()
+{
+	printf("ns per box\n");
+
+	measure(8192);
+	measure(100000);
+	measure(1000000);
+
+	return 0;
+}
@@ -0,0 +1,200 @@
+/*
+ * benchMatrix4.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Nanoseconds per multiplication of general and affine matrix4<f32> by a
+// scalar loop in order of the scalar code and by SSE2 and AVX kernels, per
+// inverse of general and affine matrices by the kernels, and per camera
+// update, which builds view and projection and multiplies them.
+
+#include "core/math/matrix4.h"
+#include "core/math/SMatrix4SIMD.h"
+#include "core/utils/SharedCPUFeatures.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+
+using namespace irrgame;
+using namespace irrgame::core;
+
+namespace
+{
+	const u32 Matrices = 1024;
+	const s32 Runs = 200;
+
+	enum EOperation
+	{
+		EO_MULTIPLY = 0,
+		EO_INVERSE
+	};
+
+	//! Product in order of scalar code
+	void multiplyScalar(const f32* a, const f32* b, f32* out)
+	{
+		f32 result[16];
+
+		for (u32 column = 0; column < 4; ++column)
+		{
+			for (u32 row = 0; row < 4; ++row)
+			{
+				result[column * 4 + row] = a[row] * b[column * 4]
+						+ a[4 + row] * b[column * 4 + 1]
+						+ a[8 + row] * b[column * 4 + 2]
+						+ a[12 + row] * b[column * 4 + 3];
+			}
+		}
+
+		for (u32 i = 0; i < 16; ++i)
+			out[i] = result[i];
+	}
+
+	void fill(core::array<matrix4f>& matrices, bool affine,
+			tests::CTestRandom& random)
+	{
+		for (u32 i = 0; i < Matrices; ++i)
+		{
+			matrix4f m(EM4CONST_NOTHING);
+
+			for (u32 k = 0; k < 16; ++k)
+				m[k] = random.nextFloat(-3.f, 3.f);
+
+			if (affine)
+			{
+				m[3] = m[7] = m[11] = 0.f;
+				m[15] = 1.f;
+			}
+
+			matrices.pushBack(m);
+		}
+	}
+
+	//! Returns nanoseconds per operation. Kernels 0 is scalar loop.
+	double measure(const SMatrix4SIMD* kernels, EOperation operation,
+			core::array<matrix4f>& a, core::array<matrix4f>& b)
+	{
+		core::array<matrix4f> out(a);
+
+		benchmarks::CBenchTimer timer;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			timer.start();
+
+			for (u32 i = 0; i < Matrices; ++i)
+			{
+				if (operation == EO_INVERSE)
+					kernels->Inverse(a[i].pointer(), out[i].pointer());
+				else if (kernels)
+					kernels->Multiply(a[i].pointer(), b[i].pointer(),
+							out[i].pointer());
+				else
+					multiplyScalar(a[i].pointer(), b[i].pointer(),
+							out[i].pointer());
+			}
+
+			timer.stop();
+
+			benchmarks::keep(out[run % Matrices][0]);
+		}
+
+		return (double) timer.getBestNs() / Matrices;
+	}
+
+	void measureOperation(const c8* name, EOperation operation,
+			core::array<matrix4f>& a, core::array<matrix4f>& b)
+	{
+		const SharedCPUFeatures& cpu = SharedCPUFeatures::getInstance();
+		const SMatrix4SIMD* sse2 = getMatrix4SSE2();
+		const SMatrix4SIMD* avx = getMatrix4AVX();
+
+		printf("%-20s", name);
+
+		if (operation == EO_MULTIPLY)
+			printf(" %8.2f", measure(0, operation, a, b));
+		else
+			printf(" %8s", "-");
+
+		if (cpu.hasSSE2() && sse2)
+			printf(" %8.2f", measure(sse2, operation, a, b));
+		else
+			printf(" %8s", "-");
+
+		if (cpu.hasAVX() && avx)
+			printf(" %8.2f", measure(avx, operation, a, b));
+		else
+			printf(" %8s", "-");
+
+		printf("\n");
+	}
+
+	//! Builds camera matrices as scene manager does every frame
+	void measureCamera(tests::CTestRandom& random)
+	{
+		core::array<vector3df> positions;
+
+		for (u32 i = 0; i < Matrices; ++i)
+		{
+			positions.pushBack(vector3df(random.nextFloat(-50.f, 50.f),
+					random.nextFloat(-50.f, 50.f),
+					random.nextFloat(-50.f, 50.f)));
+		}
+
+		benchmarks::CBenchTimer timer;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			f32 sum = 0.f;
+
+			timer.start();
+
+			for (u32 i = 0; i < Matrices; ++i)
+			{
+				matrix4f view;
+				view.buildCameraLookAtMatrixLH(positions[i],
+						vector3df(0.f, 0.f, 0.f), vector3df(0.f, 1.f, 0.f));
+
+				matrix4f projection;
+				projection.buildProjectionMatrixPerspectiveFovLH(1.f, 1.33f,
+						0.1f, 1000.f);
+
+				sum += (projection * view)[0];
+			}
+
+			timer.stop();
+
+			benchmarks::keep(sum);
+		}
+
+		printf("camera view and projection %.2f ns\n",
+				(double) timer.getBestNs() / Matrices);
+	}
+}
+
+int main()
+{
+	tests::CTestRandom random;
+
+	core::array<matrix4f> general;
+	core::array<matrix4f> otherGeneral;
+	core::array<matrix4f> affine;
+	core::array<matrix4f> otherAffine;
+
+	fill(general, false, random);
+	fill(otherGeneral, false, random);
+	fill(affine, true, random);
+	fill(otherAffine, true, random);
+
+	printf("%-20s   scalar     SSE2      AVX\n", "ns per matrix");
+
+	measureOperation("multiply general", EO_MULTIPLY, general, otherGeneral);
+	measureOperation("multiply affine", EO_MULTIPLY, affine, otherAffine);
+	measureOperation("inverse general", EO_INVERSE, general, otherGeneral);
+	measureOperation("inverse affine", EO_INVERSE, affine, otherAffine);
+
+	measureCamera(random);
+
+	return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * benchMatrixTransform.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Millions of vectors per second transformed by a scalar loop over
+// transformVect, rotateVect and normalize, and by SSE2 and AVX batch
+// kernels, for positions and normals of 8192 vertex3d and vertex3dTangents
+// and for dense vector3df arrays.
+
+#include "core/math/matrix4.h"
+#include "core/math/SMatrix4SIMD.h"
+#include "core/utils/SharedCPUFeatures.h"
+#include "core/collections/array.h"
+#include "video/vertex/vertex3dTangents.h"
+
+#include "benchUtils.h"
+
+using namespace irrgame;
+using namespace irrgame::core;
+
+namespace
+{
+	const u32 Vectors = 8192;
+	const s32 Runs = 200;
+
+	enum ETransform
+	{
+		ET_TRANSFORM = 0,
+		ET_NORMAL
+	};
+
+	//! Applies transform to every vector by the scalar methods
+	void applyScalar(ETransform transform, const matrix4f& m, vector3df* data,
+			u32 stride)
+	{
+		c8* bytes = reinterpret_cast<c8*>(data);
+
+		for (u32 i = 0; i < Vectors; ++i)
+		{
+			vector3df& value = *reinterpret_cast<vector3df*>(bytes
+					+ i * stride);
+			vector3df result;
+
+			if (transform == ET_TRANSFORM)
+			{
+				m.transformVect(result, value);
+			}
+			else
+			{
+				m.rotateVect(result, value);
+				result.normalize();
+			}
+
+			value = result;
+		}
+	}
+
+	//! Returns millions of vectors per second. Kernels 0 is scalar loop.
+	double measure(const SMatrix4SIMD* kernels, ETransform transform,
+			vector3df* data, u32 stride)
+	{
+		// close to identity, so repeated transforms keep values finite
+		matrix4f m;
+		m.setRotationDegrees(vector3df(0.01f, 0.02f, 0.03f));
+		m.setTranslation(vector3df(0.f, 0.f, 0.f));
+
+		benchmarks::CBenchTimer timer;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			timer.start();
+
+			if (!kernels)
+				applyScalar(transform, m, data, stride);
+			else if (transform == ET_TRANSFORM)
+				kernels->TransformVectArray(m.pointer(), &data->X, &data->X,
+						Vectors, stride);
+			else
+				kernels->RotateNormalizeVectArray(m.pointer(), &data->X,
+						&data->X, Vectors, stride);
+
+			timer.stop();
+		}
+
+		benchmarks::keep(data->X);
+
+		return Vectors / (timer.getBestNs() / 1e3);
+	}
+
+	void measureLayout(const c8* name, ETransform transform, vector3df* data,
+			u32 stride)
+	{
+		const SharedCPUFeatures& cpu = SharedCPUFeatures::getInstance();
+		const SMatrix4SIMD* sse2 = getMatrix4SSE2();
+		const SMatrix4SIMD* avx = getMatrix4AVX();
+
+		printf("%-26s %8.1f", name, measure(0, transform, data, stride));
+
+		if (cpu.hasSSE2() && sse2)
+			printf(" %8.1f", measure(sse2, transform, data, stride));
+		else
+			printf(" %8s", "-");
+
+		if (cpu.hasAVX() && avx)
+			printf(" %8.1f", measure(avx, transform, data, stride));
+		else
+			printf(" %8s", "-");
+
+		printf("\n");
+	}
+
+	template<class TVertex>
+	void measureVertices(const c8* positions, const c8* normals)
+	{
+		tests::CTestRandom random;
+		core::array<TVertex> vertices;
+
+		for (u32 i = 0; i < Vectors; ++i)
+		{
+			TVertex vertex;
+			vertex.Pos.set(random.nextFloat(-10.f, 10.f),
+					random.nextFloat(-10.f, 10.f),
+					random.nextFloat(-10.f, 10.f));
+			vertex.Normal = vertex.Pos;
+
+			vertices.pushBack(vertex);
+		}
+
+		measureLayout(positions, ET_TRANSFORM, &vertices[0].Pos,
+				sizeof(TVertex));
+		measureLayout(normals, ET_NORMAL, &vertices[0].Normal, sizeof(TVertex));
+	}
+}
+
+int main()
+{
+	printf("%-26s   scalar     SSE2      AVX\n", "Mvectors/s");
+
+	measureVertices<video::vertex3d>("vertex3d positions",
+			"vertex3d normals");
+	measureVertices<video::vertex3dTangents>("vertex3dTangents positions",
+			"vertex3dTangents normals");
+
+	core::array<vector3df> dense;
+
+	for (u32 i = 0; i < Vectors; ++i)
+		dense.pushBack(vector3df(1.f, 2.f, 3.f));
+
+	measureLayout("dense positions", ET_TRANSFORM, dense.pointer(),
+			sizeof(vector3df));
+	measureLayout("dense normals", ET_NORMAL, dense.pointer(),
+			sizeof(vector3df));
+
+	return 0;
+}
@@ -0,0 +1,152 @@
+/*
+ * benchSort.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Milliseconds of sorting s32 arrays of 1k, 100k, 1M and 10M elements with
+// random, sorted and reverse sorted input by heapsort, which array used
+// before, introsort, radix sort and parallel merge sort, and of sorting
+// 200k strings by heapsort and introsort.
+
+#include "core/collections/array.h"
+#include "core/collections/stringc.h"
+#include "core/math/SharedHeapsort.h"
+#include "core/math/SharedIntrosort.h"
+#include "core/math/SharedMergesort.h"
+#include "core/math/SharedRadixsort.h"
+
+#include "benchUtils.h"
+
+using namespace irrgame;
+
+namespace
+{
+	enum ESortAlgorithm
+	{
+		ESA_HEAP = 0,
+		ESA_INTRO,
+		ESA_RADIX,
+		ESA_MERGE,
+		ESA_COUNT
+	};
+
+	//! Returns runs count, which keeps time of big arrays reasonable
+	s32 getRuns(u32 size)
+	{
+		if (size <= 1000)
+			return 200;
+
+		if (size <= 100000)
+			return 10;
+
+		return size <= 1000000 ? 3 : 1;
+	}
+
+	template<class T>
+	void sort(ESortAlgorithm algorithm, T* values, u32 size)
+	{
+		switch (algorithm)
+		{
+			case ESA_HEAP:
+				core::SharedHeapsort<T>::getInstance().sort(values, size);
+				break;
+			case ESA_INTRO:
+				core::SharedIntrosort<T>::getInstance().sort(values, size);
+				break;
+			case ESA_RADIX:
+				// types without radix key are not sorted
+				core::radixSortSelector<T>::sort(values, size);
+				break;
+			default:
+				core::SharedMergesort<T>::getInstance().sort(values, size);
+				break;
+		}
+	}
+
+	//! Returns best time of sorting copies of input in milliseconds
+	template<class T>
+	double measure(ESortAlgorithm algorithm, const core::array<T>& input,
+			s32 runs)
+	{
+		benchmarks::CBenchTimer timer;
+
+		for (s32 run = 0; run < runs; ++run)
+		{
+			core::array<T> values(input);
+
+			timer.start();
+			sort(algorithm, values.pointer(), values.size());
+			timer.stop();
+
+			benchmarks::keep(values[0]);
+		}
+
+		return timer.getBestNs() / 1e6;
+	}
+
+	void measureIntegers(u32 size)
+	{
+		const c8* const patterns[] =
+		{ "random", "sorted", "reverse" };
+
+		tests::CTestRandom random;
+
+		for (u32 pattern = 0; pattern < 3; ++pattern)
+		{
+			core::array<s32> input;
+			input.reallocate(size);
+
+			for (u32 i = 0; i < size; ++i)
+			{
+				input.pushBack(pattern == 0 ? (s32) random.next()
+						: pattern == 1 ? (s32) i : (s32) (size - i));
+			}
+
+			printf("%8u %-8s", size, patterns[pattern]);
+
+			for (u32 algorithm = 0; algorithm < ESA_COUNT; ++algorithm)
+			{
+				printf(" %9.3f", measure((ESortAlgorithm) algorithm, input,
+						getRuns(size)));
+			}
+
+			printf("\n");
+		}
+	}
+
+	void measureStrings()
+	{
+		const u32 size = 200000;
+
+		tests::CTestRandom random;
+		core::array<core::stringc> input;
+
+		for (u32 i = 0; i < size; ++i)
+		{
+			core::stringc value("file_");
+			value += random.next();
+			input.pushBack(value);
+		}
+
+		printf("%u strings: heap %.1f intro %.1f merge %.1f\n", size,
+				measure(ESA_HEAP, input, 3), measure(ESA_INTRO, input, 3),
+				measure(ESA_MERGE, input, 3));
+	}
+}
+
+int main()
+{
+	const u32 sizes[] =
+	{ 1000, 100000, 1000000, 10000000 };
+
+	printf("ms      size input         heap     intro     radix     merge\n");
+
+	for (u32 i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+		measureIntegers(sizes[i]);
+
+	measureStrings();
+
+	return 0;
+}
@@ -0,0 +1,214 @@
+/*
+ * benchTriangleBVH.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Milliseconds of serial and parallel build of TriangleBVH over 1M
+// triangles of terrain and random clutter, and nanoseconds of nearest ray
+// hit, line of sight, triangles in box and closest point queries against
+// microseconds of ray test over all triangles.
+
+#include "core/shapes/TriangleBVH.h"
+#include "threads/SharedJobPool.h"
+
+#include "benchUtils.h"
+
+#include <math.h>
+
+using namespace irrgame;
+using namespace irrgame::core;
+
+namespace
+{
+	const u32 Triangles = 1000000;
+	const u32 Queries = 100000;
+	const s32 Runs = 3;
+
+	vector3df createPoint(f32 range, tests::CTestRandom& random)
+	{
+		return vector3df(random.nextFloat(-range, range),
+				random.nextFloat(-range, range),
+				random.nextFloat(-range, range));
+	}
+
+	//! Terrain of half of triangles and random small triangles above it
+	void createScene(array<triangle3df>& triangles,
+			tests::CTestRandom& random)
+	{
+		const u32 grid = (u32) sqrt(Triangles / 4.);
+		const f32 cell = 1000.f / grid;
+
+		triangles.reallocate(Triangles);
+
+		for (u32 i = 0; i < grid; ++i)
+		{
+			for (u32 j = 0; j < grid; ++j)
+			{
+				const f32 x = i * cell - 500.f;
+				const f32 z = j * cell - 500.f;
+
+				const vector3df a(x, 10.f * sinf(x * .02f), z);
+				const vector3df b(x + cell, 10.f * sinf((x + cell) * .02f), z);
+				const vector3df c(x, a.Y, z + cell);
+				const vector3df d(x + cell, b.Y, z + cell);
+
+				triangles.pushBack(triangle3df(a, b, d));
+				triangles.pushBack(triangle3df(a, d, c));
+			}
+		}
+
+		while (triangles.size() < Triangles)
+		{
+			const vector3df center = createPoint(500.f, random);
+
+			triangles.pushBack(triangle3df(center + createPoint(1.f, random),
+					center + createPoint(1.f, random),
+					center + createPoint(1.f, random)));
+		}
+	}
+
+	double measureBuild(TriangleBVH& tree, array<triangle3df>& triangles,
+			bool parallel)
+	{
+		benchmarks::CBenchTimer timer;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			timer.start();
+			tree.build(triangles.pointer(), triangles.size(), parallel);
+			timer.stop();
+		}
+
+		return timer.getBestNs() / 1e6;
+	}
+
+	void measureQueries(const TriangleBVH& tree)
+	{
+		tests::CTestRandom random;
+
+		array<vector3df> origins;
+		array<vector3df> directions;
+
+		for (u32 i = 0; i < Queries; ++i)
+		{
+			origins.pushBack(createPoint(500.f, random));
+			directions.pushBack(createPoint(1.f, random).normalize());
+		}
+
+		benchmarks::CBenchTimer ray;
+		benchmarks::CBenchTimer sight;
+		benchmarks::CBenchTimer box;
+		benchmarks::CBenchTimer closest;
+
+		array<u32> found;
+		u32 result = 0;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			SBVHHit hit;
+			SBVHClosestPoint point;
+
+			ray.start();
+
+			for (u32 i = 0; i < Queries; ++i)
+				result += tree.getIntersectionWithRay(origins[i],
+						directions[i], hit);
+
+			ray.stop();
+
+			sight.start();
+
+			for (u32 i = 0; i < Queries; ++i)
+				result += tree.intersectsWithLimitedLine(line3df(origins[i],
+						origins[i] + directions[i] * 50.f));
+
+			sight.stop();
+
+			box.start();
+
+			for (u32 i = 0; i < Queries; ++i)
+			{
+				found.setUsed(0);
+				result += tree.getTrianglesInBox(aabbox3df(origins[i],
+						origins[i] + vector3df(5.f, 5.f, 5.f)), found);
+			}
+
+			box.stop();
+
+			closest.start();
+
+			for (u32 i = 0; i < Queries; ++i)
+				result += tree.getClosestPoint(origins[i], point);
+
+			closest.stop();
+		}
+
+		benchmarks::keep(result);
+
+		printf("ns per query: ray %.0f, line of sight %.0f, box %.0f, "
+				"closest point %.0f\n", (double) ray.getBestNs() / Queries,
+				(double) sight.getBestNs() / Queries,
+				(double) box.getBestNs() / Queries,
+				(double) closest.getBestNs() / Queries);
+	}
+
+	//! Returns microseconds of nearest ray hit over all triangles
+	double measureBruteForce(const array<triangle3df>& triangles)
+	{
+		const u32 rays = 10;
+
+		tests::CTestRandom random;
+		benchmarks::CBenchTimer timer;
+
+		u32 result = 0;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			timer.start();
+
+			for (u32 ray = 0; ray < rays; ++ray)
+			{
+				const vector3df origin = createPoint(500.f, random);
+				const vector3df direction = createPoint(1.f, random);
+
+				vector3df point;
+
+				for (u32 i = 0; i < triangles.size(); ++i)
+					result += triangles[i].getIntersectionWithLine(origin,
+							direction, point);
+			}
+
+			timer.stop();
+		}
+
+		benchmarks::keep(result);
+
+		return timer.getBestNs() / 1e3 / rays;
+	}
+}
+
+int main()
+{
+	tests::CTestRandom random;
+
+	array<triangle3df> triangles;
+	createScene(triangles, random);
+
+	TriangleBVH tree;
+
+	const double serial = measureBuild(tree, triangles, false);
+	const double parallel = measureBuild(tree, triangles, true);
+
+	printf("%u triangles, %u nodes\n", tree.getTriangleCount(),
+			tree.getNodeCount());
+	printf("build ms: serial %.1f, parallel %.1f with %u workers\n", serial,
+			parallel, threads::SharedJobPool::getInstance().getWorkersCount());
+
+	measureQueries(tree);
+
+	printf("brute force ray %.0f us\n", measureBruteForce(triangles));
+
+	return 0;
+}
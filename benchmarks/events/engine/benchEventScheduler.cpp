@@ -0,0 +1,140 @@
+/*
+ * benchEventScheduler.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Throughput of SharedEventScheduler on 1M tiny events, added from main
+// thread and from workers, and latency of single event added to idle pool.
+
+#include "events/engine/SharedEventScheduler.h"
+#include "threads/irrgameAtomic.h"
+#include "threads/irrgameThread.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+
+#include <stdlib.h>
+
+using namespace irrgame;
+using namespace irrgame::events;
+
+namespace
+{
+	const s32 Events = 1000000;
+	const s32 Children = 100;
+	const s32 Samples = 200;
+
+	//! Counts runs of events
+	class CEventCounter
+	{
+		public:
+
+			CEventCounter() :
+					Count(0)
+			{
+				Tick += NewDelegate(this, &CEventCounter::tick);
+				Spawn += NewDelegate(this, &CEventCounter::spawn);
+			}
+
+			s32 tick(void*)
+			{
+				threads::irrgameAtomic::fetchAdd(&Count, 1);
+
+				return 0;
+			}
+
+			s32 spawn(void*)
+			{
+				for (s32 i = 0; i < Children; ++i)
+					SharedEventScheduler::getInstance().addEvent(&Tick,
+							EAP_BACKGROUND);
+
+				return 0;
+			}
+
+			//! Spins until count reaches value
+			void waitCount(s32 value) const
+			{
+				while (threads::irrgameAtomic::loadAcquire(&Count) < value)
+					;
+			}
+
+		public:
+
+			delegateEvent Tick;
+			delegateEvent Spawn;
+
+			s32 Count;
+	};
+
+	int compareTimes(const void* a, const void* b)
+	{
+		const u64 left = *(const u64*) a;
+		const u64 right = *(const u64*) b;
+
+		return left < right ? -1 : left > right ? 1 : 0;
+	}
+}
+
+int main()
+{
+	SharedEventScheduler& scheduler = SharedEventScheduler::getInstance();
+	scheduler.startProcess();
+
+	printf("%u workers\n", scheduler.getWorkersCount());
+
+	CEventCounter counter;
+
+	u64 start = benchmarks::getTimeNs();
+
+	for (s32 i = 0; i < Events; ++i)
+		scheduler.addEvent(&counter.Tick, EAP_HIGHPRIORITY);
+
+	counter.waitCount(Events);
+
+	u64 time = benchmarks::getTimeNs() - start;
+
+	printf("1M events from main thread:  %8.1f ms, %6.1f M events/s\n",
+			time / 1e6, Events * 1000.0 / time);
+
+	counter.Count = 0;
+	start = benchmarks::getTimeNs();
+
+	for (s32 i = 0; i < Events / Children; ++i)
+		scheduler.addEvent(&counter.Spawn, EAP_HIGHPRIORITY);
+
+	counter.waitCount(Events);
+
+	time = benchmarks::getTimeNs() - start;
+
+	printf("1M events from workers:      %8.1f ms, %6.1f M events/s\n",
+			time / 1e6, Events * 1000.0 / time);
+
+	// latency of wake up, workers fall asleep between samples
+	core::array<u64> latencies;
+	latencies.setUsed(Samples);
+
+	counter.Count = 0;
+
+	for (s32 i = 0; i < Samples; ++i)
+	{
+		threads::irrgameThread::sleep(2);
+
+		start = benchmarks::getTimeNs();
+		scheduler.addEvent(&counter.Tick, EAP_BACKGROUND);
+		counter.waitCount(i + 1);
+
+		latencies[i] = benchmarks::getTimeNs() - start;
+	}
+
+	qsort(latencies.pointer(), Samples, sizeof(u64), compareTimes);
+
+	printf("latency of idle pool, us: median %8.1f, 99%% %8.1f\n",
+			latencies[Samples / 2] / 1e3, latencies[Samples * 99 / 100] / 1e3);
+
+	scheduler.stopProcess();
+
+	return 0;
+}
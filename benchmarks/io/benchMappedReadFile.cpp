@@ -0,0 +1,141 @@
+/*
+ * benchMappedReadFile.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Time of loading 1000 BMP assets through CReadFile, which copies file
+// into loader buffer, and through memory mapped files, which are decoded
+// in place. Files stay in page cache, so it measures copies, not disk.
+
+#include "io/IReadFile.h"
+#include "video/image/IImage.h"
+#include "video/image/loader/bmp/SharedImageLoaderBmp.h"
+#include "video/image/loader/bmp/SBMPHeader.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+using namespace irrgame;
+
+namespace
+{
+	const u32 Assets = 1000;
+	const s32 Runs = 5;
+
+	//! Pixels after the header are aligned for 32 bit reads
+	const u32 BmpDataOffset = 56;
+
+	//! Writes 32 bit BMP file with random pixels
+	void writeBmp(const c8* name, u32 size, tests::CTestRandom& random)
+	{
+		core::array<u8> data;
+		data.setUsed(BmpDataOffset + size * size * 4);
+
+		for (u32 i = 0; i < data.size(); ++i)
+			data[i] = (u8) random.next();
+
+		video::SBMPHeader header;
+		memset(&header, 0, sizeof(header));
+
+		header.Id = 0x4d42;
+		header.FileSize = data.size();
+		header.BitmapDataOffset = BmpDataOffset;
+		header.BitmapHeaderSize = 40;
+		header.Width = size;
+		header.Height = size;
+		header.Planes = 1;
+		header.BPP = 32;
+		header.BitmapDataSize = size * size * 4;
+
+		memcpy(data.pointer(), &header, sizeof(header));
+
+		FILE* file = fopen(name, "wb");
+		fwrite(data.pointer(), 1, data.size(), file);
+		fclose(file);
+	}
+
+	//! Loads all assets, returns sum of their sizes
+	u32 loadAll(const core::array<core::stringc>& names, bool mapped)
+	{
+		video::SharedImageLoaderBmp& loader =
+				video::SharedImageLoaderBmp::getInstance();
+
+		u32 result = 0;
+
+		for (u32 i = 0; i < names.size(); ++i)
+		{
+			io::IReadFile* file = mapped ? io::createMappedReadFile(names[i])
+					: io::createReadFile(names[i]);
+
+			video::IImage* image = loader.createImage(file);
+			result += image->getImageDataSizeInBytes();
+
+			image->drop();
+			file->drop();
+		}
+
+		return result;
+	}
+
+	void measure(const c8* directory, u32 size)
+	{
+		tests::CTestRandom random;
+		core::array<core::stringc> names;
+
+		c8 name[256];
+
+		for (u32 i = 0; i < Assets; ++i)
+		{
+			sprintf(name, "%s/asset%u.bmp", directory, i);
+			writeBmp(name, size, random);
+
+			names.pushBack(name);
+		}
+
+		benchmarks::CBenchTimer common;
+		benchmarks::CBenchTimer mapped;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			common.start();
+			benchmarks::keep(loadAll(names, false));
+			common.stop();
+
+			mapped.start();
+			benchmarks::keep(loadAll(names, true));
+			mapped.stop();
+		}
+
+		printf("%4u assets %3ux%-3u: CReadFile %8.2f mapped %8.2f\n", Assets,
+				size, size, common.getBestNs() / 1e6, mapped.getBestNs() / 1e6);
+
+		for (u32 i = 0; i < names.size(); ++i)
+			unlink(names[i].cStr());
+	}
+}
+
+int main()
+{
+	c8 directory[] = "/tmp/irrgameXXXXXX";
+
+	if (!mkdtemp(directory))
+		return 1;
+
+#ifdef IRR_MEMORY_MAPPED_FILES
+	printf("ms per 1000 assets\n");
+
+	measure(directory, 16);
+	measure(directory, 64);
+	measure(directory, 256);
+#endif
+
+	rmdir(directory);
+
+	return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * benchAttributes.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Nanoseconds per attribute of filling, writing and reading by name an
+// attribute set with 10, 100 and 1000 entries, and of linear search by
+// name, which was used before the name index.
+
+#include "io/serialize/IAttributes.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+
+#include <string.h>
+
+using namespace irrgame;
+
+namespace
+{
+	const s32 Runs = 20;
+
+	void measure(u32 count)
+	{
+		core::array<core::stringc> names;
+		c8 name[32];
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			sprintf(name, "attribute%u", i);
+			names.pushBack(name);
+		}
+
+		benchmarks::CBenchTimer fill;
+		benchmarks::CBenchTimer write;
+		benchmarks::CBenchTimer read;
+		benchmarks::CBenchTimer linear;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			io::IAttributes* attributes = io::createAttributes();
+
+			fill.start();
+
+			for (u32 i = 0; i < count; ++i)
+				attributes->addInt(names[i].cStr(), i);
+
+			fill.stop();
+
+			write.start();
+
+			for (u32 i = 0; i < count; ++i)
+				attributes->setAttribute(names[i].cStr(), (s32) i + 1);
+
+			write.stop();
+
+			s32 sum = 0;
+
+			read.start();
+
+			for (u32 i = 0; i < count; ++i)
+				sum += attributes->getAttributeAsInt(names[i].cStr());
+
+			read.stop();
+
+			linear.start();
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				for (u32 k = 0; k < attributes->getAttributeCount(); ++k)
+				{
+					if (!strcmp(attributes->getAttributeName(k),
+							names[i].cStr()))
+					{
+						sum += attributes->getAttributeAsInt(k);
+						break;
+					}
+				}
+			}
+
+			linear.stop();
+
+			benchmarks::keep(sum);
+
+			attributes->drop();
+		}
+
+		printf("%5u attributes: add %7.1f set %7.1f get %7.1f linear %9.1f\n",
+				count, (double) fill.getBestNs() / count,
+				(double) write.getBestNs() / count,
+				(double) read.getBestNs() / count,
+				(double) linear.getBestNs() / count);
+	}
+}
+
+int main()
+{
+	printf("ns per attribute\n");
+
+	measure(10);
+	measure(100);
+	measure(1000);
+
+	return 0;
+}
@@ -0,0 +1,152 @@
+/*
+ * benchXMLReader.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Speed of parsing a 50 MB scene description in attribute format and count
+// of heap allocations made by the reader. Every node name, attribute name
+// and value is read, so lazy entity decoding is measured too.
+
+#include "io/xml/IXMLReader.h"
+#include "io/IReadFile.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+#include "benchAllocations.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+using namespace irrgame;
+using namespace io;
+
+namespace
+{
+	const u32 DocumentSize = 50 * 1024 * 1024;
+	const s32 Runs = 3;
+
+	const c8* const Names[] =
+	{ "Name", "Id", "Position", "Rotation", "Scale", "Visible", "Mesh",
+			"Material", "Speed", "Health", "Team", "Description" };
+
+	const c8* const Types[] =
+	{ "string", "int", "vector3d", "vector3d", "vector3d", "bool", "string",
+			"string", "float", "int", "int", "string" };
+
+	const c8* const Values[] =
+	{ "node", "7", "1.5, 2, -3", "0, 90, 0", "1, 1, 1", "true",
+			"meshes/tree.obj", "materials/bark.mtl", "1.25", "100", "2",
+			"&lt;big&gt; &amp; &quot;old&quot;" };
+
+	const u32 AttributeCount = sizeof(Names) / sizeof(Names[0]);
+
+	void write(core::array<c8>& text, const c8* value)
+	{
+		while (*value)
+			text.pushBack(*value++);
+	}
+
+	//! Writes scene, returns count of nodes in it
+	u32 createScene(core::array<c8>& text)
+	{
+		text.reallocate(DocumentSize + 4096);
+
+		write(text, "<?xml version=\"1.0\"?>\n<scene>\n");
+
+		u32 nodes = 0;
+
+		while (text.size() < DocumentSize)
+		{
+			write(text, "<node type=\"mesh\">\n<attributes>\n");
+
+			for (u32 i = 0; i < AttributeCount; ++i)
+			{
+				write(text, "\t<");
+				write(text, Types[i]);
+				write(text, " name=\"");
+				write(text, Names[i]);
+				write(text, "\" value=\"");
+				write(text, Values[i]);
+				write(text, "\"/>\n");
+			}
+
+			write(text, "</attributes>\n</node>\n");
+			++nodes;
+		}
+
+		write(text, "</scene>\n");
+
+		return nodes;
+	}
+
+	//! Touches every name and value, returns their total length
+	u32 parse(IXMLReader* reader)
+	{
+		u32 result = 0;
+
+		while (reader->read())
+		{
+			if (reader->getNodeType() != EXNT_ELEMENT)
+				continue;
+
+			result += strlen(reader->getNodeName());
+
+			for (u32 i = 0; i < reader->getAttributeCount(); ++i)
+			{
+				result += strlen(reader->getAttributeName(i));
+				result += strlen(reader->getAttributeValue(i));
+			}
+		}
+
+		return result;
+	}
+}
+
+int main()
+{
+	core::array<c8> text;
+	const u32 nodes = createScene(text);
+	const u32 size = text.size();
+
+	benchmarks::CBenchTimer timer;
+	u32 allocations = 0;
+
+	for (s32 run = 0; run < Runs; ++run)
+	{
+		c8* memory = new c8[size];
+		memcpy(memory, text.pointer(), size);
+
+		IReadFile* file = createMemoryReadFile(memory, size, "scene.xml",
+				true);
+
+		timer.start();
+
+		const u32 before = benchmarks::getAllocationCount();
+
+		IXMLReader* reader = createXMLReader(file);
+		benchmarks::keep(parse(reader));
+		reader->drop();
+
+		allocations = benchmarks::getAllocationCount() - before;
+
+		timer.stop();
+
+		file->drop();
+	}
+
+	const double ms = timer.getBestNs() / 1e6;
+
+	printf("%u nodes, %.1f MB: %.1f ms, %.1f MB/s\n", nodes,
+			size / 1048576.0, ms, size / 1048576.0 / (ms / 1e3));
+
+#ifdef IRRGAME_COUNT_ALLOCATIONS
+	printf("allocations: %u, %.4f per node\n", allocations,
+			(double) allocations / nodes);
+#else
+	printf("allocations are counted with glibc only\n");
+#endif
+
+	return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * benchSweepAndPrune.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Milliseconds per frame of SweepAndPrune update with 1k, 10k and 50k boxes
+// moving by up to 0.3 per frame at constant density, against brute force
+// test of all pairs, and time of first update, which inserts all boxes.
+
+#include "logic/SweepAndPrune.h"
+
+#include "benchUtils.h"
+
+#include <math.h>
+
+using namespace irrgame;
+using namespace irrgame::core;
+using namespace irrgame::logic;
+
+namespace
+{
+	//! Overlap by axes, touching boxes overlap
+	bool overlaps(const aabbox3df& a, const aabbox3df& b)
+	{
+		return a.MinEdge.X <= b.MaxEdge.X && a.MinEdge.Y <= b.MaxEdge.Y
+				&& a.MinEdge.Z <= b.MaxEdge.Z && b.MinEdge.X <= a.MaxEdge.X
+				&& b.MinEdge.Y <= a.MaxEdge.Y && b.MinEdge.Z <= a.MaxEdge.Z;
+	}
+
+	f32 bounce(f32 velocity, f32 min, f32 max, f32 world)
+	{
+		return min < -world || max > world ? -velocity : velocity;
+	}
+
+	//! Returns milliseconds of brute force test of all pairs
+	double measureBruteForce(const array<aabbox3df>& boxes)
+	{
+		const u64 start = benchmarks::getTimeNs();
+		u32 pairs = 0;
+
+		for (u32 i = 0; i < boxes.size(); ++i)
+		{
+			for (u32 j = i + 1; j < boxes.size(); ++j)
+				pairs += overlaps(boxes[i], boxes[j]);
+		}
+
+		benchmarks::keep(pairs);
+
+		return (benchmarks::getTimeNs() - start) / 1e6;
+	}
+
+	void measure(u32 count, u32 frames)
+	{
+		// same density for all counts
+		const f32 world = 6.f * cbrtf((f32) count);
+
+		tests::CTestRandom random;
+		SweepAndPrune broadphase;
+
+		array<aabbox3df> boxes;
+		array<vector3df> velocities;
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			const vector3df center(random.nextFloat(-world, world),
+					random.nextFloat(-world, world),
+					random.nextFloat(-world, world));
+			const vector3df extent(random.nextFloat(.5f, 1.5f),
+					random.nextFloat(.5f, 1.5f), random.nextFloat(.5f, 1.5f));
+
+			boxes.pushBack(aabbox3df(center - extent, center + extent));
+			velocities.pushBack(vector3df(random.nextFloat(-.3f, .3f),
+					random.nextFloat(-.3f, .3f), random.nextFloat(-.3f, .3f)));
+
+			broadphase.addObject(boxes[i]);
+		}
+
+		array<SOverlapPair> begun;
+		array<SOverlapPair> ended;
+
+		u64 start = benchmarks::getTimeNs();
+		broadphase.update(begun, ended);
+
+		const double insert = (benchmarks::getTimeNs() - start) / 1e6;
+
+		u64 update = 0;
+		u32 events = 0;
+
+		for (u32 frame = 0; frame < frames; ++frame)
+		{
+			for (u32 i = 0; i < count; ++i)
+			{
+				aabbox3df& box = boxes[i];
+				vector3df& velocity = velocities[i];
+
+				box.MinEdge += velocity;
+				box.MaxEdge += velocity;
+
+				velocity.X = bounce(velocity.X, box.MinEdge.X, box.MaxEdge.X,
+						world);
+				velocity.Y = bounce(velocity.Y, box.MinEdge.Y, box.MaxEdge.Y,
+						world);
+				velocity.Z = bounce(velocity.Z, box.MinEdge.Z, box.MaxEdge.Z,
+						world);
+
+				broadphase.setBox(i, box);
+			}
+
+			start = benchmarks::getTimeNs();
+			broadphase.update(begun, ended);
+			update += benchmarks::getTimeNs() - start;
+
+			events += begun.size() + ended.size();
+		}
+
+		printf("%6u %10.2f %10.3f %10u %10u %12.1f\n", count, insert,
+				update / 1e6 / frames, broadphase.getPairsCount(),
+				events / frames, measureBruteForce(boxes));
+	}
+}
+
+int main()
+{
+	printf("%6s %10s %10s %10s %10s %12s\n", "boxes", "insert ms",
+			"update ms", "pairs", "events", "brute ms");
+
+	measure(1000, 200);
+	measure(10000, 200);
+	measure(50000, 60);
+
+	return 0;
+}
@@ -0,0 +1,176 @@
+/*
+ * benchQueues.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Nanoseconds per element passed through blocking SPSC and MPMC queues and
+// through core::list guarded by a lock, which the scheduler used before,
+// with 1 to 16 producers and consumers and capacity of 1024 elements.
+
+#include "threads/queue/BlockingQueue.h"
+#include "threads/queue/SPSCQueue.h"
+#include "threads/lock/MonitorLock.h"
+#include "threads/LightweightSemaphore.h"
+#include "threads/irrgameAtomic.h"
+#include "threads/irrgameThread.h"
+#include "core/collections/list/list.h"
+
+#include "benchUtils.h"
+
+using namespace irrgame;
+
+namespace
+{
+	//! Elements of all producers, divisible by 1..4, 8 and 16 threads
+	const u32 Total = 240000;
+	const u32 Capacity = 1024;
+	const s32 Runs = 3;
+
+	//! Unbounded list guarded by lock, consumers wait for elements
+	class CLockedList
+	{
+		public:
+
+			CLockedList(u32 /* capacity */) :
+					Elements(0)
+			{
+			}
+
+			void push(const u64& element)
+			{
+				Lock.enter();
+				List.pushBack(element);
+				Lock.exit();
+
+				Elements.post();
+			}
+
+			void pop(u64& element)
+			{
+				Elements.wait();
+
+				Lock.enter();
+
+				core::list<u64>::Iterator it = List.begin();
+				element = *it;
+				List.erase(it);
+
+				Lock.exit();
+			}
+
+		private:
+
+			threads::MonitorLock Lock;
+			core::list<u64> List;
+			threads::LightweightSemaphore Elements;
+	};
+
+	//! Threads take roles of producers and consumers by start order
+	template<class TQueue>
+	class CExchange
+	{
+		public:
+
+			CExchange(u32 producers, u32 consumers) :
+					Queue(Capacity), Producers(producers),
+					Consumers(consumers), NextThread(0), Sum(0)
+			{
+			}
+
+			s32 run(void* /* arg */)
+			{
+				const u32 index = threads::irrgameAtomic::fetchAdd(
+						&NextThread, 1u);
+
+				if (index < Producers)
+				{
+					for (u32 i = 1; i <= Total / Producers; ++i)
+						Queue.push((u64) i);
+
+					return 0;
+				}
+
+				u64 sum = 0;
+
+				for (u32 i = 0; i < Total / Consumers; ++i)
+				{
+					u64 value = 0;
+					Queue.pop(value);
+					sum += value;
+				}
+
+				threads::irrgameAtomic::fetchAdd(&Sum, sum);
+
+				return 0;
+			}
+
+			//! Returns true if every element was received
+			bool isComplete() const
+			{
+				const u64 count = Total / Producers;
+
+				return Sum == Producers * count * (count + 1) / 2;
+			}
+
+		private:
+
+			TQueue Queue;
+
+			u32 Producers;
+			u32 Consumers;
+
+			u32 NextThread;
+			u64 Sum;
+	};
+
+	//! Returns nanoseconds per element
+	template<class TQueue>
+	double measure(u32 producers, u32 consumers)
+	{
+		benchmarks::CBenchTimer timer;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			CExchange<TQueue> exchange(producers, consumers);
+
+			threads::delegateThreadCallback callback;
+			callback += NewDelegate(&exchange, &CExchange<TQueue>::run);
+
+			timer.start();
+			tests::runThreads(&callback, producers + consumers);
+			timer.stop();
+
+			if (!exchange.isComplete())
+				printf("elements lost\n");
+		}
+
+		return (double) timer.getBestNs() / Total;
+	}
+
+	void measureThreads(u32 producers, u32 consumers)
+	{
+		typedef threads::BlockingQueue<u64> TMPMCQueue;
+
+		printf("%2u/%-2u mpmc %7.1f list %7.1f\n", producers, consumers,
+				measure<TMPMCQueue>(producers, consumers),
+				measure<CLockedList>(producers, consumers));
+	}
+}
+
+int main()
+{
+	typedef threads::BlockingQueue<u64, threads::SPSCQueue<u64> > TSPSCQueue;
+
+	printf("ns per element, producers/consumers\n");
+	printf(" 1/1  spsc %7.1f\n", measure<TSPSCQueue>(1, 1));
+
+	for (u32 threads = 1; threads <= 16; threads *= 2)
+		measureThreads(threads, threads);
+
+	measureThreads(1, 16);
+	measureThreads(16, 1);
+
+	return 0;
+}
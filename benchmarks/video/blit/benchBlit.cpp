@@ -0,0 +1,119 @@
+/*
+ * benchBlit.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Throughput of scalar, SSE2 and AVX2 blitters of blitTable in one thread,
+// in megapixels per second.
+
+#include "video/blit/blit.h"
+#include "video/image/IImage.h"
+#include "video/utils/SharedVideoUtils.h"
+#include "video/blit/blitSIMD.h"
+#include "video/blit/blitterTable.h"
+#include "core/utils/SharedCPUFeatures.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+
+#include <string.h>
+
+using namespace irrgame;
+using namespace irrgame::video;
+
+namespace
+{
+	const s32 Width = 1024;
+	const s32 Height = 1024;
+	const s32 Runs = 10;
+
+	//! Returns bytes per pixel of format, 0 for blits without image
+	u32 getPixelSize(s32 format)
+	{
+		if (format < 0)
+			return 0;
+
+		return SharedVideoUtils::getInstance().getBitsPerPixelFromFormat(
+				(EColorFormat) format) / 8;
+	}
+
+	//! Returns megapixels per second of blitter, 0 if there is no blitter
+	double measure(tExecuteBlit blitter, SBlitJob& job)
+	{
+		if (!blitter)
+			return 0;
+
+		benchmarks::CBenchTimer timer;
+
+		for (s32 i = 0; i < Runs; ++i)
+		{
+			timer.start();
+			blitter(&job);
+			timer.stop();
+
+			benchmarks::keep(job.dst);
+		}
+
+		return (double) job.width * job.height * 1000.0 / timer.getBestNs();
+	}
+}
+
+int main()
+{
+	const core::SharedCPUFeatures& cpu = core::SharedCPUFeatures::getInstance();
+
+	printf("%dx%d pixels, MPix/s: %10s %10s %10s\n", Width, Height, "scalar",
+			"SSE2", "AVX2");
+
+	tests::CTestRandom random;
+
+	for (const blitterTable* entry = blitTable;
+			entry->operation != BLITTER_INVALID; ++entry)
+	{
+		if (!entry->funcSSE2 && !entry->funcAVX2)
+			continue;
+
+		SBlitJob job;
+		memset(&job, 0, sizeof(job));
+
+		job.width = Width;
+		job.height = Height;
+		job.srcPixelMul = getPixelSize(entry->sourceFormat);
+		job.dstPixelMul = getPixelSize(entry->destFormat);
+		job.srcPitch = Width * job.srcPixelMul;
+		job.dstPitch = Width * job.dstPixelMul;
+
+		// color operations take row size from srcPitch, as Blit sets it
+		if (!job.srcPixelMul)
+			job.srcPitch = job.dstPitch;
+
+		job.argb = 0x80C08040;
+
+		core::array<u8> source;
+		core::array<u8> dest;
+
+		source.setUsed(job.srcPitch * Height + 16);
+		dest.setUsed(job.dstPitch * Height + 16);
+
+		for (u32 i = 0; i < source.size(); ++i)
+			source[i] = (u8) random.next();
+
+		for (u32 i = 0; i < dest.size(); ++i)
+			dest[i] = (u8) random.next();
+
+		job.src = source.pointer();
+		job.dst = dest.pointer();
+
+		const double scalar = measure(entry->func, job);
+		const double sse2 = measure(cpu.hasSSE2() ? entry->funcSSE2 : 0, job);
+		const double avx2 = measure(cpu.hasAVX2() ? entry->funcAVX2 : 0, job);
+
+		printf("blitter %d, format %2d <- %2d:    %10.0f %10.0f %10.0f\n",
+				entry->operation, entry->destFormat, entry->sourceFormat,
+				scalar, sse2, avx2);
+	}
+
+	return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * benchBlitBatch.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Nanoseconds per small sprite drawn by one Blit call per sprite against one
+// batched Blit call for all sprites.
+
+#include "video/blit/blit.h"
+#include "video/image/CImage.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+
+#include <string.h>
+
+using namespace irrgame;
+using namespace irrgame::video;
+
+namespace
+{
+	const s32 Sprites = 10000;
+	const s32 Runs = 20;
+
+	void measure(eBlitter operation, s32 size)
+	{
+		tests::CTestRandom random;
+
+		CImage* source = new CImage(ECF_A8R8G8B8, dimension2du(256, 256));
+		CImage* dest = new CImage(ECF_A8R8G8B8, dimension2du(1024, 1024));
+
+		memset(source->lock(), 0x80, source->getImageDataSizeInBytes());
+		source->unlock();
+
+		core::array<recti> rects;
+		core::array<vector2di> positions;
+		core::array<SBlitJob> jobs;
+
+		rects.setUsed(Sprites);
+		positions.setUsed(Sprites);
+		jobs.setUsed(Sprites);
+
+		for (s32 i = 0; i < Sprites; ++i)
+		{
+			const s32 x = (s32) random.next(256 - size);
+			const s32 y = (s32) random.next(256 - size);
+
+			rects[i] = recti(x, y, x + size, y + size);
+			positions[i].set((s32) random.next(1024 - size),
+					(s32) random.next(1024 - size));
+
+			SBlitJob& job = jobs[i];
+			memset(&job, 0, sizeof(job));
+
+			job.Source.x0 = x;
+			job.Source.y0 = y;
+			job.Source.x1 = x + size;
+			job.Source.y1 = y + size;
+			job.Dest.x0 = positions[i].X;
+			job.Dest.y0 = positions[i].Y;
+			job.argb = 0xFFFFFFFF;
+		}
+
+		benchmarks::CBenchTimer single;
+		benchmarks::CBenchTimer batch;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			single.start();
+
+			for (s32 i = 0; i < Sprites; ++i)
+				Blit(operation, dest, 0, &positions[i], source, &rects[i],
+						0xFFFFFFFF);
+
+			single.stop();
+
+			batch.start();
+			Blit(operation, dest, 0, source, jobs.pointer(), Sprites);
+			batch.stop();
+		}
+
+		printf("blitter %d, %2dx%-2d sprites: single %8.1f batch %8.1f\n",
+				operation, size, size, (double) single.getBestNs() / Sprites,
+				(double) batch.getBestNs() / Sprites);
+
+		source->drop();
+		dest->drop();
+	}
+}
+
+int main()
+{
+	printf("ns per sprite\n");
+
+	measure(BLITTER_TEXTURE, 1);
+	measure(BLITTER_TEXTURE, 8);
+	measure(BLITTER_TEXTURE, 16);
+	measure(BLITTER_TEXTURE_ALPHA_BLEND, 8);
+	measure(BLITTER_TEXTURE_ALPHA_BLEND, 16);
+
+	return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * benchBlitParallel.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Scaling of 4K Blit, copyToScaling and copyToScalingBoxFilter from 1 to N
+// processors. Job pool is sized once per process, so every processors
+// count is measured in own child process.
+
+#include "video/blit/blit.h"
+#include "video/image/CImage.h"
+#include "threads/irrgameThread.h"
+
+#include "benchUtils.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+using namespace irrgame;
+using namespace irrgame::video;
+
+namespace
+{
+	const s32 Runs = 5;
+
+	//! Prints milliseconds of operations with processors of job pool
+	void measure(u32 processors)
+	{
+		const dimension2du size(3840, 2160);
+
+		CImage* source = new CImage(ECF_A8R8G8B8, size);
+		CImage* dest = new CImage(ECF_A8R8G8B8, size);
+		CImage* small = new CImage(ECF_A8R8G8B8, dimension2du(1280, 720));
+
+		memset(source->lock(), 0x80, source->getImageDataSizeInBytes());
+		source->unlock();
+
+		// 0 splits every operation into bands
+		setParallelBlitThreshold(processors > 1 ? 0 : 0xFFFFFFFF);
+
+		benchmarks::CBenchTimer copy;
+		benchmarks::CBenchTimer blend;
+		benchmarks::CBenchTimer scaling;
+		benchmarks::CBenchTimer boxFilter;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			copy.start();
+			Blit(BLITTER_TEXTURE, dest, 0, 0, source, 0, 0);
+			copy.stop();
+
+			blend.start();
+			Blit(BLITTER_TEXTURE_ALPHA_BLEND, dest, 0, 0, source, 0, 0);
+			blend.stop();
+
+			scaling.start();
+			small->copyToScaling(dest);
+			scaling.stop();
+
+			boxFilter.start();
+			source->copyToScalingBoxFilter(small, 0, false);
+			boxFilter.stop();
+		}
+
+		printf("%2u processors: %8.2f %8.2f %8.2f %8.2f\n", processors,
+				copy.getBestNs() / 1e6, blend.getBestNs() / 1e6,
+				scaling.getBestNs() / 1e6, boxFilter.getBestNs() / 1e6);
+
+		source->drop();
+		dest->drop();
+		small->drop();
+	}
+}
+
+int main()
+{
+	const u32 processors = threads::irrgameThread::getProcessorsCount();
+
+	printf("3840x2160, ms:  %8s %8s %8s %8s\n", "copy", "blend", "scale",
+			"box");
+
+	// powers of two, last measure is done with all processors
+	for (u32 count = 1;; count *= 2)
+	{
+		if (count > processors)
+			count = processors;
+
+		// child would print buffered output again
+		fflush(stdout);
+
+		const pid_t child = fork();
+
+		if (child == 0)
+		{
+			c8 value[16];
+			sprintf(value, "%u", count);
+			setenv("IRRGAME_PROCESSORS", value, 1);
+
+			measure(count);
+
+			return 0;
+		}
+
+		waitpid(child, 0, 0);
+
+		if (count == processors)
+			break;
+	}
+
+	return 0;
+}
@@ -0,0 +1,123 @@
+/*
+ * benchColorConverter.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Throughput of SharedColorConverter::convert_viaFormat for every pair of
+// A1R5G5B5, R5G6B5, R8G8B8 and A8R8G8B8 formats over 1M pixels, with scalar
+// code only and with SSSE3 and AVX2 conversions, in GB/s of source and
+// destination bytes. Pairs without SIMD conversion run scalar code in all
+// columns.
+
+#include "video/color/SharedColorConverter.h"
+#include "video/color/SColorConverterSIMD.h"
+#include "video/utils/SharedVideoUtils.h"
+#include "core/utils/SharedCPUFeatures.h"
+#include "core/collections/array.h"
+
+#include "benchUtils.h"
+
+using namespace irrgame;
+using namespace irrgame::video;
+
+namespace
+{
+	const s32 Pixels = 1024 * 1024;
+	const s32 Runs = 10;
+
+	const EColorFormat Formats[] =
+	{ ECF_A1R5G5B5, ECF_R5G6B5, ECF_R8G8B8, ECF_A8R8G8B8 };
+
+	const c8* const FormatNames[] =
+	{ "A1R5G5B5", "R5G6B5", "R8G8B8", "A8R8G8B8" };
+
+	const u32 FormatCount = sizeof(Formats) / sizeof(Formats[0]);
+
+	u32 getPixelSize(EColorFormat format)
+	{
+		return SharedVideoUtils::getInstance().getBitsPerPixelFromFormat(
+				format) / 8;
+	}
+
+	//! Returns GB/s of conversion with SIMD conversions of one set
+	double measure(const SColorConverterSIMD* conversions, EColorFormat source,
+			EColorFormat dest, const core::array<u8>& input,
+			core::array<u8>& output)
+	{
+		SharedColorConverter& converter = SharedColorConverter::getInstance();
+		converter.setSIMD(conversions);
+
+		benchmarks::CBenchTimer timer;
+
+		for (s32 run = 0; run < Runs; ++run)
+		{
+			timer.start();
+			converter.convert_viaFormat(input.constPointer(), source, Pixels,
+					output.pointer(), dest);
+			timer.stop();
+
+			benchmarks::keep(output[0]);
+		}
+
+		const double bytes = (double) Pixels
+				* (getPixelSize(source) + getPixelSize(dest));
+
+		return bytes / timer.getBestNs();
+	}
+}
+
+int main()
+{
+	const core::SharedCPUFeatures& cpu = core::SharedCPUFeatures::getInstance();
+	SharedColorConverter& converter = SharedColorConverter::getInstance();
+
+	const SColorConverterSIMD* best = converter.getSIMD();
+	const SColorConverterSIMD* ssse3 =
+			cpu.hasSSSE3() ? getColorConverterSSSE3() : 0;
+	const SColorConverterSIMD* avx2 =
+			cpu.hasAVX2() ? getColorConverterAVX2() : 0;
+
+	tests::CTestRandom random;
+
+	core::array<u8> input;
+	core::array<u8> output;
+
+	// scalar R5G6B5 to R8G8B8 steps 4 source pixels per pixel
+	input.setUsed(Pixels * 8);
+	output.setUsed(Pixels * 4);
+
+	for (u32 i = 0; i < input.size(); ++i)
+		input[i] = (u8) random.next();
+
+	printf("GB/s %-20s %8s %8s %8s\n", "", "scalar", "SSSE3", "AVX2");
+
+	for (u32 i = 0; i < FormatCount; ++i)
+	{
+		for (u32 k = 0; k < FormatCount; ++k)
+		{
+			printf("     %-8s -> %-8s", FormatNames[i], FormatNames[k]);
+			printf(" %8.2f", measure(0, Formats[i], Formats[k], input,
+					output));
+
+			if (ssse3)
+				printf(" %8.2f", measure(ssse3, Formats[i], Formats[k], input,
+						output));
+			else
+				printf(" %8s", "-");
+
+			if (avx2)
+				printf(" %8.2f", measure(avx2, Formats[i], Formats[k], input,
+						output));
+			else
+				printf(" %8s", "-");
+
+			printf("\n");
+		}
+	}
+
+	converter.setSIMD(best);
+
+	return 0;
+}
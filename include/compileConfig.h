@@ -38,7 +38,74 @@ const u32 MaterialMaxTextures = 4;
 		((u32)(u8)(c0) | ((u32)(u8)(c1) << 8) | \
 		((u32)(u8)(c2) << 16) | ((u32)(u8)(c3) << 24 ))
 
+//! core
+//! Comment this line out to use only scalar code of matrix4<f32>.
+//! SIMD kernels are selected at runtime by CPU features and used only on x86.
+#define IRR_SIMD_MATRIX
+
+//! Comment this line out to use only scalar code of core::SharedCulling.
+//! SIMD kernels are selected at runtime by CPU features and used only on x86.
+#define IRR_SIMD_CULLING
+
+//! Culling of at least this count of boxes is split into bands, which are
+//! proceed in parallel by threads::SharedJobPool.
+//! Can be changed at runtime by core::SharedCulling::setParallelThreshold.
+#define IRR_PARALLEL_CULLING_THRESHOLD	65536
+
+//! Minimal count of boxes in one band of parallel culling, multiple of 32
+#define IRR_PARALLEL_CULLING_BAND_BOXES	8192
+
+//! Comment this line out to use only scalar node tests of core::TriangleBVH.
+//! SSE2 tests are selected at runtime by CPU features and used only on x86.
+#define IRR_SIMD_BVH
+
+//! Count of bins of surface area heuristic of core::TriangleBVH build
+#define IRR_BVH_SAH_BINS	16
+
+//! logic
+//! logic::SweepAndPrune inserts and removes objects one by one by insertion
+//! sort, update with more added and removed objects sorts all of them at once.
+#define IRR_SWEEP_AND_PRUNE_REBUILD_THRESHOLD	64
+
 //! threads
+//! Comment this line out to use non atomic reference counting in IReferenceCounted.
+//! Only safe if reference counted objects are never shared between threads.
+#define IRR_ATOMIC_REFERENCE_COUNTING
+
+//! video
+//! Comment this line out to use only scalar blitters.
+//! SIMD blitters are selected at runtime by CPU features and used only on x86.
+#define IRR_SIMD_BLITTERS
+
+//! Comment this line out to use only scalar color conversions.
+//! SIMD conversions are selected at runtime by CPU features and used only on x86.
+#define IRR_SIMD_COLOR_CONVERTER
+
+//! Blits and image scaling with at least this count of pixels are split into
+//! row bands and proceed in parallel by threads::SharedJobPool.
+//! Can be changed at runtime by video::setParallelBlitThreshold.
+#define IRR_PARALLEL_BLIT_THRESHOLD		262144
+
+//! Minimal count of pixels in one band of parallel blit
+#define IRR_PARALLEL_BLIT_BAND_PIXELS	16384
+
+//! Arrays with at least this count of elements are sorted by parallel merge sort
+//! in threads::SharedJobPool, if their elements have no radix key.
+#define IRR_PARALLEL_SORT_THRESHOLD		65536
+
+//! Default size of memory chunk of core::LinearArena in bytes
+#define IRR_LINEAR_ARENA_CHUNK_SIZE		65536
+
+//! Size of cache line in bytes. Counters of lock-free queues, which are
+//! written by different threads, are placed on different cache lines.
+#define IRR_CACHE_LINE_SIZE		64
+
+//! Count of spins of threads::LightweightSemaphore before thread is parked
+#define IRR_SEMAPHORE_SPIN_COUNT	1024
+
+//! Count of children which core::ILeafNode keeps without heap allocation
+#define IRR_LEAF_NODE_INLINE_CHILDREN	4
+
 #define PRIORITY_LOW	-20
 #define PRIORITY_NORMAL	0
 #define PRIORITY_HIGH	20
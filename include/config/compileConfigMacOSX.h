@@ -28,6 +28,10 @@ typedef signed short s16;
 typedef unsigned int u32;
 //! 32 bit signed variable.
 typedef signed int s32;
+//! 64 bit unsigned variable.
+typedef unsigned long long u64;
+//! 64 bit signed variable.
+typedef signed long long s64;
 //! 32 bit floating point variable.
 typedef float f32;
 
@@ -68,11 +72,30 @@ typedef float f32;
 #ifndef REALINLINE
 #define REALINLINE inline
 #endif /* REALINLINE */
+/*
+ * THREAD LOCAL
+ */
+#ifndef IRR_THREAD_LOCAL
+#define IRR_THREAD_LOCAL __thread
+#endif /* IRR_THREAD_LOCAL */
+
+//! Small objects (list and map nodes, attributes, delegates) are allocated
+//! from per thread caches of core::SharedSlabAllocator instead of global heap
+#define IRR_SLAB_ALLOCATOR
+/*
+ * SIMD
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#define IRR_X86_SIMD
+#endif /* x86 */
 /*
  * io
  */
 #define LINEBREAK "\r"
 
+//! Read files are memory mapped, so loaders can use their data without copying
+#define IRR_MEMORY_MAPPED_FILES
+
 /*
  * Not used in MacOSX
  */
@@ -11,5 +11,9 @@
 #include "core/allocator/EAllocStrategy.h"
 #include "core/allocator/irrAllocator.h"
 #include "core/allocator/irrAllocatorFast.h"
+#include "core/allocator/LinearArena.h"
+#include "core/allocator/LinearArenaAllocator.h"
+#include "core/allocator/ScopedArena.h"
+#include "core/allocator/SharedSlabAllocator.h"
 
 #endif /* ALLOCATOR_H_ */
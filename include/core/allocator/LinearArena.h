@@ -0,0 +1,115 @@
+/*
+ * LinearArena.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef LINEARARENA_H_
+#define LINEARARENA_H_
+
+#include "compileConfig.h"
+
+#include <stddef.h>
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Position in arena, which can be restored later by rewind
+		struct SArenaMarker
+		{
+				//! Chunk which was current. 0 for empty arena.
+				void* Chunk;
+
+				//! Used bytes of that chunk
+				size_t Used;
+		};
+
+		//! Bump pointer allocator for transient data.
+		/** Memory is taken from big chunks and is never freed per object.
+		 Call reset() once per frame (or after other unit of work) to reuse all
+		 memory, or use ScopedArena to release memory of one scope. After reset
+		 all chunks are merged into one, so steady workload does not call system
+		 allocator at all. Destructors of objects are not called.
+		 Arena is not synchronized, use one arena per thread. */
+		class LinearArena
+		{
+			public:
+
+				//! Constructor. Does not allocate.
+				//! \param chunkSize: Minimal size of memory chunk in bytes
+				LinearArena(size_t chunkSize = IRR_LINEAR_ARENA_CHUNK_SIZE);
+
+				//! Destructor. Frees all chunks.
+				virtual ~LinearArena();
+
+				/*
+				 * Methods
+				 */
+
+				//! Allocates memory block
+				//! \param size: Size of block in bytes
+				//! \param alignment: Alignment of block, must be power of two
+				void* allocate(size_t size, size_t alignment = 16);
+
+				//! Resizes memory block. The last block of arena is resized in
+				//! place if chunk has room, other blocks are copied.
+				//! \param ptr: Block of arena or 0
+				//! \param oldSize: Size of block in bytes
+				//! \param size: New size of block in bytes
+				//! \param alignment: Alignment of block, must be power of two
+				void* reallocate(void* ptr, size_t oldSize, size_t size,
+						size_t alignment = 16);
+
+				//! Releases all blocks. Chunks are kept for reuse.
+				void reset();
+
+				//! Returns current position of arena
+				SArenaMarker getMarker() const;
+
+				//! Releases all blocks allocated after marker was taken
+				void rewind(const SArenaMarker& marker);
+
+				//! Returns count of bytes used by blocks
+				size_t getUsedSize() const;
+
+				//! Returns count of bytes allocated from system
+				size_t getAllocatedSize() const;
+
+				//! Returns count of system allocations made by arena
+				u32 getSystemAllocationCount() const;
+
+			private:
+
+				// Copy constructor and assignment operator deliberately
+				// defined but not implemented.
+				LinearArena(const LinearArena& other);
+				LinearArena& operator=(const LinearArena& other);
+
+			private:
+
+				struct SChunk;
+
+				//! Allocates chunk and links it after current one
+				SChunk* createChunk(size_t size);
+
+				//! Frees all chunks
+				void freeChunks();
+
+			private:
+
+				//! First chunk of list
+				SChunk* First;
+				//! Chunk where blocks are allocated now
+				SChunk* Current;
+
+				size_t ChunkSize;
+				size_t AllocatedSize;
+				u32 SystemAllocationCount;
+		};
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* LINEARARENA_H_ */
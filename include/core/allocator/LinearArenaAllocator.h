@@ -0,0 +1,91 @@
+/*
+ * LinearArenaAllocator.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef LINEARARENAALLOCATOR_H_
+#define LINEARARENAALLOCATOR_H_
+
+#include "core/allocator/irrAllocator.h"
+#include "core/allocator/LinearArena.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Allocator which takes memory from LinearArena.
+		/** Deallocation does nothing, memory is returned by arena reset or
+		 rewind. Objects allocated by it must not outlive that reset. Copies
+		 share arena, so array bound to arena is declared as
+		 array<T, threads::NullLock, LinearArenaAllocator<T> > values(arena); */
+		template<class T>
+		class LinearArenaAllocator: public irrAllocator<T>
+		{
+			public:
+
+				//! Constructor
+				LinearArenaAllocator(LinearArena& arena);
+
+				//! Destructor
+				virtual ~LinearArenaAllocator();
+
+				//! Returns arena of allocator
+				LinearArena& getArena() const;
+
+			protected:
+
+				virtual void* internalNew(size_t cnt);
+
+				virtual void internalDelete(void* ptr);
+
+				virtual void* internalRenew(void* ptr, size_t oldCnt, size_t cnt);
+
+			private:
+
+				LinearArena* Arena;
+		};
+
+		//! Constructor
+		template<typename T>
+		inline LinearArenaAllocator<T>::LinearArenaAllocator(LinearArena& arena) :
+				Arena(&arena)
+		{
+		}
+
+		//! Destructor
+		template<typename T>
+		inline LinearArenaAllocator<T>::~LinearArenaAllocator()
+		{
+		}
+
+		//! Returns arena of allocator
+		template<typename T>
+		inline LinearArena& LinearArenaAllocator<T>::getArena() const
+		{
+			return *Arena;
+		}
+
+		template<typename T>
+		inline void* LinearArenaAllocator<T>::internalNew(size_t cnt)
+		{
+			return Arena->allocate(cnt);
+		}
+
+		template<typename T>
+		inline void LinearArenaAllocator<T>::internalDelete(void*)
+		{
+		}
+
+		template<typename T>
+		inline void* LinearArenaAllocator<T>::internalRenew(void* ptr,
+				size_t oldCnt, size_t cnt)
+		{
+			return Arena->reallocate(ptr, oldCnt, cnt);
+		}
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* LINEARARENAALLOCATOR_H_ */
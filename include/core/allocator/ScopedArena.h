@@ -0,0 +1,69 @@
+/*
+ * ScopedArena.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SCOPEDARENA_H_
+#define SCOPEDARENA_H_
+
+#include "core/allocator/LinearArena.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Releases all blocks allocated from arena during lifetime of scope.
+		/** Scopes over one arena must be nested. */
+		class ScopedArena
+		{
+			public:
+
+				//! Constructor. Remembers position of arena.
+				ScopedArena(LinearArena& arena) :
+						Arena(arena), Marker(arena.getMarker())
+				{
+				}
+
+				//! Destructor. Rewinds arena to remembered position.
+				~ScopedArena()
+				{
+					Arena.rewind(Marker);
+				}
+
+				//! Allocates memory block from arena
+				void* allocate(size_t size, size_t alignment = 16)
+				{
+					return Arena.allocate(size, alignment);
+				}
+
+				//! Allocates objects from arena. Constructors are not called.
+				/** Blocks are aligned by lowest set bit of size of T, which is
+				 power of two and multiple of alignment of T, up to 16. */
+				template<class T>
+				T* allocate(u32 count)
+				{
+					const size_t alignment = sizeof(T) & (0 - sizeof(T));
+
+					return static_cast<T*>(Arena.allocate(count * sizeof(T),
+							alignment < 16 ? alignment : 16));
+				}
+
+			private:
+
+				// Copy constructor and assignment operator deliberately
+				// defined but not implemented.
+				ScopedArena(const ScopedArena& other);
+				ScopedArena& operator=(const ScopedArena& other);
+
+			private:
+
+				LinearArena& Arena;
+				SArenaMarker Marker;
+		};
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* SCOPEDARENA_H_ */
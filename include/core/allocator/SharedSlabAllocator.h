@@ -0,0 +1,121 @@
+/*
+ * SharedSlabAllocator.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SHAREDSLABALLOCATOR_H_
+#define SHAREDSLABALLOCATOR_H_
+
+#include "compileConfig.h"
+
+#include <stddef.h>
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Allocator of small blocks by size classes.
+		/** Blocks are carved from big spans. Every thread keeps own cache of free
+		 blocks per size class, so allocation and deallocation usually take no
+		 lock. Overfull caches return batches of blocks to central depot, from
+		 which other threads refill. Spans are never returned to system.
+		 Blocks bigger than MaxBlockSize, and all blocks when IRR_SLAB_ALLOCATOR
+		 is not defined, are taken from operator new. */
+		class SharedSlabAllocator
+		{
+			public:
+				//! Singleton realization
+				static SharedSlabAllocator& getInstance();
+
+			private:
+				//! Default constructor. Should use only one time.
+				SharedSlabAllocator();
+
+				//! Destructor. Should use only one time.
+				//! Keeps all memory, blocks may be freed by later static destructors.
+				virtual ~SharedSlabAllocator();
+
+				//! Copy constructor. Do not implement.
+				SharedSlabAllocator(const SharedSlabAllocator& root);
+
+				//! Override equal operator. Do not implement.
+				const SharedSlabAllocator& operator=(SharedSlabAllocator&);
+
+			public:
+				//! Step between size classes. Blocks are aligned by it.
+				static const u32 ClassStep = 16;
+
+				//! Biggest block served by slabs
+				static const u32 MaxBlockSize = 256;
+
+				//! Count of size classes
+				static const u32 ClassesCount = MaxBlockSize / ClassStep;
+
+				//! Count of blocks moved between thread cache and depot at once
+				static const u32 BatchSize = 64;
+
+				//! Size of span in bytes
+				static const u32 SpanSize = 65536;
+
+			public:
+				//! Allocates block of given size
+				void* allocate(size_t size);
+
+				//! Frees block. Size must be same as passed to allocate.
+				void deallocate(void* ptr, size_t size);
+
+				//! Returns all blocks cached by current thread to depot.
+				//! Called by irrgameThread when its callback returns. Other
+				//! threads must call it before exit, otherwise their cached
+				//! blocks are lost.
+				void flushThreadCache();
+
+				//! Returns count of spans taken from system
+				u32 getSpansCount() const;
+
+			private:
+				//! Free block, linked into lists
+				struct SBlock
+				{
+						SBlock* Next;
+				};
+
+				//! Free blocks of one thread
+				struct SThreadCache
+				{
+						SBlock* Blocks[ClassesCount];
+						u32 Counts[ClassesCount];
+				};
+
+				//! Returns free blocks cache of current thread
+				SThreadCache* getThreadCache();
+
+				//! Fills empty thread cache from depot or new span
+				void refill(SThreadCache* cache, u32 sizeClass);
+
+				//! Moves count first blocks of thread cache to depot
+				void release(SThreadCache* cache, u32 sizeClass, u32 count);
+
+				//! Acquires spin lock of depot of size class
+				void lockDepot(u32 sizeClass);
+
+				//! Releases spin lock of depot of size class
+				void unlockDepot(u32 sizeClass);
+
+			private:
+				//! Free blocks returned by threads
+				SBlock* Depot[ClassesCount];
+
+				//! Spin locks of depots
+				s32 DepotLocks[ClassesCount];
+
+				//! Count of spans taken from system
+				u32 SpansCount;
+		};
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* SHAREDSLABALLOCATOR_H_ */
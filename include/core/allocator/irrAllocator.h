@@ -11,6 +11,7 @@
 #include "compileConfig.h"
 
 #include <new>
+#include <stdlib.h>
 // necessary for older compilers
 #include <memory.h>
 namespace irrgame
@@ -18,6 +19,7 @@ namespace irrgame
 	namespace core
 	{
 		//! Very simple allocator implementation, containers using it can be used across dll boundaries
+		/** Subclasses which override internalNew must override internalRenew too. */
 		template<class T>
 		class irrAllocator
 		{
@@ -32,9 +34,21 @@ namespace irrgame
 				//! Deallocate memory for an array of objects
 				void deallocate(T* ptr);
 
+				//! Resize memory of an array of objects, keeping its content
+				/** Objects are moved bitwise, so use it only for trivially
+				 copyable types. Memory may be resized in place without copying.
+				 \param oldCnt: Count of objects allocated now
+				 \param cnt: New count of objects */
+				T* reallocate(T* ptr, size_t oldCnt, size_t cnt);
+
 				//! Construct an element
 				void construct(T* ptr, const T&e);
 
+#if __cplusplus >= 201103L
+				//! Construct an element by moving other one
+				void construct(T* ptr, T&& e);
+#endif
+
 				//! Destruct an element
 				void destruct(T* ptr);
 
@@ -44,6 +58,8 @@ namespace irrgame
 
 				virtual void internalDelete(void* ptr);
 
+				virtual void* internalRenew(void* ptr, size_t oldCnt, size_t cnt);
+
 		};
 
 		//! Destructor
@@ -66,6 +82,13 @@ namespace irrgame
 			internalDelete(ptr);
 		}
 
+		//! Resize memory of an array of objects, keeping its content
+		template<typename T>
+		inline T* irrAllocator<T>::reallocate(T* ptr, size_t oldCnt, size_t cnt)
+		{
+			return (T*) internalRenew(ptr, oldCnt * sizeof(T), cnt * sizeof(T));
+		}
+
 		//! Construct an element
 		template<typename T>
 		inline void irrAllocator<T>::construct(T* ptr, const T&e)
@@ -73,6 +96,15 @@ namespace irrgame
 			new ((void*) ptr) T(e);
 		}
 
+#if __cplusplus >= 201103L
+		//! Construct an element by moving other one
+		template<typename T>
+		inline void irrAllocator<T>::construct(T* ptr, T&& e)
+		{
+			new ((void*) ptr) T(static_cast<T&&>(e));
+		}
+#endif
+
 		//! Destruct an element
 		template<typename T>
 		inline void irrAllocator<T>::destruct(T* ptr)
@@ -83,13 +115,21 @@ namespace irrgame
 		template<typename T>
 		inline void* irrAllocator<T>::internalNew(size_t cnt)
 		{
-			return operator new(cnt);
+			return malloc(cnt);
 		}
 
 		template<typename T>
 		inline void irrAllocator<T>::internalDelete(void* ptr)
 		{
-			operator delete(ptr);
+			free(ptr);
+		}
+
+		template<typename T>
+		inline void* irrAllocator<T>::internalRenew(void* ptr,
+				size_t /* oldCnt */, size_t cnt)
+		{
+			// big blocks are remapped by system without copying
+			return realloc(ptr, cnt);
 		}
 
 	}  // namespace core
@@ -6,6 +6,7 @@
 #define __IRR_ALLOCATOR_H_INCLUDED__
 
 #include "compileConfig.h"
+#include "core/allocator/SharedSlabAllocator.h"
 #include <new>
 // necessary for older compilers
 #include <memory.h>
@@ -17,7 +18,9 @@ namespace irrgame
 
 		//! Fast allocator, only to be used in containers inside the same memory heap.
 		/** Containers using it are NOT able to be used it across dll boundaries. Use this
-		 when using in an internal class or function or when compiled into a static lib */
+		 when using in an internal class or function or when compiled into a static lib.
+		 Small blocks are taken from SharedSlabAllocator, so deallocate needs the
+		 count which was passed to allocate. */
 		template<class T>
 		class irrAllocatorFast
 		{
@@ -27,7 +30,8 @@ namespace irrgame
 				T* allocate(size_t cnt);
 
 				//! Deallocate memory for an array of objects
-				void deallocate(T* ptr);
+				//! \param cnt: Count of objects passed to allocate
+				void deallocate(T* ptr, size_t cnt);
 
 				//! Construct an element
 				void construct(T* ptr, const T&e);
@@ -40,14 +44,15 @@ namespace irrgame
 		template<typename T>
 		inline T* irrAllocatorFast<T>::allocate(size_t cnt)
 		{
-			return (T*) operator new(cnt * sizeof(T));
+			return (T*) SharedSlabAllocator::getInstance().allocate(
+					cnt * sizeof(T));
 		}
 
 		//! Deallocate memory for an array of objects
 		template<typename T>
-		inline void irrAllocatorFast<T>::deallocate(T* ptr)
+		inline void irrAllocatorFast<T>::deallocate(T* ptr, size_t cnt)
 		{
-			operator delete(ptr);
+			SharedSlabAllocator::getInstance().deallocate(ptr, cnt * sizeof(T));
 		}
 
 		//! Construct an element
@@ -8,7 +8,8 @@
 #ifndef ILEAFNODE_H_
 #define ILEAFNODE_H_
 
-#include "core/collections/list/list.h"
+#include "core/collections/smallarray.h"
+#include "core/collections/array.h"
 #include "core/engine/IReferenceCounted.h"
 
 namespace irrgame
@@ -17,13 +18,17 @@ namespace irrgame
 	{
 		//! Base class for object which may have children and parent. T must be derived by ILeafNode.
 		/** A leaf node is a node in the some hierarchical graph. Every leaf
-		 node may have children, which are also leaf nodes. */
+		 node may have children, which are also leaf nodes. Children are stored
+		 contiguously, first IRR_LEAF_NODE_INLINE_CHILDREN of them inside the node. */
 		template<class T>
 		class ILeafNode: public IReferenceCounted
 		{
 			public:
 				typedef ILeafNode<T> LeafNode;
 
+				//! Storage of children. Iterators are pointers to T*.
+				typedef smallarray<T*, IRR_LEAF_NODE_INLINE_CHILDREN> ChildrenArray;
+
 			public:
 				//! Default constructor
 				ILeafNode(T* parent);
@@ -52,21 +57,58 @@ namespace irrgame
 				/** If no other grab exists for this node, it will be deleted. */
 				virtual void remove();
 
-				//! Returns a const reference to the list of all children.
-				/** \return The list of all children of this node. */
-				const list<T*> getChildren() const;
+				//! Returns a const reference to all children. Nothing is copied.
+				/** \return Children of this node. Reference is valid while node
+				 exists, iterators are valid until children are changed. */
+				const ChildrenArray& getChildren() const;
+
+				//! Returns count of children
+				u32 getChildrenCount() const;
+
+				//! Returns child by index
+				T* getChild(u32 index) const;
+
+				//! Returns parent or 0 for root
+				T* getParent() const;
 
 				//! Changes the parent of the scene node.
 				/** \param newParent The new parent to be used. */
 				virtual void setParent(T* value);
 
+				//! Visits this node and all its descendants in depth-first order.
+				/** Parents are visited before their children, children in order of
+				 adding. Visitor is called as bool visitor(T* node), if it returns
+				 false children of node are skipped. Uses own stack instead of
+				 recursion. Hierarchy must not be changed while it is traversed. */
+				template<class TVisitor>
+				void traverse(TVisitor& visitor);
+
+				//! Appends this node and all its descendants to result in depth-first order.
+				/** Fill it once and iterate flat array many times, while
+				 hierarchy is not changed. */
+				void getSubtree(array<T*>& result);
+
 			protected:
 
 				//! Pointer to the parent
 				T* Parent;
 
-				//! List of all children of this node
-				list<T*> Children;
+				//! All children of this node
+				ChildrenArray Children;
+
+			private:
+
+				//! Visitor of getSubtree
+				struct SSubtreeCollector
+				{
+						array<T*>* Result;
+
+						bool operator()(T* node)
+						{
+							Result->pushBack(node);
+							return true;
+						}
+				};
 		};
 
 		//! Default constructor
@@ -108,27 +150,26 @@ namespace irrgame
 			IRR_ASSERT(child != 0);
 			IRR_ASSERT(child != this);
 
-			CIterator<T*> it = Children.begin();
+			const s32 index = Children.linearSearch(child);
 
-			for (; it != Children.end(); ++it)
-				if ((*it) == child)
-				{
-					(*it)->Parent = 0;
-					(*it)->drop();
-					Children.erase(it);
-				}
+			if (index < 0)
+				return;
+
+			// order of other children is kept
+			Children.erase((u32) index);
+
+			child->Parent = 0;
+			child->drop();
 		}
 
 		//! Removes all children of this scene node
 		template<class T>
 		inline void ILeafNode<T>::removeAll()
 		{
-			CIterator<T*> it = Children.begin();
-
-			for (; it != Children.end(); ++it)
+			for (u32 i = 0; i < Children.size(); ++i)
 			{
-				(*it)->Parent = 0;
-				(*it)->drop();
+				Children[i]->Parent = 0;
+				Children[i]->drop();
 			}
 
 			Children.clear();
@@ -142,13 +183,34 @@ namespace irrgame
 				Parent->removeChild(static_cast<T*>(this));
 		}
 
-		//! Returns a const reference to the list of all children.
+		//! Returns a const reference to all children. Nothing is copied.
 		template<class T>
-		inline const list<T*> ILeafNode<T>::getChildren() const
+		inline const typename ILeafNode<T>::ChildrenArray& ILeafNode<T>::getChildren() const
 		{
 			return Children;
 		}
 
+		//! Returns count of children
+		template<class T>
+		inline u32 ILeafNode<T>::getChildrenCount() const
+		{
+			return Children.size();
+		}
+
+		//! Returns child by index
+		template<class T>
+		inline T* ILeafNode<T>::getChild(u32 index) const
+		{
+			return Children[index];
+		}
+
+		//! Returns parent or 0 for root
+		template<class T>
+		inline T* ILeafNode<T>::getParent() const
+		{
+			return Parent;
+		}
+
 		//! Changes the parent of the scene node.
 		template<class T>
 		inline void ILeafNode<T>::setParent(T* value)
@@ -167,6 +229,42 @@ namespace irrgame
 			drop();
 		}
 
+		//! Visits this node and all its descendants in depth-first order.
+		template<class T>
+		template<class TVisitor>
+		inline void ILeafNode<T>::traverse(TVisitor& visitor)
+		{
+			// nodes which are not visited yet. Hierarchies up to this depth
+			// and width do not allocate.
+			smallarray<T*, 64> stack;
+			stack.pushBack(static_cast<T*>(this));
+
+			while (!stack.empty())
+			{
+				T* node = stack[stack.size() - 1];
+				stack.erase(stack.size() - 1);
+
+				if (!visitor(node))
+					continue;
+
+				const ChildrenArray& children = node->Children;
+
+				// last child is pushed first, so first child is visited first
+				for (u32 i = children.size(); i > 0; --i)
+					stack.pushBack(children[i - 1]);
+			}
+		}
+
+		//! Appends this node and all its descendants to result in depth-first order.
+		template<class T>
+		inline void ILeafNode<T>::getSubtree(array<T*>& result)
+		{
+			SSubtreeCollector collector;
+			collector.Result = &result;
+
+			traverse(collector);
+		}
+
 	}
 // namespace core
 }// namespace irrgame
@@ -0,0 +1,162 @@
+/*
+ * InternedString.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef INTERNEDSTRING_H_
+#define INTERNEDSTRING_H_
+
+#include "core/utils/hash.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! String stored once in SharedStringPool. Never freed.
+		struct SInternedStringEntry
+		{
+				//! FNV-1a hash of text
+				u32 Hash;
+
+				//! Length of text without terminating zero
+				u32 Length;
+
+				//! Zero terminated text. Entry is allocated with size of text.
+				c8 Text[1];
+		};
+
+		//! Handle of string stored once in SharedStringPool
+		/** Use it for names, which are compared much more often than created:
+		 attribute names, xml element names, resource names. Equal strings have
+		 same handle, so they are compared by pointer, and hash is computed only
+		 once when string is interned. Handle is size of pointer, text is valid
+		 until application exits. Interning takes lock of one of pool shards. */
+		class InternedString
+		{
+			public:
+
+				//! Default constructor. Empty string, does not touch pool.
+				InternedString();
+
+				//! Constructor. Interns str.
+				InternedString(const c8* str);
+
+				//! Constructor from entry of pool. Internal, used by pool.
+				explicit InternedString(const SInternedStringEntry* entry);
+
+				/*
+				 * Methods
+				 */
+
+				//! Returns zero terminated text
+				const c8* cStr() const;
+
+				//! Returns length of text
+				u32 size() const;
+
+				//! Returns True if string is empty
+				bool empty() const;
+
+				//! Returns hash of text, which is computed when string is interned
+				u32 getHash() const;
+
+				/*
+				 * Operators
+				 */
+
+				//! Interns str
+				InternedString& operator=(const c8* str);
+
+				//! Equal strings are same entry of pool
+				bool operator==(const InternedString& other) const;
+
+				bool operator!=(const InternedString& other) const;
+
+				//! Orders strings by address of entries. Order is stable while
+				//! application runs, but is not alphabetical.
+				bool operator<(const InternedString& other) const;
+
+			private:
+
+				const SInternedStringEntry* Entry;
+		};
+
+		//! Entry of empty string. Defined by SharedStringPool.
+		extern const SInternedStringEntry InternedEmptyString;
+
+		//! Default constructor. Empty string, does not touch pool.
+		inline InternedString::InternedString() :
+				Entry(&InternedEmptyString)
+		{
+		}
+
+		//! Constructor from entry of pool.
+		inline InternedString::InternedString(const SInternedStringEntry* entry) :
+				Entry(entry)
+		{
+		}
+
+		//! Returns zero terminated text
+		inline const c8* InternedString::cStr() const
+		{
+			return Entry->Text;
+		}
+
+		//! Returns length of text
+		inline u32 InternedString::size() const
+		{
+			return Entry->Length;
+		}
+
+		//! Returns True if string is empty
+		inline bool InternedString::empty() const
+		{
+			return Entry->Length == 0;
+		}
+
+		//! Returns hash of text
+		inline u32 InternedString::getHash() const
+		{
+			return Entry->Hash;
+		}
+
+		//! Interns str
+		inline InternedString& InternedString::operator=(const c8* str)
+		{
+			*this = InternedString(str);
+			return *this;
+		}
+
+		//! Equal strings are same entry of pool
+		inline bool InternedString::operator==(const InternedString& other) const
+		{
+			return Entry == other.Entry;
+		}
+
+		inline bool InternedString::operator!=(const InternedString& other) const
+		{
+			return Entry != other.Entry;
+		}
+
+		//! Orders strings by address of entries.
+		inline bool InternedString::operator<(const InternedString& other) const
+		{
+			return Entry < other.Entry;
+		}
+
+		//! Hash of interned strings is already computed
+		template<>
+		struct hash<InternedString>
+		{
+				u32 operator()(const InternedString& value) const
+				{
+					return value.getHash();
+				}
+		};
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* INTERNEDSTRING_H_ */
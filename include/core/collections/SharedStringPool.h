@@ -0,0 +1,124 @@
+/*
+ * SharedStringPool.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SHAREDSTRINGPOOL_H_
+#define SHAREDSTRINGPOOL_H_
+
+#include "core/collections/InternedString.h"
+#include "core/allocator/LinearArena.h"
+#include "threads/lock/MonitorLock.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Thread safe pool of interned strings.
+		/** Every distinct string is stored once in arena and is never freed, so
+		 InternedString handles stay valid until application exits. Pool is split
+		 into shards by hash, every shard has own lock, hash table and arena, so
+		 threads which load different resources rarely wait for each other.
+		 Lookups of interned strings do not take locks: tables are never changed
+		 in place except filling of empty slots, grown table is published as new one. */
+		class SharedStringPool
+		{
+			public:
+				//! Singleton realization
+				static SharedStringPool& getInstance();
+
+			private:
+				//! Default constructor. Should use only one time.
+				SharedStringPool();
+
+				//! Destructor. Should use only one time.
+				virtual ~SharedStringPool();
+
+				//! Copy constructor. Do not implement.
+				SharedStringPool(const SharedStringPool& root);
+
+				//! Override equal operator. Do not implement.
+				const SharedStringPool& operator=(SharedStringPool&);
+
+			public:
+				//! Count of independent shards, must be power of two
+				static const u32 ShardsCount = 16;
+
+				//! Size of arena chunk of shard in bytes
+				static const u32 ChunkSize = 4096;
+
+				//! Returns handle of str. Stores str if it was not interned yet.
+				InternedString intern(const c8* str);
+
+				//! Finds handle of str without storing it.
+				//! Use it for lookups, string which was never interned can't be a key.
+				//@ return - True if str was interned. Otherwise False.
+				bool find(const c8* str, InternedString& result);
+
+				//! Returns count of distinct strings
+				u32 getStringsCount() const;
+
+				//! Returns count of bytes used by entries and tables
+				size_t getUsedSize() const;
+
+			private:
+				//! Open addressing table of entries
+				struct STable
+				{
+						//! Count of slots minus one. Count of slots is power of two.
+						u32 Mask;
+
+						//! Entries, empty slot is 0. Allocated with count of slots.
+						const SInternedStringEntry* Slots[1];
+				};
+
+				//! Part of pool with own lock
+				struct SShard
+				{
+						SShard();
+
+						//! Serializes interning of new strings
+						threads::MonitorLock Lock;
+
+						//! Memory of entries and tables. Replaced tables are kept
+						//! in it, because other threads may still read them.
+						LinearArena Arena;
+
+						//! Current table. 0 until first string is interned.
+						STable* Table;
+
+						//! Count of entries
+						u32 Count;
+				};
+
+				//! Returns hash and length of str
+				u32 hashString(const c8* str, u32& length) const;
+
+				//! Returns shard of hash
+				SShard& getShard(u32 hash);
+
+				//! Finds entry in current table of shard without lock
+				const SInternedStringEntry* findEntry(const SShard& shard,
+						const c8* str, u32 length, u32 hash) const;
+
+				//! Finds entry in table
+				const SInternedStringEntry* findEntry(const STable* table,
+						const c8* str, u32 length, u32 hash) const;
+
+				//! Adds entry to table. Lock of shard must be taken.
+				void insertEntry(STable* table, const SInternedStringEntry* entry);
+
+				//! Creates table with doubled count of slots and publishes it.
+				//! Lock of shard must be taken.
+				void grow(SShard& shard);
+
+			private:
+				SShard Shards[ShardsCount];
+		};
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* SHAREDSTRINGPOOL_H_ */
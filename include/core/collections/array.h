@@ -11,22 +11,38 @@
 #include "core/allocator/EAllocStrategy.h"
 
 #include "core/math/SharedMath.h"
-#include "core/math/SharedHeapsort.h"
+#include "core/math/SharedIntrosort.h"
+#include "core/math/SharedMergesort.h"
+#include "core/math/SharedRadixsort.h"
 
-#include "threads/irrgameMonitor.h"
+#include "core/utils/typeTraits.h"
+
+#include "threads/lock/NullLock.h"
+#include "threads/lock/MonitorLock.h"
 
 #include <stdio.h>
+#include <string.h>
 
 namespace irrgame
 {
 	namespace core
 	{
-		class stringc;
+		template<class TLock>
+		class string;
+		typedef string<threads::NullLock> stringc;
 
 		//! Self reallocating template array (like stl vector) with additional features.
-		/** Some features are: Heap sorting, binary search methods, easier debugging.
+		/** Some features are: Fast sorting, binary search methods, easier debugging.
+		 Array is not synchronized by default. Use threads::MonitorLock as TLock
+		 for arrays which are shared between threads.
+		 Trivially copyable elements (see isTriviallyCopyable) are moved by memcpy
+		 and memmove, other elements are moved by C++11 move semantics if available.
+		 Memory is taken from TAlloc, for example LinearArenaAllocator binds
+		 array to arena. Copy and move constructors take allocator of other
+		 array, assignment keeps own allocator.
 		 */
-		template<class T>
+		template<class T, class TLock = threads::NullLock,
+				class TAlloc = irrAllocator<T> >
 		class array: public ICollection<T>
 		{
 			public:
@@ -73,8 +89,17 @@ namespace irrgame
 				/** \param startCount Amount of elements to pre-allocate. */
 				array(u32 startCount);
 
+				//! Constructs an empty array, which takes memory from allocator.
+				/** \param allocator: Allocator of elements, it is copied. */
+				explicit array(const TAlloc& allocator);
+
 				//! Copy constructor
-				array(const array<T>& other);
+				array(const array<T, TLock, TAlloc>& other);
+
+#if __cplusplus >= 201103L
+				//! Move constructor. Other array becomes empty.
+				array(array<T, TLock, TAlloc>&& other);
+#endif
 
 				//! Destructor.
 				/** Frees allocated memory, if setFreeWhenDestroyed was not set to
@@ -103,6 +128,13 @@ namespace irrgame
 				 \param index: Where position to insert the new element. */
 				void insert(const T& value, u32 index = 0);
 
+#if __cplusplus >= 201103L
+				//! Constructs element at back of array from given arguments.
+				/** \param args: Arguments passed to constructor of element. */
+				template<class ... TArgs>
+				void emplaceBack(TArgs&&... args);
+#endif
+
 				//! Clears the array and deletes all allocated memory.
 				void clear();
 
@@ -151,9 +183,11 @@ namespace irrgame
 				/** \return True if the array is empty false if not. */
 				bool empty() const;
 
-				//! Sorts the array using heapsort.
-				/** There is no additional memory waste and the algorithm performs
-				 O(n*log n) in worst case. */
+				//! Sorts the array.
+				/** Integers, floats and other types with radixKey are sorted by
+				 radix sort. Big arrays of other types are sorted by parallel merge
+				 sort (see IRR_PARALLEL_SORT_THRESHOLD), small ones by introsort.
+				 The algorithms perform O(n*log n) in worst case. */
 				void sort();
 
 				//! Performs a binary search for an element.
@@ -208,27 +242,30 @@ namespace irrgame
 				/** Afterwards this object will contain the content of the other object and the other
 				 object will contain the content of this object.
 				 \param other Swap content with this object	*/
-				void swap(array<T>& other);
+				void swap(array<T, TLock, TAlloc>& other);
 
 				/*
 				 * Operators
 				 */
 
 				//! Assignment operator
-				array<T>& operator=(const array<T>& other);
+				array<T, TLock, TAlloc>& operator=(const array<T, TLock, TAlloc>& other);
+
+#if __cplusplus >= 201103L
+				//! Move assignment operator. Other array becomes empty.
+				array<T, TLock, TAlloc>& operator=(array<T, TLock, TAlloc>&& other);
+#endif
 
 				//! Equality operator. Typename T must implement operator!=
-				bool operator==(const array<T>& other) const;
+				bool operator==(const array<T, TLock, TAlloc>& other) const;
 
 				//! Inequality operator
-				bool operator!=(const array<T>& other) const;
+				bool operator!=(const array<T, TLock, TAlloc>& other) const;
 
 			private:
 
-				//! Sorts the array using heapsort.
+				//! Sorts the array.
 				//! Uses internal without lockers
-				/** There is no additional memory waste and the algorithm performs
-				 O(n*log n) in worst case. */
 				void sortInternal();
 
 				//! Reallocates the array, make it bigger or smaller.
@@ -239,12 +276,21 @@ namespace irrgame
 				//! Clears the array and deletes all allocated memory.
 				//! Uses internal without lockers
 				void clearInternal();
+
+				//! Returns new allocated size for adding one element by strategy
+				u32 getGrowSize() const;
+
+				//! Moves elements to uninitialized memory and destructs sources
+				void relocate(T* destination, T* source, u32 count);
+
+				//! Destructs elements. Does nothing for trivially copyable types.
+				void destructRange(T* first, u32 count);
 			private:
 				T* Data;
 				u32 Allocated;
 				u32 Used;
-				irrAllocator<T> Allocator;
-				threads::irrgameMonitor* Monitor;
+				TAlloc Allocator;
+				TLock Lock;
 				EAllocStrategy Strategy :4;
 				bool FreeWhenDestroyed :1;
 				bool IsSorted :1;
@@ -255,85 +301,85 @@ namespace irrgame
 		 */
 
 		//! Adds an element at back of array.
-		template<class T>
-		inline void array<T>::pushBack(const T& value)
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::pushBack(const T& value)
 		{
 			insert(value, Used);
 		}
 
 		//! Adds an element at the front of the array.
-		template<class T>
-		inline void array<T>::pushFront(const T& value)
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::pushFront(const T& value)
 		{
 			insert(value);
 		}
 
-		template<class T>
-		inline u32 array<T>::size() const
+		template<class T, class TLock, class TAlloc>
+		inline u32 array<T, TLock, TAlloc>::size() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			u32 result = Used;
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
-		template<class T>
-		inline T& array<T>::getLast()
+		template<class T, class TLock, class TAlloc>
+		inline T& array<T, TLock, TAlloc>::getLast()
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			// access violation
 			IRR_ASSERT(Used > 0)
 
 			T& result = Data[Used - 1];
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
-		template<class T>
-		inline const T& array<T>::getLast() const
+		template<class T, class TLock, class TAlloc>
+		inline const T& array<T, TLock, TAlloc>::getLast() const
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			// access violation
 			IRR_ASSERT(Used > 0)
 
 			const T& result = Data[Used - 1];
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
-		template<class T>
-		inline T& array<T>::operator [](u32 index)
+		template<class T, class TLock, class TAlloc>
+		inline T& array<T, TLock, TAlloc>::operator [](u32 index)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			// access violation
 			IRR_ASSERT(index >= 0 && index <= Used)
 
 			T& result = Data[index];
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
-		template<class T>
-		inline const T& array<T>::operator [](u32 index) const
+		template<class T, class TLock, class TAlloc>
+		inline const T& array<T, TLock, TAlloc>::operator [](u32 index) const
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			// access violation
 			IRR_ASSERT(index >= 0 && index <= Used)
 
 			const T& result = Data[index];
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
@@ -343,74 +389,94 @@ namespace irrgame
 		 */
 
 		//! Default constructor for empty array.
-		template<class T>
-		inline array<T>::array() :
-				Data(0), Allocated(0), Used(0), Monitor(0), Strategy(AS_DOUBLE), FreeWhenDestroyed(
+		template<class T, class TLock, class TAlloc>
+		inline array<T, TLock, TAlloc>::array() :
+				Data(0), Allocated(0), Used(0), Strategy(AS_DOUBLE), FreeWhenDestroyed(
 						true), IsSorted(true)
 		{
-			Monitor = threads::createIrrgameMonitor();
 		}
 
 		//! Constructs an array and allocates an initial chunk of memory.
-		template<class T>
-		inline array<T>::array(u32 startCount) :
-				Data(0), Allocated(0), Used(0), Monitor(0), Strategy(AS_DOUBLE), FreeWhenDestroyed(
+		template<class T, class TLock, class TAlloc>
+		inline array<T, TLock, TAlloc>::array(u32 startCount) :
+				Data(0), Allocated(0), Used(0), Strategy(AS_DOUBLE), FreeWhenDestroyed(
 						true), IsSorted(true)
 		{
-			Monitor = threads::createIrrgameMonitor();
 			reallocate(startCount);
 		}
 
+		//! Constructs an empty array, which takes memory from allocator.
+		template<class T, class TLock, class TAlloc>
+		inline array<T, TLock, TAlloc>::array(const TAlloc& allocator) :
+				Data(0), Allocated(0), Used(0), Allocator(allocator),
+				Strategy(AS_DOUBLE), FreeWhenDestroyed(true), IsSorted(true)
+		{
+		}
+
 		//! Copy constructor
-		template<class T>
-		inline array<T>::array(const array<T>& other) :
-				Data(0), Monitor(0)
+		template<class T, class TLock, class TAlloc>
+		inline array<T, TLock, TAlloc>::array(const array<T, TLock, TAlloc>& other) :
+				Data(0), Allocator(other.Allocator)
 		{
-			Monitor = threads::createIrrgameMonitor();
 			*this = other;
 		}
 
+#if __cplusplus >= 201103L
+		//! Move constructor. Other array becomes empty.
+		template<class T, class TLock, class TAlloc>
+		inline array<T, TLock, TAlloc>::array(array<T, TLock, TAlloc>&& other) :
+				Data(0), Allocated(0), Used(0), Allocator(other.Allocator),
+				Strategy(AS_DOUBLE), FreeWhenDestroyed(true), IsSorted(true)
+		{
+			*this = static_cast<array<T, TLock, TAlloc>&&>(other);
+		}
+#endif
+
 		//! Destructor.
-		template<class T>
-		inline array<T>::~array()
+		template<class T, class TLock, class TAlloc>
+		inline array<T, TLock, TAlloc>::~array()
 		{
 			clear();
-
-			if (Monitor)
-				Monitor->drop();
 		}
 
 		//! Reallocates the array, make it bigger or smaller.
-		template<class T>
-		inline void array<T>::reallocate(u32 newSize)
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::reallocate(u32 newSize)
 		{
-			Monitor->enter();
+			Lock.enter();
 			reallocateInternal(newSize);
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Reallocates the array, make it bigger or smaller.
 		//! Uses internal without lockers
-		template<class T>
-		inline void array<T>::reallocateInternal(u32 newSize)
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::reallocateInternal(u32 newSize)
 		{
+			if (isTriviallyCopyable<T>::value && FreeWhenDestroyed)
+			{
+				// memory is resized in place when possible
+				Data = Allocator.reallocate(Data, Allocated, newSize);
+				Allocated = newSize;
+
+				if (Allocated < Used)
+					Used = Allocated;
+
+				return;
+			}
+
 			T* oldData = Data;
 
 			Data = Allocator.allocate(newSize); //new T[newSize];
 			Allocated = newSize;
 
-			// copy old data
-			s32 end = Used < newSize ? Used : newSize;
+			// move old data
+			const u32 end = Used < newSize ? Used : newSize;
 
-			for (s32 i = 0; i < end; ++i)
-			{
-				// data[i] = oldData[i];
-				Allocator.construct(&Data[i], oldData[i]);
-			}
+			relocate(Data, oldData, end);
 
-			// destruct old data
-			for (u32 j = 0; j < Used; ++j)
-				Allocator.destruct(&oldData[j]);
+			// destruct old data which does not fit
+			destructRange(oldData + end, Used - end);
 
 			if (Allocated < Used)
 				Used = Allocated;
@@ -419,19 +485,19 @@ namespace irrgame
 		}
 
 		//! set a new allocation strategy
-		template<class T>
-		inline void array<T>::setAllocStrategy(EAllocStrategy value)
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::setAllocStrategy(EAllocStrategy value)
 		{
-			Monitor->enter();
+			Lock.enter();
 			Strategy = value;
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Insert item into array at specified position.
-		template<class T>
-		inline void array<T>::insert(const T& value, u32 index)
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::insert(const T& value, u32 index)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			// access violation
 			IRR_ASSERT(index >= 0 && index <= Used)
@@ -441,57 +507,58 @@ namespace irrgame
 				// this doesn't work if the element is in the same
 				// array. So we'll copy the element first to be sure
 				// we'll get no data corruption
-				const T e(value);
+				T e(value);
 
 				// increase data block
-				u32 newAlloc;
-				switch (Strategy)
-				{
-					case AS_DOUBLE:
-					{
-						newAlloc = Used + 1
-								+ (Allocated < 500 ?
-										(Allocated < 5 ? 5 : Used) : Used >> 2);
-						break;
-					}
-					default:
-					case AS_SAFE:
-					{
-						newAlloc = Used + 1;
-						break;
-					}
-				}
+				const u32 newAlloc = getGrowSize();
 
-				reallocateInternal(newAlloc);
-
-				// move array content and construct new element
-				// first move end one up
-				for (u32 i = Used; i > index; --i)
+				if (isTriviallyCopyable<T>::value && FreeWhenDestroyed)
 				{
-					if (i < Used)
-						Allocator.destruct(&Data[i]);
-					Allocator.construct(&Data[i], Data[i - 1]); // data[i] = data[i-1];
+					reallocateInternal(newAlloc);
+
+					if (Used > index)
+						memmove((void*) (Data + index + 1),
+								(const void*) (Data + index),
+								(Used - index) * sizeof(T));
 				}
-				// then add new element
-				if (Used > index)
+				else
 				{
-					Allocator.destruct(&Data[index]);
+					T* oldData = Data;
+
+					Data = Allocator.allocate(newAlloc);
+					Allocated = newAlloc;
+
+					// move array content around new element
+					relocate(Data, oldData, index);
+					relocate(Data + index + 1, oldData + index, Used - index);
+
+					Allocator.deallocate(oldData);
 				}
 
-				Allocator.construct(&Data[index], e); // data[index] = e;
+				Allocator.construct(&Data[index], core::move(e)); // data[index] = e;
 			}
 			else
 			{
 				// element inserted not at end
-				if (Used > index)
+				if (Used > index && isTriviallyCopyable<T>::value)
+				{
+					// value may be element of this array
+					const T e(value);
+
+					memmove((void*) (Data + index + 1), (const void*) (Data + index),
+							(Used - index) * sizeof(T));
+
+					Allocator.construct(&Data[index], e);
+				}
+				else if (Used > index)
 				{
 					// create one new element at the end
-					Allocator.construct(&Data[Used], Data[Used - 1]);
+					Allocator.construct(&Data[Used], core::move(Data[Used - 1]));
 
 					// move the rest of the array content
 					for (u32 i = Used - 1; i > index; --i)
 					{
-						Data[i] = Data[i - 1];
+						Data[i] = core::move(Data[i - 1]);
 					}
 					// insert the new element
 					Data[index] = value;
@@ -506,27 +573,55 @@ namespace irrgame
 			IsSorted = false;
 			++Used;
 
-			Monitor->exit();
+			Lock.exit();
+		}
+
+#if __cplusplus >= 201103L
+		//! Constructs element at back of array from given arguments.
+		template<class T, class TLock, class TAlloc>
+		template<class ... TArgs>
+		inline void array<T, TLock, TAlloc>::emplaceBack(TArgs&&... args)
+		{
+			Lock.enter();
+
+			if (Used + 1 > Allocated)
+			{
+				// arguments may refer to elements of this array
+				T e(static_cast<TArgs&&>(args)...);
+
+				reallocateInternal(getGrowSize());
+
+				Allocator.construct(&Data[Used], static_cast<T&&>(e));
+			}
+			else
+			{
+				new ((void*) &Data[Used]) T(static_cast<TArgs&&>(args)...);
+			}
+
+			IsSorted = false;
+			++Used;
+
+			Lock.exit();
 		}
+#endif
 
 		//! Clears the array and deletes all allocated memory.
-		template<class T>
-		inline void array<T>::clear()
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::clear()
 		{
-			Monitor->enter();
+			Lock.enter();
 			clearInternal();
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Clears the array and deletes all allocated memory.
 		//! Uses internal without lockers
-		template<class T>
-		inline void array<T>::clearInternal()
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::clearInternal()
 		{
 			if (FreeWhenDestroyed)
 			{
-				for (u32 i = 0; i < Used; ++i)
-					Allocator.destruct(&Data[i]);
+				destructRange(Data, Used);
 
 				Allocator.deallocate(Data); // delete [] data;
 			}
@@ -537,12 +632,64 @@ namespace irrgame
 			IsSorted = true;
 		}
 
+		//! Returns new allocated size for adding one element by strategy
+		template<class T, class TLock, class TAlloc>
+		inline u32 array<T, TLock, TAlloc>::getGrowSize() const
+		{
+			switch (Strategy)
+			{
+				case AS_DOUBLE:
+				{
+					return Used + 1
+							+ (Allocated < 500 ?
+									(Allocated < 5 ? 5 : Used) : Used >> 2);
+				}
+				default:
+				case AS_SAFE:
+				{
+					return Used + 1;
+				}
+			}
+		}
+
+		//! Moves elements to uninitialized memory and destructs sources
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::relocate(T* destination, T* source,
+				u32 count)
+		{
+			if (isTriviallyCopyable<T>::value)
+			{
+				if (count)
+					memcpy((void*) destination, (const void*) source,
+							count * sizeof(T));
+
+				return;
+			}
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				Allocator.construct(&destination[i], core::move(source[i]));
+				Allocator.destruct(&source[i]);
+			}
+		}
+
+		//! Destructs elements. Does nothing for trivially copyable types.
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::destructRange(T* first, u32 count)
+		{
+			if (isTriviallyCopyable<T>::value)
+				return;
+
+			for (u32 i = 0; i < count; ++i)
+				Allocator.destruct(&first[i]);
+		}
+
 		//! Sets pointer to new array, using this as new workspace.
-		template<class T>
-		inline void array<T>::setPointer(T* value, u32 size, bool isSorted,
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::setPointer(T* value, u32 size, bool isSorted,
 				bool freeWhenDestroyed)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			clearInternal();
 
@@ -552,86 +699,93 @@ namespace irrgame
 			IsSorted = isSorted;
 			FreeWhenDestroyed = freeWhenDestroyed;
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Sets if the array should delete the memory it uses upon destruction.
-		template<class T>
-		inline void array<T>::setFreeWhenDestroyed(bool value)
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::setFreeWhenDestroyed(bool value)
 		{
-			Monitor->enter();
+			Lock.enter();
 			FreeWhenDestroyed = value;
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Sets the size of the array and allocates new elements if necessary.
-		template<class T>
-		inline void array<T>::setUsed(u32 value)
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::setUsed(u32 value)
 		{
-			Monitor->enter();
+			Lock.enter();
 			if (Allocated < value)
 				reallocateInternal(value);
 
 			Used = value;
-			Monitor->exit();
+			Lock.exit();
 		}
 
-		template<class T>
-		inline T* array<T>::pointer()
+		template<class T, class TLock, class TAlloc>
+		inline T* array<T, TLock, TAlloc>::pointer()
 		{
-			Monitor->enter();
+			Lock.enter();
 			T* result = Data;
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
-		template<class T>
-		inline const T* array<T>::constPointer() const
+		template<class T, class TLock, class TAlloc>
+		inline const T* array<T, TLock, TAlloc>::constPointer() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			const T* result = Data;
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
-		template<class T>
-		inline u32 array<T>::allocatedSize() const
+		template<class T, class TLock, class TAlloc>
+		inline u32 array<T, TLock, TAlloc>::allocatedSize() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			u32 result = Allocated;
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
-		template<class T>
-		inline bool array<T>::empty() const
+		template<class T, class TLock, class TAlloc>
+		inline bool array<T, TLock, TAlloc>::empty() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			bool result = Used == 0;
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
-		//! Sorts the array using heapsort.
-		template<class T>
-		inline void array<T>::sort()
+		//! Sorts the array.
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::sort()
 		{
-			Monitor->enter();
+			Lock.enter();
 			sortInternal();
-			Monitor->exit();
+			Lock.exit();
 		}
 
-		//! Sorts the array using heapsort.
-		template<class T>
-		inline void array<T>::sortInternal()
+		//! Sorts the array.
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::sortInternal()
 		{
 			if (!IsSorted && Used > 1)
 			{
-				SharedHeapsort<T>::getInstance().sort(Data, Used);
+				// radix sort returns false for types without radix key
+				if (!radixSortSelector<T>::sort(Data, Used))
+				{
+					if (Used >= IRR_PARALLEL_SORT_THRESHOLD)
+						SharedMergesort<T>::getInstance().sort(Data, Used);
+					else
+						SharedIntrosort<T>::getInstance().sort(Data, Used);
+				}
 			}
 
 			IsSorted = true;
@@ -639,16 +793,16 @@ namespace irrgame
 
 		//! Performs a binary search for an element.
 		//! Use only for non const arrays. For const arrays use linearSearch
-		template<class T>
-		inline s32 array<T>::binarySearchFirst(const T& value)
+		template<class T, class TLock, class TAlloc>
+		inline s32 array<T, TLock, TAlloc>::binarySearchFirst(const T& value)
 		{
 			s32 result = IrrNotFound;
 
-			Monitor->enter();
+			Lock.enter();
 
 			if (!Used)
 			{
-				Monitor->exit();
+				Lock.exit();
 				return result;
 			}
 
@@ -677,19 +831,19 @@ namespace irrgame
 			if (!(value < Data[m]) && !(Data[m] < value))
 				result = m;
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Performs a binary search for an element.
 		//! Use only for non const arrays. For const arrays use linearSearch
-		template<class T>
-		inline s32 array<T>::binarySearchLast(const T& value)
+		template<class T, class TLock, class TAlloc>
+		inline s32 array<T, TLock, TAlloc>::binarySearchLast(const T& value)
 		{
 			s32 result = IrrNotFound;
 
-			Monitor->enter();
+			Lock.enter();
 
 			sortInternal();
 
@@ -697,7 +851,7 @@ namespace irrgame
 
 			if (index == result)
 			{
-				Monitor->exit();
+				Lock.exit();
 				return result;
 			}
 
@@ -718,18 +872,18 @@ namespace irrgame
 				result += 1;
 			}
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Finds an element in linear time, which is very slow.
-		template<class T>
-		inline s32 array<T>::linearSearch(const T& value) const
+		template<class T, class TLock, class TAlloc>
+		inline s32 array<T, TLock, TAlloc>::linearSearch(const T& value) const
 		{
 			s32 result = IrrNotFound;
 
-			Monitor->enter();
+			Lock.enter();
 
 			for (u32 i = 0; i < Used; ++i)
 				if (value == Data[i])
@@ -738,18 +892,18 @@ namespace irrgame
 					break;
 				}
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Finds an element in linear time, which is very slow.
-		template<class T>
-		inline s32 array<T>::linearReverseSearch(const T& value) const
+		template<class T, class TLock, class TAlloc>
+		inline s32 array<T, TLock, TAlloc>::linearReverseSearch(const T& value) const
 		{
 			s32 result = IrrNotFound;
 
-			Monitor->enter();
+			Lock.enter();
 
 			for (s32 i = Used - 1; i >= 0; --i)
 				if (Data[i] == value)
@@ -758,85 +912,87 @@ namespace irrgame
 					break;
 				}
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Erases an element from the array.
-		template<class T>
-		inline void array<T>::erase(u32 index)
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::erase(u32 index)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			// access violation
 			IRR_ASSERT(index >= 0 && index <= Used)
 
-			for (u32 i = index + 1; i < Used; ++i)
+			if (isTriviallyCopyable<T>::value)
 			{
-				Allocator.destruct(&Data[i - 1]);
-				Allocator.construct(&Data[i - 1], Data[i]); // data[i-1] = data[i];
+				memmove((void*) (Data + index), (const void*) (Data + index + 1),
+						(Used - index - 1) * sizeof(T));
 			}
+			else
+			{
+				for (u32 i = index + 1; i < Used; ++i)
+					Data[i - 1] = core::move(Data[i]); // data[i-1] = data[i];
 
-			Allocator.destruct(&Data[Used - 1]);
+				Allocator.destruct(&Data[Used - 1]);
+			}
 
 			--Used;
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Erases some elements from the array.
-		template<class T>
-		inline void array<T>::erase(u32 index, s32 count)
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::erase(u32 index, s32 count)
 		{
-			Monitor->enter();
+			Lock.enter();
 
-			IRR_ASSERT(index >= Used || count < 1);
+			IRR_ASSERT(index < Used && count > 0);
 
 			if (index + count > Used)
 				count = Used - index;
 
-			u32 i;
-			for (i = index; i < index + count; ++i)
-				Allocator.destruct(&Data[i]);
-
-			for (i = index + count; i < Used; ++i)
+			if (isTriviallyCopyable<T>::value)
 			{
-				if (i > index + count)
-					Allocator.destruct(&Data[i - count]);
-
-				Allocator.construct(&Data[i - count], Data[i]); // data[i-count] = data[i];
+				memmove((void*) (Data + index), (const void*) (Data + index + count),
+						(Used - index - count) * sizeof(T));
+			}
+			else
+			{
+				for (u32 i = index + count; i < Used; ++i)
+					Data[i - count] = core::move(Data[i]); // data[i-count] = data[i];
 
-				if (i >= Used - count)
-					Allocator.destruct(&Data[i]);
+				destructRange(Data + Used - count, count);
 			}
 
 			Used -= count;
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Sets if the array is sorted
-		template<class T>
-		inline void array<T>::setSorted(bool isSorted)
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::setSorted(bool isSorted)
 		{
-			Monitor->enter();
+			Lock.enter();
 			IsSorted = isSorted;
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Swap the content of this array container with the content of another array
-		template<class T>
-		inline void array<T>::swap(array<T>& other)
+		template<class T, class TLock, class TAlloc>
+		inline void array<T, TLock, TAlloc>::swap(array<T, TLock, TAlloc>& other)
 		{
 			// handle self swap
 			if (this == &other)
 				return;
 
-			other.Monitor->enter();
-			Monitor->enter();
+			other.Lock.enter();
+			Lock.enter();
 
-			SharedMath::getInstance().swap(Monitor, other.Monitor);
 			SharedMath::getInstance().swap(Data, other.Data);
 			SharedMath::getInstance().swap(Allocated, other.Allocated);
 			SharedMath::getInstance().swap(Used, other.Used);
@@ -854,8 +1010,8 @@ namespace irrgame
 			IsSorted = other.IsSorted;
 			other.IsSorted = helperIsSorted;
 
-			Monitor->exit();
-			other.Monitor->exit();
+			Lock.exit();
+			other.Lock.exit();
 		}
 
 		/*
@@ -863,15 +1019,15 @@ namespace irrgame
 		 */
 
 		//! Assignment operator
-		template<class T>
-		inline array<T>& array<T>::operator=(const array<T>& other)
+		template<class T, class TLock, class TAlloc>
+		inline array<T, TLock, TAlloc>& array<T, TLock, TAlloc>::operator=(const array<T, TLock, TAlloc>& other)
 		{
 			//handle self-assignment
 			if (this == &other)
 				return *this;
 
-			Monitor->enter();
-			other.Monitor->enter();
+			Lock.enter();
+			other.Lock.enter();
 
 			Strategy = other.Strategy;
 
@@ -889,17 +1045,63 @@ namespace irrgame
 			IsSorted = other.IsSorted;
 			Allocated = other.Allocated;
 
-			for (u32 i = 0; i < other.Used; ++i)
-				Allocator.construct(&Data[i], other.Data[i]); // data[i] = other.data[i];
+			if (isTriviallyCopyable<T>::value)
+			{
+				if (other.Used)
+					memcpy((void*) Data, (const void*) other.Data,
+							other.Used * sizeof(T));
+			}
+			else
+			{
+				for (u32 i = 0; i < other.Used; ++i)
+					Allocator.construct(&Data[i], other.Data[i]); // data[i] = other.data[i];
+			}
+
+			Lock.exit();
+			other.Lock.exit();
+
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		//! Move assignment operator. Other array becomes empty.
+		template<class T, class TLock, class TAlloc>
+		inline array<T, TLock, TAlloc>& array<T, TLock, TAlloc>::operator=(
+				array<T, TLock, TAlloc>&& other)
+		{
+			//handle self-assignment
+			if (this == &other)
+				return *this;
+
+			Lock.enter();
+			other.Lock.enter();
+
+			clearInternal();
+
+			// memory is released by the same allocator used for allocation
+			Allocator = other.Allocator;
+			Data = other.Data;
+			Allocated = other.Allocated;
+			Used = other.Used;
+			Strategy = other.Strategy;
+			FreeWhenDestroyed = other.FreeWhenDestroyed;
+			IsSorted = other.IsSorted;
+
+			other.Data = 0;
+			other.Allocated = 0;
+			other.Used = 0;
+			other.FreeWhenDestroyed = true;
+			other.IsSorted = true;
 
-			Monitor->exit();
-			other.Monitor->exit();
+			Lock.exit();
+			other.Lock.exit();
 
 			return *this;
 		}
+#endif
 
-		template<class T>
-		inline bool array<T>::operator ==(const array<T>& other) const
+		template<class T, class TLock, class TAlloc>
+		inline bool array<T, TLock, TAlloc>::operator ==(const array<T, TLock, TAlloc>& other) const
 		{
 			bool result = true;
 
@@ -907,8 +1109,8 @@ namespace irrgame
 			if (this == &other)
 				return result;
 
-			Monitor->enter();
-			other.Monitor->enter();
+			Lock.enter();
+			other.Lock.enter();
 
 			if (Used != other.Used)
 			{
@@ -924,14 +1126,14 @@ namespace irrgame
 					}
 			}
 
-			Monitor->exit();
-			other.Monitor->exit();
+			Lock.exit();
+			other.Lock.exit();
 
 			return result;
 		}
 
-		template<class T>
-		inline bool array<T>::operator !=(const array<T>& other) const
+		template<class T, class TLock, class TAlloc>
+		inline bool array<T, TLock, TAlloc>::operator !=(const array<T, TLock, TAlloc>& other) const
 		{
 			return !(*this == other);
 		}
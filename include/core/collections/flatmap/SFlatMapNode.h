@@ -0,0 +1,84 @@
+/*
+ * SFlatMapNode.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SFLATMAPNODE_H_
+#define SFLATMAPNODE_H_
+
+#include "compileConfig.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+
+		//! Key-value pair stored in sorted array of flatmap
+		template<class KType, class VType>
+		class SFlatMapNode
+		{
+			public:
+
+				SFlatMapNode(const KType& k, const VType& v);
+
+				void setValue(const VType& v);
+
+				const KType& getKey() const;
+
+				VType& getValue();
+				const VType& getValue() const;
+
+				//! Nodes are ordered by keys
+				bool operator<(const SFlatMapNode<KType, VType>& other) const;
+
+			private:
+
+				KType Key;
+				VType Value;
+		};
+
+		template<class KType, class VType>
+		inline SFlatMapNode<KType, VType>::SFlatMapNode(const KType& k,
+				const VType& v) :
+				Key(k), Value(v)
+		{
+		}
+
+		template<class KType, class VType>
+		inline void SFlatMapNode<KType, VType>::setValue(const VType& v)
+		{
+			Value = v;
+		}
+
+		template<class KType, class VType>
+		inline const KType& SFlatMapNode<KType, VType>::getKey() const
+		{
+			return Key;
+		}
+
+		template<class KType, class VType>
+		inline VType& SFlatMapNode<KType, VType>::getValue()
+		{
+			return Value;
+		}
+
+		template<class KType, class VType>
+		inline const VType& SFlatMapNode<KType, VType>::getValue() const
+		{
+			return Value;
+		}
+
+		//! Nodes are ordered by keys
+		template<class KType, class VType>
+		inline bool SFlatMapNode<KType, VType>::operator<(
+				const SFlatMapNode<KType, VType>& other) const
+		{
+			return Key < other.Key;
+		}
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* SFLATMAPNODE_H_ */
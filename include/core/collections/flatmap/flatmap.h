@@ -0,0 +1,440 @@
+/*
+ * flatmap.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef FLATMAP_H_
+#define FLATMAP_H_
+
+#include "core/collections/flatmap/SFlatMapNode.h"
+#include "core/collections/array.h"
+
+#include "threads/lock/NullLock.h"
+#include "threads/lock/MonitorLock.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+
+		//! Associative array stored as array of nodes sorted by keys
+		/** Use it for tables which are built once and read many times. Lookup
+		 is branchless binary search over contiguous memory, insertion and removal
+		 move following nodes. Fill big tables by append, nodes are sorted once
+		 by build. Call build at end of filling, the first lookup after append
+		 builds flatmap too, but it modifies nodes from const method and is
+		 not safe for concurrent readers. Only operator< of keys is used.
+		 Pointers to nodes are valid until next insertion, removal or build.
+		 Flatmap is not synchronized by default. Use threads::MonitorLock as TLock
+		 for flatmaps which are shared between threads. */
+		template<class KType, class VType, class TLock = threads::NullLock>
+		class flatmap
+		{
+			public:
+
+				typedef SFlatMapNode<KType, VType> Node;
+
+			public:
+
+				//! Default constructor. Does not allocate.
+				flatmap();
+
+				//! Destructor
+				virtual ~flatmap();
+
+				/*
+				 * Methods
+				 */
+
+				//! Inserts a new node or replaces value of existing one
+				/** \param key: the index for this value
+				 \param value: the value to insert */
+				void insert(const KType& key, const VType& value);
+
+				//! Adds node without keeping order of nodes
+				/** Nodes are sorted by next call of build, lookup or modification.
+				 Of nodes with equal keys only the one appended first is kept.
+				 \param key: the index for this value
+				 \param value: the value to insert */
+				void append(const KType& key, const VType& value);
+
+				//! Sorts nodes added by append
+				/** It is called by first lookup after append. Call it before
+				 sharing flatmap without lock between threads. */
+				void build();
+
+				//! Removes a node with the specified key.
+				//! \return Returns false if node couldn't be found.
+				bool remove(const KType& key);
+
+				//! Clear the entire flatmap and free memory
+				void clear();
+
+				//! Is the flatmap empty?
+				//! \return Returns true if empty, false if not
+				bool empty() const;
+
+				//! Search for a node with the specified key.
+				//! \param keyToFind: The key to find
+				//! \return Returns 0 if node couldn't be found.
+				Node* find(const KType& keyToFind) const;
+
+				//! Returns the number of nodes in the flatmap.
+				u32 size() const;
+
+				//! Reserves memory for count nodes
+				void reallocate(u32 count);
+
+				//! Returns node by index. Nodes are ordered by keys.
+				Node& getNode(u32 index);
+
+				//! Swap the content of this flatmap with the content of another flatmap
+				/** \param other Swap content with this object */
+				void swap(flatmap<KType, VType, TLock>& other);
+
+				/*
+				 * Operators
+				 */
+
+				//! operator [] for access to elements
+				/** Inserts default constructed value if key is absent,
+				 for example myMap["key"] = 5; */
+				VType& operator[](const KType& key);
+
+			private:
+
+				/*
+				 * Disabled methods
+				 */
+
+				// Copy constructor and assignment operator deliberately
+				// defined but not implemented. The flatmap should never be
+				// copied, pass along references to it instead.
+				explicit flatmap(const flatmap& src);
+				flatmap& operator=(const flatmap& src);
+
+			private:
+
+				//! Orders nodes by key, then by position in array
+				struct SNodeOrder
+				{
+						Node* Pointer;
+
+						bool operator<(const SNodeOrder& other) const
+						{
+							if (Pointer->getKey() < other.Pointer->getKey())
+								return true;
+
+							if (other.Pointer->getKey() < Pointer->getKey())
+								return false;
+
+							return Pointer < other.Pointer;
+						}
+				};
+
+			private:
+
+				//! Sorts appended nodes and removes duplicates if needed
+				void buildInternal() const;
+
+				//! Returns first node which key is not less than key, or end of nodes
+				Node* lowerBound(const KType& key) const;
+
+				//! Returns true if node found by lowerBound has key
+				bool isKeyAt(const Node* node, const KType& key) const;
+
+			private:
+
+				//! Nodes sorted by keys. Appended nodes are not sorted until build.
+				mutable array<Node> Nodes;
+
+				//! True if nodes were appended after last build
+				mutable bool IsDirty;
+
+				TLock Lock;
+		};
+
+		//! Default constructor. Does not allocate.
+		template<class KType, class VType, class TLock>
+		inline flatmap<KType, VType, TLock>::flatmap() :
+				IsDirty(false)
+		{
+		}
+
+		//! Destructor
+		template<class KType, class VType, class TLock>
+		inline flatmap<KType, VType, TLock>::~flatmap()
+		{
+		}
+
+		//! Inserts a new node or replaces value of existing one
+		template<class KType, class VType, class TLock>
+		inline void flatmap<KType, VType, TLock>::insert(const KType& key,
+				const VType& value)
+		{
+			Lock.enter();
+
+			buildInternal();
+
+			Node* node = lowerBound(key);
+
+			if (isKeyAt(node, key))
+				node->setValue(value);
+			else
+				Nodes.insert(Node(key, value), (u32) (node - Nodes.pointer()));
+
+			Lock.exit();
+		}
+
+		//! Adds node without keeping order of nodes
+		template<class KType, class VType, class TLock>
+		inline void flatmap<KType, VType, TLock>::append(const KType& key,
+				const VType& value)
+		{
+			Lock.enter();
+
+			Nodes.pushBack(Node(key, value));
+			IsDirty = true;
+
+			Lock.exit();
+		}
+
+		//! Sorts nodes added by append
+		template<class KType, class VType, class TLock>
+		inline void flatmap<KType, VType, TLock>::build()
+		{
+			Lock.enter();
+			buildInternal();
+			Lock.exit();
+		}
+
+		//! Removes a node with the specified key.
+		template<class KType, class VType, class TLock>
+		inline bool flatmap<KType, VType, TLock>::remove(const KType& key)
+		{
+			Lock.enter();
+
+			buildInternal();
+
+			Node* node = lowerBound(key);
+			const bool result = isKeyAt(node, key);
+
+			if (result)
+				Nodes.erase((u32) (node - Nodes.pointer()));
+
+			Lock.exit();
+
+			return result;
+		}
+
+		//! Clear the entire flatmap and free memory
+		template<class KType, class VType, class TLock>
+		inline void flatmap<KType, VType, TLock>::clear()
+		{
+			Lock.enter();
+
+			Nodes.clear();
+			IsDirty = false;
+
+			Lock.exit();
+		}
+
+		//! Is the flatmap empty?
+		template<class KType, class VType, class TLock>
+		inline bool flatmap<KType, VType, TLock>::empty() const
+		{
+			Lock.enter();
+			bool result = Nodes.empty();
+			Lock.exit();
+
+			return result;
+		}
+
+		//! Search for a node with the specified key.
+		template<class KType, class VType, class TLock>
+		inline SFlatMapNode<KType, VType>* flatmap<KType, VType, TLock>::find(
+				const KType& keyToFind) const
+		{
+			Lock.enter();
+
+			buildInternal();
+
+			Node* result = lowerBound(keyToFind);
+
+			if (!isKeyAt(result, keyToFind))
+				result = 0;
+
+			Lock.exit();
+
+			return result;
+		}
+
+		//! Returns the number of nodes in the flatmap.
+		template<class KType, class VType, class TLock>
+		inline u32 flatmap<KType, VType, TLock>::size() const
+		{
+			Lock.enter();
+
+			buildInternal();
+			u32 result = Nodes.size();
+
+			Lock.exit();
+
+			return result;
+		}
+
+		//! Reserves memory for count nodes
+		template<class KType, class VType, class TLock>
+		inline void flatmap<KType, VType, TLock>::reallocate(u32 count)
+		{
+			Lock.enter();
+
+			if (count > Nodes.allocatedSize())
+				Nodes.reallocate(count);
+
+			Lock.exit();
+		}
+
+		//! Returns node by index. Nodes are ordered by keys.
+		template<class KType, class VType, class TLock>
+		inline SFlatMapNode<KType, VType>& flatmap<KType, VType, TLock>::getNode(
+				u32 index)
+		{
+			Lock.enter();
+
+			buildInternal();
+			Node& result = Nodes[index];
+
+			Lock.exit();
+
+			return result;
+		}
+
+		//! Swap the content of this flatmap with the content of another flatmap
+		template<class KType, class VType, class TLock>
+		inline void flatmap<KType, VType, TLock>::swap(
+				flatmap<KType, VType, TLock>& other)
+		{
+			// handle self swap
+			if (this == &other)
+				return;
+
+			other.Lock.enter();
+			Lock.enter();
+
+			Nodes.swap(other.Nodes);
+			SharedMath::getInstance().swap(IsDirty, other.IsDirty);
+
+			Lock.exit();
+			other.Lock.exit();
+		}
+
+		//! operator [] for access to elements
+		template<class KType, class VType, class TLock>
+		inline VType& flatmap<KType, VType, TLock>::operator[](const KType& key)
+		{
+			Lock.enter();
+
+			buildInternal();
+
+			Node* node = lowerBound(key);
+			const u32 index = (u32) (node - Nodes.pointer());
+
+			if (!isKeyAt(node, key))
+				Nodes.insert(Node(key, VType()), index);
+
+			VType& result = Nodes.pointer()[index].getValue();
+
+			Lock.exit();
+
+			return result;
+		}
+
+		//------------------------------
+		// Private funcs
+		//------------------------------
+
+		//! Sorts appended nodes and removes duplicates if needed
+		template<class KType, class VType, class TLock>
+		inline void flatmap<KType, VType, TLock>::buildInternal() const
+		{
+			if (!IsDirty)
+				return;
+
+			IsDirty = false;
+
+			const u32 count = Nodes.size();
+			Node* nodes = Nodes.pointer();
+
+			// array sort is not stable, so equal keys are ordered by position
+			array<SNodeOrder> order(count);
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				SNodeOrder entry;
+				entry.Pointer = nodes + i;
+				order.pushBack(entry);
+			}
+
+			order.sort();
+
+			// keep node which was appended first from each run of equal keys
+			array<Node> sorted(count);
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				Node* node = order[i].Pointer;
+
+				// previous node of run may be moved, so compare with kept one
+				if (i && !(sorted.getLast().getKey() < node->getKey()))
+					continue;
+
+#if __cplusplus >= 201103L
+				sorted.emplaceBack(core::move(*node));
+#else
+				sorted.pushBack(*node);
+#endif
+			}
+
+			sorted.setSorted(true);
+			Nodes.swap(sorted);
+		}
+
+		//! Returns first node which key is not less than key, or end of nodes
+		template<class KType, class VType, class TLock>
+		inline SFlatMapNode<KType, VType>* flatmap<KType, VType, TLock>::lowerBound(
+				const KType& key) const
+		{
+			Node* base = Nodes.pointer();
+			u32 count = Nodes.size();
+
+			if (!count)
+				return base;
+
+			// halves are chosen by conditional move, there is no branch to mispredict
+			while (count > 1)
+			{
+				const u32 half = count >> 1;
+
+				base = base[half].getKey() < key ? base + half : base;
+				count -= half;
+			}
+
+			return base->getKey() < key ? base + 1 : base;
+		}
+
+		//! Returns true if node found by lowerBound has key
+		template<class KType, class VType, class TLock>
+		inline bool flatmap<KType, VType, TLock>::isKeyAt(const Node* node,
+				const KType& key) const
+		{
+			return node != Nodes.pointer() + Nodes.size()
+					&& !(key < node->getKey());
+		}
+
+	} // end namespace core
+} // end namespace irrgame
+
+#endif /* FLATMAP_H_ */
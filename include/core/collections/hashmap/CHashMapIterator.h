@@ -0,0 +1,137 @@
+/*
+ * CHashMapIterator.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef CHASHMAPITERATOR_H_
+#define CHASHMAPITERATOR_H_
+
+#include "core/collections/hashmap/SHashMapNode.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Iterator over occupied slots of hashmap. Order of nodes is undefined.
+		/** Iterator becomes invalid after insertion or removal. */
+		template<class KType, class VType>
+		class CHashMapIterator
+		{
+			public:
+
+				typedef SHashMapNode<KType, VType> Node;
+
+			public:
+
+				/*
+				 * Constructors
+				 */
+
+				//! Default constructor
+				CHashMapIterator();
+
+				//! Constructor
+				CHashMapIterator(Node* nodes, const u32* hashes, u32 capacity);
+
+				/*
+				 * Methods
+				 */
+
+				void reset();
+
+				bool atEnd() const;
+
+				Node* getNode();
+
+				/*
+				 * Operators
+				 */
+
+				void operator++(s32);
+
+				Node* operator ->();
+				Node& operator*();
+
+			private:
+
+				//! Moves to next occupied slot starting from index
+				void skipEmpty(u32 index);
+
+			private:
+
+				Node* Nodes;
+				const u32* Hashes;
+				u32 Capacity;
+				u32 Index;
+		};
+
+		//! Default constructor
+		template<class KType, class VType>
+		inline CHashMapIterator<KType, VType>::CHashMapIterator() :
+				Nodes(0), Hashes(0), Capacity(0), Index(0)
+		{
+		}
+
+		//! Constructor
+		template<class KType, class VType>
+		inline CHashMapIterator<KType, VType>::CHashMapIterator(Node* nodes,
+				const u32* hashes, u32 capacity) :
+				Nodes(nodes), Hashes(hashes), Capacity(capacity), Index(0)
+		{
+			reset();
+		}
+
+		template<class KType, class VType>
+		inline void CHashMapIterator<KType, VType>::reset()
+		{
+			skipEmpty(0);
+		}
+
+		template<class KType, class VType>
+		inline bool CHashMapIterator<KType, VType>::atEnd() const
+		{
+			return Index >= Capacity;
+		}
+
+		template<class KType, class VType>
+		inline SHashMapNode<KType, VType>* CHashMapIterator<KType, VType>::getNode()
+		{
+			return atEnd() ? 0 : Nodes + Index;
+		}
+
+		template<class KType, class VType>
+		inline void CHashMapIterator<KType, VType>::operator++(s32)
+		{
+			skipEmpty(Index + 1);
+		}
+
+		template<class KType, class VType>
+		inline SHashMapNode<KType, VType>* CHashMapIterator<KType, VType>::operator ->()
+		{
+			return getNode();
+		}
+
+		template<class KType, class VType>
+		inline SHashMapNode<KType, VType>& CHashMapIterator<KType, VType>::operator*()
+		{
+			IRR_ASSERT(!atEnd());
+
+			return Nodes[Index];
+		}
+
+		//! Moves to next occupied slot starting from index
+		template<class KType, class VType>
+		inline void CHashMapIterator<KType, VType>::skipEmpty(u32 index)
+		{
+			Index = index;
+
+			while (Index < Capacity && !Hashes[Index])
+				++Index;
+		}
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* CHASHMAPITERATOR_H_ */
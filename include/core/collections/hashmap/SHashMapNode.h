@@ -0,0 +1,73 @@
+/*
+ * SHashMapNode.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SHASHMAPNODE_H_
+#define SHASHMAPNODE_H_
+
+#include "compileConfig.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+
+		//! Key-value pair stored in hashmap slot
+		template<class KType, class VType>
+		class SHashMapNode
+		{
+			public:
+
+				SHashMapNode(const KType& k, const VType& v);
+
+				void setValue(const VType& v);
+
+				const KType& getKey() const;
+
+				VType& getValue();
+				const VType& getValue() const;
+
+			private:
+
+				KType Key;
+				VType Value;
+		};
+
+		template<class KType, class VType>
+		inline SHashMapNode<KType, VType>::SHashMapNode(const KType& k,
+				const VType& v) :
+				Key(k), Value(v)
+		{
+		}
+
+		template<class KType, class VType>
+		inline void SHashMapNode<KType, VType>::setValue(const VType& v)
+		{
+			Value = v;
+		}
+
+		template<class KType, class VType>
+		inline const KType& SHashMapNode<KType, VType>::getKey() const
+		{
+			return Key;
+		}
+
+		template<class KType, class VType>
+		inline VType& SHashMapNode<KType, VType>::getValue()
+		{
+			return Value;
+		}
+
+		template<class KType, class VType>
+		inline const VType& SHashMapNode<KType, VType>::getValue() const
+		{
+			return Value;
+		}
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* SHASHMAPNODE_H_ */
@@ -0,0 +1,506 @@
+/*
+ * hashmap.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef HASHMAP_H_
+#define HASHMAP_H_
+
+#include "core/collections/hashmap/SHashMapNode.h"
+#include "core/collections/hashmap/CHashMapIterator.h"
+
+#include "core/allocator/irrAllocator.h"
+#include "core/math/SharedMath.h"
+#include "core/utils/hash.h"
+
+#include "threads/lock/NullLock.h"
+#include "threads/lock/MonitorLock.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+
+		//! Unordered associative array using open addressing with Robin Hood probing
+		/** Nodes are stored in one flat table, so lookups touch contiguous memory
+		 and insertion does not allocate until table grows. Use it instead of map
+		 when keys do not need ordering. Pointers to nodes are valid until next
+		 insertion or removal.
+		 Hashmap is not synchronized by default. Use threads::MonitorLock as TLock
+		 for hashmaps which are shared between threads. */
+		template<class KType, class VType, class TLock = threads::NullLock,
+				class THash = hash<KType> >
+		class hashmap
+		{
+			public:
+
+				typedef SHashMapNode<KType, VType> Node;
+				typedef CHashMapIterator<KType, VType> Iterator;
+
+			public:
+
+				//! Default constructor. Does not allocate.
+				hashmap();
+
+				//! Destructor
+				virtual ~hashmap();
+
+				/*
+				 * Methods
+				 */
+
+				//! Inserts a new node or replaces value of existing one
+				/** \param key: the index for this value
+				 \param value: the value to insert */
+				void insert(const KType& key, const VType& value);
+
+				//! Removes a node with the specified key.
+				//! \return Returns false if node couldn't be found.
+				bool remove(const KType& key);
+
+				//! Clear the entire hashmap and free memory
+				void clear();
+
+				//! Is the hashmap empty?
+				//! \return Returns true if empty, false if not
+				bool empty() const;
+
+				//! Search for a node with the specified key.
+				//! \param keyToFind: The key to find
+				//! \return Returns 0 if node couldn't be found.
+				Node* find(const KType& keyToFind) const;
+
+				//! Returns the number of nodes in the hashmap.
+				u32 size() const;
+
+				//! Makes table big enough to hold count nodes without growing
+				void reallocate(u32 count);
+
+				//! Swap the content of this hashmap with the content of another hashmap
+				/** \param other Swap content with this object */
+				void swap(hashmap<KType, VType, TLock, THash>& other);
+
+				/*
+				 * Iterators
+				 */
+
+				//! Returns an iterator over all nodes in undefined order
+				Iterator getIterator();
+
+				/*
+				 * Operators
+				 */
+
+				//! operator [] for access to elements
+				/** Inserts default constructed value if key is absent,
+				 for example myMap["key"] = 5; */
+				VType& operator[](const KType& key);
+
+			private:
+
+				/*
+				 * Disabled methods
+				 */
+
+				// Copy constructor and assignment operator deliberately
+				// defined but not implemented. The hashmap should never be
+				// copied, pass along references to it instead.
+				explicit hashmap(const hashmap& src);
+				hashmap& operator=(const hashmap& src);
+
+			private:
+
+				//! Returns hash of key. Zero is reserved for empty slots.
+				u32 getHash(const KType& key) const;
+
+				//! Returns how far is slot from desired slot of hash
+				u32 getDistance(u32 hash, u32 index) const;
+
+				//! Returns index of node with key, or -1
+				s32 findInternal(const KType& key, u32 hash) const;
+
+				//! Inserts absent key, table must have free slot
+				//! \return Returns index of inserted node
+				u32 insertInternal(const KType& key, const VType& value, u32 hash);
+
+				//! Removes node by index, shifting following nodes back
+				void removeInternal(u32 index);
+
+				//! Grows table if one more node exceeds load factor
+				void growIfNeeded();
+
+				//! Moves all nodes to table of new capacity
+				void rehash(u32 newCapacity);
+
+				//! Destructs all nodes and frees table
+				void clearInternal();
+
+			private:
+
+				//! Minimal size of allocated table
+				static const u32 MinCapacity = 16;
+
+				//! Table of nodes, valid where Hashes is not zero
+				Node* Nodes;
+				//! Hashes of nodes, zero for empty slots
+				u32* Hashes;
+				//! Number of slots in table, zero or power of two
+				u32 Capacity;
+				//! Number of nodes in table
+				u32 Size;
+
+				irrAllocator<Node> Allocator;
+				irrAllocator<u32> HashAllocator;
+				THash Hasher;
+				TLock Lock;
+		};
+
+		//! Default constructor. Does not allocate.
+		template<class KType, class VType, class TLock, class THash>
+		inline hashmap<KType, VType, TLock, THash>::hashmap() :
+				Nodes(0), Hashes(0), Capacity(0), Size(0)
+		{
+		}
+
+		//! Destructor
+		template<class KType, class VType, class TLock, class THash>
+		inline hashmap<KType, VType, TLock, THash>::~hashmap()
+		{
+			clearInternal();
+		}
+
+		//! Inserts a new node or replaces value of existing one
+		template<class KType, class VType, class TLock, class THash>
+		inline void hashmap<KType, VType, TLock, THash>::insert(const KType& key,
+				const VType& value)
+		{
+			Lock.enter();
+
+			const u32 hash = getHash(key);
+			const s32 index = findInternal(key, hash);
+
+			if (index < 0)
+			{
+				growIfNeeded();
+				insertInternal(key, value, hash);
+			}
+			else
+			{
+				Nodes[index].setValue(value);
+			}
+
+			Lock.exit();
+		}
+
+		//! Removes a node with the specified key.
+		template<class KType, class VType, class TLock, class THash>
+		inline bool hashmap<KType, VType, TLock, THash>::remove(const KType& key)
+		{
+			Lock.enter();
+
+			const s32 index = findInternal(key, getHash(key));
+
+			if (index >= 0)
+				removeInternal(index);
+
+			Lock.exit();
+
+			return index >= 0;
+		}
+
+		//! Clear the entire hashmap and free memory
+		template<class KType, class VType, class TLock, class THash>
+		inline void hashmap<KType, VType, TLock, THash>::clear()
+		{
+			Lock.enter();
+			clearInternal();
+			Lock.exit();
+		}
+
+		//! Is the hashmap empty?
+		template<class KType, class VType, class TLock, class THash>
+		inline bool hashmap<KType, VType, TLock, THash>::empty() const
+		{
+			Lock.enter();
+			bool result = Size == 0;
+			Lock.exit();
+
+			return result;
+		}
+
+		//! Search for a node with the specified key.
+		template<class KType, class VType, class TLock, class THash>
+		inline SHashMapNode<KType, VType>* hashmap<KType, VType, TLock, THash>::find(
+				const KType& keyToFind) const
+		{
+			Lock.enter();
+
+			const s32 index = findInternal(keyToFind, getHash(keyToFind));
+			Node* result = index < 0 ? 0 : Nodes + index;
+
+			Lock.exit();
+
+			return result;
+		}
+
+		//! Returns the number of nodes in the hashmap.
+		template<class KType, class VType, class TLock, class THash>
+		inline u32 hashmap<KType, VType, TLock, THash>::size() const
+		{
+			Lock.enter();
+			u32 result = Size;
+			Lock.exit();
+
+			return result;
+		}
+
+		//! Makes table big enough to hold count nodes without growing
+		template<class KType, class VType, class TLock, class THash>
+		inline void hashmap<KType, VType, TLock, THash>::reallocate(u32 count)
+		{
+			Lock.enter();
+
+			u32 newCapacity = MinCapacity;
+
+			// load factor is kept at most 7/8
+			while (newCapacity - (newCapacity >> 3) < count)
+				newCapacity <<= 1;
+
+			if (newCapacity > Capacity)
+				rehash(newCapacity);
+
+			Lock.exit();
+		}
+
+		//! Swap the content of this hashmap with the content of another hashmap
+		template<class KType, class VType, class TLock, class THash>
+		inline void hashmap<KType, VType, TLock, THash>::swap(
+				hashmap<KType, VType, TLock, THash>& other)
+		{
+			// handle self swap
+			if (this == &other)
+				return;
+
+			other.Lock.enter();
+			Lock.enter();
+
+			SharedMath::getInstance().swap(Nodes, other.Nodes);
+			SharedMath::getInstance().swap(Hashes, other.Hashes);
+			SharedMath::getInstance().swap(Capacity, other.Capacity);
+			SharedMath::getInstance().swap(Size, other.Size);
+
+			Lock.exit();
+			other.Lock.exit();
+		}
+
+		//! Returns an iterator over all nodes in undefined order
+		template<class KType, class VType, class TLock, class THash>
+		inline CHashMapIterator<KType, VType> hashmap<KType, VType, TLock, THash>::getIterator()
+		{
+			Lock.enter();
+			Iterator result(Nodes, Hashes, Capacity);
+			Lock.exit();
+
+			return result;
+		}
+
+		//! operator [] for access to elements
+		template<class KType, class VType, class TLock, class THash>
+		inline VType& hashmap<KType, VType, TLock, THash>::operator[](
+				const KType& key)
+		{
+			Lock.enter();
+
+			const u32 hash = getHash(key);
+			s32 index = findInternal(key, hash);
+
+			if (index < 0)
+			{
+				growIfNeeded();
+				index = insertInternal(key, VType(), hash);
+			}
+
+			VType& result = Nodes[index].getValue();
+
+			Lock.exit();
+
+			return result;
+		}
+
+		//------------------------------
+		// Private funcs
+		//------------------------------
+
+		//! Returns hash of key. Zero is reserved for empty slots.
+		template<class KType, class VType, class TLock, class THash>
+		inline u32 hashmap<KType, VType, TLock, THash>::getHash(
+				const KType& key) const
+		{
+			// high bit is never used for slot index of reasonable table
+			return Hasher(key) | 0x80000000u;
+		}
+
+		//! Returns how far is slot from desired slot of hash
+		template<class KType, class VType, class TLock, class THash>
+		inline u32 hashmap<KType, VType, TLock, THash>::getDistance(u32 hash,
+				u32 index) const
+		{
+			return (index - hash) & (Capacity - 1);
+		}
+
+		//! Returns index of node with key, or -1
+		template<class KType, class VType, class TLock, class THash>
+		inline s32 hashmap<KType, VType, TLock, THash>::findInternal(
+				const KType& key, u32 hash) const
+		{
+			if (!Size)
+				return -1;
+
+			const u32 mask = Capacity - 1;
+			u32 index = hash & mask;
+
+			for (u32 distance = 0;; ++distance)
+			{
+				const u32 stored = Hashes[index];
+
+				// Robin Hood invariant: key would have displaced poorer node
+				if (!stored || getDistance(stored, index) < distance)
+					return -1;
+
+				if (stored == hash && Nodes[index].getKey() == key)
+					return index;
+
+				index = (index + 1) & mask;
+			}
+		}
+
+		//! Inserts absent key, table must have free slot
+		template<class KType, class VType, class TLock, class THash>
+		inline u32 hashmap<KType, VType, TLock, THash>::insertInternal(
+				const KType& key, const VType& value, u32 hash)
+		{
+			const u32 mask = Capacity - 1;
+			u32 index = hash & mask;
+			u32 distance = 0;
+
+			// inserted node stays in slot where it first displaced other one
+			s32 result = -1;
+
+			Node carried(key, value);
+
+			while (Hashes[index])
+			{
+				const u32 storedDistance = getDistance(Hashes[index], index);
+
+				// take slot from node which is closer to its desired slot
+				if (storedDistance < distance)
+				{
+					Node tmp(Nodes[index]);
+					Nodes[index] = carried;
+					carried = tmp;
+
+					SharedMath::getInstance().swap(hash, Hashes[index]);
+
+					if (result < 0)
+						result = index;
+
+					distance = storedDistance;
+				}
+
+				index = (index + 1) & mask;
+				++distance;
+			}
+
+			Allocator.construct(Nodes + index, carried);
+			Hashes[index] = hash;
+			++Size;
+
+			return result < 0 ? index : result;
+		}
+
+		//! Removes node by index, shifting following nodes back
+		template<class KType, class VType, class TLock, class THash>
+		inline void hashmap<KType, VType, TLock, THash>::removeInternal(u32 index)
+		{
+			const u32 mask = Capacity - 1;
+			u32 next = (index + 1) & mask;
+
+			// no tombstones: nodes displaced by removed one move closer to home
+			while (Hashes[next] && getDistance(Hashes[next], next) != 0)
+			{
+				Nodes[index] = Nodes[next];
+				Hashes[index] = Hashes[next];
+
+				index = next;
+				next = (next + 1) & mask;
+			}
+
+			Allocator.destruct(Nodes + index);
+			Hashes[index] = 0;
+			--Size;
+		}
+
+		//! Grows table if one more node exceeds load factor
+		template<class KType, class VType, class TLock, class THash>
+		inline void hashmap<KType, VType, TLock, THash>::growIfNeeded()
+		{
+			if (Size + 1 > Capacity - (Capacity >> 3))
+				rehash(Capacity ? Capacity << 1 : MinCapacity);
+		}
+
+		//! Moves all nodes to table of new capacity
+		template<class KType, class VType, class TLock, class THash>
+		inline void hashmap<KType, VType, TLock, THash>::rehash(u32 newCapacity)
+		{
+			Node* oldNodes = Nodes;
+			u32* oldHashes = Hashes;
+			const u32 oldCapacity = Capacity;
+
+			Nodes = Allocator.allocate(newCapacity);
+			Hashes = HashAllocator.allocate(newCapacity);
+			Capacity = newCapacity;
+			Size = 0;
+
+			for (u32 i = 0; i < newCapacity; ++i)
+				Hashes[i] = 0;
+
+			for (u32 i = 0; i < oldCapacity; ++i)
+			{
+				if (!oldHashes[i])
+					continue;
+
+				insertInternal(oldNodes[i].getKey(), oldNodes[i].getValue(),
+						oldHashes[i]);
+
+				Allocator.destruct(oldNodes + i);
+			}
+
+			Allocator.deallocate(oldNodes);
+			HashAllocator.deallocate(oldHashes);
+		}
+
+		//! Destructs all nodes and frees table
+		template<class KType, class VType, class TLock, class THash>
+		inline void hashmap<KType, VType, TLock, THash>::clearInternal()
+		{
+			for (u32 i = 0; i < Capacity; ++i)
+			{
+				if (Hashes[i])
+					Allocator.destruct(Nodes + i);
+			}
+
+			Allocator.deallocate(Nodes);
+			HashAllocator.deallocate(Hashes);
+
+			Nodes = 0;
+			Hashes = 0;
+			Capacity = 0;
+			Size = 0;
+		}
+
+	} // end namespace core
+} // end namespace irrgame
+
+#endif /* HASHMAP_H_ */
@@ -14,7 +14,7 @@ namespace irrgame
 {
 	namespace core
 	{
-		template<class T>
+		template<class T, class TLock>
 		class list;
 
 		template<class T>
@@ -10,19 +10,24 @@
 
 #include "core/collections/ICollection.h"
 
-#include "core/allocator/irrAllocator.h"
+#include "core/allocator/irrAllocatorFast.h"
 #include "core/math/SharedMath.h"
-#include "threads/irrgameMonitor.h"
+#include "threads/lock/NullLock.h"
+#include "threads/lock/MonitorLock.h"
 
 namespace irrgame
 {
 	namespace core
 	{
 
-		class stringc;
+		template<class TLock>
+		class string;
+		typedef string<threads::NullLock> stringc;
 
 		//! Doubly linked list template.
-		template<class T>
+		/** List is not synchronized by default. Use threads::MonitorLock as TLock
+		 for lists which are shared between threads. */
+		template<class T, class TLock = threads::NullLock>
 		class list: public ICollection<T>
 		{
 			public:
@@ -73,7 +78,7 @@ namespace irrgame
 				list();
 
 				//! Copy constructor.
-				list(const list<T>& other);
+				list(const list<T, TLock>& other);
 
 				//! Destructor
 				virtual ~list();
@@ -83,7 +88,7 @@ namespace irrgame
 				 */
 
 				//! Assignment operator
-				void operator=(const list<T>& other);
+				void operator=(const list<T, TLock>& other);
 
 				/*
 				 * Methods
@@ -125,7 +130,7 @@ namespace irrgame
 				 object will contain the content of this object. Iterators will afterwards be valid for
 				 the swapped object.
 				 \param other Swap content with this object	*/
-				void swap(list<T>& other);
+				void swap(list<T, TLock>& other);
 
 				//! Gets iterator of first node.
 				/** \return A list iterator pointing to the beginning of the list. */
@@ -162,8 +167,8 @@ namespace irrgame
 				SKListNode<T>* First;
 				SKListNode<T>* Last;
 				u32 Size;
-				irrAllocator<SKListNode<T> > Allocator;
-				threads::irrgameMonitor* Monitor;
+				irrAllocatorFast<SKListNode<T> > Allocator;
+				TLock Lock;
 		};
 
 		/*
@@ -171,10 +176,10 @@ namespace irrgame
 		 */
 
 		//! Adds an element at the end of the list.
-		template<class T>
-		inline void list<T>::pushBack(const T& element)
+		template<class T, class TLock>
+		inline void list<T, TLock>::pushBack(const T& element)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			SKListNode<T>* node = Allocator.allocate(1);
 			Allocator.construct(node, element);
@@ -195,14 +200,14 @@ namespace irrgame
 
 			Last = node;
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Adds an element at the begin of the list.
-		template<class T>
-		inline void list<T>::pushFront(const T& element)
+		template<class T, class TLock>
+		inline void list<T, TLock>::pushFront(const T& element)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			SKListNode<T>* node = Allocator.allocate(1);
 			Allocator.construct(node, element);
@@ -221,50 +226,50 @@ namespace irrgame
 				First = node;
 			}
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Returns amount of elements in list.
-		template<class T>
-		inline u32 list<T>::size() const
+		template<class T, class TLock>
+		inline u32 list<T, TLock>::size() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			u32 result = Size;
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Gets last element
-		template<class T>
-		inline T& list<T>::getLast()
+		template<class T, class TLock>
+		inline T& list<T, TLock>::getLast()
 		{
-			Monitor->enter();
+			Lock.enter();
 			T& result = Last->Element;
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Returns last element of collection
-		template<class T>
-		inline const T& list<T>::getLast() const
+		template<class T, class TLock>
+		inline const T& list<T, TLock>::getLast() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			const T& result = Last->Element;
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 
 		}
 
 		//! Direct access operator
-		template<class T>
-		inline T& list<T>::operator[](u32 index)
+		template<class T, class TLock>
+		inline T& list<T, TLock>::operator[](u32 index)
 		{
 			IRR_ASSERT(index < Size);
 
-			Monitor->enter();
+			Lock.enter();
 
 			SKListNode<T>* resultNode = Last;
 			for (u32 i = Size; i != index; --i)
@@ -274,18 +279,18 @@ namespace irrgame
 
 			T& result = resultNode->Element;
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Direct const access operator
-		template<class T>
-		inline const T& list<T>::operator[](u32 index) const
+		template<class T, class TLock>
+		inline const T& list<T, TLock>::operator[](u32 index) const
 		{
 			IRR_ASSERT(index < Size);
 
-			Monitor->enter();
+			Lock.enter();
 
 			SKListNode<T>* resultNode = Last;
 			for (u32 i = Size; i != index; --i)
@@ -295,7 +300,7 @@ namespace irrgame
 
 			const T& result = resultNode->Element;
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
@@ -305,40 +310,35 @@ namespace irrgame
 		 */
 
 		//! Default constructor for empty list.
-		template<class T>
-		inline list<T>::list() :
-				First(0), Last(0), Size(0), Monitor(0)
+		template<class T, class TLock>
+		inline list<T, TLock>::list() :
+				First(0), Last(0), Size(0)
 		{
-			Monitor = irrgame::threads::createIrrgameMonitor();
 		}
 
 		//! Copy constructor.
-		template<class T>
-		inline list<T>::list(const list<T>& other) :
-				First(0), Last(0), Size(0), Monitor(0)
+		template<class T, class TLock>
+		inline list<T, TLock>::list(const list<T, TLock>& other) :
+				First(0), Last(0), Size(0)
 		{
-			Monitor = threads::createIrrgameMonitor();
 			*this = other;
 		}
 
 		//! Destructor
-		template<class T>
-		inline list<T>::~list()
+		template<class T, class TLock>
+		inline list<T, TLock>::~list()
 		{
 			clear();
-
-			if (Monitor)
-				Monitor->drop();
 		}
 
 		//! Assignment operator
-		template<class T>
-		inline void list<T>::operator=(const list<T>& other)
+		template<class T, class TLock>
+		inline void list<T, TLock>::operator=(const list<T, TLock>& other)
 		{
 			if (&other == this)
 				return;
 
-			Monitor->enter();
+			Lock.enter();
 
 			clearInternal();
 
@@ -349,28 +349,28 @@ namespace irrgame
 				node = node->Next;
 			}
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Clears the list, deletes all elements in the list.
-		template<class T>
-		inline void list<T>::clear()
+		template<class T, class TLock>
+		inline void list<T, TLock>::clear()
 		{
-			Monitor->enter();
+			Lock.enter();
 			clearInternal();
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Clears the list, deletes all elements in the list.
 		//! Uses internal without lockers
-		template<class T>
-		inline void list<T>::clearInternal()
+		template<class T, class TLock>
+		inline void list<T, TLock>::clearInternal()
 		{
 			while (First)
 			{
 				SKListNode<T>* next = First->Next;
 				Allocator.destruct(First);
-				Allocator.deallocate(First);
+				Allocator.deallocate(First, 1);
 				First = next;
 			}
 
@@ -380,25 +380,25 @@ namespace irrgame
 		}
 
 		//! Checks for empty list.
-		template<class T>
-		inline bool list<T>::empty() const
+		template<class T, class TLock>
+		inline bool list<T, TLock>::empty() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			bool result = First == 0;
-			Monitor->exit();
+			Lock.exit();
 
 			_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 			return result;
 		}
 
 		//! Inserts an element after an element.
-		template<class T>
-		inline void list<T>::insertAfter(const CIterator<T>& it,
+		template<class T, class TLock>
+		inline void list<T, TLock>::insertAfter(const CIterator<T>& it,
 				const T& element)
 		{
 			IRR_ASSERT(it != Iterator(0));
 
-			Monitor->enter();
+			Lock.enter();
 
 			SKListNode<T>* node = Allocator.allocate(1);
 			Allocator.construct(node, element);
@@ -419,17 +419,17 @@ namespace irrgame
 				Last = node;
 			}
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Inserts an element before an element.
-		template<class T>
-		inline void list<T>::insertBefore(const CIterator<T>& it,
+		template<class T, class TLock>
+		inline void list<T, TLock>::insertBefore(const CIterator<T>& it,
 				const T& element)
 		{
 			IRR_ASSERT(it != Iterator(0));
 
-			Monitor->enter();
+			Lock.enter();
 
 			SKListNode<T>* node = Allocator.allocate(1);
 			Allocator.construct(node, element);
@@ -450,14 +450,14 @@ namespace irrgame
 				First = node;
 			}
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Remove an element from list.
-		template<class T>
-		inline void list<T>::remove(const T& element)
+		template<class T, class TLock>
+		inline void list<T, TLock>::remove(const T& element)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			SKListNode<T>* node = First;
 			while (node)
@@ -468,7 +468,7 @@ namespace irrgame
 					--Size;
 
 					Allocator.destruct(node);
-					Allocator.deallocate(node);
+					Allocator.deallocate(node, 1);
 
 					break;
 				}
@@ -476,12 +476,12 @@ namespace irrgame
 				node = node->Next;
 			}
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Erases an element.
-		template<class T>
-		inline CIterator<T> list<T>::erase(CIterator<T>& it)
+		template<class T, class TLock>
+		inline CIterator<T> list<T, TLock>::erase(CIterator<T>& it)
 		{
 			IRR_ASSERT(it != Iterator(0));
 
@@ -490,7 +490,7 @@ namespace irrgame
 
 			Iterator result(it);
 
-			Monitor->enter();
+			Lock.enter();
 
 			++result;
 
@@ -505,89 +505,89 @@ namespace irrgame
 				it.Current->Next->Prev = it.Current->Prev;
 
 			Allocator.destruct(it.Current);
-			Allocator.deallocate(it.Current);
+			Allocator.deallocate(it.Current, 1);
 			it.Current = 0;
 			--Size;
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Swap the content of this list container with the content of another list
-		template<class T>
-		inline void list<T>::swap(list<T>& other)
+		template<class T, class TLock>
+		inline void list<T, TLock>::swap(list<T, TLock>& other)
 		{
 			// handle self swap
 			if (this == &other)
 				return;
 
-			other.Monitor->enter();
-			Monitor->enter();
+			other.Lock.enter();
+			Lock.enter();
 
 			SharedMath::getInstance().swap(First, other.First);
 			SharedMath::getInstance().swap(Last, other.Last);
 			SharedMath::getInstance().swap(Size, other.Size);
 			SharedMath::getInstance().swap(Allocator, other.Allocator);	// memory is still released by the same Allocator used for allocation
 
-			Monitor->exit();
-			other.Monitor->exit();
+			Lock.exit();
+			other.Lock.exit();
 		}
 
 		//! Gets first node.
-		template<class T>
-		inline CIterator<T> list<T>::begin()
+		template<class T, class TLock>
+		inline CIterator<T> list<T, TLock>::begin()
 		{
-			Monitor->enter();
+			Lock.enter();
 			Iterator result(First);
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Gets end node.
-		template<class T>
-		inline CIterator<T> list<T>::end()
+		template<class T, class TLock>
+		inline CIterator<T> list<T, TLock>::end()
 		{
 			return Iterator(0);
 		}
 
 		//! Gets last element.
-		template<class T>
-		inline CIterator<T> list<T>::getLastIterator()
+		template<class T, class TLock>
+		inline CIterator<T> list<T, TLock>::getLastIterator()
 		{
-			Monitor->enter();
+			Lock.enter();
 			Iterator result(Last);
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Gets first node.
-		template<class T>
-		inline CConstIterator<T> list<T>::begin() const
+		template<class T, class TLock>
+		inline CConstIterator<T> list<T, TLock>::begin() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			ConstIterator result(First);
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Gets end node.
-		template<class T>
-		inline CConstIterator<T> list<T>::end() const
+		template<class T, class TLock>
+		inline CConstIterator<T> list<T, TLock>::end() const
 		{
 			return ConstIterator(0);
 		}
 
 		//! Gets last element.
-		template<class T>
-		inline CConstIterator<T> list<T>::getLastIterator() const
+		template<class T, class TLock>
+		inline CConstIterator<T> list<T, TLock>::getLastIterator() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			ConstIterator result(Last);
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
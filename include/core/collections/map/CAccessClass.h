@@ -16,7 +16,7 @@ namespace irrgame
 	namespace core
 	{
 
-		template<class KType, class VType>
+		template<class KType, class VType, class TLock>
 		class map;
 
 		// AccessClass is a temporary class used with the [] operator.
@@ -25,7 +25,7 @@ namespace irrgame
 		// If "Foo" already exists update its value else insert a new element.
 		// int i = myTree["Foo"]
 		// If "Foo" exists return its value.
-		template<class KType, class VType>
+		template<class KType, class VType, class TLock>
 		class CAccessClass
 		{
 				typedef RBTree<KType, VType> Node;
@@ -33,7 +33,7 @@ namespace irrgame
 			public:
 
 				//! Default constructor
-				CAccessClass(map<KType, VType>& tree, const KType& key);
+				CAccessClass(map<KType, VType, TLock>& tree, const KType& key);
 
 				// Assignment operator. Handles the myTree["Foo"] = 32; situation
 				void operator=(const VType& value);
@@ -48,21 +48,21 @@ namespace irrgame
 
 			private:
 
-				map<KType, VType>& Tree;
+				map<KType, VType, TLock>& Tree;
 				const KType& Key;
 		};
 
 		//! Default constructor
-		template<class KType, class VType>
-		inline CAccessClass<KType, VType>::CAccessClass(map<KType, VType>& tree,
+		template<class KType, class VType, class TLock>
+		inline CAccessClass<KType, VType, TLock>::CAccessClass(map<KType, VType, TLock>& tree,
 				const KType& key) :
 				Tree(tree), Key(key)
 		{
 		}
 
 		// Assignment operator. Handles the myTree["Foo"] = 32; situation
-		template<class KType, class VType>
-		inline void CAccessClass<KType, VType>::operator=(const VType& value)
+		template<class KType, class VType, class TLock>
+		inline void CAccessClass<KType, VType, TLock>::operator=(const VType& value)
 		{
 			Node* node = Tree.find(Key);
 
@@ -72,8 +72,8 @@ namespace irrgame
 		}
 
 		// Value operator
-		template<class KType, class VType>
-		inline CAccessClass<KType, VType>::operator VType()
+		template<class KType, class VType, class TLock>
+		inline CAccessClass<KType, VType, TLock>::operator VType()
 		{
 			RBTree<KType, VType>* node = Tree.find(Key);
 
@@ -8,6 +8,8 @@
 #ifndef RBTREE_H_
 #define RBTREE_H_
 
+#include "core/allocator/SharedSlabAllocator.h"
+
 namespace irrgame
 {
 	namespace core
@@ -48,6 +50,10 @@ namespace irrgame
 				bool isRed() const;
 				bool isBlack() const;
 
+				//! Nodes are allocated from SharedSlabAllocator
+				static void* operator new(size_t size);
+				static void operator delete(void* ptr, size_t size);
+
 			private:
 				RBTree();
 
@@ -71,6 +77,18 @@ namespace irrgame
 		{
 		}
 
+		template<class KType, class VType>
+		inline void* RBTree<KType, VType>::operator new(size_t size)
+		{
+			return SharedSlabAllocator::getInstance().allocate(size);
+		}
+
+		template<class KType, class VType>
+		inline void RBTree<KType, VType>::operator delete(void* ptr, size_t size)
+		{
+			SharedSlabAllocator::getInstance().deallocate(ptr, size);
+		}
+
 		template<class KType, class VType>
 		inline void RBTree<KType, VType>::setLeftChild(RBTree<KType, VType>* p)
 		{
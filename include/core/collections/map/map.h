@@ -11,7 +11,8 @@
 #include "core/collections/map/CParentLastIterator.h"
 
 #include "core/math/SharedMath.h"
-#include "threads/irrgameMonitor.h"
+#include "threads/lock/NullLock.h"
+#include "threads/lock/MonitorLock.h"
 
 namespace irrgame
 {
@@ -19,7 +20,9 @@ namespace irrgame
 	{
 
 		//! map template for associative arrays using a red-black tree
-		template<class KType, class VType>
+		/** Map is not synchronized by default. Use threads::MonitorLock as TLock
+		 for maps which are shared between threads. */
+		template<class KType, class VType, class TLock = threads::NullLock>
 		class map
 		{
 			public:
@@ -28,7 +31,7 @@ namespace irrgame
 				typedef CMapIterator<KType, VType> Iterator;
 				typedef CParentFirstIterator<KType, VType> ParentFirstIterator;
 				typedef CParentLastIterator<KType, VType> ParentLastIterator;
-				typedef CAccessClass<KType, VType> AccessClass;
+				typedef CAccessClass<KType, VType, TLock> AccessClass;
 
 			public:
 
@@ -81,7 +84,7 @@ namespace irrgame
 				 object will contain the content of this object. Iterators will afterwards be valid for
 				 the swapped object.
 				 \param other Swap content with this object	*/
-				void swap(map<KType, VType>& other);
+				void swap(map<KType, VType, TLock>& other);
 
 				/*
 				 * Iterators
@@ -154,35 +157,33 @@ namespace irrgame
 				Node* Root;
 				//! Number of nodes in the tree
 				u32 Size;
-				threads::irrgameMonitor* Monitor;
+				TLock Lock;
 		};
 
 		//! Default constructor.
-		template<class KType, class VType>
-		inline map<KType, VType>::map() :
-				Root(0), Size(0), Monitor(0)
+		template<class KType, class VType, class TLock>
+		inline map<KType, VType, TLock>::map() :
+				Root(0), Size(0)
 		{
-			Monitor = threads::createIrrgameMonitor();
 		}
 
 		//! Destructor
-		template<class KType, class VType>
-		inline map<KType, VType>::~map()
+		template<class KType, class VType, class TLock>
+		inline map<KType, VType, TLock>::~map()
 		{
 			clear();
-
-			if (Monitor)
-				Monitor->drop();
 		}
 
 		//! Inserts a new node into the tree
 		/** \param keyNew: the index for this value
 		 \param v: the value to insert
 		 \return True if successful, false if it fails (already exists) */
-		template<class KType, class VType>
-		inline void map<KType, VType>::insert(const KType& keyNew,
+		template<class KType, class VType, class TLock>
+		inline void map<KType, VType, TLock>::insert(const KType& keyNew,
 				const VType& v)
 		{
+			Lock.enter();
+
 			// First insert node the "usual" way (no fancy balance logic yet)
 			Node* newNode = new Node(keyNew, v);
 
@@ -256,13 +257,15 @@ namespace irrgame
 			}
 			// Color the root black
 			Root->setBlack();
+
+			Lock.exit();
 		}
 
 		//! Removes a node from the tree and returns it.
-		template<class KType, class VType>
-		inline RBTree<KType, VType>* map<KType, VType>::delink(const KType& k)
+		template<class KType, class VType, class TLock>
+		inline RBTree<KType, VType>* map<KType, VType, TLock>::delink(const KType& k)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			Node* p = findInternal(k);
 
@@ -299,16 +302,16 @@ namespace irrgame
 
 			--Size;
 
-			Monitor->exit();
+			Lock.exit();
 
 			return p;
 		}
 
 		//! Removes a node from the tree and deletes it.
-		template<class KType, class VType>
-		inline void map<KType, VType>::remove(const KType& k)
+		template<class KType, class VType, class TLock>
+		inline void map<KType, VType, TLock>::remove(const KType& k)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			Node* p = findInternal(k);
 
@@ -346,14 +349,14 @@ namespace irrgame
 
 			--Size;
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Clear the entire tree
-		template<class KType, class VType>
-		inline void map<KType, VType>::clear()
+		template<class KType, class VType, class TLock>
+		inline void map<KType, VType, TLock>::clear()
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			ParentLastIterator i(Root);
 
@@ -368,17 +371,17 @@ namespace irrgame
 			Root = 0;
 			Size = 0;
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Is the tree empty?
 		//! \return Returns true if empty, false if not
-		template<class KType, class VType>
-		inline bool map<KType, VType>::empty() const
+		template<class KType, class VType, class TLock>
+		inline bool map<KType, VType, TLock>::empty() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			bool result = Root == 0;
-			Monitor->exit();
+			Lock.exit();
 
 			_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 			return result;
@@ -387,13 +390,13 @@ namespace irrgame
 		//! Search for a node with the specified key.
 		//! \param keyToFind: The key to find
 		//! \return Returns 0 if node couldn't be found.
-		template<class KType, class VType>
-		inline RBTree<KType, VType>* map<KType, VType>::find(
+		template<class KType, class VType, class TLock>
+		inline RBTree<KType, VType>* map<KType, VType, TLock>::find(
 				const KType& keyToFind) const
 		{
-			Monitor->enter();
+			Lock.enter();
 			Node* result = findInternal(keyToFind);
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
@@ -401,8 +404,8 @@ namespace irrgame
 		//! Search for a node with the specified key.
 		//! \param keyToFind: The key to find
 		//! \return Returns 0 if node couldn't be found.
-		template<class KType, class VType>
-		inline RBTree<KType, VType>* map<KType, VType>::findInternal(
+		template<class KType, class VType, class TLock>
+		inline RBTree<KType, VType>* map<KType, VType, TLock>::findInternal(
 				const KType& keyToFind) const
 		{
 			Node* result = Root;
@@ -431,23 +434,23 @@ namespace irrgame
 		//! Gets the root element.
 		//! \return Returns a pointer to the root node, or
 		//! 0 if the tree is empty.
-		template<class KType, class VType>
-		inline RBTree<KType, VType>* map<KType, VType>::getRoot() const
+		template<class KType, class VType, class TLock>
+		inline RBTree<KType, VType>* map<KType, VType, TLock>::getRoot() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			Node* result = Root;
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Returns the number of nodes in the tree.
-		template<class KType, class VType>
-		inline u32 map<KType, VType>::size() const
+		template<class KType, class VType, class TLock>
+		inline u32 map<KType, VType, TLock>::size() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			u32 result = Size;
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
@@ -457,22 +460,21 @@ namespace irrgame
 		 object will contain the content of this object. Iterators will afterwards be valid for
 		 the swapped object.
 		 \param other Swap content with this object	*/
-		template<class KType, class VType>
-		inline void map<KType, VType>::swap(map<KType, VType>& other)
+		template<class KType, class VType, class TLock>
+		inline void map<KType, VType, TLock>::swap(map<KType, VType, TLock>& other)
 		{
 			// handle self swap
 			if (this == &other)
 				return;
 
-			other.Monitor->enter();
-			Monitor->enter();
+			other.Lock.enter();
+			Lock.enter();
 
-			SharedMath::getInstance().swap(Monitor, other.Monitor);
 			SharedMath::getInstance().swap(Root, other.Root);
 			SharedMath::getInstance().swap(Size, other.Size);
 
-			Monitor->exit();
-			other.Monitor->exit();
+			Lock.exit();
+			other.Lock.exit();
 		}
 
 		//------------------------------
@@ -480,12 +482,12 @@ namespace irrgame
 		//------------------------------
 
 		//! Returns an iterator
-		template<class KType, class VType>
-		inline CMapIterator<KType, VType> map<KType, VType>::getIterator()
+		template<class KType, class VType, class TLock>
+		inline CMapIterator<KType, VType> map<KType, VType, TLock>::getIterator()
 		{
-			Monitor->enter();
+			Lock.enter();
 			Iterator result(Root);
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
@@ -495,12 +497,12 @@ namespace irrgame
 		//! when storing the tree structure, because when reading it
 		//! later (and inserting elements) the tree structure will
 		//! be the same.
-		template<class KType, class VType>
-		inline CParentFirstIterator<KType, VType> map<KType, VType>::getParentFirstIterator()
+		template<class KType, class VType, class TLock>
+		inline CParentFirstIterator<KType, VType> map<KType, VType, TLock>::getParentFirstIterator()
 		{
-			Monitor->enter();
+			Lock.enter();
 			ParentFirstIterator result(Root);
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
@@ -510,12 +512,12 @@ namespace irrgame
 		//! Typical usage is when deleting all elements in the tree
 		//! because you must delete the children before you delete
 		//! their parent.
-		template<class KType, class VType>
-		inline CParentLastIterator<KType, VType> map<KType, VType>::getParentLastIterator()
+		template<class KType, class VType, class TLock>
+		inline CParentLastIterator<KType, VType> map<KType, VType, TLock>::getParentLastIterator()
 		{
-			Monitor->enter();
+			Lock.enter();
 			ParentLastIterator it(Root);
-			Monitor->exit();
+			Lock.exit();
 
 			return it;
 		}
@@ -525,13 +527,13 @@ namespace irrgame
 		//------------------------------
 
 		//! operator [] for access to elements
-		template<class KType, class VType>
-		inline CAccessClass<KType, VType> map<KType, VType>::operator[](
+		template<class KType, class VType, class TLock>
+		inline CAccessClass<KType, VType, TLock> map<KType, VType, TLock>::operator[](
 				const KType& k)
 		{
-			Monitor->enter();
+			Lock.enter();
 			AccessClass result(*this, k);
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
@@ -541,8 +543,8 @@ namespace irrgame
 		//------------------------------
 
 		//! Set node as new root.
-		template<class KType, class VType>
-		inline void map<KType, VType>::setRoot(Node* newRoot)
+		template<class KType, class VType, class TLock>
+		inline void map<KType, VType, TLock>::setRoot(Node* newRoot)
 		{
 			Root = newRoot;
 			if (Root != 0)
@@ -553,8 +555,8 @@ namespace irrgame
 		}
 
 		//! Insert a node into the tree without using any fancy balancing logic.
-		template<class KType, class VType>
-		inline void map<KType, VType>::insert(Node* newNode)
+		template<class KType, class VType, class TLock>
+		inline void map<KType, VType, TLock>::insert(Node* newNode)
 		{
 			if (Root == 0)
 			{
@@ -599,8 +601,8 @@ namespace irrgame
 
 		//! Rotate left.
 		//! Pull up node's right child and let it knock node down to the left
-		template<class KType, class VType>
-		inline void map<KType, VType>::rotateLeft(Node* p)
+		template<class KType, class VType, class TLock>
+		inline void map<KType, VType, TLock>::rotateLeft(Node* p)
 		{
 			Node* right = p->getRightChild();
 
@@ -624,8 +626,8 @@ namespace irrgame
 
 		//! Rotate right.
 		//! Pull up node's left child and let it knock node down to the right
-		template<class KType, class VType>
-		inline void map<KType, VType>::rotateRight(Node* p)
+		template<class KType, class VType, class TLock>
+		inline void map<KType, VType, TLock>::rotateRight(Node* p)
 		{
 			Node* left = p->getLeftChild();
 
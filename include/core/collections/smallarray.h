@@ -0,0 +1,317 @@
+/*
+ * smallarray.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SMALLARRAY_H_
+#define SMALLARRAY_H_
+
+#include "core/allocator/irrAllocator.h"
+#include "core/utils/typeTraits.h"
+
+#include <string.h>
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Contiguous array, which keeps first TInlineSize elements inside the object.
+		/** Use it for many small collections, for example children of nodes of
+		 hierarchy: most of them never touch heap, and elements of all of them
+		 are read without pointer chasing. T must be trivially copyable, elements
+		 are moved by memcpy. Iterators are plain pointers, they are valid until
+		 the array is changed. Smallarray is not synchronized. */
+		template<class T, u32 TInlineSize>
+		class smallarray
+		{
+			public:
+				typedef T* Iterator;
+				typedef const T* ConstIterator;
+
+			public:
+				//! Default constructor. Does not allocate.
+				smallarray();
+
+				//! Destructor
+				~smallarray();
+
+				/*
+				 * Methods
+				 */
+
+				//! Adds an element at back of array.
+				void pushBack(const T& value);
+
+				//! Inserts element at index. Following elements are moved.
+				void insert(const T& value, u32 index);
+
+				//! Erases element at index. Following elements are moved, so order is kept.
+				void erase(u32 index);
+
+				//! Clears the array and frees heap memory
+				void clear();
+
+				//! Reserves memory for count elements
+				void reallocate(u32 count);
+
+				//! Returns count of elements
+				u32 size() const;
+
+				//! Returns count of elements, which fit into reserved memory
+				u32 allocatedSize() const;
+
+				//! Returns True if array is empty
+				bool empty() const;
+
+				//! Returns True if elements are stored inside the object
+				bool isInline() const;
+
+				//! Finds an element by linear search
+				//! \return Position of the element, or -1 if not found.
+				s32 linearSearch(const T& value) const;
+
+				//! Returns pointer to elements
+				T* pointer();
+
+				//! Returns pointer to elements
+				const T* constPointer() const;
+
+				//! Returns iterator to first element
+				Iterator begin();
+
+				//! Returns iterator to first element
+				ConstIterator begin() const;
+
+				//! Returns iterator after last element
+				Iterator end();
+
+				//! Returns iterator after last element
+				ConstIterator end() const;
+
+				/*
+				 * Operators
+				 */
+
+				T& operator[](u32 index);
+
+				const T& operator[](u32 index) const;
+
+			private:
+
+				// Copy constructor and assignment operator deliberately
+				// defined but not implemented. Pass along references instead.
+				smallarray(const smallarray& other);
+				smallarray& operator=(const smallarray& other);
+
+			private:
+				//! Elements. Points to InlineData until array grows.
+				T* Data;
+
+				u32 Used;
+				u32 Allocated;
+
+				T InlineData[TInlineSize];
+		};
+
+		//! Default constructor. Does not allocate.
+		template<class T, u32 TInlineSize>
+		inline smallarray<T, TInlineSize>::smallarray() :
+				Data(InlineData), Used(0), Allocated(TInlineSize)
+		{
+			IRR_ASSERT(isTriviallyCopyable<T>::value);
+		}
+
+		//! Destructor
+		template<class T, u32 TInlineSize>
+		inline smallarray<T, TInlineSize>::~smallarray()
+		{
+			if (!isInline())
+				irrAllocator<T>().deallocate(Data);
+		}
+
+		//! Adds an element at back of array.
+		template<class T, u32 TInlineSize>
+		inline void smallarray<T, TInlineSize>::pushBack(const T& value)
+		{
+			if (Used == Allocated)
+			{
+				// value may be element of this array
+				const T copy(value);
+				reallocate(Allocated * 2);
+				Data[Used++] = copy;
+				return;
+			}
+
+			Data[Used++] = value;
+		}
+
+		//! Inserts element at index. Following elements are moved.
+		template<class T, u32 TInlineSize>
+		inline void smallarray<T, TInlineSize>::insert(const T& value, u32 index)
+		{
+			IRR_ASSERT(index <= Used);
+
+			const T copy(value);
+
+			if (Used == Allocated)
+				reallocate(Allocated * 2);
+
+			memmove((void*) (Data + index + 1), (const void*) (Data + index),
+					(Used - index) * sizeof(T));
+
+			Data[index] = copy;
+			++Used;
+		}
+
+		//! Erases element at index. Following elements are moved, so order is kept.
+		template<class T, u32 TInlineSize>
+		inline void smallarray<T, TInlineSize>::erase(u32 index)
+		{
+			IRR_ASSERT(index < Used);
+
+			memmove((void*) (Data + index), (const void*) (Data + index + 1),
+					(Used - index - 1) * sizeof(T));
+
+			--Used;
+		}
+
+		//! Clears the array and frees heap memory
+		template<class T, u32 TInlineSize>
+		inline void smallarray<T, TInlineSize>::clear()
+		{
+			if (!isInline())
+				irrAllocator<T>().deallocate(Data);
+
+			Data = InlineData;
+			Used = 0;
+			Allocated = TInlineSize;
+		}
+
+		//! Reserves memory for count elements
+		template<class T, u32 TInlineSize>
+		inline void smallarray<T, TInlineSize>::reallocate(u32 count)
+		{
+			if (count <= Allocated)
+				return;
+
+			irrAllocator<T> allocator;
+
+			if (isInline())
+			{
+				T* data = allocator.allocate(count);
+				memcpy((void*) data, (const void*) InlineData, Used * sizeof(T));
+				Data = data;
+			}
+			else
+			{
+				Data = allocator.reallocate(Data, Allocated, count);
+			}
+
+			Allocated = count;
+		}
+
+		//! Returns count of elements
+		template<class T, u32 TInlineSize>
+		inline u32 smallarray<T, TInlineSize>::size() const
+		{
+			return Used;
+		}
+
+		//! Returns count of elements, which fit into reserved memory
+		template<class T, u32 TInlineSize>
+		inline u32 smallarray<T, TInlineSize>::allocatedSize() const
+		{
+			return Allocated;
+		}
+
+		//! Returns True if array is empty
+		template<class T, u32 TInlineSize>
+		inline bool smallarray<T, TInlineSize>::empty() const
+		{
+			return Used == 0;
+		}
+
+		//! Returns True if elements are stored inside the object
+		template<class T, u32 TInlineSize>
+		inline bool smallarray<T, TInlineSize>::isInline() const
+		{
+			return Data == InlineData;
+		}
+
+		//! Finds an element by linear search
+		template<class T, u32 TInlineSize>
+		inline s32 smallarray<T, TInlineSize>::linearSearch(const T& value) const
+		{
+			for (u32 i = 0; i < Used; ++i)
+			{
+				if (Data[i] == value)
+					return (s32) i;
+			}
+
+			return -1;
+		}
+
+		//! Returns pointer to elements
+		template<class T, u32 TInlineSize>
+		inline T* smallarray<T, TInlineSize>::pointer()
+		{
+			return Data;
+		}
+
+		//! Returns pointer to elements
+		template<class T, u32 TInlineSize>
+		inline const T* smallarray<T, TInlineSize>::constPointer() const
+		{
+			return Data;
+		}
+
+		//! Returns iterator to first element
+		template<class T, u32 TInlineSize>
+		inline T* smallarray<T, TInlineSize>::begin()
+		{
+			return Data;
+		}
+
+		//! Returns iterator to first element
+		template<class T, u32 TInlineSize>
+		inline const T* smallarray<T, TInlineSize>::begin() const
+		{
+			return Data;
+		}
+
+		//! Returns iterator after last element
+		template<class T, u32 TInlineSize>
+		inline T* smallarray<T, TInlineSize>::end()
+		{
+			return Data + Used;
+		}
+
+		//! Returns iterator after last element
+		template<class T, u32 TInlineSize>
+		inline const T* smallarray<T, TInlineSize>::end() const
+		{
+			return Data + Used;
+		}
+
+		template<class T, u32 TInlineSize>
+		inline T& smallarray<T, TInlineSize>::operator[](u32 index)
+		{
+			IRR_ASSERT(index < Used);
+
+			return Data[index];
+		}
+
+		template<class T, u32 TInlineSize>
+		inline const T& smallarray<T, TInlineSize>::operator[](u32 index) const
+		{
+			IRR_ASSERT(index < Used);
+
+			return Data[index];
+		}
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* SMALLARRAY_H_ */
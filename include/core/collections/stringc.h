@@ -9,7 +9,8 @@
 #include "core/collections/ICollection.h"
 #include "core/allocator/irrAllocator.h"
 #include "core/utils/SharedCoreUtils.h"
-#include "threads/irrgameMonitor.h"
+#include "threads/lock/NullLock.h"
+#include "threads/lock/MonitorLock.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -17,21 +18,21 @@
 
 namespace irrgame
 {
-	namespace threads
-	{
-		class irrgameMonitor;
-	}  // namespace threads
-
 	namespace core
 	{
 
-		//! Very simple unicode threadsafe string class with some useful features.
-		/** so you can assign Unicode to this string*/
-		class stringc
+		//! Very simple unicode string class with some useful features.
+		/** so you can assign Unicode to this string.
+		 String is not synchronized by default. Use threads::MonitorLock as TLock
+		 (or stringcSync typedef) for strings which are shared between threads.
+		 Strings up to InlineSize - 1 characters are stored inside the object
+		 without heap allocation. */
+		template<class TLock = threads::NullLock>
+		class string
 		{
 			public:
 				//! Returns empty string
-				static const stringc& getEmpty(void);
+				static const string& getEmpty(void);
 
 			public:
 
@@ -40,24 +41,29 @@ namespace irrgame
 				 */
 
 				//! Default constructor
-				stringc();
+				string();
 				//! Copy constructor
-				stringc(const stringc& other);
+				string(const string& other);
+
+#if __cplusplus >= 201103L
+				//! Move constructor. Other string becomes empty.
+				string(string&& other);
+#endif
 
 				//! Constructs a string from a float
-				explicit stringc(const double number);
+				explicit string(const double number);
 				//! Constructs a string from an int
-				explicit stringc(s32 number);
+				explicit string(s32 number);
 				//! Constructs a string from an unsigned int
-				explicit stringc(u32 number);
+				explicit string(u32 number);
 
 				//! Constructor for copying a string from a pointer with a given length
-				stringc(const c8* const c, u32 length);
+				string(const c8* const c, u32 length);
 				//! Constructor for unicode and ascii strings
-				stringc(const c8* const c);
+				string(const c8* const c);
 
 				//! Destructor
-				virtual ~stringc();
+				virtual ~string();
 
 				/*
 				 * Methods
@@ -84,19 +90,19 @@ namespace irrgame
 				/** \param other: Other string to compare.
 				 \param sourcePos: where to start to compare in the string
 				 \return True if the strings are equal ignoring case. */
-				bool equalsIgnoreCase(const stringc& other,
+				bool equalsIgnoreCase(const string& other,
 						const u32 sourcePos = 0) const;
 
 				//! Compares the strings ignoring case.
 				/** \param other: Other string to compare.
 				 \return True if this string is smaller ignoring case. */
-				bool lowerIgnoreCase(const stringc& other) const;
+				bool lowerIgnoreCase(const string& other) const;
 
 				//! compares the first n characters of the strings
 				/** \param other Other string to compare.
 				 \param n Number of characters to compare
 				 \return True if the n first characters of both strings are equal. */
-				bool equalsn(const stringc& other, u32 n) const;
+				bool equalsn(const string& other, u32 n) const;
 				//! compares the first n characters of the strings
 				/** \param str Other string to compare.
 				 \param n Number of characters to compare
@@ -105,11 +111,11 @@ namespace irrgame
 
 				//! Appends a string to this string
 				/** \param other: String to append. */
-				void append(const stringc& other);
+				void append(const string& other);
 				//! Appends a string of the length l to this string.
 				/** \param other: other String to append to this string.
 				 \param length: How much characters of the other string to add to this one. */
-				void append(const stringc& other, u32 length);
+				void append(const string& other, u32 length);
 				//! Appends a character to this string
 				/** \param character: Character to append. */
 				void append(c8 character);
@@ -140,7 +146,7 @@ namespace irrgame
 				//! Returns a substring
 				/** \param begin: Start of substring.
 				 \param length: Length of substring. */
-				stringc subString(u32 begin, u32 length) const;
+				string subString(u32 begin, u32 length) const;
 
 				//! Replaces all characters of a specify type with another one
 				/** \param toReplace Character to replace.
@@ -180,7 +186,7 @@ namespace irrgame
 				 substrings results in the original string. Otherwise, only the
 				 characters between the delimiters are returned.
 				 */
-				void split(ICollection<stringc>& ret, const c8* const c,
+				void split(ICollection<string>& ret, const c8* const c,
 						u32 count = 1, bool ignoreEmptyTokens = true,
 						bool keepSeparators = false) const;
 
@@ -190,35 +196,39 @@ namespace irrgame
 
 				//! Appends a string to this string
 				/** \param other String to append. */
-				stringc& operator +=(const stringc& other);
+				string& operator +=(const string& other);
 				//! Appends a character to this string
 				/** \param c Character to append. */
-				stringc& operator +=(c8 c);
+				string& operator +=(c8 c);
 				//! Appends a char string to this string
 				/** \param c Char string to append. */
-				stringc& operator +=(const c8* const c);
+				string& operator +=(const c8* const c);
 				//! Appends a string representation of a number to this string
 				/** \param i Number to append. */
-				stringc& operator +=(const s32 i);
+				string& operator +=(const s32 i);
 				//! Appends a string representation of a number to this string
 				/** \param i Number to append. */
-				stringc& operator +=(const u32 i);
+				string& operator +=(const u32 i);
 				//! Appends a string representation of a number to this string
 				/** \param i Number to append. */
-				stringc& operator +=(const double i);
+				string& operator +=(const double i);
 				//! Appends a string representation of a number to this string
 				/** \param i Number to append. */
-				stringc& operator +=(const f32 i);
+				string& operator +=(const f32 i);
 
 				//! Assignment operator
-				stringc& operator=(const stringc& other);
+				string& operator=(const string& other);
+#if __cplusplus >= 201103L
+				//! Move assignment operator. Other string becomes empty.
+				string& operator=(string&& other);
+#endif
 				//! Assignment operator for strings, ascii and unicode
-				stringc& operator=(const c8* const c);
+				string& operator=(const c8* const c);
 
 				//! Append operator for other strings
-				stringc operator+(const stringc& other) const;
+				string operator+(const string& other) const;
 				//! Append operator for strings, ascii and unicode
-				stringc operator+(const c8* const c) const;
+				string operator+(const c8* const c) const;
 
 				//! Direct access operator
 				c8& operator [](const u32 index);
@@ -227,32 +237,48 @@ namespace irrgame
 				const c8& operator [](const u32 index) const;
 
 				//! Equality operator
-				bool operator ==(const stringc& other) const;
+				bool operator ==(const string& other) const;
 				//! Equality operator
 				bool operator ==(const c8* const str) const;
 
 				//! Is smaller comparator
-				bool operator <(const stringc& other) const;
+				bool operator <(const string& other) const;
 
 				//! Inequality operator
 				bool operator !=(const c8* const str) const;
 				//! Inequality operator
-				bool operator !=(const stringc& other) const;
+				bool operator !=(const string& other) const;
+
+			public:
+				//! Size of inline buffer, including trailing NUL
+				static const u32 InlineSize = 23;
 
 			private:
 
 				//! Reallocate the Array, make it bigger or smaller
 				void reallocate(u32 newSize);
 
+				//! Frees memory of array, if it is not inline buffer
+				void releaseArray(c8* array);
+
 			private:
 				//--- member variables
 				c8* Array;
 				u32 Allocated;
 				u32 Used;
 				irrAllocator<c8> Allocator;
-				threads::irrgameMonitor* Monitor;
+				TLock Lock;
+
+				//! Storage of short strings. Array points here when Allocated == InlineSize.
+				c8 Buffer[InlineSize];
 		};
 
+		//! Not synchronized string
+		typedef string<threads::NullLock> stringc;
+
+		//! Synchronized string. Every access is guarded by own monitor
+		typedef string<threads::MonitorLock> stringcSync;
+
 	} // end namespace core
 } // end namespace irrgame
 
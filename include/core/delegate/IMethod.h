@@ -2,6 +2,7 @@
 #define __I_DELEGATE_H_INCLUDED__
 
 #include "core/engine/IReferenceCounted.h"
+#include "core/allocator/SharedSlabAllocator.h"
 
 namespace irrgame
 {
@@ -16,6 +17,18 @@ namespace irrgame
 			{
 			}
 
+			//! Methods are allocated from core::SharedSlabAllocator
+			static void* operator new(size_t size)
+			{
+				return core::SharedSlabAllocator::getInstance().allocate(size);
+			}
+
+			//! Size is size of most derived method, destructor is virtual
+			static void operator delete(void* ptr, size_t size)
+			{
+				core::SharedSlabAllocator::getInstance().deallocate(ptr, size);
+			}
+
 			//! Call function which contains in this delegate
 			virtual TRet invoke(TParam p) = 0;
 
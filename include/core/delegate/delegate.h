@@ -163,7 +163,8 @@ namespace irrgame
 	template<class TRet, class TParam>
 	TRet delegate<TRet, TParam>::invoke(TParam p)
 	{
-		TRet result;
+		// empty delegate returns default value
+		TRet result = TRet();
 
 		u32 defaultSize = Methods.size();
 
@@ -21,6 +21,9 @@ namespace irrgame
 		class IDimensionalObject: public ILeafNode<T>
 		{
 			public:
+				//! Default constructor
+				IDimensionalObject(T* parent);
+
 				//! Default destructor
 				virtual ~IDimensionalObject();
 
@@ -29,6 +32,11 @@ namespace irrgame
 				 hierarchy you might want to update the parents first.*/
 				virtual void updateAbsoluteTransformation();
 
+				//! Updates absolute transformations of this object and all its descendants.
+				/** Parents are updated before their children, so whole hierarchy
+				 is updated in one depth-first pass without recursion. */
+				void updateAbsoluteTransformations();
+
 				//! Returns object absolute position
 				virtual vector3df getAbsolutePosition();
 				//! Returns object absolute scale
@@ -57,8 +65,27 @@ namespace irrgame
 
 				//! Relative position, rotation of the game object.
 				matrix4f RelativeTransformation;
+
+			private:
+
+				//! Visitor of updateAbsoluteTransformations
+				struct STransformationUpdater
+				{
+						bool operator()(T* object)
+						{
+							object->updateAbsoluteTransformation();
+							return true;
+						}
+				};
 		};
 
+		//! Default constructor
+		template<class T>
+		inline IDimensionalObject<T>::IDimensionalObject(T* parent) :
+				ILeafNode<T>(parent)
+		{
+		}
+
 		//! Default destructor
 		template<class T>
 		inline IDimensionalObject<T>::~IDimensionalObject()
@@ -81,6 +108,14 @@ namespace irrgame
 			}
 		}
 
+		//! Updates absolute transformations of this object and all its descendants.
+		template<class T>
+		inline void IDimensionalObject<T>::updateAbsoluteTransformations()
+		{
+			STransformationUpdater updater;
+			this->traverse(updater);
+		}
+
 		//! Returns object absolute position
 		template<class T>
 		inline vector3df IDimensionalObject<T>::getAbsolutePosition()
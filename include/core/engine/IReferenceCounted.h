@@ -6,6 +6,7 @@
 #define __I_IREFERENCE_COUNTED_H_INCLUDED__
 
 #include "compileConfig.h"
+#include "threads/irrgameAtomic.h"
 
 namespace irrgame
 {
@@ -110,6 +111,19 @@ namespace irrgame
 			 \return True, if the object was deleted. */
 			bool drop() const;
 
+			//! Drops the object, but postpones its deletion.
+			/** Works like drop(), but if reference counter reaches zero
+			 the object is not deleted immediately. It is linked into list of
+			 current thread and deleted on next flushDeferredDrops() call from
+			 the same thread. Use it for mass release of objects (e.g. scene
+			 teardown), so destructors run in one batch.
+			 \return True, if the object was queued for deletion. */
+			bool dropDeferred() const;
+
+			//! Deletes all objects queued by dropDeferred() from current thread.
+			/** \return Amount of deleted objects. */
+			static u32 flushDeferredDrops();
+
 			//! Get the reference count.
 			/** \return Current value of the reference counter. */
 			s32 getReferenceCount() const;
@@ -147,8 +161,50 @@ namespace irrgame
 
 			//! The reference counter. Mutable to do reference counting on const objects.
 			mutable s32 ReferenceCounter;
+
+			//! Next object in deferred drop list of current thread.
+			mutable const IReferenceCounted* NextDeferred;
 	};
 
+	//! Grabs the object. Increments the reference counter by one.
+	inline void IReferenceCounted::grab() const
+	{
+#ifdef IRR_ATOMIC_REFERENCE_COUNTING
+		threads::irrgameAtomic::incrementRelaxed(&ReferenceCounter);
+#else
+		++ReferenceCounter;
+#endif
+	}
+
+	//! Drops the object. Decrements the reference counter by one.
+	inline bool IReferenceCounted::drop() const
+	{
+		// someone is doing bad reference counting.
+		IRR_ASSERT(getReferenceCount() > 0)
+
+#ifdef IRR_ATOMIC_REFERENCE_COUNTING
+		if (threads::irrgameAtomic::decrementAcqRel(&ReferenceCounter) == 0)
+#else
+		if (--ReferenceCounter == 0)
+#endif
+		{
+			delete this;
+			return true;
+		}
+
+		return false;
+	}
+
+	//! Get the reference count.
+	inline s32 IReferenceCounted::getReferenceCount() const
+	{
+#ifdef IRR_ATOMIC_REFERENCE_COUNTING
+		return threads::irrgameAtomic::loadRelaxed(&ReferenceCounter);
+#else
+		return ReferenceCounter;
+#endif
+	}
+
 } // end namespace irr
 
 #endif
@@ -14,9 +14,13 @@
 
 //! Collections
 #include "core/collections/array.h"
+#include "core/collections/smallarray.h"
 #include "core/collections/list/list.h"
 #include "core/collections/map/map.h"
+#include "core/collections/hashmap/hashmap.h"
+#include "core/collections/flatmap/flatmap.h"
 #include "core/collections/stringc.h"
+#include "core/collections/SharedStringPool.h"
 
 
 
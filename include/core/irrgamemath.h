@@ -9,7 +9,11 @@
 #define IRRGAMEMATH_H_
 
 #include "core/math/SharedConverter.h"
+#include "core/math/SharedCulling.h"
 #include "core/math/SharedHeapsort.h"
+#include "core/math/SharedIntrosort.h"
+#include "core/math/SharedMergesort.h"
+#include "core/math/SharedRadixsort.h"
 #include "core/math/SharedMath.h"
 
 #include "core/math/matrix4.h"
@@ -9,12 +9,14 @@
 #define IRRGAMESHAPES_H_
 
 #include "core/shapes/aabbox3d.h"
+#include "core/shapes/aabbox3darray.h"
 #include "core/shapes/dimension2d.h"
 #include "core/shapes/line2d.h"
 #include "core/shapes/line3d.h"
 #include "core/shapes/plane3d.h"
 #include "core/shapes/rect.h"
 #include "core/shapes/triangle3d.h"
+#include "core/shapes/TriangleBVH.h"
 #include "core/shapes/vector2d.h"
 #include "core/shapes/vector3d.h"
 
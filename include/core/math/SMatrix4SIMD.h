@@ -0,0 +1,66 @@
+/*
+ * SMatrix4SIMD.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SMATRIX4SIMD_H_
+#define SMATRIX4SIMD_H_
+
+#include "compileConfig.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Transforms count vectors of 3 floats by matrix m (data of matrix4<f32>).
+		//! Vectors are stride bytes apart in both arrays. out may be same as in.
+		typedef void (*tTransformVectArraySIMD)(const f32* m, f32* out,
+				const f32* in, u32 count, u32 stride);
+
+		//! Multiplies matrices a and b. out may be same as a or b.
+		typedef void (*tMultiplyMatrix4SIMD)(const f32* a, const f32* b,
+				f32* out);
+
+		//! Inverts matrix m. If there is no inverse returns false and keeps out.
+		//! out may be same as m.
+		typedef bool (*tInverseMatrix4SIMD)(const f32* m, f32* out);
+
+		//! SIMD versions of matrix4<f32> operations for one instruction set.
+		//! Except inverse each one produces exactly the same values as its
+		//! scalar reference. Matrices are not required to be aligned.
+		struct SMatrix4SIMD
+		{
+			public:
+				//! Same as matrix4::transformVect for every vector
+				tTransformVectArraySIMD TransformVectArray;
+
+				//! Same as matrix4::rotateVect for every vector
+				tTransformVectArraySIMD RotateVectArray;
+
+				//! Same as matrix4::rotateVect and vector3d::normalize for every vector
+				tTransformVectArraySIMD RotateNormalizeVectArray;
+
+				//! Same as matrix4::operator*
+				tMultiplyMatrix4SIMD Multiply;
+
+				//! Same as matrix4::getInverse up to rounding errors. Affine
+				//! matrices (last column is 0, 0, 0, 1) are inverted as 3x3
+				//! matrix and translation.
+				tInverseMatrix4SIMD Inverse;
+		};
+
+		//! Returns SIMD kernels supported by current processor.
+		//! 0 if there are no such or they are disabled by config.
+		const SMatrix4SIMD* getMatrix4SIMD();
+
+		//! Returns kernels of one instruction set, 0 if they are disabled
+		//! by config. Use them only if SharedCPUFeatures reports the set.
+		const SMatrix4SIMD* getMatrix4SSE2();
+		const SMatrix4SIMD* getMatrix4AVX();
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* SMATRIX4SIMD_H_ */
@@ -0,0 +1,93 @@
+/*
+ * SharedCulling.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SHAREDCULLING_H_
+#define SHAREDCULLING_H_
+
+#include "core/shapes/aabbox3darray.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+		struct SCullingKernels;
+
+		//! Tests many boxes of aabbox3darray at once and writes visibility bit mask.
+		/** Bit (i & 31) of mask word (i >> 5) is set if box i is visible, unused
+		 bits of last word are cleared. Boxes are tested by SIMD kernels selected
+		 by CPU features, 4 or 8 at a time. Arrays with at least
+		 getParallelThreshold() boxes are split into bands, which are proceed in
+		 parallel by threads::SharedJobPool. */
+		class SharedCulling
+		{
+			public:
+				//! Maximal count of planes tested by cullFrustum
+				static const u32 MaxPlanes = 8;
+
+			public:
+				//! Singleton realization
+				static SharedCulling& getInstance();
+
+			private:
+				//! Default constructor. Should use only one time.
+				SharedCulling();
+
+				//! Destructor. Should use only one time.
+				virtual ~SharedCulling();
+
+				//! Copy constructor. Do not implement.
+				SharedCulling(const SharedCulling& root);
+
+				//! Override equal operator. Do not implement.
+				const SharedCulling& operator=(SharedCulling&);
+
+			public:
+				//! Returns count of u32 words of mask for count boxes
+				u32 getMaskSize(u32 count) const;
+
+				//! Culls boxes by planes, which normals point out of visible
+				//! volume, like planes of view frustum.
+				/** Box is visible if it is not in front of any plane, so result
+				 is same as testing aabbox3d::classifyPlaneRelation of every box
+				 against every plane and culling on ISREL3D_FRONT.
+				 \param boxes Boxes to test.
+				 \param planes Planes, at most MaxPlanes.
+				 \param planesCount Count of planes, 6 for view frustum.
+				 \param visible Mask of getMaskSize(boxes.size()) words. */
+				void cullFrustum(const aabbox3darray& boxes,
+						const plane3d<f32>* planes, u32 planesCount, u32* visible);
+
+				//! Culls boxes, which do not intersect box.
+				/** Box is visible if it overlaps box on every axis, touching
+				 boxes intersect. Unlike aabbox3d::intersectsWithBox edges are
+				 compared per axis without tolerance.
+				 \param boxes Boxes to test.
+				 \param box Box to test with, for example bounds of light or
+				 region of level.
+				 \param visible Mask of getMaskSize(boxes.size()) words. */
+				void cullBox(const aabbox3darray& boxes, const aabbox3d<f32>& box,
+						u32* visible);
+
+				//! Sets minimal count of boxes, which are culled in parallel.
+				//! 0 - always parallel.
+				void setParallelThreshold(u32 boxes);
+
+				//! Returns minimal count of boxes, which are culled in parallel
+				u32 getParallelThreshold() const;
+
+			private:
+				//! Kernels selected by CPU features
+				const SCullingKernels* Kernels;
+
+				//! Minimal count of boxes of parallel culling
+				u32 ParallelThreshold;
+		};
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* SHAREDCULLING_H_ */
@@ -0,0 +1,211 @@
+/*
+ * SharedIntrosort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SHAREDINTROSORT_H_
+#define SHAREDINTROSORT_H_
+
+#include "core/math/SharedHeapsort.h"
+#include "core/utils/typeTraits.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Introspective sort. Quicksort with median of three pivot, which
+		//! switches to heapsort on bad partitions and to insertion sort on small ones.
+		/** Performs O(n*log n) in worst case and needs no additional memory.
+		 Only operator< of T is used. Sort is not stable. */
+		template<class T>
+		class SharedIntrosort
+		{
+			public:
+				//! Singleton realization
+				static SharedIntrosort<T>& getInstance();
+
+			private:
+				//! Default constructor. Should use only one time.
+				SharedIntrosort();
+
+				//! Destructor. Should use only one time.
+				virtual ~SharedIntrosort();
+
+				//! Copy constructor. Do not implement.
+				SharedIntrosort(const SharedIntrosort& root);
+
+				//! Override equal operator. Do not implement.
+				const SharedIntrosort& operator=(SharedIntrosort&);
+
+			public:
+				//! Partitions smaller than it are left for insertion sort
+				static const s32 InsertionSortSize = 16;
+
+				//! Sorts an array with size 'size' using introsort.
+				void sort(T* arr, s32 size);
+
+			private:
+				//! Sorts range by quicksort until partitions are small or depth is exhausted
+				void sortLoop(T* first, T* last, s32 depth);
+
+				//! Moves median of a, b and c to result
+				void moveMedianToFirst(T* result, T* a, T* b, T* c);
+
+				//! Partitions range around pivot. Range must contain elements
+				//! not less and not greater than pivot at its ends.
+				T* partition(T* first, T* last, const T& pivot);
+
+				//! Sorts range using insertion sort
+				void insertionSort(T* first, T* last);
+
+				//! Swaps two elements
+				void swap(T& a, T& b);
+		};
+
+		//! Singleton realization
+		template<class T>
+		inline SharedIntrosort<T>& SharedIntrosort<T>::getInstance()
+		{
+			static SharedIntrosort instance;
+			return instance;
+		}
+
+		//! Default constructor. Should use only one time.
+		template<class T>
+		inline SharedIntrosort<T>::SharedIntrosort()
+		{
+		}
+
+		//! Destructor. Should use only one time.
+		template<class T>
+		inline SharedIntrosort<T>::~SharedIntrosort()
+		{
+		}
+
+		//! Sorts an array with size 'size' using introsort.
+		template<class T>
+		inline void SharedIntrosort<T>::sort(T* arr, s32 size)
+		{
+			if (size < 2)
+				return;
+
+			// depth limit 2*log2(size), after it partitions are treated as bad
+			s32 depth = 0;
+
+			for (s32 i = size; i > 1; i >>= 1)
+				depth += 2;
+
+			sortLoop(arr, arr + size, depth);
+
+			// all partitions are small and ordered between each other
+			insertionSort(arr, arr + size);
+		}
+
+		//! Sorts range by quicksort until partitions are small or depth is exhausted
+		template<class T>
+		inline void SharedIntrosort<T>::sortLoop(T* first, T* last, s32 depth)
+		{
+			while (last - first > InsertionSortSize)
+			{
+				if (depth == 0)
+				{
+					SharedHeapsort<T>::getInstance().sort(first,
+							(s32) (last - first));
+					return;
+				}
+
+				--depth;
+
+				moveMedianToFirst(first, first + 1, first + (last - first) / 2,
+						last - 1);
+
+				T* cut = partition(first + 1, last, *first);
+
+				// recurse into right part, loop on left one
+				sortLoop(cut, last, depth);
+				last = cut;
+			}
+		}
+
+		//! Moves median of a, b and c to result
+		template<class T>
+		inline void SharedIntrosort<T>::moveMedianToFirst(T* result, T* a, T* b,
+				T* c)
+		{
+			if (*a < *b)
+			{
+				if (*b < *c)
+					swap(*result, *b);
+				else if (*a < *c)
+					swap(*result, *c);
+				else
+					swap(*result, *a);
+			}
+			else if (*a < *c)
+				swap(*result, *a);
+			else if (*b < *c)
+				swap(*result, *c);
+			else
+				swap(*result, *b);
+		}
+
+		//! Partitions range around pivot
+		template<class T>
+		inline T* SharedIntrosort<T>::partition(T* first, T* last,
+				const T& pivot)
+		{
+			while (true)
+			{
+				while (*first < pivot)
+					++first;
+
+				--last;
+
+				while (pivot < *last)
+					--last;
+
+				if (!(first < last))
+					return first;
+
+				swap(*first, *last);
+				++first;
+			}
+		}
+
+		//! Sorts range using insertion sort
+		template<class T>
+		inline void SharedIntrosort<T>::insertionSort(T* first, T* last)
+		{
+			for (T* i = first + 1; i < last; ++i)
+			{
+				if (!(*i < *(i - 1)))
+					continue;
+
+				T value(core::move(*i));
+				T* j = i;
+
+				do
+				{
+					*j = core::move(*(j - 1));
+					--j;
+				} while (j != first && value < *(j - 1));
+
+				*j = core::move(value);
+			}
+		}
+
+		//! Swaps two elements
+		template<class T>
+		inline void SharedIntrosort<T>::swap(T& a, T& b)
+		{
+			T t(core::move(a));
+			a = core::move(b);
+			b = core::move(t);
+		}
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* SHAREDINTROSORT_H_ */
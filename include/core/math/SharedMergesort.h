@@ -0,0 +1,353 @@
+/*
+ * SharedMergesort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SHAREDMERGESORT_H_
+#define SHAREDMERGESORT_H_
+
+#include "core/math/SharedIntrosort.h"
+#include "core/allocator/irrAllocator.h"
+#include "threads/SharedJobPool.h"
+
+#include <string.h>
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Parallel merge sort. Runs are sorted by introsort in threads::SharedJobPool,
+		//! then merged level by level. Every merge is split into bands by merge path,
+		//! so all threads are busy on last levels too. Elements are moved while
+		//! merged, so splits of all bands are found before merge and every band
+		//! reads only elements which it takes.
+		/** Needs additional memory of array size. Only operator< of T is used.
+		 Sort is not stable, because runs are sorted by introsort. */
+		template<class T>
+		class SharedMergesort
+		{
+			public:
+				//! Singleton realization
+				static SharedMergesort<T>& getInstance();
+
+			private:
+				//! Default constructor. Should use only one time.
+				SharedMergesort();
+
+				//! Destructor. Should use only one time.
+				virtual ~SharedMergesort();
+
+				//! Copy constructor. Do not implement.
+				SharedMergesort(const SharedMergesort& root);
+
+				//! Override equal operator. Do not implement.
+				const SharedMergesort& operator=(SharedMergesort&);
+
+			public:
+				//! Count of elements merged by one band
+				static const u32 BandSize = 16384;
+
+				//! Sorts an array with size 'size' using parallel merge sort.
+				//! Without worker threads array is sorted by introsort.
+				void sort(T* arr, u32 size);
+
+				//! Sorts an array with size 'size', which is split into runsCount runs.
+				void sort(T* arr, u32 size, u32 runsCount);
+
+			private:
+				//! State of sort shared by job bands
+				struct SContext
+				{
+						T* Source;
+						T* Destination;
+						u32 Size;
+						u32 RunSize;
+
+						//! Count of elements taken from left run before begin of band
+						u32* Splits;
+				};
+
+				//! Bounds of pair of runs, which are merged together
+				struct SPair
+				{
+						u32 Begin;
+						u32 Middle;
+						u32 End;
+				};
+
+				//! Sorts runs [begin; end) by introsort
+				static void sortRuns(void* context, u32 begin, u32 end);
+
+				//! Finds splits of bands [begin; end) of current level
+				static void splitBands(void* context, u32 begin, u32 end);
+
+				//! Merges bands [begin; end) of current level
+				static void mergeBands(void* context, u32 begin, u32 end);
+
+				//! Moves elements [begin; end) from source to destination
+				static void moveBand(void* context, u32 begin, u32 end);
+
+				//! Returns pair of runs of current level, which contains element
+				static SPair getPair(const SContext* context, u32 element);
+
+				//! Returns count of elements taken from left run into first
+				//! 'count' elements of merge result
+				static u32 splitMerge(const T* left, u32 leftSize, const T* right,
+						u32 rightSize, u32 count);
+		};
+
+		//! Singleton realization
+		template<class T>
+		inline SharedMergesort<T>& SharedMergesort<T>::getInstance()
+		{
+			static SharedMergesort instance;
+			return instance;
+		}
+
+		//! Default constructor. Should use only one time.
+		template<class T>
+		inline SharedMergesort<T>::SharedMergesort()
+		{
+		}
+
+		//! Destructor. Should use only one time.
+		template<class T>
+		inline SharedMergesort<T>::~SharedMergesort()
+		{
+		}
+
+		//! Sorts an array with size 'size' using parallel merge sort.
+		template<class T>
+		inline void SharedMergesort<T>::sort(T* arr, u32 size)
+		{
+			const u32 threadsCount =
+					threads::SharedJobPool::getInstance().getWorkersCount() + 1;
+
+			// power of two runs, at least one per thread
+			u32 runsCount = 1;
+
+			while (runsCount < threadsCount)
+				runsCount <<= 1;
+
+			sort(arr, size, runsCount);
+		}
+
+		//! Sorts an array with size 'size', which is split into runsCount runs.
+		template<class T>
+		inline void SharedMergesort<T>::sort(T* arr, u32 size, u32 runsCount)
+		{
+			if (runsCount < 2 || size < runsCount * 2)
+			{
+				SharedIntrosort<T>::getInstance().sort(arr, (s32) size);
+				return;
+			}
+
+			threads::SharedJobPool& pool = threads::SharedJobPool::getInstance();
+
+			SContext context;
+			context.Source = arr;
+			context.Destination = 0;
+			context.Size = size;
+			context.RunSize = (size + runsCount - 1) / runsCount;
+			context.Splits = 0;
+
+			pool.parallelFor(sortRuns, &context, runsCount);
+
+			irrAllocator<T> allocator;
+			T* buffer = allocator.allocate(size);
+
+			// merge targets must be constructed objects
+			if (!isTriviallyCopyable<T>::value)
+			{
+				for (u32 i = 0; i < size; ++i)
+					allocator.construct(buffer + i, arr[i]);
+			}
+
+			const u32 bandsCount = (size + BandSize - 1) / BandSize;
+
+			context.Destination = buffer;
+			context.Splits = new u32[bandsCount];
+
+			for (; context.RunSize < size; context.RunSize *= 2)
+			{
+				pool.parallelFor(splitBands, &context, bandsCount);
+				pool.parallelFor(mergeBands, &context, bandsCount);
+
+				T* t = context.Source;
+				context.Source = context.Destination;
+				context.Destination = t;
+			}
+
+			if (context.Source != arr)
+			{
+				context.Destination = arr;
+				pool.parallelFor(moveBand, &context, size, BandSize);
+			}
+
+			delete[] context.Splits;
+
+			if (!isTriviallyCopyable<T>::value)
+			{
+				for (u32 i = 0; i < size; ++i)
+					allocator.destruct(buffer + i);
+			}
+
+			allocator.deallocate(buffer);
+		}
+
+		//! Sorts runs [begin; end) by introsort
+		template<class T>
+		inline void SharedMergesort<T>::sortRuns(void* context, u32 begin,
+				u32 end)
+		{
+			SContext* c = static_cast<SContext*>(context);
+
+			for (u32 run = begin; run < end; ++run)
+			{
+				const u32 first = run * c->RunSize;
+
+				if (first >= c->Size)
+					break;
+
+				const u32 count =
+						c->Size - first < c->RunSize ? c->Size - first : c->RunSize;
+
+				SharedIntrosort<T>::getInstance().sort(c->Source + first,
+						(s32) count);
+			}
+		}
+
+		//! Finds splits of bands [begin; end) of current level
+		template<class T>
+		inline void SharedMergesort<T>::splitBands(void* context, u32 begin,
+				u32 end)
+		{
+			SContext* c = static_cast<SContext*>(context);
+
+			for (u32 band = begin; band < end; ++band)
+			{
+				const u32 first = band * BandSize;
+				const SPair pair = getPair(c, first);
+
+				c->Splits[band] = splitMerge(c->Source + pair.Begin,
+						pair.Middle - pair.Begin, c->Source + pair.Middle,
+						pair.End - pair.Middle, first - pair.Begin);
+			}
+		}
+
+		//! Merges bands [begin; end) of current level
+		template<class T>
+		inline void SharedMergesort<T>::mergeBands(void* context, u32 begin,
+				u32 end)
+		{
+			SContext* c = static_cast<SContext*>(context);
+
+			for (u32 band = begin; band < end; ++band)
+			{
+				u32 first = band * BandSize;
+				const u32 last =
+						c->Size - first < BandSize ? c->Size : first + BandSize;
+
+				// band may cross few pairs, next pairs are merged from their begin
+				u32 i = c->Splits[band];
+
+				while (first < last)
+				{
+					const SPair pair = getPair(c, first);
+					const u32 segmentEnd = last < pair.End ? last : pair.End;
+
+					T* left = c->Source + pair.Begin;
+					T* right = c->Source + pair.Middle;
+
+					// next band starts inside of pair, its split bounds this one
+					const u32 leftSize =
+							segmentEnd == pair.End ?
+									pair.Middle - pair.Begin : c->Splits[band + 1];
+					const u32 rightSize = segmentEnd - pair.Begin - leftSize;
+
+					u32 j = first - pair.Begin - i;
+
+					T* dst = c->Destination + first;
+					T* dstEnd = c->Destination + segmentEnd;
+
+					for (; dst != dstEnd; ++dst)
+					{
+						if (j == rightSize
+								|| (i < leftSize && !(right[j] < left[i])))
+							*dst = core::move(left[i++]);
+						else
+							*dst = core::move(right[j++]);
+					}
+
+					first = segmentEnd;
+					i = 0;
+				}
+			}
+		}
+
+		//! Moves elements [begin; end) from source to destination
+		template<class T>
+		inline void SharedMergesort<T>::moveBand(void* context, u32 begin,
+				u32 end)
+		{
+			SContext* c = static_cast<SContext*>(context);
+
+			if (isTriviallyCopyable<T>::value)
+			{
+				memcpy((void*) (c->Destination + begin),
+						(const void*) (c->Source + begin), (end - begin) * sizeof(T));
+				return;
+			}
+
+			for (u32 i = begin; i < end; ++i)
+				c->Destination[i] = core::move(c->Source[i]);
+		}
+
+		//! Returns pair of runs of current level, which contains element
+		template<class T>
+		inline typename SharedMergesort<T>::SPair SharedMergesort<T>::getPair(
+				const SContext* context, u32 element)
+		{
+			SPair result;
+
+			result.Begin = element - element % (context->RunSize * 2);
+			result.Middle =
+					context->Size - result.Begin < context->RunSize ?
+							context->Size : result.Begin + context->RunSize;
+			result.End =
+					context->Size - result.Middle < context->RunSize ?
+							context->Size : result.Middle + context->RunSize;
+
+			return result;
+		}
+
+		//! Returns count of elements taken from left run into first 'count'
+		//! elements of merge result
+		template<class T>
+		inline u32 SharedMergesort<T>::splitMerge(const T* left, u32 leftSize,
+				const T* right, u32 rightSize, u32 count)
+		{
+			u32 low = count > rightSize ? count - rightSize : 0;
+			u32 high = count < leftSize ? count : leftSize;
+
+			// find first i, after which left element is greater than taken right one
+			while (low < high)
+			{
+				const u32 i = (low + high) >> 1;
+				const u32 j = count - i;
+
+				if (j > 0 && !(right[j - 1] < left[i]))
+					low = i + 1;
+				else
+					high = i;
+			}
+
+			return low;
+		}
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* SHAREDMERGESORT_H_ */
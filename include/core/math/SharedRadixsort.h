@@ -0,0 +1,239 @@
+/*
+ * SharedRadixsort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SHAREDRADIXSORT_H_
+#define SHAREDRADIXSORT_H_
+
+#include "core/allocator/irrAllocator.h"
+#include "core/utils/typeTraits.h"
+
+#include <string.h>
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Unsigned key of radix sort, which is ordered as values of type.
+		/** Specialized for integers and floats. Specialize it for own trivially
+		 copyable types (render items, for example) to sort them by radix sort:
+		 define Type, IsDefined = true and static Type get(const T&). */
+		template<class T>
+		struct radixKey
+		{
+				static const bool IsDefined = false;
+		};
+
+#define IRR_RADIX_KEY_UNSIGNED(type, keyType) \
+		template<> \
+		struct radixKey<type> \
+		{ \
+				typedef keyType Type; \
+				static const bool IsDefined = true; \
+				static Type get(type value) \
+				{ \
+					return value; \
+				} \
+		};
+
+		// sign bit is flipped, so negative values go first
+#define IRR_RADIX_KEY_SIGNED(type, keyType, signedKeyType) \
+		template<> \
+		struct radixKey<type> \
+		{ \
+				typedef keyType Type; \
+				static const bool IsDefined = true; \
+				static Type get(type value) \
+				{ \
+					return (Type) (signedKeyType) value \
+							^ ((Type) 1 << (sizeof(Type) * 8 - 1)); \
+				} \
+		};
+
+		IRR_RADIX_KEY_UNSIGNED(u8, u32)
+		IRR_RADIX_KEY_UNSIGNED(u16, u32)
+		IRR_RADIX_KEY_UNSIGNED(u32, u32)
+		IRR_RADIX_KEY_UNSIGNED(u64, u64)
+		IRR_RADIX_KEY_SIGNED(c8, u32, s32)
+		IRR_RADIX_KEY_SIGNED(s8, u32, s32)
+		IRR_RADIX_KEY_SIGNED(s16, u32, s32)
+		IRR_RADIX_KEY_SIGNED(s32, u32, s32)
+		IRR_RADIX_KEY_SIGNED(s64, u64, s64)
+
+#undef IRR_RADIX_KEY_UNSIGNED
+#undef IRR_RADIX_KEY_SIGNED
+
+		//! Key of floats. All bits of negative values are flipped, so their
+		//! order is reversed, and sign bit of positive values is set.
+		template<>
+		struct radixKey<f32>
+		{
+				typedef u32 Type;
+				static const bool IsDefined = true;
+				static Type get(f32 value)
+				{
+					u32 bits;
+					memcpy(&bits, &value, sizeof(bits));
+
+					return bits ^ ((u32) ((s32) bits >> 31) | 0x80000000u);
+				}
+		};
+
+		//! Least significant digit radix sort by radixKey of T.
+		/** Performs O(n) and needs additional memory of array size. Sort
+		 is stable. T must be trivially copyable. Passes of digits which are
+		 same for all keys are skipped, so small values are sorted faster. */
+		template<class T>
+		class SharedRadixsort
+		{
+			public:
+				//! Singleton realization
+				static SharedRadixsort<T>& getInstance();
+
+			private:
+				//! Default constructor. Should use only one time.
+				SharedRadixsort();
+
+				//! Destructor. Should use only one time.
+				virtual ~SharedRadixsort();
+
+				//! Copy constructor. Do not implement.
+				SharedRadixsort(const SharedRadixsort& root);
+
+				//! Override equal operator. Do not implement.
+				const SharedRadixsort& operator=(SharedRadixsort&);
+
+			public:
+				//! Arrays smaller than it are sorted faster by comparison sort
+				static const u32 MinSize = 256;
+
+				//! Sorts an array with size 'size' using radix sort.
+				void sort(T* arr, u32 size);
+
+			private:
+				typedef typename radixKey<T>::Type KeyType;
+
+				//! Count of 8 bit digits in key
+				static const u32 DigitsCount = sizeof(KeyType);
+		};
+
+		//! Sorts by radix sort if T has radix key and is trivially copyable
+		/** \return False if array was not sorted. */
+		template<class T, bool TUseRadix = radixKey<T>::IsDefined
+				&& isTriviallyCopyable<T>::value>
+		struct radixSortSelector
+		{
+				static bool sort(T*, u32)
+				{
+					return false;
+				}
+		};
+
+		template<class T>
+		struct radixSortSelector<T, true>
+		{
+				static bool sort(T* arr, u32 size)
+				{
+					if (size < SharedRadixsort<T>::MinSize)
+						return false;
+
+					SharedRadixsort<T>::getInstance().sort(arr, size);
+
+					return true;
+				}
+		};
+
+		//! Singleton realization
+		template<class T>
+		inline SharedRadixsort<T>& SharedRadixsort<T>::getInstance()
+		{
+			static SharedRadixsort instance;
+			return instance;
+		}
+
+		//! Default constructor. Should use only one time.
+		template<class T>
+		inline SharedRadixsort<T>::SharedRadixsort()
+		{
+		}
+
+		//! Destructor. Should use only one time.
+		template<class T>
+		inline SharedRadixsort<T>::~SharedRadixsort()
+		{
+		}
+
+		//! Sorts an array with size 'size' using radix sort.
+		template<class T>
+		inline void SharedRadixsort<T>::sort(T* arr, u32 size)
+		{
+			IRR_ASSERT(isTriviallyCopyable<T>::value);
+
+			if (size < 2)
+				return;
+
+			// histograms of all digits are built in one pass
+			u32 counts[DigitsCount][256];
+			memset(counts, 0, sizeof(counts));
+
+			for (u32 i = 0; i < size; ++i)
+			{
+				KeyType key = radixKey<T>::get(arr[i]);
+
+				for (u32 d = 0; d < DigitsCount; ++d)
+				{
+					++counts[d][key & 0xff];
+					key >>= 8;
+				}
+			}
+
+			irrAllocator<T> allocator;
+			T* buffer = allocator.allocate(size);
+
+			T* src = arr;
+			T* dst = buffer;
+
+			const KeyType firstKey = radixKey<T>::get(arr[0]);
+
+			for (u32 d = 0; d < DigitsCount; ++d)
+			{
+				const u32 shift = d * 8;
+
+				// all keys have same digit, order is not changed
+				if (counts[d][(firstKey >> shift) & 0xff] == size)
+					continue;
+
+				u32 offsets[256];
+				u32 sum = 0;
+
+				for (u32 i = 0; i < 256; ++i)
+				{
+					offsets[i] = sum;
+					sum += counts[d][i];
+				}
+
+				for (u32 i = 0; i < size; ++i)
+				{
+					const u32 digit = (radixKey<T>::get(src[i]) >> shift) & 0xff;
+					memcpy((void*) (dst + offsets[digit]++), (const void*) (src + i),
+							sizeof(T));
+				}
+
+				T* t = src;
+				src = dst;
+				dst = t;
+			}
+
+			if (src != arr)
+				memcpy((void*) arr, (const void*) src, size * sizeof(T));
+
+			allocator.deallocate(buffer);
+		}
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* SHAREDRADIXSORT_H_ */
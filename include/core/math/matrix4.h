@@ -8,6 +8,7 @@
 #include "core/math/EMatrix4Constructor.h"
 #include "core/math/SharedFastMath.h"
 #include "core/math/SharedConverter.h"
+#include "core/math/SMatrix4SIMD.h"
 #include "core/collections/stringc.h"
 #include "core/shapes/aabbox3d.h"
 #include "core/shapes/plane3d.h"
@@ -183,6 +184,30 @@ namespace irrgame
 				//! An alternate transform vector method, writing into an array of 4 floats
 				void transformVect(T *out, const vector3df &in) const;
 
+				//! Transforms count vectors by this matrix
+				/** Vectors may be members of bigger structures, for example
+				 positions of vertices: m.transformVectArray(&vertices[0].Pos,
+				 &vertices[0].Pos, count, sizeof(vertex3d)). Uses SIMD for f32.
+				 \param out First result vector. May be same as in.
+				 \param in First source vector.
+				 \param count Count of vectors.
+				 \param stride Distance between vectors in bytes, same for in and out. */
+				void transformVectArray(vector3df* out, const vector3df* in,
+						u32 count, u32 stride = sizeof(vector3df)) const;
+
+				//! Rotates count vectors by the rotation part of this matrix
+				/** Parameters are same as in transformVectArray(). */
+				void rotateVectArray(vector3df* out, const vector3df* in,
+						u32 count, u32 stride = sizeof(vector3df)) const;
+
+				//! Transforms count normals by the inverse transposed matrix and normalizes them
+				/** Normals stay perpendicular to transformed surfaces also when
+				 matrix has non uniform scale. Parameters are same as in
+				 transformVectArray(), for example m.transformNormalArray(
+				 &vertices[0].Normal, &vertices[0].Normal, count, sizeof(vertex3d)). */
+				void transformNormalArray(vector3df* out, const vector3df* in,
+						u32 count, u32 stride = sizeof(vector3df)) const;
+
 				//! Translate a vector by the translation part of this matrix.
 				void translateVect(vector3df& vect) const;
 
@@ -214,7 +239,10 @@ namespace irrgame
 				bool getInversePrimitive(matrix4<T>& out) const;
 
 				//! Gets the inversed matrix of this one
-				/** \param out: where result matrix is written to.
+				/** For f32 SIMD is used and affine matrices (last column is
+				 0, 0, 0, 1) are inverted faster, results may differ from scalar
+				 ones by rounding errors.
+				 \param out: where result matrix is written to.
 				 \return Returns false if there is no inverse matrix. */
 				bool getInverse(matrix4<T>& out) const;
 
@@ -362,11 +390,34 @@ namespace irrgame
 				bool equals(const matrix4<T>& other, const T tolerance =
 						(T) SharedMath::RoundErrF32) const;
 
+			private:
+				//! Returns SIMD kernels, which can be used for this type of matrix, or 0
+				static const SMatrix4SIMD* getSIMD();
+
+				//! Applies rotateVect() or transformVect() and normalize() to vectors
+				void transformVectArray(vector3df* out, const vector3df* in,
+						u32 count, u32 stride, bool translate,
+						bool normalize) const;
+
 			private:
 				//! Matrix data, stored in row-major order
 				T M[16];
 		};
 
+		//! There are no SIMD kernels for most of types
+		template<class T>
+		inline const SMatrix4SIMD* matrix4<T>::getSIMD()
+		{
+			return 0;
+		}
+
+		//! Kernels for f32 are selected by processor
+		template<>
+		inline const SMatrix4SIMD* matrix4<f32>::getSIMD()
+		{
+			return getMatrix4SIMD();
+		}
+
 		//! Returns global const identity matrix
 		template<class T>
 		matrix4<T>& matrix4<T>::getIdentityMatrix()
@@ -632,6 +683,17 @@ namespace irrgame
 		template<class T>
 		inline matrix4<T>& matrix4<T>::operator*=(const matrix4<T>& other)
 		{
+			const SMatrix4SIMD* simd = getSIMD();
+
+			if (simd)
+			{
+				// kernel reads both matrices before writing
+				simd->Multiply(reinterpret_cast<const f32*>(M),
+						reinterpret_cast<const f32*>(other.M),
+						reinterpret_cast<f32*>(M));
+				return *this;
+			}
+
 			matrix4<T> temp(*this);
 			return setbyproduct_nocheck(temp, other);
 		}
@@ -643,6 +705,16 @@ namespace irrgame
 		inline matrix4<T>& matrix4<T>::setbyproduct_nocheck(
 				const matrix4<T>& other_a, const matrix4<T>& other_b)
 		{
+			const SMatrix4SIMD* simd = getSIMD();
+
+			if (simd)
+			{
+				simd->Multiply(reinterpret_cast<const f32*>(other_a.M),
+						reinterpret_cast<const f32*>(other_b.M),
+						reinterpret_cast<f32*>(M));
+				return *this;
+			}
+
 			const T *m1 = other_a.M;
 			const T *m2 = other_b.M;
 
@@ -701,6 +773,16 @@ namespace irrgame
 
 			matrix4<T> m3(EM4CONST_NOTHING);
 
+			const SMatrix4SIMD* simd = getSIMD();
+
+			if (simd)
+			{
+				simd->Multiply(reinterpret_cast<const f32*>(M),
+						reinterpret_cast<const f32*>(m2.M),
+						reinterpret_cast<f32*>(m3.M));
+				return m3;
+			}
+
 			const T *m1 = M;
 
 			m3[0] = m1[0] * m2[0] + m1[4] * m2[1] + m1[8] * m2[2]
@@ -1117,6 +1199,83 @@ namespace irrgame
 			out[3] = in.X * M[3] + in.Y * M[7] + in.Z * M[11] + M[15];
 		}
 
+		//! Transforms count vectors by this matrix
+		template<class T>
+		inline void matrix4<T>::transformVectArray(vector3df* out,
+				const vector3df* in, u32 count, u32 stride) const
+		{
+			transformVectArray(out, in, count, stride, true, false);
+		}
+
+		//! Rotates count vectors by the rotation part of this matrix
+		template<class T>
+		inline void matrix4<T>::rotateVectArray(vector3df* out,
+				const vector3df* in, u32 count, u32 stride) const
+		{
+			transformVectArray(out, in, count, stride, false, false);
+		}
+
+		//! Transforms count normals by the inverse transposed matrix and normalizes them
+		template<class T>
+		inline void matrix4<T>::transformNormalArray(vector3df* out,
+				const vector3df* in, u32 count, u32 stride) const
+		{
+			// inverse is computed once for whole array
+			const matrix4<T> normalMatrix(*this, EM4CONST_INVERSE_TRANSPOSED);
+
+			normalMatrix.transformVectArray(out, in, count, stride, false, true);
+		}
+
+		//! Applies rotateVect() or transformVect() and normalize() to vectors
+		template<class T>
+		inline void matrix4<T>::transformVectArray(vector3df* out,
+				const vector3df* in, u32 count, u32 stride, bool translate,
+				bool normalize) const
+		{
+			IRR_ASSERT(stride >= sizeof(vector3df));
+
+			const SMatrix4SIMD* simd = getSIMD();
+
+			if (simd)
+			{
+				tTransformVectArraySIMD kernel = simd->RotateVectArray;
+
+				if (translate)
+					kernel = simd->TransformVectArray;
+				else if (normalize)
+					kernel = simd->RotateNormalizeVectArray;
+
+				kernel(reinterpret_cast<const f32*>(M), &out->X, &in->X, count,
+						stride);
+				return;
+			}
+
+			const c8* source = reinterpret_cast<const c8*>(in);
+			c8* destination = reinterpret_cast<c8*>(out);
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				const vector3df& vect =
+						*reinterpret_cast<const vector3df*>(source);
+
+				// out may be same as in
+				vector3df result;
+
+				if (translate)
+					transformVect(result, vect);
+				else
+					rotateVect(result, vect);
+
+				if (normalize)
+					result.normalize();
+
+				*reinterpret_cast<vector3df*>(destination) = result;
+
+				source += stride;
+				destination += stride;
+			}
+		}
+
 		//! Transforms a plane by this matrix
 		template<class T>
 		inline void matrix4<T>::transformPlane(plane3df &plane) const
@@ -1250,6 +1409,12 @@ namespace irrgame
 			/// The inverse is calculated using Cramers rule.
 			/// If no inverse exists then 'false' is returned.
 
+			const SMatrix4SIMD* simd = getSIMD();
+
+			if (simd)
+				return simd->Inverse(reinterpret_cast<const f32*>(M),
+						reinterpret_cast<f32*>(out.M));
+
 			const matrix4<T> &m = *this;
 
 			f32 d = (m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0))
@@ -1451,6 +1616,13 @@ namespace irrgame
 		template<class T>
 		inline bool matrix4<T>::makeInverse()
 		{
+			const SMatrix4SIMD* simd = getSIMD();
+
+			// kernel keeps matrix if there is no inverse
+			if (simd)
+				return simd->Inverse(reinterpret_cast<const f32*>(M),
+						reinterpret_cast<f32*>(M));
+
 			matrix4<T> temp(EM4CONST_NOTHING);
 
 			if (getInverse(temp))
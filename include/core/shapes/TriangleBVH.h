@@ -0,0 +1,194 @@
+/*
+ * TriangleBVH.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef TRIANGLEBVH_H_
+#define TRIANGLEBVH_H_
+
+#include "core/collections/array.h"
+#include "core/math/SharedMath.h"
+#include "core/shapes/triangle3d.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Intersection of ray or line with triangle of TriangleBVH
+		struct SBVHHit
+		{
+				//! Index of triangle in source of TriangleBVH::build
+				u32 Triangle;
+
+				//! Position of intersection along line in units of its
+				//! vector. For ray with normalized direction it is distance
+				//! from origin.
+				f32 Distance;
+
+				//! Point of intersection
+				vector3d<f32> Point;
+		};
+
+		//! Point of triangle of TriangleBVH, which is closest to some point
+		struct SBVHClosestPoint
+		{
+				//! Index of triangle in source of TriangleBVH::build
+				u32 Triangle;
+
+				//! Squared distance from point
+				f32 DistanceSQ;
+
+				//! Closest point of triangle
+				vector3d<f32> Point;
+		};
+
+		//! Node of TriangleBVH with up to 4 children. Unused children are
+		//! 0xFFFFFFFF and have inverted boxes.
+		struct SBVHNode
+		{
+				//! Boxes of children as Bounds[component][child], components
+				//! are MinEdge.X, MinEdge.Y, MinEdge.Z, MaxEdge.X, MaxEdge.Y,
+				//! MaxEdge.Z.
+				f32 Bounds[6][4];
+
+				//! Index of child node or, if highest bit is set, leaf
+				u32 Child[4];
+		};
+
+		//! Bounding volume hierarchy over static triangle soup.
+		/** Replaces linear scans over triangle3d for picking, line of sight and
+		 collision queries. Tree is built by binned surface area heuristic,
+		 every node keeps bounding boxes of up to 4 children as structure of
+		 arrays, so they are tested at once by SIMD. Leaves have up to
+		 LeafTriangles triangles. Triangles are copied, so source may be freed
+		 after build. Queries are const and may run in many threads at once,
+		 build must not run at same time with them. */
+		class TriangleBVH
+		{
+			public:
+				//! Maximal count of triangles in leaf
+				static const u32 LeafTriangles = 4;
+
+			public:
+				//! Default constructor. Does not allocate.
+				TriangleBVH();
+
+				//! Destructor
+				virtual ~TriangleBVH();
+
+				/*
+				 * Methods
+				 */
+
+				//! Builds tree over triangles.
+				/** \param triangles Triangles, their indices are reported by
+				 queries.
+				 \param count Count of triangles.
+				 \param parallel If True, subtrees are built in parallel by
+				 threads::SharedJobPool. Tree is same as built by one thread. */
+				void build(const triangle3d<f32>* triangles, u32 count,
+						bool parallel = false);
+
+				//! Builds tree over indexed triangle list, for example vertices
+				//! and indices of mesh buffer.
+				/** \param positions Position of first vertex.
+				 \param stride Distance between positions of vertices in bytes.
+				 \param indices Three indices per triangle. Triangle i is made
+				 of indices 3 * i, 3 * i + 1 and 3 * i + 2.
+				 \param indexCount Count of indices.
+				 \param parallel If True, subtrees are built in parallel. */
+				void build(const vector3d<f32>* positions, u32 stride,
+						const u16* indices, u32 indexCount,
+						bool parallel = false);
+
+				//! Builds tree over indexed triangle list with 32 bit indices.
+				void build(const vector3d<f32>* positions, u32 stride,
+						const u32* indices, u32 indexCount,
+						bool parallel = false);
+
+				//! Frees tree and triangles
+				void clear();
+
+				//! Returns count of triangles
+				u32 getTriangleCount() const;
+
+				//! Returns count of nodes
+				u32 getNodeCount() const;
+
+				//! Returns box of all triangles
+				const aabbox3d<f32>& getBoundingBox() const;
+
+				//! Finds nearest intersection of ray with triangles.
+				/** Triangles are hit from both sides.
+				 \param origin Start of ray.
+				 \param direction Direction of ray, not required to be
+				 normalized.
+				 \param outHit Nearest intersection, if there is one.
+				 \param maxDistance Intersections farther than this (in units
+				 of direction) are ignored.
+				 \return True if there was an intersection. */
+				bool getIntersectionWithRay(const vector3d<f32>& origin,
+						const vector3d<f32>& direction, SBVHHit& outHit,
+						f32 maxDistance = SharedMath::MaxFloat) const;
+
+				//! Finds intersection with line, which is nearest to its start.
+				/** Same as triangle3d::getIntersectionWithLimitedLine for every
+				 triangle, but only between start and end of line. */
+				bool getIntersectionWithLimitedLine(const line3d<f32>& line,
+						SBVHHit& outHit) const;
+
+				//! Returns True if line intersects any triangle between its
+				//! start and end, for example line of sight is blocked.
+				/** Stops on first found intersection, so it is faster than
+				 getIntersectionWithLimitedLine. */
+				bool intersectsWithLimitedLine(const line3d<f32>& line) const;
+
+				//! Appends indices of triangles, which intersect box.
+				/** Triangles are tested exactly by separating axes, not only by
+				 their bounding boxes. Order of indices is not defined.
+				 \return Count of appended indices. */
+				u32 getTrianglesInBox(const aabbox3d<f32>& box,
+						array<u32>& outTriangles) const;
+
+				//! Finds point of triangles, which is closest to point.
+				/** \param point Point to search from.
+				 \param outClosest Closest point, if there is one.
+				 \param maxDistance Triangles farther than this are ignored.
+				 \return True if some triangle is not farther than
+				 maxDistance. */
+				bool getClosestPoint(const vector3d<f32>& point,
+						SBVHClosestPoint& outClosest,
+						f32 maxDistance = SharedMath::MaxFloat) const;
+
+			private:
+
+				// Copy constructor and assignment operator deliberately
+				// defined but not implemented.
+				TriangleBVH(const TriangleBVH& other);
+				TriangleBVH& operator=(const TriangleBVH& other);
+
+			private:
+
+				//! Builds tree over Triangles, which are filled already
+				void buildTree(bool parallel);
+
+			private:
+				//! Nodes, root is first
+				array<SBVHNode> Nodes;
+
+				//! Triangles in order of leaves
+				array<triangle3d<f32> > Triangles;
+
+				//! Index of every triangle of Triangles in source
+				array<u32> Indices;
+
+				//! Box of all triangles
+				aabbox3d<f32> BoundingBox;
+		};
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* TRIANGLEBVH_H_ */
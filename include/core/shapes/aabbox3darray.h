@@ -0,0 +1,218 @@
+/*
+ * aabbox3darray.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef AABBOX3DARRAY_H_
+#define AABBOX3DARRAY_H_
+
+#include "core/allocator/irrAllocator.h"
+#include "core/shapes/aabbox3d.h"
+
+#include <string.h>
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Array of f32 axis aligned boxes stored as structure of arrays.
+		/** Every edge component (MinEdge.X, ..., MaxEdge.Z) of all boxes is kept
+		 in own contiguous array, so many boxes are tested at once by SIMD, see
+		 SharedCulling. Pointers to components are valid until the array grows.
+		 Array is not synchronized. */
+		class aabbox3darray
+		{
+			public:
+				//! Components of box
+				enum EComponent
+				{
+					EC_MIN_X = 0,
+					EC_MIN_Y,
+					EC_MIN_Z,
+					EC_MAX_X,
+					EC_MAX_Y,
+					EC_MAX_Z,
+
+					EC_COUNT
+				};
+
+			public:
+				//! Default constructor. Does not allocate.
+				aabbox3darray();
+
+				//! Destructor
+				~aabbox3darray();
+
+				/*
+				 * Methods
+				 */
+
+				//! Adds a box at back of array.
+				void pushBack(const aabbox3d<f32>& box);
+
+				//! Erases box at index. Last box is moved to its place, so
+				//! order is not kept.
+				void erase(u32 index);
+
+				//! Clears the array and frees memory
+				void clear();
+
+				//! Reserves memory for count boxes
+				void reallocate(u32 count);
+
+				//! Returns count of boxes
+				u32 size() const;
+
+				//! Returns True if array is empty
+				bool empty() const;
+
+				//! Returns box at index
+				aabbox3d<f32> get(u32 index) const;
+
+				//! Replaces box at index
+				void set(u32 index, const aabbox3d<f32>& box);
+
+				//! Returns array of component of all boxes
+				const f32* getComponent(EComponent component) const;
+
+				//! Returns array of component of all boxes
+				f32* getComponent(EComponent component);
+
+			private:
+
+				// Copy constructor and assignment operator deliberately
+				// defined but not implemented. Pass along references instead.
+				aabbox3darray(const aabbox3darray& other);
+				aabbox3darray& operator=(const aabbox3darray& other);
+
+			private:
+				//! Components one after another, every one has Allocated elements
+				f32* Data;
+
+				u32 Used;
+				u32 Allocated;
+		};
+
+		//! Default constructor. Does not allocate.
+		inline aabbox3darray::aabbox3darray() :
+				Data(0), Used(0), Allocated(0)
+		{
+		}
+
+		//! Destructor
+		inline aabbox3darray::~aabbox3darray()
+		{
+			clear();
+		}
+
+		//! Adds a box at back of array.
+		inline void aabbox3darray::pushBack(const aabbox3d<f32>& box)
+		{
+			if (Used == Allocated)
+				reallocate(Allocated ? Allocated * 2 : 16);
+
+			set(Used++, box);
+		}
+
+		//! Erases box at index. Last box is moved to its place.
+		inline void aabbox3darray::erase(u32 index)
+		{
+			IRR_ASSERT(index < Used);
+
+			--Used;
+
+			for (u32 i = 0; i < EC_COUNT; ++i)
+				Data[i * Allocated + index] = Data[i * Allocated + Used];
+		}
+
+		//! Clears the array and frees memory
+		inline void aabbox3darray::clear()
+		{
+			if (Data)
+				irrAllocator<f32>().deallocate(Data);
+
+			Data = 0;
+			Used = 0;
+			Allocated = 0;
+		}
+
+		//! Reserves memory for count boxes
+		inline void aabbox3darray::reallocate(u32 count)
+		{
+			if (count <= Allocated)
+				return;
+
+			irrAllocator<f32> allocator;
+
+			// every component moves to its new offset
+			f32* data = allocator.allocate(EC_COUNT * count);
+
+			if (Data)
+			{
+				for (u32 i = 0; i < EC_COUNT; ++i)
+					memcpy(data + i * count, Data + i * Allocated,
+							Used * sizeof(f32));
+
+				allocator.deallocate(Data);
+			}
+
+			Data = data;
+			Allocated = count;
+		}
+
+		//! Returns count of boxes
+		inline u32 aabbox3darray::size() const
+		{
+			return Used;
+		}
+
+		//! Returns True if array is empty
+		inline bool aabbox3darray::empty() const
+		{
+			return Used == 0;
+		}
+
+		//! Returns box at index
+		inline aabbox3d<f32> aabbox3darray::get(u32 index) const
+		{
+			IRR_ASSERT(index < Used);
+
+			return aabbox3d<f32>(Data[EC_MIN_X * Allocated + index],
+					Data[EC_MIN_Y * Allocated + index],
+					Data[EC_MIN_Z * Allocated + index],
+					Data[EC_MAX_X * Allocated + index],
+					Data[EC_MAX_Y * Allocated + index],
+					Data[EC_MAX_Z * Allocated + index]);
+		}
+
+		//! Replaces box at index
+		inline void aabbox3darray::set(u32 index, const aabbox3d<f32>& box)
+		{
+			IRR_ASSERT(index < Used);
+
+			Data[EC_MIN_X * Allocated + index] = box.MinEdge.X;
+			Data[EC_MIN_Y * Allocated + index] = box.MinEdge.Y;
+			Data[EC_MIN_Z * Allocated + index] = box.MinEdge.Z;
+			Data[EC_MAX_X * Allocated + index] = box.MaxEdge.X;
+			Data[EC_MAX_Y * Allocated + index] = box.MaxEdge.Y;
+			Data[EC_MAX_Z * Allocated + index] = box.MaxEdge.Z;
+		}
+
+		//! Returns array of component of all boxes
+		inline const f32* aabbox3darray::getComponent(EComponent component) const
+		{
+			return Data + component * Allocated;
+		}
+
+		//! Returns array of component of all boxes
+		inline f32* aabbox3darray::getComponent(EComponent component)
+		{
+			return Data + component * Allocated;
+		}
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* AABBOX3DARRAY_H_ */
@@ -382,7 +382,7 @@ namespace irrgame
 		{
 			const f32 d = Normal.dotProduct(lookDirection);
 
-			return SharedFastMath::F32_LOWER_EQUAL_0(d);
+			return SharedFastMath::getInstance().F32_LOWER_EQUAL_0(d);
 		}
 
 		//! Get the distance to a point.
@@ -36,9 +36,6 @@ namespace irrgame
 				//! Constructor with the same value for both members
 				explicit vector2d(T n);
 
-				//! Copy constructor
-				vector2d(const vector2d<T>& other);
-
 				//! Constructor from dimension
 				vector2d(const dimension2d<T>& other);
 
@@ -48,8 +45,6 @@ namespace irrgame
 
 				vector2d<T> operator-() const;
 
-				vector2d<T>& operator=(const vector2d<T>& other);
-
 				vector2d<T>& operator=(const dimension2d<T>& other);
 
 				vector2d<T> operator+(const vector2d<T>& other) const;
@@ -246,12 +241,6 @@ namespace irrgame
 				X(n), Y(n)
 		{
 		}
-		//! Copy constructor
-		template<class T>
-		inline vector2d<T>::vector2d(const vector2d<T>& other) :
-				X(other.X), Y(other.Y)
-		{
-		}
 
 		//! Constructor from dimension
 		template<class T>
@@ -266,14 +255,6 @@ namespace irrgame
 			return vector2d<T>(-X, -Y);
 		}
 
-		template<class T>
-		inline vector2d<T>& vector2d<T>::operator=(const vector2d<T>& other)
-		{
-			X = other.X;
-			Y = other.Y;
-			return *this;
-		}
-
 		template<class T>
 		inline vector2d<T>& vector2d<T>::operator=(const dimension2d<T>& other)
 		{
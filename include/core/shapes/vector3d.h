@@ -35,12 +35,6 @@ namespace irrgame
 				//! Constructor with the same value for all elements
 				explicit vector3d(T n);
 
-				//! Copy constructor
-				vector3d(const vector3d<T>& other);
-
-				//! Assignment operator
-				vector3d<T>& operator=(const vector3d<T>& other);
-
 				// operators
 				vector3d<T> operator-() const;
 				vector3d<T> operator+(const vector3d<T>& other) const;
@@ -265,29 +259,6 @@ namespace irrgame
 		{
 		}
 
-		//! Copy constructor
-		template<class T>
-		inline vector3d<T>::vector3d(const vector3d<T>& other)
-
-		{
-			*this = other;
-		}
-
-		//! Assignment operator
-		template<class T>
-		inline vector3d<T>& vector3d<T>::operator=(const vector3d<T>& other)
-		{
-			//handle self-assignment
-			if (this == &other)
-				return *this;
-
-			X = other.X;
-			Y = other.Y;
-			Z = other.Z;
-
-			return *this;
-		}
-
 		// operators
 		template<class T>
 		inline vector3d<T> vector3d<T>::operator-() const
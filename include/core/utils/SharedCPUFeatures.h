@@ -0,0 +1,64 @@
+/*
+ * SharedCPUFeatures.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SHAREDCPUFEATURES_H_
+#define SHAREDCPUFEATURES_H_
+
+#include "compileConfig.h"
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Instruction set extensions of the current processor.
+		//! Detected once via CPUID. Use it to select SIMD code paths at runtime.
+		class SharedCPUFeatures
+		{
+			public:
+				//! Singleton realization
+				static SharedCPUFeatures& getInstance();
+
+			private:
+				//! Default constructor. Should use only one time.
+				SharedCPUFeatures();
+
+				//! Destructor. Should use only one time.
+				virtual ~SharedCPUFeatures();
+
+				//! Copy constructor. Do not implement.
+				SharedCPUFeatures(const SharedCPUFeatures& root);
+
+				//! Override equal operator. Do not implement.
+				const SharedCPUFeatures& operator=(SharedCPUFeatures&);
+
+			public:
+				//! Returns true if processor supports SSE2
+				bool hasSSE2() const;
+
+				//! Returns true if processor supports SSSE3
+				bool hasSSSE3() const;
+
+				//! Returns true if processor supports SSE4.1
+				bool hasSSE41() const;
+
+				//! Returns true if processor and OS support AVX
+				bool hasAVX() const;
+
+				//! Returns true if processor and OS support AVX2
+				bool hasAVX2() const;
+
+			private:
+				bool SSE2;
+				bool SSSE3;
+				bool SSE41;
+				bool AVX;
+				bool AVX2;
+		};
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* SHAREDCPUFEATURES_H_ */
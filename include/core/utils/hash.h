@@ -0,0 +1,111 @@
+/*
+ * hash.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef HASH_H_
+#define HASH_H_
+
+#include "compileConfig.h"
+
+#include <stddef.h>
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Returns FNV-1a hash of zero terminated string
+		inline u32 hashString(const c8* str)
+		{
+			u32 result = 2166136261u;
+
+			while (*str)
+			{
+				result ^= (u8) *str++;
+				result *= 16777619u;
+			}
+
+			return result;
+		}
+
+		//! Mixes bits of integer, so close keys give different low bits
+		inline u32 hashInteger(u32 value)
+		{
+			value ^= value >> 16;
+			value *= 0x85ebca6bu;
+			value ^= value >> 13;
+			value *= 0xc2b2ae35u;
+			value ^= value >> 16;
+
+			return value;
+		}
+
+		//! Mixes bits of 64 bit integer and folds it to 32 bit
+		inline u32 hashInteger(u64 value)
+		{
+			value ^= value >> 33;
+			value *= 0xff51afd7ed558ccdull;
+			value ^= value >> 33;
+			value *= 0xc4ceb9fe1a85ec53ull;
+			value ^= value >> 33;
+
+			return (u32) value;
+		}
+
+		template<class TLock>
+		class string;
+
+		//! Hash functor used by hashed collections.
+		/** Specialized for integers, pointers and strings. Specialize it for
+		 own key types or pass own functor to collection. */
+		template<class T>
+		struct hash;
+
+#define IRR_HASH_INTEGER(type, hashType) \
+		template<> \
+		struct hash<type> \
+		{ \
+				u32 operator()(type value) const \
+				{ \
+					return hashInteger((hashType) value); \
+				} \
+		};
+
+		IRR_HASH_INTEGER(c8, u32)
+		IRR_HASH_INTEGER(s8, u32)
+		IRR_HASH_INTEGER(u8, u32)
+		IRR_HASH_INTEGER(s16, u32)
+		IRR_HASH_INTEGER(u16, u32)
+		IRR_HASH_INTEGER(s32, u32)
+		IRR_HASH_INTEGER(u32, u32)
+		IRR_HASH_INTEGER(s64, u64)
+		IRR_HASH_INTEGER(u64, u64)
+
+#undef IRR_HASH_INTEGER
+
+		//! Hash of pointers
+		template<class T>
+		struct hash<T*>
+		{
+				u32 operator()(const T* value) const
+				{
+					return hashInteger((u64) (size_t) value);
+				}
+		};
+
+		//! Hash of strings
+		template<class TLock>
+		struct hash<string<TLock> >
+		{
+				u32 operator()(const string<TLock>& value) const
+				{
+					return hashString(value.cStr());
+				}
+		};
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* HASH_H_ */
@@ -0,0 +1,54 @@
+/*
+ * typeTraits.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef TYPETRAITS_H_
+#define TYPETRAITS_H_
+
+#include "compileConfig.h"
+
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+#define IRR_IS_TRIVIALLY_COPYABLE(T) __is_trivially_copyable(T)
+#elif defined(__GNUC__) || defined(_MSC_VER)
+#define IRR_IS_TRIVIALLY_COPYABLE(T) (__has_trivial_copy(T) \
+		&& __has_trivial_assign(T) && __has_trivial_destructor(T))
+#else
+#define IRR_IS_TRIVIALLY_COPYABLE(T) false
+#endif
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Value is true if objects of type can be copied by memcpy and need no destruction.
+		/** Detected by compiler. Specialize it for types which compiler
+		 can not detect. */
+		template<class T>
+		struct isTriviallyCopyable
+		{
+				static const bool value = IRR_IS_TRIVIALLY_COPYABLE(T);
+		};
+
+#if __cplusplus >= 201103L
+		//! Casts value to rvalue, so it is moved instead of copied
+		template<class T>
+		inline T&& move(T& value)
+		{
+			return static_cast<T&&>(value);
+		}
+#else
+		//! Returns value itself, objects are copied without C++11
+		template<class T>
+		inline T& move(T& value)
+		{
+			return value;
+		}
+#endif
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* TYPETRAITS_H_ */
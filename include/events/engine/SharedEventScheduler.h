@@ -10,17 +10,29 @@
 
 #include "core/delegate.h"
 #include "core/collections/list/list.h"
+#include "threads/lock/MonitorLock.h"
+#include "threads/queue/MPMCQueue.h"
 #include "EEventPriority.h"
 
 namespace irrgame
 {
+	namespace threads
+	{
+		class irrgameSemaphore;
+	}  // namespace threads
+
 	namespace events
 	{
 		//! Use this delegate for add event to specify queue
 		typedef delegate<s32, void*> delegateEvent;
 
+		struct SEventWorker;
+
 		//! Event sheduler which manage engine events.
-		//! Represents a simple scheduler which have 3 threads with different priorities.
+		//! Realtime events are proceed in main thread. High priority and background events
+		//! are proceed by pool of worker threads (one per processor) with work stealing.
+		//! All workers have normal OS priority, each one takes background
+		//! events only when there are no high priority ones.
 		//! Напрямую разраб не должен обращаться к шедулеру. Все ивенты должны закидывать сюда манагеры.
 		class SharedEventScheduler
 		{
@@ -49,18 +61,60 @@ namespace irrgame
 				//! Start process events.
 				void startProcess();
 
+				//! Stop process events. Blocks until all workers are finished.
+				void stopProcess();
+
 				//! Proceed next real time event in main thread.
 				//! Must be call manually
 				void proceedNextRealTimeEvent();
 
+				//! Returns count of worker threads
+				u32 getWorkersCount() const;
+
 			private:
-				int proceedHPEvents(void* stub);
-				int proceedBGEvents(void* stub);
+				//! Worker thread function
+				s32 proceedWorkerEvents(void* worker);
+
+				//! Takes next event with specify priority for worker.
+				//! Own events first, then shared queue, then steals from other workers.
+				delegateEvent* takeEvent(SEventWorker* worker, EEventPriority qType);
+
+				//! Adds event to shared queue
+				void addSharedEvent(delegateEvent* e, EEventPriority qType);
+
+				//! Takes next event from shared queue
+				delegateEvent* takeSharedEvent(EEventPriority qType);
+
+				//! Return True if any worker event is waiting.
+				bool haveWorkerEvents() const;
+
+				//! Wakes up one sleeping worker if exists.
+				void wakeUpWorker();
 
 			private:
-				core::list<delegateEvent*> RealtimeEvents;
-				core::list<delegateEvent*> HighpriorityEvents;
-				core::list<delegateEvent*> BackgroundEvents;
+				//! Events added from non worker threads. One lock-free queue per priority.
+				threads::MPMCQueue<delegateEvent*> SharedEvents[EAP_COUNT];
+
+				//! Events which did not fit into full shared queues
+				core::list<delegateEvent*> OverflowEvents[EAP_COUNT];
+
+				//! Size of each overflow queue. Allows to skip locking of empty queues.
+				u32 OverflowEventsCount[EAP_COUNT];
+
+				//! Guards overflow queues
+				threads::MonitorLock OverflowEventsLock;
+
+				//! Worker threads
+				core::array<SEventWorker*> Workers;
+
+				//! Sleeping workers are waiting on it
+				threads::irrgameSemaphore* WakeUp;
+
+				//! Count of workers which are going to sleep and not woken up yet
+				s32 SleepingWorkers;
+
+				//! Non zero while workers are running
+				s32 IsRunning;
 		};
 	}
 
@@ -13,6 +13,7 @@
 #include "events/user/EUserKeyStates.h"
 #include "events/user/SCursorInfo.h"
 #include "core/collections/map/map.h"
+#include "core/collections/flatmap/flatmap.h"
 
 namespace irrgame
 {
@@ -61,7 +62,7 @@ namespace irrgame
 
 			protected:
 
-				//Platform dependent
+				//Platform dependent. Fill KeyMap by append, initKeyStates builds it.
 				virtual void initKeyMap() = 0;
 
 				//Platform dependent
@@ -73,8 +74,8 @@ namespace irrgame
 
 				//user event handler state
 				bool IsRunning;
-				//key map collection
-				core::map<s32, EUserKeys> KeyMap;
+				//key map collection. Built once, read on every key event.
+				core::flatmap<s32, EUserKeys> KeyMap;
 				//key states collection
 				core::map<EUserKeys, EUserKeyStates> KeyStates;
 				//cursors info collection
@@ -43,11 +43,36 @@ namespace irrgame
 				//! Get name of file.
 				/** \return File name as zero terminated character string. */
 				virtual const core::stringc& getFileName() const = 0;
+
+				//! Get whole file data, if it is already in memory.
+				/** Memory files and memory mapped files return their data, so it
+				 can be used without copying. Data is valid until file is dropped
+				 and must not be changed.
+				 \return Pointer to first byte of file or 0 if file data is not
+				 in memory. */
+				virtual const void* getBuffer() const
+				{
+					return 0;
+				}
+
+				//! Get file data at current position, if it is already in memory.
+				/** \return Pointer to byte at getPos() or 0 if file data is not
+				 in memory. */
+				virtual const void* getPointer() const
+				{
+					const c8* buffer = static_cast<const c8*>(getBuffer());
+
+					return buffer ? buffer + getPos() : 0;
+				}
 		};
 
 		//! Internal function, please do not use.
 		IReadFile* createReadFile(const core::stringc& fileName);
 
+		//! Internal function, please do not use.
+		//! Returns 0 if file can not be memory mapped.
+		IReadFile* createMappedReadFile(const core::stringc& fileName);
+
 		//! Internal function, please do not use.
 		IReadFile* createLimitReadFile(const core::stringc& fileName,
 				IReadFile* alreadyOpenedFile, long pos, long areaSize);
@@ -6,8 +6,10 @@
 #define __I_ATTRIBUTE_H_INCLUDED__
 
 #include "core/engine/IReferenceCounted.h"
+#include "core/allocator/SharedSlabAllocator.h"
 
 #include "core/collections/stringc.h"
+#include "core/collections/InternedString.h"
 #include "core/collections/array.h"
 
 #include "core/shapes/vector2d.h"
@@ -40,6 +42,18 @@ namespace irrgame
 				{
 				}
 
+				//! Attributes are allocated from SharedSlabAllocator
+				static void* operator new(size_t size)
+				{
+					return core::SharedSlabAllocator::getInstance().allocate(size);
+				}
+
+				//! Size is size of most derived attribute, destructor is virtual
+				static void operator delete(void* ptr, size_t size)
+				{
+					core::SharedSlabAllocator::getInstance().deallocate(ptr, size);
+				}
+
 				virtual EAttributeType getType() const = 0;
 
 				virtual const c8* getTypeString() const = 0;
@@ -241,7 +255,8 @@ namespace irrgame
 
 			public:
 
-				core::stringc Name;
+				//! Name of attribute. Same names of all attributes share one copy.
+				core::InternedString Name;
 
 		};
 	} // end namespace io
@@ -73,6 +73,11 @@ namespace irrgame
 				//! Returns attribute index from name, -1 if not found
 				virtual s32 findAttribute(const c8* attributeName) = 0;
 
+				//! Returns attribute index from interned name, -1 if not found.
+				//! Names are compared by pointers, keep handles of often used names.
+				virtual s32 findAttribute(
+						const core::InternedString& attributeName) = 0;
+
 				//! Reads attributes from a xml file.
 				//! \param reader The XML reader to read from
 				//! \param readCurrentElementOnly If set to true, reading only works if current element has the name 'attributes' or
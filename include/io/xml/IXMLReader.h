@@ -6,6 +6,7 @@
 #define IRRXMLREADER_H_
 #include "EXmlNodeTypes.h"
 #include "core/engine/IReferenceCounted.h"
+#include "core/collections/InternedString.h"
 
 namespace irrgame
 {
@@ -99,6 +100,12 @@ namespace irrgame
 				 \return Name of the current node or 0 if the node has no name. */
 				virtual const c8* getNodeName() const = 0;
 
+				//! Returns the name of the current node as interned string.
+				/** Names are interned once per node, so elements are compared
+				 with other interned names by pointer. Use it for names of elements,
+				 not for text data. */
+				virtual core::InternedString getInternedNodeName() const = 0;
+
 				//! Returns data of the current node.
 				/** Only non null if the node has some
 				 data and it is of type EXN_TEXT or EXN_UNKNOWN. */
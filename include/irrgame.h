@@ -56,6 +56,12 @@
 
 #include "threads/irrgameMonitor.h"
 #include "threads/irrgameThread.h"
+#include "threads/lock/NullLock.h"
+#include "threads/lock/MonitorLock.h"
+#include "threads/LightweightSemaphore.h"
+#include "threads/queue/MPMCQueue.h"
+#include "threads/queue/SPSCQueue.h"
+#include "threads/queue/BlockingQueue.h"
 
 //video
 #include "video/utils/AbsRectangle.h"
@@ -0,0 +1,226 @@
+/*
+ * SweepAndPrune.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SWEEPANDPRUNE_H_
+#define SWEEPANDPRUNE_H_
+
+#include "core/allocator/LinearArenaAllocator.h"
+#include "core/collections/array.h"
+#include "core/collections/hashmap/hashmap.h"
+#include "core/shapes/aabbox3d.h"
+
+namespace irrgame
+{
+	namespace logic
+	{
+		class IGameObject;
+
+		//! Pair of objects of SweepAndPrune, which begin or end to overlap
+		struct SOverlapPair
+		{
+				//! Smaller handle of pair
+				u32 First;
+
+				//! Bigger handle of pair
+				u32 Second;
+		};
+
+		//! Collision broadphase over axis aligned boxes of game objects.
+		/** Incremental sweep and prune: ends of boxes are kept in one sorted
+		 list per axis. When box moves, its ends are moved by insertion sort,
+		 so cost depends on how far objects move between updates, not on
+		 count of objects. Pairs begin or end to overlap only when ends of
+		 their boxes pass each other, so overlapping pairs are kept up to date
+		 without testing all pairs.
+
+		 Objects are identified by handles, which stay same while object is
+		 in broadphase. Changes of objects are applied by update(), which
+		 reports pairs, which began and ended to overlap since previous
+		 update. Boxes touching each other overlap. Broadphase is not
+		 synchronized. */
+		class SweepAndPrune
+		{
+			public:
+				//! Handle, which is not returned by addObject
+				static const u32 InvalidHandle = 0xFFFFFFFF;
+
+			public:
+				//! Default constructor. Does not allocate.
+				SweepAndPrune();
+
+				//! Destructor
+				virtual ~SweepAndPrune();
+
+				/*
+				 * Methods
+				 */
+
+				//! Adds object with box. Object is inserted by next update.
+				/** \param box Bounds of object. Its edges must be finite and
+				 smaller than SharedMath::MaxFloat by absolute value.
+				 \param object Game object, which is returned by getObject.
+				 May be 0.
+				 \return Handle of object. */
+				u32 addObject(const core::aabbox3d<f32>& box,
+						IGameObject* object = 0);
+
+				//! Removes object. Object is removed by next update, which
+				//! reports end of all its overlaps.
+				/** Handle is reused by addObject after that update, until
+				 then getObject returns object. */
+				void removeObject(u32 handle);
+
+				//! Sets box of object. Object is moved by next update.
+				void setBox(u32 handle, const core::aabbox3d<f32>& box);
+
+				//! Returns box of object
+				const core::aabbox3d<f32>& getBox(u32 handle) const;
+
+				//! Returns game object of handle
+				IGameObject* getObject(u32 handle) const;
+
+				//! Returns count of objects, which are added and not removed
+				u32 getObjectsCount() const;
+
+				//! Applies added, removed and moved objects.
+				/** \param outBegun Pairs, which began to overlap since previous
+				 update. Array is cleared first.
+				 \param outEnded Pairs, which ended to overlap, including pairs
+				 of removed objects. Array is cleared first. Pair which began
+				 and ended between updates is not reported. */
+				void update(core::array<SOverlapPair>& outBegun,
+						core::array<SOverlapPair>& outEnded);
+
+				//! Returns True if boxes of objects overlapped by last update
+				bool isOverlapping(u32 first, u32 second) const;
+
+				//! Returns count of pairs, which overlapped by last update
+				u32 getPairsCount() const;
+
+				//! Removes all objects without reporting their pairs
+				void clear();
+
+			private:
+
+				// Copy constructor and assignment operator deliberately
+				// defined but not implemented.
+				SweepAndPrune(const SweepAndPrune& other);
+				SweepAndPrune& operator=(const SweepAndPrune& other);
+
+			private:
+				//! End of box on one axis
+				struct SEndpoint
+				{
+						f32 Value;
+
+						//! Handle shifted by one, lowest bit is set for maximum
+						u32 Data;
+
+						//! Minimums are before maximums with same value, so
+						//! touching boxes overlap
+						bool operator<(const SEndpoint& other) const
+						{
+							return Value < other.Value
+									|| (Value == other.Value && !(Data & 1)
+											&& (other.Data & 1));
+						}
+				};
+
+				//! Object of broadphase
+				struct SProxy
+				{
+						core::aabbox3d<f32> Box;
+
+						IGameObject* Object;
+
+						//! Indices of minimums (Ends[0]) and maximums (Ends[1])
+						//! in Endpoints of every axis
+						u32 Ends[2][3];
+
+						//! EProxyFlag
+						u32 Flags;
+				};
+
+				//! Flags of SProxy
+				enum EProxyFlag
+				{
+					//! Handle is used by object
+					EPF_USED = 1,
+
+					//! Ends of object are in Endpoints
+					EPF_INSERTED = 2,
+
+					//! Box was changed after insert
+					EPF_MOVED = 4,
+
+					//! Object waits for remove
+					EPF_REMOVED = 8
+				};
+
+			private:
+				//! Inserts, moves and removes objects one by one
+				void updateIncremental();
+
+				//! Sorts Endpoints of all objects and finds overlapping
+				//! pairs from scratch
+				void rebuild();
+
+				//! Moves ends of object to edges of its box
+				void moveProxy(u32 handle);
+
+				//! Moves end at index down, until it is sorted
+				void sortDown(u32 axis, u32 index);
+
+				//! Moves end at index up, until it is sorted
+				void sortUp(u32 axis, u32 index);
+
+				//! Returns True if objects overlap on axes other than axis
+				bool overlapsOnOtherAxes(const SProxy& a, const SProxy& b,
+						u32 axis) const;
+
+				//! Marks pair as overlapping
+				void addPair(u32 first, u32 second);
+
+				//! Marks pair as not overlapping
+				void removePair(u32 first, u32 second);
+
+				//! Reports changed pairs and forgets pairs, which ended
+				void flushPairs(core::array<SOverlapPair>& outBegun,
+						core::array<SOverlapPair>& outEnded);
+
+			private:
+				//! Objects, index is handle
+				core::array<SProxy> Proxies;
+
+				//! Handles of removed objects, which may be reused
+				core::array<u32> FreeHandles;
+
+				//! Handles added, moved and removed since last update
+				core::array<u32> Added;
+				core::array<u32> Moved;
+				core::array<u32> Removed;
+
+				//! Sorted ends of boxes of every axis between two sentinels
+				core::array<SEndpoint> Endpoints[3];
+
+				//! Overlapping pairs by key of handles, value is EPairState
+				core::hashmap<u64, u8> Pairs;
+
+				//! Memory of temporary lists of update, reset at its end
+				core::LinearArena Scratch;
+
+				//! Keys of pairs, which were changed during update
+				core::array<u64, threads::NullLock,
+						core::LinearArenaAllocator<u64> > ChangedPairs;
+
+				u32 ObjectsCount;
+		};
+
+	}  // namespace logic
+}  // namespace irrgame
+
+#endif /* SWEEPANDPRUNE_H_ */
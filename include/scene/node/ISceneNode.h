@@ -39,6 +39,13 @@ namespace irrgame
 				//! Update absolute transformation by data from game object(logic).
 				virtual void updateAbsoluteTransformation() = 0;
 
+				//! Updates absolute transformations of this node and all its descendants.
+				//! Parents are updated before their children.
+				void updateAbsoluteTransformations();
+
+				//! Renders this node and all its descendants in depth-first order.
+				void renderAll();
+
 			protected:
 		};
 	}
@@ -0,0 +1,122 @@
+/*
+ * LightweightSemaphore.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef LIGHTWEIGHTSEMAPHORE_H_
+#define LIGHTWEIGHTSEMAPHORE_H_
+
+#include "threads/irrgameAtomic.h"
+#include "threads/irrgameSemaphore.h"
+
+namespace irrgame
+{
+	namespace threads
+	{
+		//! Counting semaphore, which calls system only to park and wake up threads.
+		/** Count is kept in atomic counter. Negative count is count of parked
+		 threads. Waiting thread spins a bit before it is parked on irrgameSemaphore,
+		 so short waits never enter kernel. */
+		class LightweightSemaphore
+		{
+			public:
+				//! Default constructor
+				//@ param0 - initial count
+				LightweightSemaphore(s32 initialCount = 0);
+
+				//! Destructor
+				~LightweightSemaphore();
+
+				//! Increments count and wakes up to count parked threads
+				void post(u32 count = 1);
+
+				//! Blocks the calling thread until count is greater than zero, then decrements it.
+				void wait();
+
+				//! Decrements count if it is greater than zero. Never blocks.
+				//@ return - True if count was decremented. Otherwise False.
+				bool tryWait();
+
+				//! Returns current count. Result may be outdated immediately.
+				s32 getCount() const;
+
+			private:
+
+				//! Copy constructor. Do not implement.
+				LightweightSemaphore(const LightweightSemaphore& other);
+
+				//! Override equal operator. Do not implement.
+				LightweightSemaphore& operator=(const LightweightSemaphore& other);
+
+			private:
+				s32 Count;
+
+				//! Parked threads are waiting on it
+				irrgameSemaphore* Semaphore;
+		};
+
+		//! Default constructor
+		inline LightweightSemaphore::LightweightSemaphore(s32 initialCount) :
+				Count(initialCount), Semaphore(0)
+		{
+			IRR_ASSERT(initialCount >= 0);
+
+			Semaphore = createIrrgameSemaphore();
+		}
+
+		//! Destructor
+		inline LightweightSemaphore::~LightweightSemaphore()
+		{
+			if (Semaphore)
+				Semaphore->drop();
+		}
+
+		//! Increments count and wakes up to count parked threads
+		inline void LightweightSemaphore::post(u32 count)
+		{
+			const s32 old = irrgameAtomic::fetchAdd(&Count, (s32) count);
+
+			// only threads which made count negative are parked
+			if (old < 0)
+				Semaphore->post((u32) -old < count ? (u32) -old : count);
+		}
+
+		//! Blocks the calling thread until count is greater than zero, then decrements it.
+		inline void LightweightSemaphore::wait()
+		{
+			for (u32 i = 0; i < IRR_SEMAPHORE_SPIN_COUNT; ++i)
+			{
+				if (tryWait())
+					return;
+			}
+
+			if (irrgameAtomic::fetchAdd(&Count, -1) <= 0)
+				Semaphore->wait();
+		}
+
+		//! Decrements count if it is greater than zero. Never blocks.
+		inline bool LightweightSemaphore::tryWait()
+		{
+			s32 count = irrgameAtomic::loadRelaxed(&Count);
+
+			while (count > 0)
+			{
+				if (irrgameAtomic::compareExchange(&Count, count, count - 1))
+					return true;
+			}
+
+			return false;
+		}
+
+		//! Returns current count. Result may be outdated immediately.
+		inline s32 LightweightSemaphore::getCount() const
+		{
+			return irrgameAtomic::loadRelaxed(&Count);
+		}
+
+	}  // namespace threads
+}  // namespace irrgame
+
+#endif /* LIGHTWEIGHTSEMAPHORE_H_ */
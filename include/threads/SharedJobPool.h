@@ -0,0 +1,109 @@
+/*
+ * SharedJobPool.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SHAREDJOBPOOL_H_
+#define SHAREDJOBPOOL_H_
+
+#include "compileConfig.h"
+#include "threads/lock/MonitorLock.h"
+
+namespace irrgame
+{
+	// job pool is used by core collections, so it does not include them
+	template<class TRet, class TParam>
+	class delegate;
+
+	namespace threads
+	{
+		class irrgameSemaphore;
+		class irrgameThread;
+
+		//! Function which proceed part [begin; end) of some job
+		typedef void (*tParallelJob)(void* context, u32 begin, u32 end);
+
+		//! Pool of worker threads for data parallel jobs (fork-join).
+		//! Job is split into bands, which are proceed by workers and calling thread.
+		//! Workers are created on first use, one less than processors count.
+		class SharedJobPool
+		{
+			public:
+				//! Singleton realization
+				static SharedJobPool& getInstance();
+
+			private:
+				//! Default constructor. Should use only one time.
+				SharedJobPool();
+
+				//! Destructor. Should use only one time.
+				virtual ~SharedJobPool();
+
+				//! Copy constructor. Do not implement.
+				SharedJobPool(const SharedJobPool& root);
+
+				//! Override equal operator. Do not implement.
+				const SharedJobPool& operator=(SharedJobPool&);
+
+			public:
+				//! Proceed [0; count) in parallel. Blocks until whole job is done.
+				//! Nested calls from job function are proceed in calling thread.
+				//@ param0 - job function
+				//@ param1 - context passed to job function
+				//@ param2 - count of items
+				//@ param3 - minimal count of items in one band
+				void parallelFor(tParallelJob job, void* context, u32 count,
+						u32 minBandSize = 1);
+
+				//! Returns count of worker threads. Calling thread is not counted.
+				u32 getWorkersCount();
+
+			private:
+				//! Creates worker threads if not created yet
+				void startWorkers();
+
+				//! Worker thread function
+				s32 proceedWorker(void* arg);
+
+				//! Proceed bands of current job until all are taken
+				void proceedBands();
+
+			private:
+				//! Worker threads
+				irrgameThread** Workers;
+				u32 WorkersCount;
+
+				//! Worker thread function
+				delegate<s32, void*>* WorkerCallback;
+
+				//! Workers are waiting on it for new job
+				irrgameSemaphore* WakeUp;
+
+				//! Workers report on it when job is done
+				irrgameSemaphore* Done;
+
+				//! Only one job is proceed at a time
+				MonitorLock JobLock;
+
+				//! Guards creation of workers
+				MonitorLock StartLock;
+
+				//! Current job
+				tParallelJob Job;
+				void* Context;
+				u32 Count;
+				u32 BandSize;
+				u32 BandsCount;
+
+				//! Next band to proceed
+				u32 NextBand;
+
+				//! Non zero while workers are running
+				s32 IsRunning;
+		};
+	}  // namespace threads
+}  // namespace irrgame
+
+#endif /* SHAREDJOBPOOL_H_ */
@@ -0,0 +1,143 @@
+/*
+ * irrgameAtomic.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef IRRGAMEATOMIC_H_
+#define IRRGAMEATOMIC_H_
+
+#include "compileConfig.h"
+
+namespace irrgame
+{
+	namespace threads
+	{
+		//! Atomic operations over plain variables.
+		//! Platform dependent. Uses compiler builtins (gcc, clang).
+		class irrgameAtomic
+		{
+			public:
+				//! Atomically increments value. No ordering guarantees.
+				//! Suitable for increment of reference counters.
+				//@ return - new value
+				template<class T>
+				static T incrementRelaxed(T* value);
+
+				//! Atomically decrements value with acquire-release ordering.
+				//! All writes before decrement are visible to thread which sees zero.
+				//@ return - new value
+				template<class T>
+				static T decrementAcqRel(T* value);
+
+				//! Atomically adds delta to value with acquire-release ordering.
+				//@ return - previous value
+				template<class T>
+				static T fetchAdd(T* value, T delta);
+
+				//! Loads value without ordering guarantees.
+				template<class T>
+				static T loadRelaxed(const T* value);
+
+				//! Loads value with acquire ordering.
+				template<class T>
+				static T loadAcquire(const T* value);
+
+				//! Stores value without ordering guarantees.
+				template<class T>
+				static void storeRelaxed(T* value, T newValue);
+
+				//! Stores value with release ordering.
+				template<class T>
+				static void storeRelease(T* value, T newValue);
+
+				//! Stores newValue into value and returns previous value. Acquire-release ordering.
+				template<class T>
+				static T exchange(T* value, T newValue);
+
+				//! Stores desired into value if value equals expected. Sequentially consistent ordering.
+				//! On failure expected is updated with current value.
+				//@ return - True if value was replaced. Otherwise False.
+				template<class T>
+				static bool compareExchange(T* value, T& expected, T desired);
+
+				//! Full memory barrier
+				static void fence();
+		};
+
+		//! Atomically increments value. No ordering guarantees.
+		template<class T>
+		inline T irrgameAtomic::incrementRelaxed(T* value)
+		{
+			return __atomic_add_fetch(value, 1, __ATOMIC_RELAXED);
+		}
+
+		//! Atomically decrements value with acquire-release ordering.
+		template<class T>
+		inline T irrgameAtomic::decrementAcqRel(T* value)
+		{
+			return __atomic_sub_fetch(value, 1, __ATOMIC_ACQ_REL);
+		}
+
+		//! Atomically adds delta to value with acquire-release ordering.
+		template<class T>
+		inline T irrgameAtomic::fetchAdd(T* value, T delta)
+		{
+			return __atomic_fetch_add(value, delta, __ATOMIC_ACQ_REL);
+		}
+
+		//! Loads value without ordering guarantees.
+		template<class T>
+		inline T irrgameAtomic::loadRelaxed(const T* value)
+		{
+			return __atomic_load_n(value, __ATOMIC_RELAXED);
+		}
+
+		//! Loads value with acquire ordering.
+		template<class T>
+		inline T irrgameAtomic::loadAcquire(const T* value)
+		{
+			return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+		}
+
+		//! Stores value without ordering guarantees.
+		template<class T>
+		inline void irrgameAtomic::storeRelaxed(T* value, T newValue)
+		{
+			__atomic_store_n(value, newValue, __ATOMIC_RELAXED);
+		}
+
+		//! Stores value with release ordering.
+		template<class T>
+		inline void irrgameAtomic::storeRelease(T* value, T newValue)
+		{
+			__atomic_store_n(value, newValue, __ATOMIC_RELEASE);
+		}
+
+		//! Stores newValue into value and returns previous value.
+		template<class T>
+		inline T irrgameAtomic::exchange(T* value, T newValue)
+		{
+			return __atomic_exchange_n(value, newValue, __ATOMIC_ACQ_REL);
+		}
+
+		//! Stores desired into value if value equals expected.
+		template<class T>
+		inline bool irrgameAtomic::compareExchange(T* value, T& expected,
+				T desired)
+		{
+			return __atomic_compare_exchange_n(value, &expected, desired, false,
+					__ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+		}
+
+		//! Full memory barrier
+		inline void irrgameAtomic::fence()
+		{
+			__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		}
+
+	}  // namespace threads
+}  // namespace irrgame
+
+#endif /* IRRGAMEATOMIC_H_ */
@@ -0,0 +1,40 @@
+/*
+ * irrgameSemaphore.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef IRRGAMESEMAPHORE_H_
+#define IRRGAMESEMAPHORE_H_
+
+#include "core/engine/IReferenceCounted.h"
+
+namespace irrgame
+{
+	namespace threads
+	{
+		//! Counting semaphore. Use it for park threads without busy waiting.
+		class irrgameSemaphore: public IReferenceCounted
+		{
+			public:
+				//! Destructor
+				virtual ~irrgameSemaphore()
+				{
+				}
+
+				//! Increments counter and wakes up to count waiting threads.
+				//! Platform dependent
+				virtual void post(u32 count = 1) = 0;
+
+				//! Blocks the calling thread until counter is greater than zero, then decrements it.
+				//! Platform dependent
+				virtual void wait() = 0;
+		};
+
+		//! irrgameSemaphore creator. Internal function. Please do not use.
+		irrgameSemaphore* createIrrgameSemaphore(u32 initialCount = 0);
+	}
+}
+
+#endif /* IRRGAMESEMAPHORE_H_ */
@@ -43,6 +43,10 @@ namespace irrgame
 				//! Returns current thread id
 				static s32 getCurrentThreadID();
 
+				//! Returns count of hardware threads which can run concurrently.
+				//! Platform dependent
+				static u32 getProcessorsCount();
+
 			public:
 
 				//! Destructor
@@ -71,6 +75,12 @@ namespace irrgame
 				//! Gets callback input args
 				virtual void* getCallbackArg();
 
+			protected:
+				//! Runs callback, then releases caches of current thread.
+				//! Platform realization must call it as body of thread instead
+				//! of calling callback directly.
+				s32 proceedCallback();
+
 			protected:
 				//! Thread name
 				core::stringc Name;
@@ -0,0 +1,86 @@
+/*
+ * MonitorLock.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef MONITORLOCK_H_
+#define MONITORLOCK_H_
+
+#include "threads/irrgameMonitor.h"
+
+namespace irrgame
+{
+	namespace threads
+	{
+		//! Lock policy which guards every access with own irrgameMonitor.
+		//! Use it for collections which are shared between threads.
+		class MonitorLock
+		{
+			public:
+				//! Default constructor
+				MonitorLock();
+
+				//! Copy constructor. Creates new monitor, monitors are never shared.
+				MonitorLock(const MonitorLock& other);
+
+				//! Destructor
+				~MonitorLock();
+
+				//! Assignment operator. Keeps own monitor.
+				MonitorLock& operator=(const MonitorLock& other);
+
+				//! Acquires a lock
+				void enter() const;
+
+				//! Releases a lock
+				void exit() const;
+
+			private:
+				irrgameMonitor* Monitor;
+		};
+
+		//! Default constructor
+		inline MonitorLock::MonitorLock() :
+				Monitor(0)
+		{
+			Monitor = createIrrgameMonitor();
+		}
+
+		//! Copy constructor. Creates new monitor, monitors are never shared.
+		inline MonitorLock::MonitorLock(const MonitorLock&) :
+				Monitor(0)
+		{
+			Monitor = createIrrgameMonitor();
+		}
+
+		//! Destructor
+		inline MonitorLock::~MonitorLock()
+		{
+			if (Monitor)
+				Monitor->drop();
+		}
+
+		//! Assignment operator. Keeps own monitor.
+		inline MonitorLock& MonitorLock::operator=(const MonitorLock&)
+		{
+			return *this;
+		}
+
+		//! Acquires a lock
+		inline void MonitorLock::enter() const
+		{
+			Monitor->enter();
+		}
+
+		//! Releases a lock
+		inline void MonitorLock::exit() const
+		{
+			Monitor->exit();
+		}
+
+	}  // namespace threads
+}  // namespace irrgame
+
+#endif /* MONITORLOCK_H_ */
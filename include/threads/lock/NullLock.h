@@ -0,0 +1,42 @@
+/*
+ * NullLock.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef NULLLOCK_H_
+#define NULLLOCK_H_
+
+#include "compileConfig.h"
+
+namespace irrgame
+{
+	namespace threads
+	{
+		//! Lock policy which does nothing.
+		//! Default policy for collections. Owner of the collection is responsible for synchronization.
+		class NullLock
+		{
+			public:
+				//! Does nothing
+				void enter() const;
+
+				//! Does nothing
+				void exit() const;
+		};
+
+		//! Does nothing
+		inline void NullLock::enter() const
+		{
+		}
+
+		//! Does nothing
+		inline void NullLock::exit() const
+		{
+		}
+
+	}  // namespace threads
+}  // namespace irrgame
+
+#endif /* NULLLOCK_H_ */
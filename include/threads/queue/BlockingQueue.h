@@ -0,0 +1,185 @@
+/*
+ * BlockingQueue.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef BLOCKINGQUEUE_H_
+#define BLOCKINGQUEUE_H_
+
+#include "threads/queue/MPMCQueue.h"
+#include "threads/queue/SPSCQueue.h"
+#include "threads/LightweightSemaphore.h"
+#include "threads/irrgameThread.h"
+
+namespace irrgame
+{
+	namespace threads
+	{
+		//! Bounded queue, which parks consumers while it is empty and producers
+		//! while it is full.
+		/** Wraps MPMCQueue or SPSCQueue. Count of elements and count of free
+		 cells are kept in two LightweightSemaphore, so threads enter kernel only
+		 when they really have to sleep. Thread rules of TQueue are kept, for
+		 example BlockingQueue<T, SPSCQueue<T> > has one producer and one consumer. */
+		template<class T, class TQueue = MPMCQueue<T> >
+		class BlockingQueue
+		{
+			public:
+				//! Default constructor
+				//@ param0 - capacity, must be power of two
+				BlockingQueue(u32 capacity = 1024);
+
+				//! Destructor
+				~BlockingQueue();
+
+				//! Adds element to the tail. Blocks while queue is full.
+				void push(const T& element);
+
+				//! Adds element to the tail if queue is not full. Never blocks.
+				//! Return False if queue is full.
+				bool tryPush(const T& element);
+
+				//! Takes element from the head. Blocks while queue is empty.
+				void pop(T& element);
+
+				//! Takes element from the head if queue is not empty. Never blocks.
+				//! Return False if queue is empty.
+				bool tryPop(T& element);
+
+				//! Return True if queue looks empty. Result may be outdated immediately.
+				bool empty() const;
+
+				//! Returns count of elements. Result may be outdated immediately.
+				u32 size() const;
+
+				//! Returns maximal count of elements
+				u32 getCapacity() const;
+
+			private:
+
+				//! Copy constructor. Do not implement.
+				BlockingQueue(const BlockingQueue& other);
+
+				//! Override equal operator. Do not implement.
+				BlockingQueue& operator=(const BlockingQueue& other);
+
+				//! Adds element after free cell was acquired
+				void pushAcquired(const T& element);
+
+				//! Takes element after it was acquired
+				void popAcquired(T& element);
+
+			private:
+				TQueue Queue;
+
+				//! Count of elements, which are acquired by consumers
+				LightweightSemaphore Elements;
+
+				//! Count of free cells, which are acquired by producers
+				LightweightSemaphore Cells;
+		};
+
+		//! Default constructor
+		template<class T, class TQueue>
+		inline BlockingQueue<T, TQueue>::BlockingQueue(u32 capacity) :
+				Queue(capacity), Elements(0), Cells((s32) capacity)
+		{
+		}
+
+		//! Destructor
+		template<class T, class TQueue>
+		inline BlockingQueue<T, TQueue>::~BlockingQueue()
+		{
+		}
+
+		//! Adds element to the tail. Blocks while queue is full.
+		template<class T, class TQueue>
+		inline void BlockingQueue<T, TQueue>::push(const T& element)
+		{
+			Cells.wait();
+			pushAcquired(element);
+		}
+
+		//! Adds element to the tail if queue is not full. Never blocks.
+		template<class T, class TQueue>
+		inline bool BlockingQueue<T, TQueue>::tryPush(const T& element)
+		{
+			if (!Cells.tryWait())
+				return false;
+
+			pushAcquired(element);
+
+			return true;
+		}
+
+		//! Takes element from the head. Blocks while queue is empty.
+		template<class T, class TQueue>
+		inline void BlockingQueue<T, TQueue>::pop(T& element)
+		{
+			Elements.wait();
+			popAcquired(element);
+		}
+
+		//! Takes element from the head if queue is not empty. Never blocks.
+		template<class T, class TQueue>
+		inline bool BlockingQueue<T, TQueue>::tryPop(T& element)
+		{
+			if (!Elements.tryWait())
+				return false;
+
+			popAcquired(element);
+
+			return true;
+		}
+
+		//! Return True if queue looks empty.
+		template<class T, class TQueue>
+		inline bool BlockingQueue<T, TQueue>::empty() const
+		{
+			return Queue.empty();
+		}
+
+		//! Returns count of elements.
+		template<class T, class TQueue>
+		inline u32 BlockingQueue<T, TQueue>::size() const
+		{
+			return Queue.size();
+		}
+
+		//! Returns maximal count of elements
+		template<class T, class TQueue>
+		inline u32 BlockingQueue<T, TQueue>::getCapacity() const
+		{
+			return Queue.getCapacity();
+		}
+
+		//! Adds element after free cell was acquired
+		template<class T, class TQueue>
+		inline void BlockingQueue<T, TQueue>::pushAcquired(const T& element)
+		{
+			// cells are freed out of order, so cell at next position
+			// may be still taken by slower consumer for a moment
+			while (!Queue.push(element))
+				irrgameThread::sleep(0);
+
+			Elements.post();
+		}
+
+		//! Takes element after it was acquired
+		template<class T, class TQueue>
+		inline void BlockingQueue<T, TQueue>::popAcquired(T& element)
+		{
+			// elements are added out of order, so element at next position
+			// may be still written by slower producer for a moment
+			while (!Queue.pop(element))
+				irrgameThread::sleep(0);
+
+			Cells.post();
+		}
+
+	}  // namespace threads
+}  // namespace irrgame
+
+#endif /* BLOCKINGQUEUE_H_ */
@@ -0,0 +1,216 @@
+/*
+ * MPMCQueue.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef MPMCQUEUE_H_
+#define MPMCQUEUE_H_
+
+#include "threads/irrgameAtomic.h"
+#include "core/utils/typeTraits.h"
+
+namespace irrgame
+{
+	namespace threads
+	{
+		//! Bounded lock-free multi producer multi consumer queue (Vyukov).
+		/** Ring of cells, every cell has sequence number, which tells whether
+		 cell is free for push or ready for pop on current lap. Producers and
+		 consumers only race for own position counter by compare exchange, so
+		 push and pop do not touch each other cache lines while queue is neither
+		 empty nor full. Any thread may call push() and pop().
+		 T must be default constructible. */
+		template<class T>
+		class MPMCQueue
+		{
+			public:
+				//! Default constructor
+				//@ param0 - capacity, must be power of two
+				MPMCQueue(u32 capacity = 1024);
+
+				//! Destructor
+				~MPMCQueue();
+
+				//! Adds element to the tail.
+				//! Return False if queue is full.
+				bool push(const T& element);
+
+				//! Takes element from the head.
+				//! Return False if queue is empty.
+				bool pop(T& element);
+
+				//! Return True if queue looks empty. Result may be outdated immediately.
+				bool empty() const;
+
+				//! Returns count of elements. Result may be outdated immediately.
+				u32 size() const;
+
+				//! Returns maximal count of elements
+				u32 getCapacity() const;
+
+			private:
+
+				//! Copy constructor. Do not implement.
+				MPMCQueue(const MPMCQueue& other);
+
+				//! Override equal operator. Do not implement.
+				MPMCQueue& operator=(const MPMCQueue& other);
+
+			private:
+				struct SCell
+				{
+						//! Equals to position of push, which may fill the cell,
+						//! or to position of pop plus one, which may take element.
+						u32 Sequence;
+						T Element;
+				};
+
+				SCell* Buffer;
+				u32 Mask;
+
+				c8 Padding0[IRR_CACHE_LINE_SIZE];
+
+				//! Position of next push
+				u32 EnqueuePos;
+
+				c8 Padding1[IRR_CACHE_LINE_SIZE];
+
+				//! Position of next pop
+				u32 DequeuePos;
+
+				c8 Padding2[IRR_CACHE_LINE_SIZE];
+		};
+
+		//! Default constructor
+		template<class T>
+		inline MPMCQueue<T>::MPMCQueue(u32 capacity) :
+				Buffer(0), Mask(capacity - 1), EnqueuePos(0), DequeuePos(0)
+		{
+			// capacity must be power of two
+			IRR_ASSERT(capacity > 1 && (capacity & (capacity - 1)) == 0);
+
+			Buffer = new SCell[capacity];
+
+			for (u32 i = 0; i < capacity; ++i)
+				Buffer[i].Sequence = i;
+		}
+
+		//! Destructor
+		template<class T>
+		inline MPMCQueue<T>::~MPMCQueue()
+		{
+			delete[] Buffer;
+		}
+
+		//! Adds element to the tail.
+		template<class T>
+		inline bool MPMCQueue<T>::push(const T& element)
+		{
+			u32 pos = irrgameAtomic::loadRelaxed(&EnqueuePos);
+			SCell* cell = 0;
+
+			while (true)
+			{
+				cell = &Buffer[pos & Mask];
+
+				const s32 diff = (s32) (irrgameAtomic::loadAcquire(&cell->Sequence)
+						- pos);
+
+				if (diff == 0)
+				{
+					// cell is free, claim position. On failure pos is reloaded.
+					if (irrgameAtomic::compareExchange(&EnqueuePos, pos, pos + 1))
+						break;
+				}
+				else if (diff < 0)
+				{
+					// cell is not taken on previous lap yet
+					return false;
+				}
+				else
+				{
+					// other producer claimed position
+					pos = irrgameAtomic::loadRelaxed(&EnqueuePos);
+				}
+			}
+
+			cell->Element = element;
+
+			// element must be visible before cell is marked as ready
+			irrgameAtomic::storeRelease(&cell->Sequence, pos + 1);
+
+			return true;
+		}
+
+		//! Takes element from the head.
+		template<class T>
+		inline bool MPMCQueue<T>::pop(T& element)
+		{
+			u32 pos = irrgameAtomic::loadRelaxed(&DequeuePos);
+			SCell* cell = 0;
+
+			while (true)
+			{
+				cell = &Buffer[pos & Mask];
+
+				const s32 diff = (s32) (irrgameAtomic::loadAcquire(&cell->Sequence)
+						- (pos + 1));
+
+				if (diff == 0)
+				{
+					// cell is ready, claim position. On failure pos is reloaded.
+					if (irrgameAtomic::compareExchange(&DequeuePos, pos, pos + 1))
+						break;
+				}
+				else if (diff < 0)
+				{
+					// cell is not filled on this lap yet
+					return false;
+				}
+				else
+				{
+					// other consumer claimed position
+					pos = irrgameAtomic::loadRelaxed(&DequeuePos);
+				}
+			}
+
+			element = core::move(cell->Element);
+
+			// free cell for push on next lap
+			irrgameAtomic::storeRelease(&cell->Sequence, pos + Mask + 1);
+
+			return true;
+		}
+
+		//! Return True if queue looks empty.
+		template<class T>
+		inline bool MPMCQueue<T>::empty() const
+		{
+			return size() == 0;
+		}
+
+		//! Returns count of elements.
+		template<class T>
+		inline u32 MPMCQueue<T>::size() const
+		{
+			const u32 dequeuePos = irrgameAtomic::loadAcquire(&DequeuePos);
+			const s32 result = (s32) (irrgameAtomic::loadAcquire(&EnqueuePos)
+					- dequeuePos);
+
+			// positions are loaded not at once, pop may overtake push
+			return result > 0 ? (u32) result : 0;
+		}
+
+		//! Returns maximal count of elements
+		template<class T>
+		inline u32 MPMCQueue<T>::getCapacity() const
+		{
+			return Mask + 1;
+		}
+
+	}  // namespace threads
+}  // namespace irrgame
+
+#endif /* MPMCQUEUE_H_ */
@@ -0,0 +1,172 @@
+/*
+ * SPSCQueue.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SPSCQUEUE_H_
+#define SPSCQUEUE_H_
+
+#include "threads/irrgameAtomic.h"
+#include "core/utils/typeTraits.h"
+
+namespace irrgame
+{
+	namespace threads
+	{
+		//! Bounded wait-free single producer single consumer queue.
+		/** Only one thread may call push() and only one thread may call pop().
+		 Both finish in constant count of steps. Every side keeps copy of other
+		 side position and reloads it only when queue looks full or empty.
+		 T must be default constructible. */
+		template<class T>
+		class SPSCQueue
+		{
+			public:
+				//! Default constructor
+				//@ param0 - capacity, must be power of two
+				SPSCQueue(u32 capacity = 1024);
+
+				//! Destructor
+				~SPSCQueue();
+
+				//! Adds element to the tail. Producer thread only.
+				//! Return False if queue is full.
+				bool push(const T& element);
+
+				//! Takes element from the head. Consumer thread only.
+				//! Return False if queue is empty.
+				bool pop(T& element);
+
+				//! Return True if queue looks empty. Result may be outdated immediately.
+				bool empty() const;
+
+				//! Returns count of elements. Result may be outdated immediately.
+				u32 size() const;
+
+				//! Returns maximal count of elements
+				u32 getCapacity() const;
+
+			private:
+
+				//! Copy constructor. Do not implement.
+				SPSCQueue(const SPSCQueue& other);
+
+				//! Override equal operator. Do not implement.
+				SPSCQueue& operator=(const SPSCQueue& other);
+
+			private:
+				T* Buffer;
+				u32 Mask;
+
+				c8 Padding0[IRR_CACHE_LINE_SIZE];
+
+				//! Position of next push. Written by producer.
+				u32 Tail;
+
+				//! Copy of Head, which is known to producer
+				u32 HeadCache;
+
+				c8 Padding1[IRR_CACHE_LINE_SIZE];
+
+				//! Position of next pop. Written by consumer.
+				u32 Head;
+
+				//! Copy of Tail, which is known to consumer
+				u32 TailCache;
+
+				c8 Padding2[IRR_CACHE_LINE_SIZE];
+		};
+
+		//! Default constructor
+		template<class T>
+		inline SPSCQueue<T>::SPSCQueue(u32 capacity) :
+				Buffer(0), Mask(capacity - 1), Tail(0), HeadCache(0), Head(0), TailCache(
+						0)
+		{
+			// capacity must be power of two
+			IRR_ASSERT(capacity > 0 && (capacity & (capacity - 1)) == 0);
+
+			Buffer = new T[capacity];
+		}
+
+		//! Destructor
+		template<class T>
+		inline SPSCQueue<T>::~SPSCQueue()
+		{
+			delete[] Buffer;
+		}
+
+		//! Adds element to the tail. Producer thread only.
+		template<class T>
+		inline bool SPSCQueue<T>::push(const T& element)
+		{
+			const u32 tail = irrgameAtomic::loadRelaxed(&Tail);
+
+			if (tail - HeadCache > Mask)
+			{
+				HeadCache = irrgameAtomic::loadAcquire(&Head);
+
+				if (tail - HeadCache > Mask)
+					return false;
+			}
+
+			Buffer[tail & Mask] = element;
+
+			// element must be visible before new tail
+			irrgameAtomic::storeRelease(&Tail, tail + 1);
+
+			return true;
+		}
+
+		//! Takes element from the head. Consumer thread only.
+		template<class T>
+		inline bool SPSCQueue<T>::pop(T& element)
+		{
+			const u32 head = irrgameAtomic::loadRelaxed(&Head);
+
+			if (head == TailCache)
+			{
+				TailCache = irrgameAtomic::loadAcquire(&Tail);
+
+				if (head == TailCache)
+					return false;
+			}
+
+			element = core::move(Buffer[head & Mask]);
+
+			// element must be taken before its cell is given to producer
+			irrgameAtomic::storeRelease(&Head, head + 1);
+
+			return true;
+		}
+
+		//! Return True if queue looks empty.
+		template<class T>
+		inline bool SPSCQueue<T>::empty() const
+		{
+			return size() == 0;
+		}
+
+		//! Returns count of elements.
+		template<class T>
+		inline u32 SPSCQueue<T>::size() const
+		{
+			const u32 head = irrgameAtomic::loadAcquire(&Head);
+			const s32 result = (s32) (irrgameAtomic::loadAcquire(&Tail) - head);
+
+			return result > 0 ? (u32) result : 0;
+		}
+
+		//! Returns maximal count of elements
+		template<class T>
+		inline u32 SPSCQueue<T>::getCapacity() const
+		{
+			return Mask + 1;
+		}
+
+	}  // namespace threads
+}  // namespace irrgame
+
+#endif /* SPSCQUEUE_H_ */
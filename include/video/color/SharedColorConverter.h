@@ -15,6 +15,8 @@ namespace irrgame
 {
 	namespace video
 	{
+		struct SColorConverterSIMD;
+
 		class SharedColorConverter
 		{
 
@@ -103,6 +105,15 @@ namespace irrgame
 				void convert32BitTo32Bit(const s32* in, s32* out, s32 width,
 						s32 height, s32 linepad, bool flip = false);
 
+				//! Selects SIMD part of bulk conversions. By default it is the
+				//! best set supported by processor.
+				/** \param conversions: Conversions of supported set, see
+				 getColorConverterSSSE3, or 0 to convert by scalar code only. */
+				void setSIMD(const SColorConverterSIMD* conversions);
+
+				//! Returns SIMD part of bulk conversions, 0 if there is none
+				const SColorConverterSIMD* getSIMD() const;
+
 				//! functions for converting one image format to another efficiently
 				//! and hopefully correctly.
 				//!
@@ -149,6 +160,10 @@ namespace irrgame
 				void convert_R5G6B5toA1R5G5B5(const void* sP, s32 sN, void* dP);
 				void convert_viaFormat(const void* sP, EColorFormat sF, s32 sN,
 						void* dP, EColorFormat dF);
+
+			private:
+				//! SIMD versions of bulk conversions. 0 if not supported.
+				const SColorConverterSIMD* SIMD;
 		};
 	}  // namespace video
 }  // namespace irrgame
@@ -18,6 +18,7 @@ namespace irrgame
 		/** Usually used for tangent space normal mapping. */
 		class vertex3dTangents: public vertex3d
 		{
+			public:
 				//! Default constructor
 				vertex3dTangents();
 
@@ -0,0 +1,220 @@
+/*
+ * LinearArena.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#include "core/allocator/LinearArena.h"
+
+#include <new>
+#include <string.h>
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Header of memory chunk, data follows it
+		struct LinearArena::SChunk
+		{
+				SChunk* Next;
+				size_t Size;
+				size_t Used;
+		};
+
+		//! Constructor. Does not allocate.
+		LinearArena::LinearArena(size_t chunkSize) :
+				First(0), Current(0), ChunkSize(chunkSize), AllocatedSize(0),
+				SystemAllocationCount(0)
+		{
+		}
+
+		//! Destructor. Frees all chunks.
+		LinearArena::~LinearArena()
+		{
+			freeChunks();
+		}
+
+		/*
+		 * Methods
+		 */
+
+		//! Allocates memory block
+		void* LinearArena::allocate(size_t size, size_t alignment)
+		{
+			IRR_ASSERT(alignment && (alignment & (alignment - 1)) == 0);
+
+			SChunk* chunk = Current;
+
+			while (chunk)
+			{
+				const size_t start = (size_t) (chunk + 1);
+				const size_t aligned = (start + chunk->Used + alignment - 1)
+						& ~(alignment - 1);
+
+				if (aligned + size <= start + chunk->Size)
+				{
+					chunk->Used = aligned + size - start;
+					Current = chunk;
+
+					return (void*) aligned;
+				}
+
+				// following chunks are free after rewind or reset
+				chunk = chunk->Next;
+
+				if (chunk)
+					chunk->Used = 0;
+			}
+
+			const size_t required = size + alignment;
+
+			createChunk(required > ChunkSize ? required : ChunkSize);
+
+			return allocate(size, alignment);
+		}
+
+		//! Resizes memory block
+		void* LinearArena::reallocate(void* ptr, size_t oldSize, size_t size,
+				size_t alignment)
+		{
+			if (ptr && Current)
+			{
+				const size_t start = (size_t) (Current + 1);
+				const size_t block = (size_t) ptr;
+
+				// last block grows or shrinks without copy
+				if (block + oldSize == start + Current->Used
+						&& block + size <= start + Current->Size)
+				{
+					Current->Used = block + size - start;
+					return ptr;
+				}
+			}
+
+			void* result = allocate(size, alignment);
+
+			if (ptr)
+				memcpy(result, ptr, oldSize < size ? oldSize : size);
+
+			return result;
+		}
+
+		//! Releases all blocks. Chunks are kept for reuse.
+		void LinearArena::reset()
+		{
+			if (First && First->Next)
+			{
+				// merge chunks, so next frame fits into one chunk
+				const size_t size = AllocatedSize;
+
+				freeChunks();
+				createChunk(size);
+			}
+
+			Current = First;
+
+			if (Current)
+				Current->Used = 0;
+		}
+
+		//! Returns current position of arena
+		SArenaMarker LinearArena::getMarker() const
+		{
+			SArenaMarker result;
+
+			result.Chunk = Current;
+			result.Used = Current ? Current->Used : 0;
+
+			return result;
+		}
+
+		//! Releases all blocks allocated after marker was taken
+		void LinearArena::rewind(const SArenaMarker& marker)
+		{
+			if (!marker.Chunk)
+			{
+				Current = First;
+
+				if (Current)
+					Current->Used = 0;
+
+				return;
+			}
+
+			Current = static_cast<SChunk*>(marker.Chunk);
+			Current->Used = marker.Used;
+		}
+
+		//! Returns count of bytes used by blocks
+		size_t LinearArena::getUsedSize() const
+		{
+			size_t result = 0;
+
+			for (SChunk* chunk = First; chunk; chunk = chunk->Next)
+			{
+				result += chunk->Used;
+
+				if (chunk == Current)
+					break;
+			}
+
+			return result;
+		}
+
+		//! Returns count of bytes allocated from system
+		size_t LinearArena::getAllocatedSize() const
+		{
+			return AllocatedSize;
+		}
+
+		//! Returns count of system allocations made by arena
+		u32 LinearArena::getSystemAllocationCount() const
+		{
+			return SystemAllocationCount;
+		}
+
+		//! Allocates chunk and links it after current one
+		LinearArena::SChunk* LinearArena::createChunk(size_t size)
+		{
+			SChunk* chunk = static_cast<SChunk*>(operator new(
+					sizeof(SChunk) + size));
+
+			chunk->Size = size;
+			chunk->Used = 0;
+
+			if (Current)
+			{
+				chunk->Next = Current->Next;
+				Current->Next = chunk;
+			}
+			else
+			{
+				chunk->Next = First;
+				First = chunk;
+			}
+
+			Current = chunk;
+
+			AllocatedSize += size;
+			++SystemAllocationCount;
+
+			return chunk;
+		}
+
+		//! Frees all chunks
+		void LinearArena::freeChunks()
+		{
+			while (First)
+			{
+				SChunk* next = First->Next;
+				operator delete(First);
+				First = next;
+			}
+
+			Current = 0;
+			AllocatedSize = 0;
+		}
+
+	}  // namespace core
+}  // namespace irrgame
@@ -0,0 +1,239 @@
+/*
+ * SharedSlabAllocator.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#include "core/allocator/SharedSlabAllocator.h"
+#include "threads/irrgameAtomic.h"
+
+#include <new>
+
+namespace irrgame
+{
+	namespace core
+	{
+#ifdef IRR_SLAB_ALLOCATOR
+		//! Cache of free blocks of current thread. Created on first use.
+		static IRR_THREAD_LOCAL void* CurrentThreadCache = 0;
+#endif
+
+		//! Singleton realization
+		SharedSlabAllocator& SharedSlabAllocator::getInstance()
+		{
+			static SharedSlabAllocator instance;
+			return instance;
+		}
+
+		//! Default constructor. Should use only one time.
+		SharedSlabAllocator::SharedSlabAllocator() :
+				SpansCount(0)
+		{
+			for (u32 i = 0; i < ClassesCount; ++i)
+			{
+				Depot[i] = 0;
+				DepotLocks[i] = 0;
+			}
+		}
+
+		//! Destructor. Should use only one time.
+		SharedSlabAllocator::~SharedSlabAllocator()
+		{
+		}
+
+		//! Allocates block of given size
+		void* SharedSlabAllocator::allocate(size_t size)
+		{
+#ifdef IRR_SLAB_ALLOCATOR
+			if (size <= MaxBlockSize)
+			{
+				const u32 sizeClass = size ? (u32) (size - 1) / ClassStep : 0;
+				SThreadCache* cache = getThreadCache();
+
+				if (!cache->Blocks[sizeClass])
+					refill(cache, sizeClass);
+
+				SBlock* block = cache->Blocks[sizeClass];
+
+				cache->Blocks[sizeClass] = block->Next;
+				--cache->Counts[sizeClass];
+
+				return block;
+			}
+#endif
+			return operator new(size);
+		}
+
+		//! Frees block. Size must be same as passed to allocate.
+		void SharedSlabAllocator::deallocate(void* ptr, size_t size)
+		{
+			if (!ptr)
+				return;
+
+#ifdef IRR_SLAB_ALLOCATOR
+			if (size <= MaxBlockSize)
+			{
+				const u32 sizeClass = size ? (u32) (size - 1) / ClassStep : 0;
+				SThreadCache* cache = getThreadCache();
+
+				SBlock* block = static_cast<SBlock*>(ptr);
+
+				block->Next = cache->Blocks[sizeClass];
+				cache->Blocks[sizeClass] = block;
+
+				// keep one batch for next allocations, give other to depot
+				if (++cache->Counts[sizeClass] >= 2 * BatchSize)
+					release(cache, sizeClass, BatchSize);
+
+				return;
+			}
+#endif
+			operator delete(ptr);
+		}
+
+		//! Returns all blocks cached by current thread to depot.
+		void SharedSlabAllocator::flushThreadCache()
+		{
+#ifdef IRR_SLAB_ALLOCATOR
+			SThreadCache* cache = static_cast<SThreadCache*>(CurrentThreadCache);
+
+			if (!cache)
+				return;
+
+			for (u32 i = 0; i < ClassesCount; ++i)
+			{
+				if (cache->Counts[i])
+					release(cache, i, cache->Counts[i]);
+			}
+
+			CurrentThreadCache = 0;
+
+			delete cache;
+#endif
+		}
+
+		//! Returns count of spans taken from system
+		u32 SharedSlabAllocator::getSpansCount() const
+		{
+			return threads::irrgameAtomic::loadRelaxed(&SpansCount);
+		}
+
+		//! Returns free blocks cache of current thread
+		SharedSlabAllocator::SThreadCache* SharedSlabAllocator::getThreadCache()
+		{
+#ifdef IRR_SLAB_ALLOCATOR
+			SThreadCache* cache = static_cast<SThreadCache*>(CurrentThreadCache);
+
+			if (!cache)
+			{
+				cache = new SThreadCache();
+
+				for (u32 i = 0; i < ClassesCount; ++i)
+				{
+					cache->Blocks[i] = 0;
+					cache->Counts[i] = 0;
+				}
+
+				CurrentThreadCache = cache;
+			}
+
+			return cache;
+#else
+			return 0;
+#endif
+		}
+
+		//! Fills empty thread cache from depot or new span
+		void SharedSlabAllocator::refill(SThreadCache* cache, u32 sizeClass)
+		{
+			lockDepot(sizeClass);
+
+			SBlock* first = Depot[sizeClass];
+			SBlock* last = first;
+			u32 count = first ? 1 : 0;
+
+			while (last && last->Next && count < BatchSize)
+			{
+				last = last->Next;
+				++count;
+			}
+
+			if (last)
+			{
+				Depot[sizeClass] = last->Next;
+				last->Next = 0;
+			}
+
+			unlockDepot(sizeClass);
+
+			if (!first)
+			{
+				// carve new span into blocks of size class
+				const u32 blockSize = (sizeClass + 1) * ClassStep;
+				u8* span = static_cast<u8*>(operator new(SpanSize));
+
+				count = SpanSize / blockSize;
+
+				for (u32 i = 0; i < count; ++i)
+				{
+					SBlock* block = reinterpret_cast<SBlock*>(span
+							+ i * blockSize);
+					block->Next =
+							i + 1 < count ?
+									reinterpret_cast<SBlock*>(span
+											+ (i + 1) * blockSize) :
+									0;
+				}
+
+				first = reinterpret_cast<SBlock*>(span);
+
+				threads::irrgameAtomic::incrementRelaxed(&SpansCount);
+			}
+
+			cache->Blocks[sizeClass] = first;
+			cache->Counts[sizeClass] = count;
+		}
+
+		//! Moves count first blocks of thread cache to depot
+		void SharedSlabAllocator::release(SThreadCache* cache, u32 sizeClass,
+				u32 count)
+		{
+			SBlock* first = cache->Blocks[sizeClass];
+			SBlock* last = first;
+
+			for (u32 i = 1; i < count; ++i)
+				last = last->Next;
+
+			cache->Blocks[sizeClass] = last->Next;
+			cache->Counts[sizeClass] -= count;
+
+			lockDepot(sizeClass);
+
+			last->Next = Depot[sizeClass];
+			Depot[sizeClass] = first;
+
+			unlockDepot(sizeClass);
+		}
+
+		//! Acquires spin lock of depot of size class
+		void SharedSlabAllocator::lockDepot(u32 sizeClass)
+		{
+			while (threads::irrgameAtomic::exchange(DepotLocks + sizeClass, 1)
+					!= 0)
+			{
+				while (threads::irrgameAtomic::loadRelaxed(
+						DepotLocks + sizeClass) != 0)
+				{
+				}
+			}
+		}
+
+		//! Releases spin lock of depot of size class
+		void SharedSlabAllocator::unlockDepot(u32 sizeClass)
+		{
+			threads::irrgameAtomic::storeRelease(DepotLocks + sizeClass, 0);
+		}
+
+	}  // namespace core
+}  // namespace irrgame
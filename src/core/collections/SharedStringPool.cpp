@@ -0,0 +1,274 @@
+/*
+ * SharedStringPool.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#include "core/collections/SharedStringPool.h"
+#include "threads/irrgameAtomic.h"
+
+#include <string.h>
+#include <stddef.h>
+
+using namespace irrgame::threads;
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Entry of empty string. Hash is FNV-1a hash of empty string.
+		const SInternedStringEntry InternedEmptyString =
+		{ 2166136261u, 0,
+		{ 0 } };
+
+		//! Constructor. Interns str.
+		InternedString::InternedString(const c8* str) :
+				Entry(&InternedEmptyString)
+		{
+			IRR_ASSERT(str != 0);
+
+			Entry = SharedStringPool::getInstance().intern(str).Entry;
+		}
+
+		//! Singleton realization
+		SharedStringPool& SharedStringPool::getInstance()
+		{
+			static SharedStringPool instance;
+			return instance;
+		}
+
+		//! Default constructor. Should use only one time.
+		SharedStringPool::SharedStringPool()
+		{
+		}
+
+		//! Destructor. Should use only one time.
+		SharedStringPool::~SharedStringPool()
+		{
+		}
+
+		//! Returns handle of str. Stores str if it was not interned yet.
+		InternedString SharedStringPool::intern(const c8* str)
+		{
+			u32 length = 0;
+			const u32 hash = hashString(str, length);
+
+			if (length == 0)
+				return InternedString();
+
+			SShard& shard = getShard(hash);
+
+			// most of strings are already interned
+			const SInternedStringEntry* result = findEntry(shard, str, length,
+					hash);
+
+			if (result)
+				return InternedString(result);
+
+			shard.Lock.enter();
+
+			// other thread could intern it while lock was taken
+			result = findEntry(shard.Table, str, length, hash);
+
+			if (!result)
+			{
+				// keep table at most half full, so probe sequences stay short
+				if (!shard.Table || (shard.Count + 1) * 2 > shard.Table->Mask + 1)
+					grow(shard);
+
+				SInternedStringEntry* entry =
+						static_cast<SInternedStringEntry*>(shard.Arena.allocate(
+								offsetof(SInternedStringEntry, Text) + length + 1,
+								sizeof(u32)));
+
+				entry->Hash = hash;
+				entry->Length = length;
+				memcpy(entry->Text, str, length + 1);
+
+				insertEntry(shard.Table, entry);
+				++shard.Count;
+
+				result = entry;
+			}
+
+			shard.Lock.exit();
+
+			return InternedString(result);
+		}
+
+		//! Finds handle of str without storing it.
+		bool SharedStringPool::find(const c8* str, InternedString& result)
+		{
+			u32 length = 0;
+			const u32 hash = hashString(str, length);
+
+			if (length == 0)
+			{
+				result = InternedString();
+				return true;
+			}
+
+			const SInternedStringEntry* entry = findEntry(getShard(hash), str,
+					length, hash);
+
+			if (!entry)
+				return false;
+
+			result = InternedString(entry);
+
+			return true;
+		}
+
+		//! Returns count of distinct strings
+		u32 SharedStringPool::getStringsCount() const
+		{
+			u32 result = 0;
+
+			for (u32 i = 0; i < ShardsCount; ++i)
+			{
+				Shards[i].Lock.enter();
+				result += Shards[i].Count;
+				Shards[i].Lock.exit();
+			}
+
+			return result;
+		}
+
+		//! Returns count of bytes used by entries and tables
+		size_t SharedStringPool::getUsedSize() const
+		{
+			size_t result = 0;
+
+			for (u32 i = 0; i < ShardsCount; ++i)
+			{
+				Shards[i].Lock.enter();
+				result += Shards[i].Arena.getUsedSize();
+				Shards[i].Lock.exit();
+			}
+
+			return result;
+		}
+
+		//------------------------------
+		// Private funcs
+		//------------------------------
+
+		//! Shard constructor
+		SharedStringPool::SShard::SShard() :
+				Arena(ChunkSize), Table(0), Count(0)
+		{
+		}
+
+		//! Returns hash and length of str
+		u32 SharedStringPool::hashString(const c8* str, u32& length) const
+		{
+			// same as core::hashString, length is counted in same pass
+			u32 result = 2166136261u;
+			const c8* p = str;
+
+			while (*p)
+			{
+				result ^= (u8) *p++;
+				result *= 16777619u;
+			}
+
+			length = (u32) (p - str);
+
+			return result;
+		}
+
+		//! Returns shard of hash
+		SharedStringPool::SShard& SharedStringPool::getShard(u32 hash)
+		{
+			// low bits select slots, so shard is selected by high bits
+			return Shards[(hash >> 24) & (ShardsCount - 1)];
+		}
+
+		//! Finds entry in current table of shard without lock
+		const SInternedStringEntry* SharedStringPool::findEntry(
+				const SShard& shard, const c8* str, u32 length, u32 hash) const
+		{
+			const STable* table = irrgameAtomic::loadAcquire(&shard.Table);
+
+			while (true)
+			{
+				const SInternedStringEntry* result = findEntry(table, str,
+						length, hash);
+
+				if (result)
+					return result;
+
+				// table may be replaced while it was searched, new entries
+				// are added to new table only
+				const STable* current = irrgameAtomic::loadAcquire(&shard.Table);
+
+				if (current == table)
+					return 0;
+
+				table = current;
+			}
+		}
+
+		//! Finds entry in table
+		const SInternedStringEntry* SharedStringPool::findEntry(
+				const STable* table, const c8* str, u32 length, u32 hash) const
+		{
+			if (!table)
+				return 0;
+
+			for (u32 slot = hash & table->Mask;; slot = (slot + 1) & table->Mask)
+			{
+				const SInternedStringEntry* entry = irrgameAtomic::loadAcquire(
+						&table->Slots[slot]);
+
+				if (!entry)
+					return 0;
+
+				if (entry->Hash == hash && entry->Length == length
+						&& memcmp(entry->Text, str, length) == 0)
+					return entry;
+			}
+		}
+
+		//! Adds entry to table. Lock of shard must be taken.
+		void SharedStringPool::insertEntry(STable* table,
+				const SInternedStringEntry* entry)
+		{
+			u32 slot = entry->Hash & table->Mask;
+
+			while (table->Slots[slot])
+				slot = (slot + 1) & table->Mask;
+
+			// entry must be visible before it can be found
+			irrgameAtomic::storeRelease(&table->Slots[slot], entry);
+		}
+
+		//! Creates table with doubled count of slots and publishes it.
+		void SharedStringPool::grow(SShard& shard)
+		{
+			const u32 count = shard.Table ? (shard.Table->Mask + 1) * 2 : 64;
+			const size_t size = offsetof(STable, Slots)
+					+ count * sizeof(SInternedStringEntry*);
+
+			STable* table = static_cast<STable*>(shard.Arena.allocate(size,
+					sizeof(void*)));
+
+			memset(table, 0, size);
+			table->Mask = count - 1;
+
+			if (shard.Table)
+			{
+				for (u32 i = 0; i <= shard.Table->Mask; ++i)
+				{
+					if (shard.Table->Slots[i])
+						insertEntry(table, shard.Table->Slots[i]);
+				}
+			}
+
+			// old table stays in arena for threads which are reading it
+			irrgameAtomic::storeRelease(&shard.Table, table);
+		}
+
+	}  // namespace core
+}  // namespace irrgame
@@ -8,7 +8,8 @@
 #include "core/collections/stringc.h"
 #include "core/utils/SharedCoreUtils.h"
 
-#include "threads/irrgameMonitor.h"
+#include "threads/lock/NullLock.h"
+#include "threads/lock/MonitorLock.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -19,47 +20,56 @@ namespace irrgame
 	namespace core
 	{
 		//! Returns empty string
-		const stringc& stringc::getEmpty(void)
+		template<class TLock>
+		const string<TLock>& string<TLock>::getEmpty(void)
 		{
-			static const stringc empty;
+			static const string<TLock> empty;
 			return empty;
 		}
 
 		//! Default constructor
-		stringc::stringc() :
-				Array(0), Allocated(1), Used(1), Monitor(0)
+		template<class TLock>
+		string<TLock>::string() :
+				Array(Buffer), Allocated(InlineSize), Used(1)
 		{
-			Monitor = threads::createIrrgameMonitor();
-
-			Array = Allocator.allocate(1); // new T[1];
 			Array[0] = 0x0;
 		}
 
 		//! Copy constructor
-		stringc::stringc(const stringc& other) :
-				Array(0), Allocated(0), Used(0), Monitor(0)
+		template<class TLock>
+		string<TLock>::string(const string<TLock>& other) :
+				Array(Buffer), Allocated(InlineSize), Used(0)
 		{
-			Monitor = threads::createIrrgameMonitor();
 			*this = other;
 		}
 
-		//! Constructs a string from a float
-		stringc::stringc(const double number) :
-				Array(0), Allocated(0), Used(0), Monitor(0)
+#if __cplusplus >= 201103L
+		//! Move constructor. Other string becomes empty.
+		template<class TLock>
+		string<TLock>::string(string<TLock>&& other) :
+				Array(Buffer), Allocated(InlineSize), Used(1)
 		{
-			Monitor = threads::createIrrgameMonitor();
+			Array[0] = 0x0;
+
+			*this = static_cast<string<TLock>&&>(other);
+		}
+#endif
 
+		//! Constructs a string from a float
+		template<class TLock>
+		string<TLock>::string(const double number) :
+				Array(Buffer), Allocated(InlineSize), Used(0)
+		{
 			c8 tmpbuf[255];
 			snprintf(tmpbuf, 255, "%0.6f", number);
 			*this = tmpbuf;
 		}
 
 		//! Constructs a string from an int
-		stringc::stringc(s32 number) :
-				Array(0), Allocated(0), Used(0), Monitor(0)
+		template<class TLock>
+		string<TLock>::string(s32 number) :
+				Array(Buffer), Allocated(InlineSize), Used(0)
 		{
-			Monitor = threads::createIrrgameMonitor();
-
 			// store if negative and make positive
 			bool negative = false;
 
@@ -101,11 +111,10 @@ namespace irrgame
 		}
 
 		//! Constructs a string from an unsigned int
-		stringc::stringc(u32 number) :
-				Array(0), Allocated(0), Used(0), Monitor(0)
+		template<class TLock>
+		string<TLock>::string(u32 number) :
+				Array(Buffer), Allocated(InlineSize), Used(0)
 		{
-			Monitor = threads::createIrrgameMonitor();
-
 			// temporary buffer for 16 numbers
 			c8 tmpbuf[16] =
 			{ 0 };
@@ -131,11 +140,10 @@ namespace irrgame
 		}
 
 		//! Constructor for copying a string from a pointer with a given length
-		stringc::stringc(const c8* const c, u32 length) :
-				Array(0), Allocated(0), Used(0), Monitor(0)
+		template<class TLock>
+		string<TLock>::string(const c8* const c, u32 length) :
+				Array(Buffer), Allocated(InlineSize), Used(0)
 		{
-			Monitor = threads::createIrrgameMonitor();
-
 			if (!c)
 			{
 				// correctly init the string to an empty one
@@ -143,8 +151,13 @@ namespace irrgame
 				return;
 			}
 
-			Allocated = Used = length + 1;
-			Array = Allocator.allocate(Used); // new T[Used];
+			Used = length + 1;
+
+			if (Used > Allocated)
+			{
+				Allocated = Used;
+				Array = Allocator.allocate(Used); // new T[Used];
+			}
 
 			for (u32 l = 0; l < length; ++l)
 				Array[l] = (c8) c[l];
@@ -153,64 +166,100 @@ namespace irrgame
 		}
 
 		//! Constructor for unicode strings
-		stringc::stringc(const c8* const c) :
-				Array(0), Allocated(0), Used(0), Monitor(0)
+		template<class TLock>
+		string<TLock>::string(const c8* const c) :
+				Array(Buffer), Allocated(InlineSize), Used(0)
 		{
-			Monitor = threads::createIrrgameMonitor();
-
 			*this = c;
 		}
 
 		//! Destructor
-		stringc::~stringc()
+		template<class TLock>
+		string<TLock>::~string()
 		{
-			Monitor->enter();
-			Allocator.deallocate(Array); // delete [] Array;
-			Monitor->exit();
-
-			if (Monitor)
-				Monitor->drop();
+			Lock.enter();
+			releaseArray(Array);
+			Lock.exit();
 		}
 
 		//! Assignment operator
-		stringc& stringc::operator=(const stringc& other)
+		template<class TLock>
+		string<TLock>& string<TLock>::operator=(const string<TLock>& other)
 		{
 			//handle self-assignment
 			if (this == &other)
 				return *this;
 
-			other.Monitor->enter();
+			other.Lock.enter();
 
-			stringc& result = stringc::operator =(other.Array);
+			string<TLock>& result = string<TLock>::operator =(other.Array);
 
-			other.Monitor->exit();
+			other.Lock.exit();
 
 			return result;
 		}
 
+#if __cplusplus >= 201103L
+		//! Move assignment operator. Other string becomes empty.
+		template<class TLock>
+		string<TLock>& string<TLock>::operator=(string<TLock>&& other)
+		{
+			//handle self-assignment
+			if (this == &other)
+				return *this;
+
+			// inline strings are short, so they are copied
+			if (other.Array == other.Buffer)
+			{
+				*this = other;
+
+				other.Lock.enter();
+				other.Used = 1;
+				other.Array[0] = 0x0;
+				other.Lock.exit();
+
+				return *this;
+			}
+
+			other.Lock.enter();
+			Lock.enter();
+
+			releaseArray(Array);
+
+			Array = other.Array;
+			Allocated = other.Allocated;
+			Used = other.Used;
+
+			other.Array = other.Buffer;
+			other.Allocated = InlineSize;
+			other.Used = 1;
+			other.Array[0] = 0x0;
+
+			Lock.exit();
+			other.Lock.exit();
+
+			return *this;
+		}
+#endif
+
 		//! Assignment operator for strings, ascii and unicode
-		stringc& stringc::operator=(const c8* const c)
+		template<class TLock>
+		string<TLock>& string<TLock>::operator=(const c8* const c)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			if (!c)
 			{
-
-				if (!Array)
-				{
-					Array = Allocator.allocate(1); //new T[1];
-					Allocated = 1;
-				}
 				Used = 1;
 				Array[0] = 0x0;
 
-				Monitor->exit();
+				Lock.exit();
 				return *this;
 			}
 
 			if ((void*) c == (void*) Array)
 			{
-				Monitor->exit();
+				Lock.exit();
 				return *this;
 			}
 
@@ -236,76 +285,82 @@ namespace irrgame
 				Array[l] = c[l];
 
 			if (oldArray != Array)
-				Allocator.deallocate(oldArray); // delete [] oldArray;
+				releaseArray(oldArray);
 
-			Monitor->exit();
+			Lock.exit();
 			return *this;
 		}
 
 		//! Append operator for other strings
-		stringc stringc::operator+(const stringc& other) const
+		template<class TLock>
+		string<TLock> string<TLock>::operator+(const string<TLock>& other) const
 		{
-			Monitor->enter();
-			stringc result(*this);
+			Lock.enter();
+			string<TLock> result(*this);
 			result.append(other);
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Append operator for strings, ascii and unicode
-		stringc stringc::operator+(const c8* const c) const
+		template<class TLock>
+		string<TLock> string<TLock>::operator+(const c8* const c) const
 		{
-			Monitor->enter();
-			stringc result(*this);
+			Lock.enter();
+			string<TLock> result(*this);
 			result.append(c);
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Direct access operator
-		c8& stringc::operator [](const u32 index)
+		template<class TLock>
+		c8& string<TLock>::operator [](const u32 index)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			// bad index
 			IRR_ASSERT(index >= 0 && index < Used)
 
 			c8& result = Array[index];
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Direct access operator
-		const c8& stringc::operator [](const u32 index) const
+		template<class TLock>
+		const c8& string<TLock>::operator [](const u32 index) const
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			// bad index
 			IRR_ASSERT(index >= 0 && index < Used)
 
 			const c8& result = Array[index];
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Equality operator
-		bool stringc::operator ==(const stringc& other) const
+		template<class TLock>
+		bool string<TLock>::operator ==(const string<TLock>& other) const
 		{
 			if (this == &other)
 				return true;
 
 			_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
-			return stringc::operator==(other.Array);
+			return string<TLock>::operator==(other.Array);
 		}
 
 		//! Equality operator
-		bool stringc::operator ==(const c8* const str) const
+		template<class TLock>
+		bool string<TLock>::operator ==(const c8* const str) const
 		{
 			if (!str)
 			{
@@ -313,27 +368,28 @@ namespace irrgame
 				return false;
 			}
 
-			Monitor->enter();
+			Lock.enter();
 
 			u32 i;
 			for (i = 0; Array[i] && str[i]; ++i)
 				if (Array[i] != str[i])
 				{
-					Monitor->exit();
+					Lock.exit();
 					_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 					return false;
 				}
 
 			bool result = !Array[i] && !str[i];
 
-			Monitor->exit();
+			Lock.exit();
 
 			_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 			return result;
 		}
 
 		//! Is smaller comparator
-		bool stringc::operator <(const stringc& other) const
+		template<class TLock>
+		bool string<TLock>::operator <(const string<TLock>& other) const
 		{
 			if (this == &other)
 			{
@@ -341,14 +397,14 @@ namespace irrgame
 				return false;
 			}
 
-			Monitor->enter();
+			Lock.enter();
 
 			for (u32 i = 0; Array[i] && other.Array[i]; ++i)
 			{
 				s32 diff = Array[i] - other.Array[i];
 				if (diff)
 				{
-					Monitor->exit();
+					Lock.exit();
 					_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX
 					return diff < 0;
 				}
@@ -356,21 +412,23 @@ namespace irrgame
 
 			bool result = Used < other.Used;
 
-			Monitor->exit();
+			Lock.exit();
 
 			_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 			return result;
 		}
 
 		//! Inequality operator
-		bool stringc::operator !=(const c8* const str) const
+		template<class TLock>
+		bool string<TLock>::operator !=(const c8* const str) const
 		{
 			_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 			return !(*this == str);
 		}
 
 		//! Inequality operator
-		bool stringc::operator !=(const stringc& other) const
+		template<class TLock>
+		bool string<TLock>::operator !=(const string<TLock>& other) const
 		{
 			_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 			return !(*this == other);
@@ -379,25 +437,27 @@ namespace irrgame
 		//! Returns length of the string's content
 		/** \return Length of the string's content in characters, excluding
 		 the trailing NUL. */
-		u32 stringc::size() const
+		template<class TLock>
+		u32 string<TLock>::size() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			u32 result = Used - 1;
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Return True if this string is empty. Otherwise return False.
-		bool stringc::empty()
+		template<class TLock>
+		bool string<TLock>::empty()
 		{
 			bool result = false;
 
-			Monitor->enter();
+			Lock.enter();
 
 			result = Used - 1 == 0;
 
-			Monitor->exit();
+			Lock.exit();
 
 			_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 			return result;
@@ -405,46 +465,50 @@ namespace irrgame
 
 		//! Returns character string
 		/** \return pointer to C-style NUL terminated string. */
-		const c8* stringc::cStr() const
+		template<class TLock>
+		const c8* string<TLock>::cStr() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			const c8* result = Array;
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! Makes the string lower case.
-		void stringc::makeLower()
+		template<class TLock>
+		void string<TLock>::makeLower()
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			for (u32 i = 0; i < Used; ++i)
 				Array[i] = SharedCoreUtils::getInstance().localeLower(Array[i]);
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Makes the string upper case.
-		void stringc::makeUpper()
+		template<class TLock>
+		void string<TLock>::makeUpper()
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			for (u32 i = 0; i < Used; ++i)
 				Array[i] = SharedCoreUtils::getInstance().localeUpper(Array[i]);
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Compares the strings ignoring case.
-		bool stringc::equalsIgnoreCase(const stringc& other,
+		template<class TLock>
+		bool string<TLock>::equalsIgnoreCase(const string<TLock>& other,
 				const u32 sourcePos) const
 		{
 			if (this == &other)
 				return true;
 
-			Monitor->enter();
-			other.Monitor->enter();
+			Lock.enter();
+			other.Lock.enter();
 
 			IRR_ASSERT(sourcePos < Used);
 
@@ -455,23 +519,24 @@ namespace irrgame
 						!= SharedCoreUtils::getInstance().localeLower(
 								other.Array[i]))
 				{
-					Monitor->exit();
-					other.Monitor->exit();
+					Lock.exit();
+					other.Lock.exit();
 					_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 					return false;
 				}
 
 			bool result = Array[sourcePos + i] == 0 && other.Array[i] == 0;
 
-			Monitor->exit();
-			other.Monitor->exit();
+			Lock.exit();
+			other.Lock.exit();
 
 			_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 			return result;
 		}
 
 		//! Compares the strings ignoring case.
-		bool stringc::lowerIgnoreCase(const stringc& other) const
+		template<class TLock>
+		bool string<TLock>::lowerIgnoreCase(const string<TLock>& other) const
 		{
 			if (this == &other)
 			{
@@ -479,8 +544,8 @@ namespace irrgame
 				return false;
 			}
 
-			Monitor->enter();
-			other.Monitor->enter();
+			Lock.enter();
+			other.Lock.enter();
 
 			for (u32 i = 0; Array[i] && other.Array[i]; ++i)
 			{
@@ -491,8 +556,8 @@ namespace irrgame
 
 				if (diff)
 				{
-					Monitor->exit();
-					other.Monitor->exit();
+					Lock.exit();
+					other.Lock.exit();
 
 					_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 					return diff < 0;
@@ -501,33 +566,35 @@ namespace irrgame
 
 			bool result = Used < other.Used;
 
-			Monitor->exit();
-			other.Monitor->exit();
+			Lock.exit();
+			other.Lock.exit();
 
 			_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 			return result;
 		}
 
 		//! compares the first n characters of the strings
-		bool stringc::equalsn(const stringc& other, u32 n) const
+		template<class TLock>
+		bool string<TLock>::equalsn(const string<TLock>& other, u32 n) const
 		{
 			if (this == &other)
 				return true;
 
 			_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
-			return stringc::equalsn(other.Array, n);
+			return string<TLock>::equalsn(other.Array, n);
 		}
 
 		//! compares the first n characters of the strings
-		bool stringc::equalsn(const c8* const str, u32 n) const
+		template<class TLock>
+		bool string<TLock>::equalsn(const c8* const str, u32 n) const
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			IRR_ASSERT(n < Used);
 
 			if (!str)
 			{
-				Monitor->exit();
+				Lock.exit();
 				_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 				return false;
 			}
@@ -536,7 +603,7 @@ namespace irrgame
 			for (i = 0; Array[i] && str[i] && i < n; ++i)
 				if (Array[i] != str[i])
 				{
-					Monitor->exit();
+					Lock.exit();
 					_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 					return false;
 				}
@@ -544,14 +611,15 @@ namespace irrgame
 			// if one (or both) of the strings was smaller then they
 			// are only equal if they have the same length
 			bool result = (i == n) || (Array[i] == 0 && str[i] == 0);
-			Monitor->exit();
+			Lock.exit();
 
 			_IRR_IMPLEMENT_MANAGED_MARSHALLING_BUGFIX;
 			return result;
 		}
 
 		//! Appends a string to this string
-		void stringc::append(const stringc& other)
+		template<class TLock>
+		void string<TLock>::append(const string<TLock>& other)
 		{
 			bool selfAppending = false;
 
@@ -560,29 +628,36 @@ namespace irrgame
 				selfAppending = true;
 
 			if (!selfAppending)
-				other.Monitor->enter();
-			Monitor->enter();
+				other.Lock.enter();
+			Lock.enter();
 
-			--Used;
-			u32 len = other.Used;
+			// length is taken before Used changes, other may be this string
+			const u32 len = other.Used - 1;
 
 			if (Used + len > Allocated)
 				reallocate(Used + len);
 
+			--Used;
+
 			for (u32 l = 0; l < len; ++l)
 				Array[Used + l] = other.Array[l];
 
 			Used += len;
 
+			// ensure proper termination
+			Array[Used] = 0;
+			++Used;
+
 			if (!selfAppending)
-				other.Monitor->exit();
-			Monitor->exit();
+				other.Lock.exit();
+			Lock.exit();
 		}
 
 		//! Appends a character to this string
-		void stringc::append(c8 character)
+		template<class TLock>
+		void string<TLock>::append(c8 character)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			if (Used + 1 > Allocated)
 				reallocate(Used + 1);
@@ -592,13 +667,14 @@ namespace irrgame
 			Array[Used - 2] = character;
 			Array[Used - 1] = 0;
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Appends a char string to this string
-		void stringc::append(const c8* const other)
+		template<class TLock>
+		void string<TLock>::append(const c8* const other)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			IRR_ASSERT(other != 0);
 
@@ -621,11 +697,12 @@ namespace irrgame
 
 			Used += len;
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Appends a string of the length l to this string.
-		void stringc::append(const stringc& other, u32 length)
+		template<class TLock>
+		void string<TLock>::append(const string<TLock>& other, u32 length)
 		{
 			bool selfAppending = false;
 
@@ -634,8 +711,8 @@ namespace irrgame
 				selfAppending = true;
 
 			if (!selfAppending)
-				other.Monitor->enter();
-			Monitor->enter();
+				other.Lock.enter();
+			Lock.enter();
 
 			IRR_ASSERT((other.Used - 1) > length);
 
@@ -653,16 +730,17 @@ namespace irrgame
 			++Used;
 
 			if (!selfAppending)
-				other.Monitor->exit();
-			Monitor->exit();
+				other.Lock.exit();
+			Lock.exit();
 		}
 
 		//! finds next occurrence of character in string
-		s32 stringc::findFirst(c8 c, u32 startPos) const
+		template<class TLock>
+		s32 string<TLock>::findFirst(c8 c, u32 startPos) const
 		{
 			s32 result = IrrNotFound;
 
-			Monitor->enter();
+			Lock.enter();
 
 			IRR_ASSERT(startPos < Used);
 
@@ -673,17 +751,18 @@ namespace irrgame
 					break;
 				}
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! finds last occurrence of character in string
-		s32 stringc::findLast(c8 c) const
+		template<class TLock>
+		s32 string<TLock>::findLast(c8 c) const
 		{
 			s32 result = IrrNotFound;
 
-			Monitor->enter();
+			Lock.enter();
 
 			for (u32 i = Used - 1; i > 0; --i)
 			{
@@ -694,24 +773,25 @@ namespace irrgame
 				}
 			}
 
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! finds another string in this string
-		s32 stringc::find(const c8* const str, const u32 start) const
+		template<class TLock>
+		s32 string<TLock>::find(const c8* const str, const u32 start) const
 		{
 			s32 result = IrrNotFound;
 
-			Monitor->enter();
+			Lock.enter();
 
 			IRR_ASSERT(str != 0);
 			IRR_ASSERT(start < Used);
 
 			if (!(*str))
 			{
-				Monitor->exit();
+				Lock.exit();
 				return result;
 			}
 
@@ -722,7 +802,7 @@ namespace irrgame
 
 			if (len > Used - 1)
 			{
-				Monitor->exit();
+				Lock.exit();
 				return result;
 			}
 
@@ -740,16 +820,17 @@ namespace irrgame
 				}
 			}
 
-			Monitor->exit();
+			Lock.exit();
 			return result;
 		}
 
 		//! Returns a substring
-		stringc stringc::subString(u32 begin, u32 length) const
+		template<class TLock>
+		string<TLock> string<TLock>::subString(u32 begin, u32 length) const
 		{
-			stringc result;
+			string<TLock> result;
 
-			Monitor->enter();
+			Lock.enter();
 
 			// no proper substring length
 			IRR_ASSERT(length > 0);
@@ -767,65 +848,73 @@ namespace irrgame
 				result.Array[i] = Array[i + begin];
 
 			result.Array[length] = 0;
-			result.Used = result.Allocated;
+			result.Used = length + 1;
 
-			Monitor->exit();
+			Lock.exit();
 			return result;
 		}
 
 		//! Appends a string to this string
-		stringc& stringc::operator +=(const stringc& other)
+		template<class TLock>
+		string<TLock>& string<TLock>::operator +=(const string<TLock>& other)
 		{
 			append(other);
 			return *this;
 		}
 
 		//! Appends a character to this string
-		stringc& stringc::operator +=(c8 c)
+		template<class TLock>
+		string<TLock>& string<TLock>::operator +=(c8 c)
 		{
 			append(c);
 			return *this;
 		}
 
 		//! Appends a char string to this string
-		stringc& stringc::operator +=(const c8* const c)
+		template<class TLock>
+		string<TLock>& string<TLock>::operator +=(const c8* const c)
 		{
 			append(c);
 			return *this;
 		}
 
 		//! Appends a string representation of a number to this string
-		stringc& stringc::operator +=(const s32 i)
+		template<class TLock>
+		string<TLock>& string<TLock>::operator +=(const s32 i)
 		{
-			append(stringc(i));
+			append(string<TLock>(i));
 			return *this;
 		}
 
 		//! Appends a string representation of a number to this string
-		stringc& stringc::operator +=(const u32 i)
+		template<class TLock>
+		string<TLock>& string<TLock>::operator +=(const u32 i)
 		{
-			append(stringc(i));
+			append(string<TLock>(i));
 			return *this;
 		}
 
 		//! Appends a string representation of a number to this string
-		stringc& stringc::operator +=(const double i)
+		template<class TLock>
+		string<TLock>& string<TLock>::operator +=(const double i)
 		{
-			append(stringc(i));
+			append(string<TLock>(i));
 			return *this;
 		}
 
 		//! Appends a string representation of a number to this string
-		stringc& stringc::operator +=(const f32 i)
+		template<class TLock>
+		string<TLock>& string<TLock>::operator +=(const f32 i)
 		{
-			append(stringc(i));
+			append(string<TLock>(i));
 			return *this;
 		}
 
 		//! Replaces all characters of a special type with another one
-		void stringc::replace(c8 toReplace, c8 replaceWith)
+		template<class TLock>
+		void string<TLock>::replace(c8 toReplace, c8 replaceWith)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			for (u32 i = 0; i < Used; ++i)
 			{
@@ -835,13 +924,14 @@ namespace irrgame
 				}
 			}
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! Removes characters from a string.
-		void stringc::remove(c8 c)
+		template<class TLock>
+		void string<TLock>::remove(c8 c)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			u32 pos = 0;
 			u32 found = 0;
@@ -858,20 +948,20 @@ namespace irrgame
 			Used -= found;
 			Array[Used] = 0;
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//		//! Returns new string which trims this string.
 		//		 string& string::trim(const string& whitespace)
 		//		{
-		//			Monitor->enter();
+		//			Lock.enter();
 		//
 		//			//for clear - use string::clear()
 		//			IRR_ASSERT(this != &whitespace);
 		//			//trim empty was
 		//			IRR_ASSERT(Used - 1 > 0);
 		//
-		//			whitespace.Monitor->enter();
+		//			whitespace.Lock.enter();
 		//
 		//			// find start and end of the substring without the specified characters
 		//			const s32 begin = findFirstCharNotInList(whitespace.Array,
@@ -879,7 +969,7 @@ namespace irrgame
 		//
 		//			if (begin == irrNotFound)
 		//			{
-		//				Monitor->exit();
+		//				Lock.exit();
 		//				return (*this = "");
 		//			}
 		//
@@ -890,15 +980,16 @@ namespace irrgame
 		//
 		//			(*result) = subString(begin, (end + 1) - begin);
 		//
-		//			Monitor->exit();
+		//			Lock.exit();
 		//
 		//			return *result;
 		//		}
 
 		//! Erases a character from the string.
-		void stringc::erase(u32 index)
+		template<class TLock>
+		void string<TLock>::erase(u32 index)
 		{
-			Monitor->enter();
+			Lock.enter();
 
 			// access violation
 			IRR_ASSERT(index >= 0 && index < Used)
@@ -908,21 +999,23 @@ namespace irrgame
 
 			--Used;
 
-			Monitor->exit();
+			Lock.exit();
 		}
 
 		//! gets the last char of a string or null
-		c8 stringc::lastChar() const
+		template<class TLock>
+		c8 string<TLock>::lastChar() const
 		{
-			Monitor->enter();
+			Lock.enter();
 			c8 result = Used > 1 ? Array[Used - 2] : 0;
-			Monitor->exit();
+			Lock.exit();
 
 			return result;
 		}
 
 		//! split string into parts.
-		void stringc::split(ICollection<stringc>& ret, const c8* const c,
+		template<class TLock>
+		void string<TLock>::split(ICollection<string<TLock> >& ret, const c8* const c,
 				u32 count, bool ignoreEmptyTokens, bool keepSeparators) const
 		{
 			IRR_ASSERT(c != 0);
@@ -938,7 +1031,7 @@ namespace irrgame
 					{
 						if ((!ignoreEmptyTokens || i - lastpos != 0)
 								&& !lastWasSeparator)
-							ret.pushBack(stringc(&Array[lastpos], i - lastpos));
+							ret.pushBack(string<TLock>(&Array[lastpos], i - lastpos));
 						foundSeparator = true;
 						lastpos = (keepSeparators ? i : i + 1);
 						break;
@@ -948,27 +1041,51 @@ namespace irrgame
 			}
 
 			if ((Used - 1) > lastpos)
-				ret.pushBack(stringc(&Array[lastpos], (Used - 1) - lastpos));
+				ret.pushBack(string<TLock>(&Array[lastpos], (Used - 1) - lastpos));
 		}
 
 		//! Reallocate the Array, make it bigger or smaller
-		void stringc::reallocate(u32 newSize)
+		template<class TLock>
+		void string<TLock>::reallocate(u32 newSize)
 		{
 			c8* oldArray = Array;
 
-			Array = Allocator.allocate(newSize); //new T[newSize];
-			Allocated = newSize;
+			if (newSize <= InlineSize)
+			{
+				Array = Buffer;
+				Allocated = InlineSize;
+			}
+			else
+			{
+				Array = Allocator.allocate(newSize); //new T[newSize];
+				Allocated = newSize;
+			}
+
+			if (oldArray != Array)
+			{
+				u32 amount = Used < newSize ? Used : newSize;
+				for (u32 i = 0; i < amount; ++i)
+					Array[i] = oldArray[i];
 
-			u32 amount = Used < newSize ? Used : newSize;
-			for (u32 i = 0; i < amount; ++i)
-				Array[i] = oldArray[i];
+				releaseArray(oldArray);
+			}
 
-			if (Allocated < Used)
-				Used = Allocated;
+			if (newSize < Used)
+				Used = newSize;
+		}
 
-			Allocator.deallocate(oldArray); // delete [] old_Array;
+		//! Frees memory of array, if it is not inline buffer
+		template<class TLock>
+		void string<TLock>::releaseArray(c8* array)
+		{
+			if (array != Buffer)
+				Allocator.deallocate(array); // delete [] array;
 		}
 
+		//! Explicit instantiation for available lock policies
+		template class string<threads::NullLock> ;
+		template class string<threads::MonitorLock> ;
+
 	} // namespace core
 }  // namespace irrgame
 
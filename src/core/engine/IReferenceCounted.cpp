@@ -13,7 +13,7 @@ namespace irrgame
 
 	//! Constructor.
 	IReferenceCounted::IReferenceCounted() :
-			DebugName(0), ReferenceCounter(1)
+			DebugName(0), ReferenceCounter(1), NextDeferred(0)
 	{
 //		s32 threadID = threads::irrgameThread::getCurrentThreadID();
 //		ThreadsReferenceCounters.insert(threadID, 1);
@@ -24,119 +24,57 @@ namespace irrgame
 	{
 	}
 
-	//! Grabs the object. Increments the reference counter by one.
-	/** Someone who calls grab() to an object, should later also
-	 call drop() to it. If an object never gets as much drop() as
-	 grab() calls, it will never be destroyed. The
-	 IReferenceCounted class provides a basic reference counting
-	 mechanism with its methods grab() and drop(). Most objects of
-	 the Irrlicht Engine are derived from IReferenceCounted, and so
-	 they are reference counted.
-
-	 When you create an object in the Irrlicht engine, calling a
-	 method which starts with 'create', an object is created, and
-	 you get a pointer to the new object. If you no longer need the
-	 object, you have to call drop(). This will destroy the object,
-	 if grab() was not called in another part of you program,
-	 because this part still needs the object. Note, that you only
-	 need to call drop() to the object, if you created it, and the
-	 method had a 'create' in it.
-
-	 A simple example:
-
-	 If you want to create a texture, you may want to call an
-	 imaginable method IDriver::createTexture. You call
-	 ITexture* texture = driver->createTexture(dimension2d<u32>(128, 128));
-	 If you no longer need the texture, call texture->drop().
-	 If you want to load a texture, you may want to call imaginable
-	 method IDriver::loadTexture. You do this like
-	 ITexture* texture = driver->loadTexture("example.jpg");
-	 You will not have to drop the pointer to the loaded texture,
-	 because the name of the method does not start with 'create'.
-	 The texture is stored somewhere by the driver. */
-	void IReferenceCounted::grab() const
+	//! Head of deferred drop list of current thread
+	static IRR_THREAD_LOCAL const IReferenceCounted* DeferredDropsHead = 0;
+
+	//! Drops the object, but postpones its deletion.
+	bool IReferenceCounted::dropDeferred() const
 	{
-//		s32 threadID = threads::irrgameThread::getCurrentThreadID();
+		// someone is doing bad reference counting.
+		IRR_ASSERT(getReferenceCount() > 0)
 
-//		if (haveDependiesFromThread(threadID))
-//		{
-//			DictIntInt::Node* node = ThreadsReferenceCounters.find(threadID);
-//			node->setValue(node->getValue() + 1);
-//		}
-//		else
-//			ThreadsReferenceCounters.insert(threadID, 1);
+#ifdef IRR_ATOMIC_REFERENCE_COUNTING
+		if (threads::irrgameAtomic::decrementAcqRel(&ReferenceCounter) != 0)
+#else
+		if (--ReferenceCounter != 0)
+#endif
+			return false;
 
-		++ReferenceCounter;
+		// nobody references object now, so it is safe to reuse it as list node
+		NextDeferred = DeferredDropsHead;
+		DeferredDropsHead = this;
 
+		return true;
 	}
 
-	//! Drops the object. Decrements the reference counter by one.
-	/** The IReferenceCounted class provides a basic reference
-	 counting mechanism with its methods grab() and drop(). Most
-	 objects of the Irrlicht Engine are derived from
-	 IReferenceCounted, and so they are reference counted.
-
-	 When you create an object in the Irrlicht engine, calling a
-	 method which starts with 'create', an object is created, and
-	 you get a pointer to the new object. If you no longer need the
-	 object, you have to call drop(). This will destroy the object,
-	 if grab() was not called in another part of you program,
-	 because this part still needs the object. Note, that you only
-	 need to call drop() to the object, if you created it, and the
-	 method had a 'create' in it.
-
-	 A simple example:
-
-	 If you want to create a texture, you may want to call an
-	 imaginable method IDriver::createTexture. You call
-	 ITexture* texture = driver->createTexture(dimension2d<u32>(128, 128));
-	 If you no longer need the texture, call texture->drop().
-	 If you want to load a texture, you may want to call imaginable
-	 method IDriver::loadTexture. You do this like
-	 ITexture* texture = driver->loadTexture("example.jpg");
-	 You will not have to drop the pointer to the loaded texture,
-	 because the name of the method does not start with 'create'.
-	 The texture is stored somewhere by the driver.
-	 \return True, if the object was deleted. */
-	bool IReferenceCounted::drop() const
+	//! Deletes all objects queued by dropDeferred() from current thread.
+	u32 IReferenceCounted::flushDeferredDrops()
 	{
-		// someone is doing bad reference counting.
-		IRR_ASSERT(ReferenceCounter > 0)
-
-//		s32 threadID = threads::irrgameThread::getCurrentThreadID();
+		u32 result = 0;
 
-//		if (haveDependiesFromThread(threadID))
-//		{
-//			DictIntInt::Node* node = ThreadsReferenceCounters.find(threadID);
-//			node->setValue(node->getValue() - 1);
+		// destructors may queue new objects, so take whole list each pass
+		while (DeferredDropsHead)
+		{
+			const IReferenceCounted* node = DeferredDropsHead;
+			DeferredDropsHead = 0;
 
-		--ReferenceCounter;
-//		}
-//		else
-//		{
-//			//something wrong
-//			IRR_ASSERT(false);
-//		}
+			while (node)
+			{
+				const IReferenceCounted* next = node->NextDeferred;
+				delete node;
+				node = next;
 
-		if (!ReferenceCounter)
-		{
-			delete this;
-			return true;
+				++result;
+			}
 		}
 
-		return false;
-	}
-
-	//! Get the reference count.
-	s32 IReferenceCounted::getReferenceCount() const
-	{
-		return ReferenceCounter;
+		return result;
 	}
 
 	//! Return True if object have dependies(reference count more 0) from specify thread.
 	//! Otherwise return False.
 	//@ param0 - thread id
-	bool IReferenceCounted::haveDependiesFromThread(s32 threadID) const
+	bool IReferenceCounted::haveDependiesFromThread(s32) const
 	{
 //		return ThreadsReferenceCounters.find(threadID) != 0;
 		return false;
@@ -40,44 +40,44 @@ namespace irrgame
 		const f32 SharedFastMath::F32Value0 = 0x00000000;
 		const f32 SharedFastMath::F32Value1 = 0x3f800000;
 
-		bool SharedFastMath::F32_LOWER_0(f32 f)
+		bool SharedFastMath::F32_LOWER_0(f32 f) const
 		{
 			return ((*((u32 *) &(f))) > 0x80000000U);
 		}
 
-		bool SharedFastMath::F32_LOWER_EQUAL_0(f32 f)
+		bool SharedFastMath::F32_LOWER_EQUAL_0(f32 f) const
 		{
 			return ((*((s32 *) &(f))) <= 0x00000000);
 		}
 
-		bool SharedFastMath::F32_GREATER_0(f32 f)
+		bool SharedFastMath::F32_GREATER_0(f32 f) const
 		{
 			return ((*((s32 *) &(f))) > 0x00000000);
 		}
 
-		bool SharedFastMath::F32_GREATER_EQUAL_0(f32 f)
+		bool SharedFastMath::F32_GREATER_EQUAL_0(f32 f) const
 		{
 			return ((*((u32 *) &(f))) <= 0x80000000U);
 		}
 
-		bool SharedFastMath::F32_EQUAL_1(f32 f)
+		bool SharedFastMath::F32_EQUAL_1(f32 f) const
 		{
 			return ((*((u32 *) &(f))) == 0x3f800000);
 		}
 
-		bool SharedFastMath::F32_EQUAL_0(f32 f)
+		bool SharedFastMath::F32_EQUAL_0(f32 f) const
 		{
 			return (((*((u32 *) &(f))) & 0x7FFFFFFFU) == 0x00000000);
 		}
 
 		// only same sign
-		bool F32_A_GREATER_B(f32 a, f32 b)
+		bool SharedFastMath::F32_A_GREATER_B(f32 a, f32 b) const
 		{
 			return ((*((s32 *) &(a))) > (*((s32 *) &(b))));
 		}
 
 		// calculate: 1 / sqrtf ( x )
-		f32 SharedFastMath::invertSqrt(const f32 f)
+		f32 SharedFastMath::invertSqrt(const f32 f) const
 		{
 #ifdef _MSC_VER
 // SSE reciprocal square root estimate, accurate to 12 significant
@@ -99,7 +99,7 @@ namespace irrgame
 		}
 
 		// calculate: 1 / x
-		f32 SharedFastMath::invert(const f32 f)
+		f32 SharedFastMath::invert(const f32 f) const
 		{
 #ifdef _MSC_VER
 
@@ -131,7 +131,7 @@ namespace irrgame
 		}
 
 		// calculate: 1 / x, low precision allowed
-		f32 SharedFastMath::invertApproximate(const f32 f)
+		f32 SharedFastMath::invertApproximate(const f32 f) const
 		{
 #ifdef _MSC_VER
 
@@ -167,7 +167,7 @@ namespace irrgame
 #endif
 		}
 
-		s32 SharedFastMath::floor32(f32 x)
+		s32 SharedFastMath::floor32(f32 x) const
 		{
 			const f32 h = 0.5f;
 
@@ -195,7 +195,7 @@ namespace irrgame
 			return t;
 		}
 
-		s32 SharedFastMath::ceil32(f32 x)
+		s32 SharedFastMath::ceil32(f32 x) const
 		{
 			const f32 h = 0.5f;
 
@@ -223,7 +223,7 @@ namespace irrgame
 			return t;
 		}
 
-		s32 SharedFastMath::round32(f32 x)
+		s32 SharedFastMath::round32(f32 x) const
 		{
 			s32 t;
 
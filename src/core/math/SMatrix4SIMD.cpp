@@ -0,0 +1,797 @@
+/*
+ * SMatrix4SIMD.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#include "core/math/SMatrix4SIMD.h"
+
+#if defined(IRR_SIMD_MATRIX) && defined(IRR_X86_SIMD)
+
+#include "core/math/SharedMath.h"
+#include "core/utils/SharedCPUFeatures.h"
+
+#include <immintrin.h>
+#include <math.h>
+
+/*
+ * Kernels are compiled for their instruction set with target attribute,
+ * so whole engine is not required to be built with -mavx.
+ */
+#define IRR_TARGET_SSE2 __attribute__((target("sse2")))
+#define IRR_TARGET_AVX __attribute__((target("avx")))
+
+namespace irrgame
+{
+	namespace core
+	{
+		/*
+		 * Vectors are 3 floats, which are usually members of vertices. Blocks of
+		 * 4 (SSE2) or 8 (AVX) vectors are transposed to registers of x, y and z,
+		 * so all lanes do useful work also when vectors are normalized. Dense
+		 * arrays are loaded and stored by whole registers. In strided arrays 16
+		 * bytes may be read from any vector except the last one: 4 bytes after
+		 * it belong to the next one. Only 12 bytes of vector are ever written.
+		 */
+
+		//! Matrix elements, which are used by SSE2 kernels, every one in all lanes
+		struct SMatrixLanes_SSE2
+		{
+				//! Element (row, column) is M[row * 4 + column]
+				__m128 M[4][3];
+		};
+
+		//! Matrix elements, which are used by AVX kernels, every one in all lanes
+		struct SMatrixLanes_AVX
+		{
+				//! Element (row, column) is M[row * 4 + column]
+				__m256 M[4][3];
+		};
+
+		//! Transforms vectors in lanes of x, y and z. Operations are in same
+		//! order as in matrix4::transformVect and vector3d::normalize, so
+		//! results are same.
+		template<bool TTranslate, bool TNormalize>
+		struct STransformVectors
+		{
+				static IRR_TARGET_SSE2 void apply(__m128& x, __m128& y,
+						__m128& z, const SMatrixLanes_SSE2& m)
+				{
+					__m128 result[3];
+
+					for (u32 i = 0; i < 3; ++i)
+					{
+						result[i] = _mm_add_ps(
+								_mm_add_ps(_mm_mul_ps(x, m.M[0][i]),
+										_mm_mul_ps(y, m.M[1][i])),
+								_mm_mul_ps(z, m.M[2][i]));
+
+						if (TTranslate)
+							result[i] = _mm_add_ps(result[i], m.M[3][i]);
+					}
+
+					if (TNormalize)
+					{
+						const __m128 length = _mm_add_ps(
+								_mm_add_ps(_mm_mul_ps(result[0], result[0]),
+										_mm_mul_ps(result[1], result[1])),
+								_mm_mul_ps(result[2], result[2]));
+
+						// vector3d::normalize keeps vectors with length near to 0
+						const __m128 mask = _mm_cmpnle_ps(
+								_mm_sub_ps(length,
+										_mm_set1_ps(SharedMath::RoundErrF32)),
+								_mm_setzero_ps());
+
+						const __m128 invertLength = _mm_div_ps(_mm_set1_ps(1.f),
+								_mm_sqrt_ps(length));
+
+						for (u32 i = 0; i < 3; ++i)
+						{
+							result[i] = _mm_or_ps(
+									_mm_and_ps(mask,
+											_mm_mul_ps(result[i], invertLength)),
+									_mm_andnot_ps(mask, result[i]));
+						}
+					}
+
+					x = result[0];
+					y = result[1];
+					z = result[2];
+				}
+
+				static IRR_TARGET_AVX void apply(__m256& x, __m256& y,
+						__m256& z, const SMatrixLanes_AVX& m)
+				{
+					__m256 result[3];
+
+					for (u32 i = 0; i < 3; ++i)
+					{
+						result[i] = _mm256_add_ps(
+								_mm256_add_ps(_mm256_mul_ps(x, m.M[0][i]),
+										_mm256_mul_ps(y, m.M[1][i])),
+								_mm256_mul_ps(z, m.M[2][i]));
+
+						if (TTranslate)
+							result[i] = _mm256_add_ps(result[i], m.M[3][i]);
+					}
+
+					if (TNormalize)
+					{
+						const __m256 length = _mm256_add_ps(
+								_mm256_add_ps(_mm256_mul_ps(result[0], result[0]),
+										_mm256_mul_ps(result[1], result[1])),
+								_mm256_mul_ps(result[2], result[2]));
+
+						const __m256 mask = _mm256_cmp_ps(
+								_mm256_sub_ps(length,
+										_mm256_set1_ps(SharedMath::RoundErrF32)),
+								_mm256_setzero_ps(), _CMP_NLE_UQ);
+
+						const __m256 invertLength = _mm256_div_ps(
+								_mm256_set1_ps(1.f), _mm256_sqrt_ps(length));
+
+						for (u32 i = 0; i < 3; ++i)
+						{
+							result[i] = _mm256_blendv_ps(result[i],
+									_mm256_mul_ps(result[i], invertLength),
+									mask);
+						}
+					}
+
+					x = result[0];
+					y = result[1];
+					z = result[2];
+				}
+		};
+
+		//! Stores x, y and z of v
+		IRR_TARGET_SSE2 inline void storeVector_SSE2(f32* p, const __m128 v)
+		{
+			_mm_storel_pi((__m64*) p, v);
+			_mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+		}
+
+		//! Returns pointer, which is bytes after p
+		inline const f32* shift(const f32* p, u32 bytes)
+		{
+			return reinterpret_cast<const f32*>(reinterpret_cast<const c8*>(p)
+					+ bytes);
+		}
+
+		//! Returns pointer, which is bytes after p
+		inline f32* shift(f32* p, u32 bytes)
+		{
+			return reinterpret_cast<f32*>(reinterpret_cast<c8*>(p) + bytes);
+		}
+
+		//! Loads 4 floats from low and 4 floats from high
+		IRR_TARGET_AVX inline __m256 loadPair_AVX(const f32* low,
+				const f32* high)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)),
+					_mm_loadu_ps(high), 1);
+		}
+
+		//! Stores low half of v to low and high half to high
+		IRR_TARGET_AVX inline void storePair_AVX(f32* low, f32* high,
+				const __m256 v)
+		{
+			_mm_storeu_ps(low, _mm256_castps256_ps128(v));
+			_mm_storeu_ps(high, _mm256_extractf128_ps(v, 1));
+		}
+
+		//! Stores x, y and z of both halves of v
+		IRR_TARGET_AVX inline void storeVectorPair_AVX(f32* low, f32* high,
+				const __m256 v)
+		{
+			storeVector_SSE2(low, _mm256_castps256_ps128(v));
+			storeVector_SSE2(high, _mm256_extractf128_ps(v, 1));
+		}
+
+		/*
+		 * Transposition of 4 vectors in every 128 bit lane. Same code is used
+		 * for SSE2 and AVX, because shuffles of AVX work in 128 bit lanes.
+		 */
+
+#define IRR_DEFINE_TRANSPOSITIONS(TRegister, TARGET, SHUFFLE, UNPACKLO, UNPACKHI) \
+		/* Vectors v0..v3 -> registers of x, y and z */ \
+		TARGET inline void transposeToLanes(const TRegister* v, \
+				TRegister& x, TRegister& y, TRegister& z) \
+		{ \
+			const TRegister xy01 = UNPACKLO(v[0], v[1]); \
+			const TRegister xy23 = UNPACKLO(v[2], v[3]); \
+			const TRegister zw01 = UNPACKHI(v[0], v[1]); \
+			const TRegister zw23 = UNPACKHI(v[2], v[3]); \
+			x = SHUFFLE(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0)); \
+			y = SHUFFLE(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2)); \
+			z = SHUFFLE(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0)); \
+		} \
+		\
+		/* Registers of x, y and z -> vectors v0..v3, w is undefined */ \
+		TARGET inline void transposeFromLanes(const TRegister x, \
+				const TRegister y, const TRegister z, TRegister* v) \
+		{ \
+			const TRegister xy01 = UNPACKLO(x, y); \
+			const TRegister xy23 = UNPACKHI(x, y); \
+			const TRegister zz01 = UNPACKLO(z, z); \
+			const TRegister zz23 = UNPACKHI(z, z); \
+			v[0] = SHUFFLE(xy01, zz01, _MM_SHUFFLE(1, 0, 1, 0)); \
+			v[1] = SHUFFLE(xy01, zz01, _MM_SHUFFLE(3, 2, 3, 2)); \
+			v[2] = SHUFFLE(xy23, zz23, _MM_SHUFFLE(1, 0, 1, 0)); \
+			v[3] = SHUFFLE(xy23, zz23, _MM_SHUFFLE(3, 2, 3, 2)); \
+		} \
+		\
+		/* 12 floats x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3 -> x, y and z */ \
+		TARGET inline void deinterleaveToLanes(const TRegister* v, \
+				TRegister& x, TRegister& y, TRegister& z) \
+		{ \
+			const TRegister x23 = SHUFFLE(v[1], v[2], _MM_SHUFFLE(1, 1, 2, 2)); \
+			const TRegister y01 = SHUFFLE(v[0], v[1], _MM_SHUFFLE(0, 0, 1, 1)); \
+			const TRegister y23 = SHUFFLE(v[1], v[2], _MM_SHUFFLE(2, 2, 3, 3)); \
+			const TRegister z01 = SHUFFLE(v[0], v[1], _MM_SHUFFLE(1, 1, 2, 2)); \
+			x = SHUFFLE(v[0], x23, _MM_SHUFFLE(2, 0, 3, 0)); \
+			y = SHUFFLE(y01, y23, _MM_SHUFFLE(2, 0, 2, 0)); \
+			z = SHUFFLE(z01, v[2], _MM_SHUFFLE(3, 0, 2, 0)); \
+		} \
+		\
+		/* Registers of x, y and z -> 12 floats of deinterleaveToLanes */ \
+		TARGET inline void interleaveFromLanes(const TRegister x, \
+				const TRegister y, const TRegister z, TRegister* v) \
+		{ \
+			const TRegister x0y0 = SHUFFLE(x, y, _MM_SHUFFLE(0, 0, 0, 0)); \
+			const TRegister z0x1 = SHUFFLE(z, x, _MM_SHUFFLE(1, 1, 0, 0)); \
+			const TRegister y1z1 = SHUFFLE(y, z, _MM_SHUFFLE(1, 1, 1, 1)); \
+			const TRegister x2y2 = SHUFFLE(x, y, _MM_SHUFFLE(2, 2, 2, 2)); \
+			const TRegister z2x3 = SHUFFLE(z, x, _MM_SHUFFLE(3, 3, 2, 2)); \
+			const TRegister y3z3 = SHUFFLE(y, z, _MM_SHUFFLE(3, 3, 3, 3)); \
+			v[0] = SHUFFLE(x0y0, z0x1, _MM_SHUFFLE(2, 0, 2, 0)); \
+			v[1] = SHUFFLE(y1z1, x2y2, _MM_SHUFFLE(2, 0, 2, 0)); \
+			v[2] = SHUFFLE(z2x3, y3z3, _MM_SHUFFLE(2, 0, 2, 0)); \
+		}
+
+		IRR_DEFINE_TRANSPOSITIONS(__m128, IRR_TARGET_SSE2, _mm_shuffle_ps,
+				_mm_unpacklo_ps, _mm_unpackhi_ps)
+
+		IRR_DEFINE_TRANSPOSITIONS(__m256, IRR_TARGET_AVX, _mm256_shuffle_ps,
+				_mm256_unpacklo_ps, _mm256_unpackhi_ps)
+
+#undef IRR_DEFINE_TRANSPOSITIONS
+
+		template<bool TTranslate, bool TNormalize>
+		IRR_TARGET_SSE2 void transformVectArray_SSE2(const f32* m, f32* out,
+				const f32* in, u32 count, u32 stride)
+		{
+			SMatrixLanes_SSE2 lanes;
+
+			for (u32 row = 0; row < 4; ++row)
+			{
+				for (u32 column = 0; column < 3; ++column)
+					lanes.M[row][column] = _mm_set1_ps(m[row * 4 + column]);
+			}
+
+			const c8* source = reinterpret_cast<const c8*>(in);
+			c8* destination = reinterpret_cast<c8*>(out);
+
+			u32 i = 0;
+
+			__m128 v[4];
+			__m128 x;
+			__m128 y;
+			__m128 z;
+
+			if (stride == 3 * sizeof(f32))
+			{
+				// dense array, 4 vectors are exactly 3 registers
+				for (; i + 4 <= count; i += 4)
+				{
+					const f32* p = reinterpret_cast<const f32*>(source);
+					f32* q = reinterpret_cast<f32*>(destination);
+
+					v[0] = _mm_loadu_ps(p);
+					v[1] = _mm_loadu_ps(p + 4);
+					v[2] = _mm_loadu_ps(p + 8);
+
+					deinterleaveToLanes(v, x, y, z);
+					STransformVectors<TTranslate, TNormalize>::apply(x, y, z,
+							lanes);
+					interleaveFromLanes(x, y, z, v);
+
+					_mm_storeu_ps(q, v[0]);
+					_mm_storeu_ps(q + 4, v[1]);
+					_mm_storeu_ps(q + 8, v[2]);
+
+					source += 4 * stride;
+					destination += 4 * stride;
+				}
+			}
+			else
+			{
+				// last vector of block must not be the last one
+				for (; i + 4 < count; i += 4)
+				{
+					v[0] = _mm_loadu_ps(reinterpret_cast<const f32*>(source));
+					v[1] = _mm_loadu_ps(
+							reinterpret_cast<const f32*>(source + stride));
+					v[2] = _mm_loadu_ps(
+							reinterpret_cast<const f32*>(source + 2 * stride));
+					v[3] = _mm_loadu_ps(
+							reinterpret_cast<const f32*>(source + 3 * stride));
+
+					transposeToLanes(v, x, y, z);
+					STransformVectors<TTranslate, TNormalize>::apply(x, y, z,
+							lanes);
+					transposeFromLanes(x, y, z, v);
+
+					storeVector_SSE2(reinterpret_cast<f32*>(destination), v[0]);
+					storeVector_SSE2(
+							reinterpret_cast<f32*>(destination + stride), v[1]);
+					storeVector_SSE2(
+							reinterpret_cast<f32*>(destination + 2 * stride),
+							v[2]);
+					storeVector_SSE2(
+							reinterpret_cast<f32*>(destination + 3 * stride),
+							v[3]);
+
+					source += 4 * stride;
+					destination += 4 * stride;
+				}
+			}
+
+			// rest of vectors one by one in first lane
+			for (; i < count; ++i)
+			{
+				const f32* p = reinterpret_cast<const f32*>(source);
+				f32* q = reinterpret_cast<f32*>(destination);
+
+				x = _mm_load_ss(p);
+				y = _mm_load_ss(p + 1);
+				z = _mm_load_ss(p + 2);
+
+				STransformVectors<TTranslate, TNormalize>::apply(x, y, z, lanes);
+
+				_mm_store_ss(q, x);
+				_mm_store_ss(q + 1, y);
+				_mm_store_ss(q + 2, z);
+
+				source += stride;
+				destination += stride;
+			}
+		}
+
+		template<bool TTranslate, bool TNormalize>
+		IRR_TARGET_AVX void transformVectArray_AVX(const f32* m, f32* out,
+				const f32* in, u32 count, u32 stride)
+		{
+			SMatrixLanes_AVX lanes;
+
+			for (u32 row = 0; row < 4; ++row)
+			{
+				for (u32 column = 0; column < 3; ++column)
+					lanes.M[row][column] = _mm256_set1_ps(m[row * 4 + column]);
+			}
+
+			const c8* source = reinterpret_cast<const c8*>(in);
+			c8* destination = reinterpret_cast<c8*>(out);
+
+			u32 i = 0;
+
+			// vectors 0..3 are in low halves of registers, 4..7 in high ones
+			__m256 v[4];
+			__m256 x;
+			__m256 y;
+			__m256 z;
+
+			if (stride == 3 * sizeof(f32))
+			{
+				for (; i + 8 <= count; i += 8)
+				{
+					const f32* p = reinterpret_cast<const f32*>(source);
+					f32* q = reinterpret_cast<f32*>(destination);
+
+					v[0] = loadPair_AVX(p, p + 12);
+					v[1] = loadPair_AVX(p + 4, p + 16);
+					v[2] = loadPair_AVX(p + 8, p + 20);
+
+					deinterleaveToLanes(v, x, y, z);
+					STransformVectors<TTranslate, TNormalize>::apply(x, y, z,
+							lanes);
+					interleaveFromLanes(x, y, z, v);
+
+					storePair_AVX(q, q + 12, v[0]);
+					storePair_AVX(q + 4, q + 16, v[1]);
+					storePair_AVX(q + 8, q + 20, v[2]);
+
+					source += 8 * stride;
+					destination += 8 * stride;
+				}
+			}
+			else
+			{
+				for (; i + 8 < count; i += 8)
+				{
+					const f32* p0 = reinterpret_cast<const f32*>(source);
+					const f32* p4 = reinterpret_cast<const f32*>(source
+							+ 4 * stride);
+
+					v[0] = loadPair_AVX(p0, p4);
+					v[1] = loadPair_AVX(shift(p0, stride), shift(p4, stride));
+					v[2] = loadPair_AVX(shift(p0, 2 * stride),
+							shift(p4, 2 * stride));
+					v[3] = loadPair_AVX(shift(p0, 3 * stride),
+							shift(p4, 3 * stride));
+
+					transposeToLanes(v, x, y, z);
+					STransformVectors<TTranslate, TNormalize>::apply(x, y, z,
+							lanes);
+					transposeFromLanes(x, y, z, v);
+
+					f32* q0 = reinterpret_cast<f32*>(destination);
+					f32* q4 = reinterpret_cast<f32*>(destination + 4 * stride);
+
+					storeVectorPair_AVX(q0, q4, v[0]);
+					storeVectorPair_AVX(shift(q0, stride), shift(q4, stride),
+							v[1]);
+					storeVectorPair_AVX(shift(q0, 2 * stride),
+							shift(q4, 2 * stride), v[2]);
+					storeVectorPair_AVX(shift(q0, 3 * stride),
+							shift(q4, 3 * stride), v[3]);
+
+					source += 8 * stride;
+					destination += 8 * stride;
+				}
+			}
+
+			transformVectArray_SSE2<TTranslate, TNormalize>(m,
+					reinterpret_cast<f32*>(destination),
+					reinterpret_cast<const f32*>(source), count - i, stride);
+		}
+
+		/*
+		 * Operations with whole matrices. Matrix is stored as 4 rows, row r of
+		 * product a * b is sum of rows of a weighted by elements of row r of b.
+		 */
+
+		//! Lanes x, y, z, w of result are lanes of v with these indices
+#define IRR_SWIZZLE(v, x, y, z, w) _mm_shuffle_ps(v, v, _MM_SHUFFLE(w, z, y, x))
+
+		//! Lanes x, y of result are lanes of a, lanes z, w are lanes of b
+#define IRR_SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+
+		//! Returns true if last column of m is 0, 0, 0, 1
+		inline bool isAffine(const f32* m)
+		{
+			return m[3] == 0.f && m[7] == 0.f && m[11] == 0.f && m[15] == 1.f;
+		}
+
+		//! Returns row of a * b, which has weights b of rows a0..a3.
+		//! Operations are in same order as in matrix4::operator*
+		IRR_TARGET_SSE2 inline __m128 multiplyRow_SSE2(const __m128 b,
+				const __m128 a0, const __m128 a1, const __m128 a2,
+				const __m128 a3)
+		{
+			return _mm_add_ps(
+					_mm_add_ps(
+							_mm_add_ps(_mm_mul_ps(IRR_SWIZZLE(b, 0, 0, 0, 0), a0),
+									_mm_mul_ps(IRR_SWIZZLE(b, 1, 1, 1, 1), a1)),
+							_mm_mul_ps(IRR_SWIZZLE(b, 2, 2, 2, 2), a2)),
+					_mm_mul_ps(IRR_SWIZZLE(b, 3, 3, 3, 3), a3));
+		}
+
+		//! Same as multiplyRow_SSE2 for b, which has 0 in last column
+		IRR_TARGET_SSE2 inline __m128 multiplyAffineRow_SSE2(const __m128 b,
+				const __m128 a0, const __m128 a1, const __m128 a2)
+		{
+			return _mm_add_ps(
+					_mm_add_ps(_mm_mul_ps(IRR_SWIZZLE(b, 0, 0, 0, 0), a0),
+							_mm_mul_ps(IRR_SWIZZLE(b, 1, 1, 1, 1), a1)),
+					_mm_mul_ps(IRR_SWIZZLE(b, 2, 2, 2, 2), a2));
+		}
+
+		IRR_TARGET_SSE2 void multiply_SSE2(const f32* a, const f32* b, f32* out)
+		{
+			const __m128 a0 = _mm_loadu_ps(a);
+			const __m128 a1 = _mm_loadu_ps(a + 4);
+			const __m128 a2 = _mm_loadu_ps(a + 8);
+			const __m128 a3 = _mm_loadu_ps(a + 12);
+
+			// all rows are loaded before storing, out may be a or b
+			const __m128 b0 = _mm_loadu_ps(b);
+			const __m128 b1 = _mm_loadu_ps(b + 4);
+			const __m128 b2 = _mm_loadu_ps(b + 8);
+			const __m128 b3 = _mm_loadu_ps(b + 12);
+
+			_mm_storeu_ps(out, multiplyRow_SSE2(b0, a0, a1, a2, a3));
+			_mm_storeu_ps(out + 4, multiplyRow_SSE2(b1, a0, a1, a2, a3));
+			_mm_storeu_ps(out + 8, multiplyRow_SSE2(b2, a0, a1, a2, a3));
+			_mm_storeu_ps(out + 12, multiplyRow_SSE2(b3, a0, a1, a2, a3));
+		}
+
+		//! Multiplies two rows of b (in halves of register) as multiplyRow_SSE2
+		IRR_TARGET_AVX inline __m256 multiplyRows_AVX(const __m256 b,
+				const __m256 a0, const __m256 a1, const __m256 a2,
+				const __m256 a3)
+		{
+			return _mm256_add_ps(
+					_mm256_add_ps(
+							_mm256_add_ps(
+									_mm256_mul_ps(
+											_mm256_permute_ps(b,
+													_MM_SHUFFLE(0, 0, 0, 0)),
+											a0),
+									_mm256_mul_ps(
+											_mm256_permute_ps(b,
+													_MM_SHUFFLE(1, 1, 1, 1)),
+											a1)),
+							_mm256_mul_ps(
+									_mm256_permute_ps(b, _MM_SHUFFLE(2, 2, 2, 2)),
+									a2)),
+					_mm256_mul_ps(_mm256_permute_ps(b, _MM_SHUFFLE(3, 3, 3, 3)),
+							a3));
+		}
+
+		IRR_TARGET_AVX void multiply_AVX(const f32* a, const f32* b, f32* out)
+		{
+			const __m256 a0 = _mm256_broadcast_ps((const __m128*) a);
+			const __m256 a1 = _mm256_broadcast_ps((const __m128*) (a + 4));
+			const __m256 a2 = _mm256_broadcast_ps((const __m128*) (a + 8));
+			const __m256 a3 = _mm256_broadcast_ps((const __m128*) (a + 12));
+
+			// all rows are loaded before storing, out may be a or b
+			const __m256 b01 = _mm256_loadu_ps(b);
+			const __m256 b23 = _mm256_loadu_ps(b + 8);
+
+			_mm256_storeu_ps(out, multiplyRows_AVX(b01, a0, a1, a2, a3));
+			_mm256_storeu_ps(out + 8, multiplyRows_AVX(b23, a0, a1, a2, a3));
+		}
+
+		/*
+		 * Inverse of 4x4 matrix is computed from its 2x2 blocks
+		 * | A B |
+		 * | C D |, every block is stored in one register by rows.
+		 * A# is adjugate of A, |A| is determinant of A.
+		 */
+
+		//! A * B of 2x2 matrices
+		IRR_TARGET_SSE2 inline __m128 multiply2x2_SSE2(const __m128 a,
+				const __m128 b)
+		{
+			return _mm_add_ps(_mm_mul_ps(a, IRR_SWIZZLE(b, 0, 3, 0, 3)),
+					_mm_mul_ps(IRR_SWIZZLE(a, 1, 0, 3, 2),
+							IRR_SWIZZLE(b, 2, 1, 2, 1)));
+		}
+
+		//! A# * B of 2x2 matrices
+		IRR_TARGET_SSE2 inline __m128 adjugateMultiply2x2_SSE2(const __m128 a,
+				const __m128 b)
+		{
+			return _mm_sub_ps(_mm_mul_ps(IRR_SWIZZLE(a, 3, 3, 0, 0), b),
+					_mm_mul_ps(IRR_SWIZZLE(a, 1, 1, 2, 2),
+							IRR_SWIZZLE(b, 2, 3, 0, 1)));
+		}
+
+		//! A * B# of 2x2 matrices
+		IRR_TARGET_SSE2 inline __m128 multiplyAdjugate2x2_SSE2(const __m128 a,
+				const __m128 b)
+		{
+			return _mm_sub_ps(_mm_mul_ps(a, IRR_SWIZZLE(b, 3, 0, 3, 0)),
+					_mm_mul_ps(IRR_SWIZZLE(a, 1, 0, 3, 2),
+							IRR_SWIZZLE(b, 2, 1, 2, 1)));
+		}
+
+		//! Cross product of x, y and z, w is 0
+		IRR_TARGET_SSE2 inline __m128 crossProduct_SSE2(const __m128 a,
+				const __m128 b)
+		{
+			return _mm_sub_ps(
+					_mm_mul_ps(IRR_SWIZZLE(a, 1, 2, 0, 3),
+							IRR_SWIZZLE(b, 2, 0, 1, 3)),
+					_mm_mul_ps(IRR_SWIZZLE(a, 2, 0, 1, 3),
+							IRR_SWIZZLE(b, 1, 2, 0, 3)));
+		}
+
+		//! Inverts affine matrix. Rows of inverse of 3x3 part are cross
+		//! products of its rows divided by determinant, translation is
+		//! -translation * inverse of 3x3 part.
+		IRR_TARGET_SSE2 bool inverseAffine_SSE2(const f32* m, f32* out)
+		{
+			const __m128 r0 = _mm_loadu_ps(m);
+			const __m128 r1 = _mm_loadu_ps(m + 4);
+			const __m128 r2 = _mm_loadu_ps(m + 8);
+			const __m128 t = _mm_loadu_ps(m + 12);
+
+			const __m128 c0 = crossProduct_SSE2(r1, r2);
+			const __m128 c1 = crossProduct_SSE2(r2, r0);
+			const __m128 c2 = crossProduct_SSE2(r0, r1);
+
+			const __m128 products = _mm_mul_ps(r0, c0);
+			const __m128 sum = _mm_add_ps(products,
+					IRR_SWIZZLE(products, 2, 3, 0, 1));
+			const __m128 determinant = _mm_add_ps(sum,
+					IRR_SWIZZLE(sum, 1, 0, 3, 2));
+
+			// same check as in matrix4::getInverse
+			if (fabsf(_mm_cvtss_f32(determinant)) <= SharedMath::RoundErrF32)
+				return false;
+
+			const __m128 invertDeterminant = _mm_div_ps(_mm_set1_ps(1.f),
+					determinant);
+
+			// transpose c0, c1, c2, w of rows stays 0
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 xy01 = _mm_unpacklo_ps(c0, c1);
+			const __m128 xy2 = _mm_unpacklo_ps(c2, zero);
+			const __m128 zw01 = _mm_unpackhi_ps(c0, c1);
+			const __m128 zw2 = _mm_unpackhi_ps(c2, zero);
+
+			const __m128 i0 = _mm_mul_ps(_mm_movelh_ps(xy01, xy2),
+					invertDeterminant);
+			const __m128 i1 = _mm_mul_ps(_mm_movehl_ps(xy2, xy01),
+					invertDeterminant);
+			const __m128 i2 = _mm_mul_ps(_mm_movelh_ps(zw01, zw2),
+					invertDeterminant);
+
+			const __m128 i3 = _mm_sub_ps(_mm_setr_ps(0.f, 0.f, 0.f, 1.f),
+					multiplyAffineRow_SSE2(t, i0, i1, i2));
+
+			_mm_storeu_ps(out, i0);
+			_mm_storeu_ps(out + 4, i1);
+			_mm_storeu_ps(out + 8, i2);
+			_mm_storeu_ps(out + 12, i3);
+
+			return true;
+		}
+
+		IRR_TARGET_SSE2 bool inverse_SSE2(const f32* m, f32* out)
+		{
+			if (isAffine(m))
+				return inverseAffine_SSE2(m, out);
+
+			const __m128 r0 = _mm_loadu_ps(m);
+			const __m128 r1 = _mm_loadu_ps(m + 4);
+			const __m128 r2 = _mm_loadu_ps(m + 8);
+			const __m128 r3 = _mm_loadu_ps(m + 12);
+
+			const __m128 a = _mm_movelh_ps(r0, r1);
+			const __m128 b = _mm_movehl_ps(r1, r0);
+			const __m128 c = _mm_movelh_ps(r2, r3);
+			const __m128 d = _mm_movehl_ps(r3, r2);
+
+			// |A| |B| |C| |D|
+			const __m128 determinants = _mm_sub_ps(
+					_mm_mul_ps(IRR_SHUFFLE(r0, r2, 0, 2, 0, 2),
+							IRR_SHUFFLE(r1, r3, 1, 3, 1, 3)),
+					_mm_mul_ps(IRR_SHUFFLE(r0, r2, 1, 3, 1, 3),
+							IRR_SHUFFLE(r1, r3, 0, 2, 0, 2)));
+
+			const __m128 determinantA = IRR_SWIZZLE(determinants, 0, 0, 0, 0);
+			const __m128 determinantB = IRR_SWIZZLE(determinants, 1, 1, 1, 1);
+			const __m128 determinantC = IRR_SWIZZLE(determinants, 2, 2, 2, 2);
+			const __m128 determinantD = IRR_SWIZZLE(determinants, 3, 3, 3, 3);
+
+			const __m128 adjugateDC = adjugateMultiply2x2_SSE2(d, c);
+			const __m128 adjugateAB = adjugateMultiply2x2_SSE2(a, b);
+
+			// inverse is 1 / |M| * | X Y |
+			//                      | Z W |, adjugates of blocks are computed
+			__m128 x = _mm_sub_ps(_mm_mul_ps(determinantD, a),
+					multiply2x2_SSE2(b, adjugateDC));
+			__m128 w = _mm_sub_ps(_mm_mul_ps(determinantA, d),
+					multiply2x2_SSE2(c, adjugateAB));
+			__m128 y = _mm_sub_ps(_mm_mul_ps(determinantB, c),
+					multiplyAdjugate2x2_SSE2(d, adjugateAB));
+			__m128 z = _mm_sub_ps(_mm_mul_ps(determinantC, b),
+					multiplyAdjugate2x2_SSE2(a, adjugateDC));
+
+			// |M| = |A| * |D| + |B| * |C| - trace(A#B * D#C)
+			__m128 trace = _mm_mul_ps(adjugateAB,
+					IRR_SWIZZLE(adjugateDC, 0, 2, 1, 3));
+			trace = _mm_add_ps(trace, IRR_SWIZZLE(trace, 2, 3, 0, 1));
+			trace = _mm_add_ps(trace, IRR_SWIZZLE(trace, 1, 0, 3, 2));
+
+			const __m128 determinant = _mm_sub_ps(
+					_mm_add_ps(_mm_mul_ps(determinantA, determinantD),
+							_mm_mul_ps(determinantB, determinantC)), trace);
+
+			if (fabsf(_mm_cvtss_f32(determinant)) <= SharedMath::RoundErrF32)
+				return false;
+
+			const __m128 invertDeterminant = _mm_div_ps(
+					_mm_setr_ps(1.f, -1.f, -1.f, 1.f), determinant);
+
+			x = _mm_mul_ps(x, invertDeterminant);
+			y = _mm_mul_ps(y, invertDeterminant);
+			z = _mm_mul_ps(z, invertDeterminant);
+			w = _mm_mul_ps(w, invertDeterminant);
+
+			// adjugates of blocks are transposed while rows are assembled
+			_mm_storeu_ps(out, IRR_SHUFFLE(x, y, 3, 1, 3, 1));
+			_mm_storeu_ps(out + 4, IRR_SHUFFLE(x, y, 2, 0, 2, 0));
+			_mm_storeu_ps(out + 8, IRR_SHUFFLE(z, w, 3, 1, 3, 1));
+			_mm_storeu_ps(out + 12, IRR_SHUFFLE(z, w, 2, 0, 2, 0));
+
+			return true;
+		}
+
+#undef IRR_SHUFFLE
+#undef IRR_SWIZZLE
+
+		//! Kernels for SSE2
+		static const SMatrix4SIMD Matrix4SSE2 =
+		{ transformVectArray_SSE2<true, false>,
+				transformVectArray_SSE2<false, false>,
+				transformVectArray_SSE2<false, true>, multiply_SSE2, inverse_SSE2 };
+
+		//! Kernels for AVX. Inverse works with 2x2 blocks, which fit 128 bit
+		//! registers, it is same as for SSE2.
+		static const SMatrix4SIMD Matrix4AVX =
+		{ transformVectArray_AVX<true, false>,
+				transformVectArray_AVX<false, false>,
+				transformVectArray_AVX<false, true>, multiply_AVX, inverse_SSE2 };
+
+		//! Selects kernels by features of current processor
+		static const SMatrix4SIMD* selectMatrix4SIMD()
+		{
+			const SharedCPUFeatures& cpu = SharedCPUFeatures::getInstance();
+
+			if (cpu.hasAVX())
+				return &Matrix4AVX;
+
+			if (cpu.hasSSE2())
+				return &Matrix4SSE2;
+
+			return 0;
+		}
+
+		//! Returns SIMD kernels supported by current processor.
+		const SMatrix4SIMD* getMatrix4SIMD()
+		{
+			// features are detected once, matrices ask for kernels often
+			static const SMatrix4SIMD* result = selectMatrix4SIMD();
+			return result;
+		}
+
+		//! Returns kernels of SSE2 instruction set
+		const SMatrix4SIMD* getMatrix4SSE2()
+		{
+			return &Matrix4SSE2;
+		}
+
+		//! Returns kernels of AVX instruction set
+		const SMatrix4SIMD* getMatrix4AVX()
+		{
+			return &Matrix4AVX;
+		}
+
+	}  // namespace core
+}  // namespace irrgame
+
+#else
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Returns SIMD kernels supported by current processor.
+		const SMatrix4SIMD* getMatrix4SIMD()
+		{
+			return 0;
+		}
+
+		//! Returns kernels of SSE2 instruction set
+		const SMatrix4SIMD* getMatrix4SSE2()
+		{
+			return 0;
+		}
+
+		//! Returns kernels of AVX instruction set
+		const SMatrix4SIMD* getMatrix4AVX()
+		{
+			return 0;
+		}
+
+	}  // namespace core
+}  // namespace irrgame
+
+#endif /* IRR_SIMD_MATRIX && IRR_X86_SIMD */
@@ -0,0 +1,651 @@
+/*
+ * SharedCulling.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#include "core/math/SharedCulling.h"
+#include "threads/SharedJobPool.h"
+
+#if defined(IRR_SIMD_CULLING) && defined(IRR_X86_SIMD)
+
+#include "core/utils/SharedCPUFeatures.h"
+
+#include <immintrin.h>
+
+/*
+ * Kernels are compiled for their instruction set with target attribute,
+ * so whole engine is not required to be built with -mavx.
+ */
+#define IRR_TARGET_SSE2 __attribute__((target("sse2")))
+#define IRR_TARGET_AVX __attribute__((target("avx")))
+
+#endif /* IRR_SIMD_CULLING && IRR_X86_SIMD */
+
+namespace irrgame
+{
+	namespace core
+	{
+		/*
+		 * Kernel tests boxes [begin; end), begin is multiple of 32, and writes
+		 * words of mask from begin / 32. Every word is written once, so bands
+		 * of words are proceed by threads without synchronization.
+		 */
+		typedef void (*tCullingKernel)(const void* query, u32 begin, u32 end,
+				u32* visible);
+
+		//! Kernels for one instruction set
+		struct SCullingKernels
+		{
+			public:
+				tCullingKernel Frustum;
+				tCullingKernel Box;
+		};
+
+		//! Planes prepared for cullFrustum. For every plane components of
+		//! box, which are nearest to its front side, are selected like in
+		//! aabbox3d::classifyPlaneRelation.
+		struct SFrustumQuery
+		{
+			public:
+				u32 PlanesCount;
+
+				const f32* X[SharedCulling::MaxPlanes];
+				const f32* Y[SharedCulling::MaxPlanes];
+				const f32* Z[SharedCulling::MaxPlanes];
+
+				f32 NormalX[SharedCulling::MaxPlanes];
+				f32 NormalY[SharedCulling::MaxPlanes];
+				f32 NormalZ[SharedCulling::MaxPlanes];
+				f32 D[SharedCulling::MaxPlanes];
+		};
+
+		//! Box prepared for cullBox
+		struct SBoxQuery
+		{
+			public:
+				const f32* Component[aabbox3darray::EC_COUNT];
+
+				//! Edges of tested box
+				f32 Edge[aabbox3darray::EC_COUNT];
+		};
+
+		//! Returns True if box index is not in front of any plane. Operations
+		//! are in same order as in classifyPlaneRelation, so results are same.
+		inline bool isVisible(const SFrustumQuery& q, u32 index)
+		{
+			for (u32 p = 0; p < q.PlanesCount; ++p)
+			{
+				if (q.NormalX[p] * q.X[p][index] + q.NormalY[p] * q.Y[p][index]
+						+ q.NormalZ[p] * q.Z[p][index] + q.D[p] > 0.0f)
+					return false;
+			}
+
+			return true;
+		}
+
+		//! Returns True if box index intersects box of query
+		inline bool isVisible(const SBoxQuery& q, u32 index)
+		{
+			return q.Component[aabbox3darray::EC_MIN_X][index]
+					<= q.Edge[aabbox3darray::EC_MAX_X]
+					&& q.Component[aabbox3darray::EC_MIN_Y][index]
+							<= q.Edge[aabbox3darray::EC_MAX_Y]
+					&& q.Component[aabbox3darray::EC_MIN_Z][index]
+							<= q.Edge[aabbox3darray::EC_MAX_Z]
+					&& q.Component[aabbox3darray::EC_MAX_X][index]
+							>= q.Edge[aabbox3darray::EC_MIN_X]
+					&& q.Component[aabbox3darray::EC_MAX_Y][index]
+							>= q.Edge[aabbox3darray::EC_MIN_Y]
+					&& q.Component[aabbox3darray::EC_MAX_Z][index]
+							>= q.Edge[aabbox3darray::EC_MIN_Z];
+		}
+
+		//! Returns mask of boxes [index; index + count), which are visible
+		template<class TQuery>
+		inline u32 getVisibleBits(const TQuery& q, u32 index, u32 count)
+		{
+			u32 result = 0;
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				if (isVisible(q, index + i))
+					result |= 1u << i;
+			}
+
+			return result;
+		}
+
+		//! Returns count of boxes of word, which starts at box index
+		inline u32 getWordBoxes(u32 index, u32 end)
+		{
+			return end - index < 32 ? end - index : 32;
+		}
+
+		//! Scalar kernel for any query
+		template<class TQuery>
+		void cull_Scalar(const void* query, u32 begin, u32 end, u32* visible)
+		{
+			const TQuery& q = *(const TQuery*) query;
+
+			for (u32 index = begin; index < end; index += 32)
+				visible[index >> 5] = getVisibleBits(q, index,
+						getWordBoxes(index, end));
+		}
+
+		//! Kernels without SIMD
+		static const SCullingKernels CullingScalar =
+		{ cull_Scalar<SFrustumQuery>, cull_Scalar<SBoxQuery> };
+
+#if defined(IRR_SIMD_CULLING) && defined(IRR_X86_SIMD)
+
+		/*
+		 * Components are loaded unaligned, so arrays are not required to be
+		 * aligned. Boxes are tested 4 (SSE2) or 8 (AVX) at a time, last boxes
+		 * of array, which do not fill register, are tested by scalar code.
+		 */
+
+		//! Returns lanes of boxes, which are in front of plane. x, y and z are
+		//! edges of boxes nearest to its front side.
+		IRR_TARGET_SSE2 inline __m128 isInFront_SSE2(const f32* x, const f32* y,
+				const f32* z, const __m128& normalX, const __m128& normalY,
+				const __m128& normalZ, const __m128& d)
+		{
+			__m128 distance = _mm_add_ps(
+					_mm_mul_ps(normalX, _mm_loadu_ps(x)),
+					_mm_mul_ps(normalY, _mm_loadu_ps(y)));
+
+			distance = _mm_add_ps(distance,
+					_mm_mul_ps(normalZ, _mm_loadu_ps(z)));
+			distance = _mm_add_ps(distance, d);
+
+			return _mm_cmpgt_ps(distance, _mm_setzero_ps());
+		}
+
+		IRR_TARGET_SSE2 void cullFrustum_SSE2(const void* query, u32 begin,
+				u32 end, u32* visible)
+		{
+			const SFrustumQuery& q = *(const SFrustumQuery*) query;
+
+			for (u32 index = begin; index < end; index += 32)
+			{
+				const u32 count = getWordBoxes(index, end);
+				const u32 blocks = count / 4;
+
+				// lanes of boxes of word, which are culled by some plane
+				__m128 culled[8];
+
+				for (u32 b = 0; b < 8; ++b)
+					culled[b] = _mm_setzero_ps();
+
+				// every plane is prepared once for whole word
+				for (u32 p = 0; p < q.PlanesCount; ++p)
+				{
+					const __m128 normalX = _mm_set1_ps(q.NormalX[p]);
+					const __m128 normalY = _mm_set1_ps(q.NormalY[p]);
+					const __m128 normalZ = _mm_set1_ps(q.NormalZ[p]);
+					const __m128 d = _mm_set1_ps(q.D[p]);
+
+					const f32* x = q.X[p] + index;
+					const f32* y = q.Y[p] + index;
+					const f32* z = q.Z[p] + index;
+
+					if (blocks == 8)
+					{
+						culled[0] = _mm_or_ps(culled[0],
+								isInFront_SSE2(x, y, z, normalX, normalY,
+										normalZ, d));
+
+						culled[1] = _mm_or_ps(culled[1],
+								isInFront_SSE2(x + 4, y + 4, z + 4,
+										normalX, normalY, normalZ, d));
+
+						culled[2] = _mm_or_ps(culled[2],
+								isInFront_SSE2(x + 8, y + 8, z + 8,
+										normalX, normalY, normalZ, d));
+
+						culled[3] = _mm_or_ps(culled[3],
+								isInFront_SSE2(x + 12, y + 12, z + 12,
+										normalX, normalY, normalZ, d));
+
+						culled[4] = _mm_or_ps(culled[4],
+								isInFront_SSE2(x + 16, y + 16, z + 16,
+										normalX, normalY, normalZ, d));
+
+						culled[5] = _mm_or_ps(culled[5],
+								isInFront_SSE2(x + 20, y + 20, z + 20,
+										normalX, normalY, normalZ, d));
+
+						culled[6] = _mm_or_ps(culled[6],
+								isInFront_SSE2(x + 24, y + 24, z + 24,
+										normalX, normalY, normalZ, d));
+
+						culled[7] = _mm_or_ps(culled[7],
+								isInFront_SSE2(x + 28, y + 28, z + 28,
+										normalX, normalY, normalZ, d));
+					}
+					else
+					{
+						for (u32 b = 0; b < blocks; ++b)
+							culled[b] = _mm_or_ps(culled[b],
+									isInFront_SSE2(x + b * 4, y + b * 4,
+											z + b * 4, normalX, normalY,
+											normalZ, d));
+					}
+				}
+
+				u32 result = 0;
+
+				for (u32 b = 0; b < blocks; ++b)
+					result |= (u32) (~_mm_movemask_ps(culled[b]) & 0xF)
+							<< (b * 4);
+
+				if (blocks * 4 < count)
+					result |= getVisibleBits(q, index + blocks * 4,
+							count - blocks * 4) << (blocks * 4);
+
+				visible[index >> 5] = result;
+			}
+		}
+
+		IRR_TARGET_SSE2 void cullBox_SSE2(const void* query, u32 begin, u32 end,
+				u32* visible)
+		{
+			const SBoxQuery& q = *(const SBoxQuery*) query;
+
+			__m128 edge[aabbox3darray::EC_COUNT];
+
+			for (u32 c = 0; c < aabbox3darray::EC_COUNT; ++c)
+				edge[c] = _mm_set1_ps(q.Edge[c]);
+
+			for (u32 index = begin; index < end; index += 32)
+			{
+				const u32 count = getWordBoxes(index, end);
+				u32 result = 0;
+				u32 i = 0;
+
+				for (; i + 4 <= count; i += 4)
+				{
+					const u32 n = index + i;
+
+					__m128 inside = _mm_and_ps(
+							_mm_cmple_ps(
+									_mm_loadu_ps(
+											q.Component[aabbox3darray::EC_MIN_X]
+													+ n),
+									edge[aabbox3darray::EC_MAX_X]),
+							_mm_cmpge_ps(
+									_mm_loadu_ps(
+											q.Component[aabbox3darray::EC_MAX_X]
+													+ n),
+									edge[aabbox3darray::EC_MIN_X]));
+
+					inside = _mm_and_ps(inside,
+							_mm_cmple_ps(
+									_mm_loadu_ps(
+											q.Component[aabbox3darray::EC_MIN_Y]
+													+ n),
+									edge[aabbox3darray::EC_MAX_Y]));
+
+					inside = _mm_and_ps(inside,
+							_mm_cmpge_ps(
+									_mm_loadu_ps(
+											q.Component[aabbox3darray::EC_MAX_Y]
+													+ n),
+									edge[aabbox3darray::EC_MIN_Y]));
+
+					inside = _mm_and_ps(inside,
+							_mm_cmple_ps(
+									_mm_loadu_ps(
+											q.Component[aabbox3darray::EC_MIN_Z]
+													+ n),
+									edge[aabbox3darray::EC_MAX_Z]));
+
+					inside = _mm_and_ps(inside,
+							_mm_cmpge_ps(
+									_mm_loadu_ps(
+											q.Component[aabbox3darray::EC_MAX_Z]
+													+ n),
+									edge[aabbox3darray::EC_MIN_Z]));
+
+					result |= (u32) _mm_movemask_ps(inside) << i;
+				}
+
+				if (i < count)
+					result |= getVisibleBits(q, index + i, count - i) << i;
+
+				visible[index >> 5] = result;
+			}
+		}
+
+		//! Returns lanes of boxes, which are in front of plane. x, y and z are
+		//! edges of boxes nearest to its front side.
+		IRR_TARGET_AVX inline __m256 isInFront_AVX(const f32* x, const f32* y,
+				const f32* z, const __m256& normalX, const __m256& normalY,
+				const __m256& normalZ, const __m256& d)
+		{
+			__m256 distance = _mm256_add_ps(
+					_mm256_mul_ps(normalX, _mm256_loadu_ps(x)),
+					_mm256_mul_ps(normalY, _mm256_loadu_ps(y)));
+
+			distance = _mm256_add_ps(distance,
+					_mm256_mul_ps(normalZ, _mm256_loadu_ps(z)));
+			distance = _mm256_add_ps(distance, d);
+
+			return _mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_GT_OQ);
+		}
+
+		IRR_TARGET_AVX void cullFrustum_AVX(const void* query, u32 begin,
+				u32 end, u32* visible)
+		{
+			const SFrustumQuery& q = *(const SFrustumQuery*) query;
+
+			for (u32 index = begin; index < end; index += 32)
+			{
+				const u32 count = getWordBoxes(index, end);
+				const u32 blocks = count / 8;
+
+				// lanes of boxes of word, which are culled by some plane
+				__m256 culled[4];
+
+				for (u32 b = 0; b < 4; ++b)
+					culled[b] = _mm256_setzero_ps();
+
+				// every plane is prepared once for whole word
+				for (u32 p = 0; p < q.PlanesCount; ++p)
+				{
+					const __m256 normalX = _mm256_set1_ps(q.NormalX[p]);
+					const __m256 normalY = _mm256_set1_ps(q.NormalY[p]);
+					const __m256 normalZ = _mm256_set1_ps(q.NormalZ[p]);
+					const __m256 d = _mm256_set1_ps(q.D[p]);
+
+					const f32* x = q.X[p] + index;
+					const f32* y = q.Y[p] + index;
+					const f32* z = q.Z[p] + index;
+
+					if (blocks == 4)
+					{
+						culled[0] = _mm256_or_ps(culled[0],
+								isInFront_AVX(x, y, z, normalX, normalY,
+										normalZ, d));
+
+						culled[1] = _mm256_or_ps(culled[1],
+								isInFront_AVX(x + 8, y + 8, z + 8,
+										normalX, normalY, normalZ, d));
+
+						culled[2] = _mm256_or_ps(culled[2],
+								isInFront_AVX(x + 16, y + 16, z + 16,
+										normalX, normalY, normalZ, d));
+
+						culled[3] = _mm256_or_ps(culled[3],
+								isInFront_AVX(x + 24, y + 24, z + 24,
+										normalX, normalY, normalZ, d));
+					}
+					else
+					{
+						for (u32 b = 0; b < blocks; ++b)
+							culled[b] = _mm256_or_ps(culled[b],
+									isInFront_AVX(x + b * 8, y + b * 8,
+											z + b * 8, normalX, normalY,
+											normalZ, d));
+					}
+				}
+
+				u32 result = 0;
+
+				for (u32 b = 0; b < blocks; ++b)
+					result |= (u32) (~_mm256_movemask_ps(culled[b]) & 0xFF)
+							<< (b * 8);
+
+				if (blocks * 8 < count)
+					result |= getVisibleBits(q, index + blocks * 8,
+							count - blocks * 8) << (blocks * 8);
+
+				visible[index >> 5] = result;
+			}
+		}
+
+		IRR_TARGET_AVX void cullBox_AVX(const void* query, u32 begin, u32 end,
+				u32* visible)
+		{
+			const SBoxQuery& q = *(const SBoxQuery*) query;
+
+			__m256 edge[aabbox3darray::EC_COUNT];
+
+			for (u32 c = 0; c < aabbox3darray::EC_COUNT; ++c)
+				edge[c] = _mm256_set1_ps(q.Edge[c]);
+
+			for (u32 index = begin; index < end; index += 32)
+			{
+				const u32 count = getWordBoxes(index, end);
+				u32 result = 0;
+				u32 i = 0;
+
+				for (; i + 8 <= count; i += 8)
+				{
+					const u32 n = index + i;
+
+					__m256 inside = _mm256_and_ps(
+							_mm256_cmp_ps(
+									_mm256_loadu_ps(
+											q.Component[aabbox3darray::EC_MIN_X]
+													+ n),
+									edge[aabbox3darray::EC_MAX_X], _CMP_LE_OQ),
+							_mm256_cmp_ps(
+									_mm256_loadu_ps(
+											q.Component[aabbox3darray::EC_MAX_X]
+													+ n),
+									edge[aabbox3darray::EC_MIN_X], _CMP_GE_OQ));
+
+					inside = _mm256_and_ps(inside,
+							_mm256_cmp_ps(
+									_mm256_loadu_ps(
+											q.Component[aabbox3darray::EC_MIN_Y]
+													+ n),
+									edge[aabbox3darray::EC_MAX_Y], _CMP_LE_OQ));
+
+					inside = _mm256_and_ps(inside,
+							_mm256_cmp_ps(
+									_mm256_loadu_ps(
+											q.Component[aabbox3darray::EC_MAX_Y]
+													+ n),
+									edge[aabbox3darray::EC_MIN_Y], _CMP_GE_OQ));
+
+					inside = _mm256_and_ps(inside,
+							_mm256_cmp_ps(
+									_mm256_loadu_ps(
+											q.Component[aabbox3darray::EC_MIN_Z]
+													+ n),
+									edge[aabbox3darray::EC_MAX_Z], _CMP_LE_OQ));
+
+					inside = _mm256_and_ps(inside,
+							_mm256_cmp_ps(
+									_mm256_loadu_ps(
+											q.Component[aabbox3darray::EC_MAX_Z]
+													+ n),
+									edge[aabbox3darray::EC_MIN_Z], _CMP_GE_OQ));
+
+					result |= (u32) _mm256_movemask_ps(inside) << i;
+				}
+
+				if (i < count)
+					result |= getVisibleBits(q, index + i, count - i) << i;
+
+				visible[index >> 5] = result;
+			}
+		}
+
+		//! Kernels for SSE2
+		static const SCullingKernels CullingSSE2 =
+		{ cullFrustum_SSE2, cullBox_SSE2 };
+
+		//! Kernels for AVX
+		static const SCullingKernels CullingAVX =
+		{ cullFrustum_AVX, cullBox_AVX };
+
+		//! Returns kernels for best instruction set of processor
+		static const SCullingKernels* selectCullingKernels()
+		{
+			const SharedCPUFeatures& cpu = SharedCPUFeatures::getInstance();
+
+			if (cpu.hasAVX())
+				return &CullingAVX;
+
+			if (cpu.hasSSE2())
+				return &CullingSSE2;
+
+			return &CullingScalar;
+		}
+
+#else
+
+		//! Returns kernels for best instruction set of processor
+		static const SCullingKernels* selectCullingKernels()
+		{
+			return &CullingScalar;
+		}
+
+#endif /* IRR_SIMD_CULLING && IRR_X86_SIMD */
+
+		//! Context of parallel culling
+		struct SCullingBands
+		{
+			public:
+				tCullingKernel Kernel;
+				const void* Query;
+				u32 Count;
+				u32* Visible;
+		};
+
+		//! Culls boxes of mask words [begin; end)
+		static void executeCullingBands(void* context, u32 begin, u32 end)
+		{
+			const SCullingBands* bands = (const SCullingBands*) context;
+
+			const u32 last = end * 32 < bands->Count ? end * 32 : bands->Count;
+
+			bands->Kernel(bands->Query, begin * 32, last, bands->Visible);
+		}
+
+		//! Runs kernel over all words of mask, in parallel if boxes are many
+		static void executeCulling(tCullingKernel kernel, const void* query,
+				u32 count, u32 threshold, u32* visible)
+		{
+			if (count < threshold || count <= 32)
+			{
+				kernel(query, 0, count, visible);
+				return;
+			}
+
+			SCullingBands bands;
+			bands.Kernel = kernel;
+			bands.Query = query;
+			bands.Count = count;
+			bands.Visible = visible;
+
+			threads::SharedJobPool::getInstance().parallelFor(
+					executeCullingBands, &bands, (count + 31) / 32,
+					IRR_PARALLEL_CULLING_BAND_BOXES / 32);
+		}
+
+		//! Singleton realization
+		SharedCulling& SharedCulling::getInstance()
+		{
+			static SharedCulling instance;
+			return instance;
+		}
+
+		//! Default constructor. Should use only one time.
+		SharedCulling::SharedCulling() :
+				Kernels(selectCullingKernels()), ParallelThreshold(
+						IRR_PARALLEL_CULLING_THRESHOLD)
+		{
+		}
+
+		//! Destructor. Should use only one time.
+		SharedCulling::~SharedCulling()
+		{
+		}
+
+		//! Returns count of u32 words of mask for count boxes
+		u32 SharedCulling::getMaskSize(u32 count) const
+		{
+			return (count + 31) / 32;
+		}
+
+		//! Culls boxes by planes, which normals point out of visible volume.
+		void SharedCulling::cullFrustum(const aabbox3darray& boxes,
+				const plane3d<f32>* planes, u32 planesCount, u32* visible)
+		{
+			IRR_ASSERT(planesCount <= MaxPlanes);
+			IRR_ASSERT(visible != 0);
+
+			SFrustumQuery q;
+			q.PlanesCount = planesCount;
+
+			for (u32 p = 0; p < planesCount; ++p)
+			{
+				const vector3d<f32>& normal = planes[p].Normal;
+
+				// nearest to front side edge, same as in classifyPlaneRelation
+				q.X[p] = boxes.getComponent(
+						normal.X > 0.0f ?
+								aabbox3darray::EC_MIN_X :
+								aabbox3darray::EC_MAX_X);
+				q.Y[p] = boxes.getComponent(
+						normal.Y > 0.0f ?
+								aabbox3darray::EC_MIN_Y :
+								aabbox3darray::EC_MAX_Y);
+				q.Z[p] = boxes.getComponent(
+						normal.Z > 0.0f ?
+								aabbox3darray::EC_MIN_Z :
+								aabbox3darray::EC_MAX_Z);
+
+				q.NormalX[p] = normal.X;
+				q.NormalY[p] = normal.Y;
+				q.NormalZ[p] = normal.Z;
+				q.D[p] = planes[p].D;
+			}
+
+			executeCulling(Kernels->Frustum, &q, boxes.size(),
+					ParallelThreshold, visible);
+		}
+
+		//! Culls boxes, which do not intersect box.
+		void SharedCulling::cullBox(const aabbox3darray& boxes,
+				const aabbox3d<f32>& box, u32* visible)
+		{
+			IRR_ASSERT(visible != 0);
+
+			SBoxQuery q;
+
+			for (u32 c = 0; c < aabbox3darray::EC_COUNT; ++c)
+				q.Component[c] = boxes.getComponent(
+						(aabbox3darray::EComponent) c);
+
+			q.Edge[aabbox3darray::EC_MIN_X] = box.MinEdge.X;
+			q.Edge[aabbox3darray::EC_MIN_Y] = box.MinEdge.Y;
+			q.Edge[aabbox3darray::EC_MIN_Z] = box.MinEdge.Z;
+			q.Edge[aabbox3darray::EC_MAX_X] = box.MaxEdge.X;
+			q.Edge[aabbox3darray::EC_MAX_Y] = box.MaxEdge.Y;
+			q.Edge[aabbox3darray::EC_MAX_Z] = box.MaxEdge.Z;
+
+			executeCulling(Kernels->Box, &q, boxes.size(), ParallelThreshold,
+					visible);
+		}
+
+		//! Sets minimal count of boxes, which are culled in parallel.
+		void SharedCulling::setParallelThreshold(u32 boxes)
+		{
+			ParallelThreshold = boxes;
+		}
+
+		//! Returns minimal count of boxes, which are culled in parallel
+		u32 SharedCulling::getParallelThreshold() const
+		{
+			return ParallelThreshold;
+		}
+
+	}  // namespace core
+}  // namespace irrgame
@@ -0,0 +1,1422 @@
+/*
+ * TriangleBVH.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#include "core/shapes/TriangleBVH.h"
+#include "core/collections/smallarray.h"
+#include "core/allocator/irrAllocator.h"
+#include "threads/SharedJobPool.h"
+
+#include <math.h>
+
+#if defined(IRR_SIMD_BVH) && defined(IRR_X86_SIMD)
+
+#include "core/utils/SharedCPUFeatures.h"
+
+#include <immintrin.h>
+
+/*
+ * Kernels are compiled for their instruction set with target attribute,
+ * so whole engine is not required to be built with -msse2.
+ */
+#define IRR_TARGET_SSE2 __attribute__((target("sse2")))
+
+#endif /* IRR_SIMD_BVH && IRR_X86_SIMD */
+
+namespace irrgame
+{
+	namespace core
+	{
+		/*
+		 * Child of node is index of other node or leaf. Leaf is LeafFlag,
+		 * index of its first triangle shifted by LeafCountBits and count of
+		 * its triangles.
+		 */
+
+		//! Highest bit of child, which is leaf
+		static const u32 LeafFlag = 0x80000000;
+
+		//! Bits of count of triangles of leaf
+		static const u32 LeafCountBits = 3;
+
+		//! Child of node, which is not used
+		static const u32 EmptyChild = 0xFFFFFFFF;
+
+		//! Far distance of ray in box is scaled by it, so rounding errors of
+		//! slab test never miss triangle, which touches box.
+		static const f32 RayBoxTolerance = 1.0000004f;
+
+		//! Direction components of ray are not smaller than it, so their
+		//! reciprocals are finite
+		static const f32 MinRayDirection = 1e-20f;
+
+		//! Parallel build creates about this count of subtrees per thread
+		static const u32 BuildTasksPerThread = 8;
+
+		//! Minimal count of triangles of subtree, which is built by other
+		//! thread
+		static const u32 MinBuildTaskTriangles = 1024;
+
+		inline u32 makeLeaf(u32 first, u32 count)
+		{
+			return LeafFlag | (first << LeafCountBits) | count;
+		}
+
+		inline u32 getLeafFirst(u32 child)
+		{
+			return (child & ~LeafFlag) >> LeafCountBits;
+		}
+
+		inline u32 getLeafCount(u32 child)
+		{
+			return child & ((1 << LeafCountBits) - 1);
+		}
+
+		/*
+		 * Build
+		 */
+
+		//! Build data of triangle
+		struct SBuildTriangle
+		{
+				f32 Min[3];
+				f32 Max[3];
+				f32 Centroid[3];
+
+				//! Index in TriangleBVH::Triangles before build
+				u32 Index;
+		};
+
+		//! Range of build triangles and their bounds
+		struct SBuildRange
+		{
+				u32 Begin;
+				u32 End;
+
+				f32 Min[3];
+				f32 Max[3];
+
+				//! Bounds of centroids of triangles
+				f32 CentroidMin[3];
+				f32 CentroidMax[3];
+		};
+
+		//! Bin of surface area heuristic
+		struct SBuildBin
+		{
+				u32 Count;
+
+				f32 Min[3];
+				f32 Max[3];
+		};
+
+		//! Subtree, which is built later by other thread
+		struct SBuildTask
+		{
+				SBuildRange Range;
+
+				//! Node and its child, which is root of subtree
+				u32 Parent;
+				u32 Slot;
+
+				//! Nodes of subtree, its root is first
+				array<SBVHNode>* Nodes;
+		};
+
+		//! State of one build
+		struct SBuilder
+		{
+				SBuildTriangle* Triangles;
+
+				//! Subtrees, which are left for other threads. 0 - build all.
+				array<SBuildTask>* Tasks;
+
+				//! Maximal count of triangles of subtree, which is left as task
+				u32 TaskTriangles;
+		};
+
+		//! Sets inverted bounds, so adding any point makes them valid
+		inline void resetBounds(f32* min, f32* max)
+		{
+			for (u32 a = 0; a < 3; ++a)
+			{
+				min[a] = SharedMath::MaxFloat;
+				max[a] = -SharedMath::MaxFloat;
+			}
+		}
+
+		//! Adds bounds to other bounds. Written as selects, which compile
+		//! to min and max instructions, because branches on unordered
+		//! triangles are mispredicted.
+		inline void addBounds(f32* min, f32* max, const f32* addedMin,
+				const f32* addedMax)
+		{
+			for (u32 a = 0; a < 3; ++a)
+			{
+				min[a] = addedMin[a] < min[a] ? addedMin[a] : min[a];
+				max[a] = addedMax[a] > max[a] ? addedMax[a] : max[a];
+			}
+		}
+
+		//! Returns half of surface area of bounds
+		inline f32 getHalfArea(const f32* min, const f32* max)
+		{
+			const f32 x = max[0] - min[0];
+			const f32 y = max[1] - min[1];
+			const f32 z = max[2] - min[2];
+
+			return x * y + y * z + z * x;
+		}
+
+		//! Returns bin of centroid
+		inline u32 getBin(f32 centroid, f32 min, f32 scale)
+		{
+			const u32 bin = (u32) ((centroid - min) * scale);
+
+			return bin < IRR_BVH_SAH_BINS ? bin : IRR_BVH_SAH_BINS - 1;
+		}
+
+		//! Computes bounds of triangles of range and of their centroids
+		static void computeBounds(const SBuildTriangle* triangles,
+				SBuildRange& range)
+		{
+			resetBounds(range.Min, range.Max);
+			resetBounds(range.CentroidMin, range.CentroidMax);
+
+			for (u32 i = range.Begin; i < range.End; ++i)
+			{
+				const SBuildTriangle& t = triangles[i];
+
+				addBounds(range.Min, range.Max, t.Min, t.Max);
+				addBounds(range.CentroidMin, range.CentroidMax, t.Centroid,
+						t.Centroid);
+			}
+		}
+
+		//! Splits range in two by binned surface area heuristic. Triangles
+		//! are reordered, so triangles of left range are before right ones.
+		/** Triangles are binned only along axis, where their centroids are
+		 spread most, and are read twice, by binning and by partition.
+		 Bounds of both ranges are unions of their bins, bounds of centroids
+		 are collected by partition. */
+		static void splitRange(SBuildTriangle* triangles,
+				const SBuildRange& range, SBuildRange& left, SBuildRange& right)
+		{
+			u32 a = 0;
+			f32 extent = range.CentroidMax[0] - range.CentroidMin[0];
+
+			for (u32 i = 1; i < 3; ++i)
+			{
+				if (range.CentroidMax[i] - range.CentroidMin[i] > extent)
+				{
+					a = i;
+					extent = range.CentroidMax[i] - range.CentroidMin[i];
+				}
+			}
+
+			const f32 min = range.CentroidMin[a];
+			const f32 scale = extent > 0.0f ? IRR_BVH_SAH_BINS / extent : 0.0f;
+
+			SBuildBin bins[IRR_BVH_SAH_BINS];
+
+			for (u32 b = 0; b < IRR_BVH_SAH_BINS; ++b)
+			{
+				bins[b].Count = 0;
+				resetBounds(bins[b].Min, bins[b].Max);
+			}
+
+			if (scale > 0.0f)
+			{
+				for (u32 i = range.Begin; i < range.End; ++i)
+				{
+					const SBuildTriangle& t = triangles[i];
+					SBuildBin& bin = bins[getBin(t.Centroid[a], min, scale)];
+
+					++bin.Count;
+					addBounds(bin.Min, bin.Max, t.Min, t.Max);
+				}
+			}
+
+			// plane p separates bins [0; p) and [p; IRR_BVH_SAH_BINS)
+			f32 rightArea[IRR_BVH_SAH_BINS];
+			u32 rightCount[IRR_BVH_SAH_BINS];
+
+			f32 boundsMin[3];
+			f32 boundsMax[3];
+			resetBounds(boundsMin, boundsMax);
+			u32 count = 0;
+
+			for (u32 p = IRR_BVH_SAH_BINS - 1; p > 0; --p)
+			{
+				count += bins[p].Count;
+				addBounds(boundsMin, boundsMax, bins[p].Min, bins[p].Max);
+
+				rightCount[p] = count;
+				rightArea[p] = count ? getHalfArea(boundsMin, boundsMax) : 0.0f;
+			}
+
+			resetBounds(boundsMin, boundsMax);
+			count = 0;
+
+			f32 bestCost = SharedMath::MaxFloat;
+			u32 bestPlane = 0;
+
+			for (u32 p = 1; p < IRR_BVH_SAH_BINS; ++p)
+			{
+				count += bins[p - 1].Count;
+				addBounds(boundsMin, boundsMax, bins[p - 1].Min,
+						bins[p - 1].Max);
+
+				if (count == 0 || rightCount[p] == 0)
+					continue;
+
+				const f32 cost = getHalfArea(boundsMin, boundsMax) * count
+						+ rightArea[p] * rightCount[p];
+
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestPlane = p;
+				}
+			}
+
+			left.Begin = range.Begin;
+			right.End = range.End;
+
+			if (bestPlane == 0)
+			{
+				// all centroids are same, so triangles are split in halves
+				left.End = right.Begin = range.Begin
+						+ (range.End - range.Begin) / 2;
+
+				computeBounds(triangles, left);
+				computeBounds(triangles, right);
+				return;
+			}
+
+			resetBounds(left.Min, left.Max);
+			resetBounds(right.Min, right.Max);
+
+			for (u32 p = 0; p < IRR_BVH_SAH_BINS; ++p)
+			{
+				SBuildRange& side = p < bestPlane ? left : right;
+				addBounds(side.Min, side.Max, bins[p].Min, bins[p].Max);
+			}
+
+			resetBounds(left.CentroidMin, left.CentroidMax);
+			resetBounds(right.CentroidMin, right.CentroidMax);
+
+			u32 i = range.Begin;
+			u32 j = range.End;
+
+			while (i < j)
+			{
+				const f32* centroid = triangles[i].Centroid;
+
+				if (getBin(centroid[a], min, scale) < bestPlane)
+				{
+					addBounds(left.CentroidMin, left.CentroidMax, centroid,
+							centroid);
+					++i;
+				}
+				else
+				{
+					addBounds(right.CentroidMin, right.CentroidMax, centroid,
+							centroid);
+					--j;
+
+					const SBuildTriangle t = triangles[i];
+					triangles[i] = triangles[j];
+					triangles[j] = t;
+				}
+			}
+
+			left.End = right.Begin = i;
+		}
+
+		//! Builds node over range and its subtree. Returns index of node.
+		static u32 buildNode(const SBuilder& builder, array<SBVHNode>& nodes,
+				const SBuildRange& range)
+		{
+			// range is split until there are 4 children, every time range
+			// with largest area is split
+			SBuildRange children[4];
+			children[0] = range;
+			u32 count = 1;
+
+			while (count < 4)
+			{
+				s32 split = -1;
+				f32 splitArea = -1.0f;
+
+				for (u32 i = 0; i < count; ++i)
+				{
+					const f32 area = getHalfArea(children[i].Min,
+							children[i].Max);
+
+					if (children[i].End - children[i].Begin
+							> TriangleBVH::LeafTriangles && area > splitArea)
+					{
+						split = (s32) i;
+						splitArea = area;
+					}
+				}
+
+				if (split < 0)
+					break;
+
+				SBuildRange left;
+				SBuildRange right;
+				splitRange(builder.Triangles, children[split], left, right);
+
+				children[split] = left;
+				children[count++] = right;
+			}
+
+			const u32 index = nodes.size();
+			nodes.pushBack(SBVHNode());
+
+			SBVHNode& node = nodes[index];
+
+			for (u32 i = 0; i < 4; ++i)
+			{
+				for (u32 a = 0; a < 3; ++a)
+				{
+					node.Bounds[a][i] = i < count ?
+							children[i].Min[a] : SharedMath::MaxFloat;
+					node.Bounds[a + 3][i] = i < count ?
+							children[i].Max[a] : -SharedMath::MaxFloat;
+				}
+
+				node.Child[i] = EmptyChild;
+			}
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				const u32 size = children[i].End - children[i].Begin;
+
+				if (size <= TriangleBVH::LeafTriangles)
+				{
+					nodes[index].Child[i] = makeLeaf(children[i].Begin, size);
+				}
+				else if (builder.Tasks && size <= builder.TaskTriangles)
+				{
+					SBuildTask task;
+					task.Range = children[i];
+					task.Parent = index;
+					task.Slot = i;
+					task.Nodes = 0;
+
+					builder.Tasks->pushBack(task);
+				}
+				else
+				{
+					// nodes may be reallocated by subtree
+					const u32 child = buildNode(builder, nodes, children[i]);
+					nodes[index].Child[i] = child;
+				}
+			}
+
+			return index;
+		}
+
+		//! Context of parallel build
+		struct SBuildTasks
+		{
+				SBuilder Builder;
+				SBuildTask* Tasks;
+		};
+
+		//! Builds subtrees [begin; end)
+		static void buildTasks(void* context, u32 begin, u32 end)
+		{
+			const SBuildTasks* c = (const SBuildTasks*) context;
+
+			for (u32 i = begin; i < end; ++i)
+			{
+				SBuildTask& task = c->Tasks[i];
+
+				task.Nodes = new array<SBVHNode>();
+				buildNode(c->Builder, *task.Nodes, task.Range);
+			}
+		}
+
+		//! Fills triangles by indexed vertices
+		template<class TIndex>
+		inline void fillTriangles(array<triangle3d<f32> >& triangles,
+				const vector3d<f32>* positions, u32 stride,
+				const TIndex* indices, u32 indexCount)
+		{
+			const u8* vertices = (const u8*) positions;
+
+			triangles.clear();
+			triangles.reallocate(indexCount / 3);
+
+			for (u32 i = 0; i + 2 < indexCount; i += 3)
+				triangles.pushBack(
+						triangle3d<f32>(
+								*(const vector3d<f32>*) (vertices
+										+ indices[i] * stride),
+								*(const vector3d<f32>*) (vertices
+										+ indices[i + 1] * stride),
+								*(const vector3d<f32>*) (vertices
+										+ indices[i + 2] * stride)));
+		}
+
+		/*
+		 * Exact tests of triangles
+		 */
+
+		//! Intersects triangle with line origin + t * direction, where
+		//! t is in [tMin; tMax]. Triangle is hit from both sides.
+		inline bool intersectTriangle(const triangle3d<f32>& triangle,
+				const vector3d<f32>& origin, const vector3d<f32>& direction,
+				f32 tMin, f32 tMax, f32& outT)
+		{
+			const vector3d<f32> edge1 = triangle.pointB - triangle.pointA;
+			const vector3d<f32> edge2 = triangle.pointC - triangle.pointA;
+
+			const vector3d<f32> p = direction.crossProduct(edge2);
+			const f32 determinant = edge1.dotProduct(p);
+
+			// line is parallel to triangle or triangle is degenerated
+			if (determinant == 0.0f)
+				return false;
+
+			const f32 inverted = 1.0f / determinant;
+
+			const vector3d<f32> s = origin - triangle.pointA;
+			const f32 u = s.dotProduct(p) * inverted;
+
+			if (u < 0.0f || u > 1.0f)
+				return false;
+
+			const vector3d<f32> q = s.crossProduct(edge1);
+			const f32 v = direction.dotProduct(q) * inverted;
+
+			if (v < 0.0f || u + v > 1.0f)
+				return false;
+
+			const f32 t = edge2.dotProduct(q) * inverted;
+
+			if (t < tMin || t > tMax)
+				return false;
+
+			outT = t;
+			return true;
+		}
+
+		//! Returns True if projections of triangle and box to axis overlap.
+		//! Triangle is relative to center of box.
+		inline bool overlapOnAxis(const vector3d<f32>& axis,
+				const vector3d<f32>& v0, const vector3d<f32>& v1,
+				const vector3d<f32>& v2, const vector3d<f32>& half)
+		{
+			const f32 p0 = axis.dotProduct(v0);
+			const f32 p1 = axis.dotProduct(v1);
+			const f32 p2 = axis.dotProduct(v2);
+
+			f32 min = p0 < p1 ? p0 : p1;
+			f32 max = p0 < p1 ? p1 : p0;
+
+			if (p2 < min)
+				min = p2;
+
+			if (p2 > max)
+				max = p2;
+
+			const f32 radius = half.X * fabsf(axis.X) + half.Y * fabsf(axis.Y)
+					+ half.Z * fabsf(axis.Z);
+
+			return min <= radius && max >= -radius;
+		}
+
+		//! Returns True if triangle intersects box. Separating axes are
+		//! normals of box, normal of triangle and cross products of edges.
+		static bool intersectsTriangleBox(const triangle3d<f32>& triangle,
+				const vector3d<f32>& center, const vector3d<f32>& half)
+		{
+			const vector3d<f32> v0 = triangle.pointA - center;
+			const vector3d<f32> v1 = triangle.pointB - center;
+			const vector3d<f32> v2 = triangle.pointC - center;
+
+			// normals of box
+			for (u32 a = 0; a < 3; ++a)
+			{
+				const f32 p0 = a == 0 ? v0.X : (a == 1 ? v0.Y : v0.Z);
+				const f32 p1 = a == 0 ? v1.X : (a == 1 ? v1.Y : v1.Z);
+				const f32 p2 = a == 0 ? v2.X : (a == 1 ? v2.Y : v2.Z);
+				const f32 h = a == 0 ? half.X : (a == 1 ? half.Y : half.Z);
+
+				if ((p0 > h && p1 > h && p2 > h)
+						|| (p0 < -h && p1 < -h && p2 < -h))
+					return false;
+			}
+
+			const vector3d<f32> edges[3] =
+			{ v1 - v0, v2 - v1, v0 - v2 };
+
+			// normal of triangle
+			if (!overlapOnAxis(edges[0].crossProduct(edges[1]), v0, v1, v2,
+					half))
+				return false;
+
+			// cross products of edges of triangle and box
+			for (u32 e = 0; e < 3; ++e)
+			{
+				const vector3d<f32>& edge = edges[e];
+
+				if (!overlapOnAxis(vector3d<f32>(0.0f, -edge.Z, edge.Y), v0, v1,
+						v2, half)
+						|| !overlapOnAxis(vector3d<f32>(edge.Z, 0.0f, -edge.X),
+								v0, v1, v2, half)
+						|| !overlapOnAxis(vector3d<f32>(-edge.Y, edge.X, 0.0f),
+								v0, v1, v2, half))
+					return false;
+			}
+
+			return true;
+		}
+
+		//! Returns point of triangle, which is closest to point
+		static vector3d<f32> getClosestPointOfTriangle(
+				const triangle3d<f32>& triangle, const vector3d<f32>& point)
+		{
+			const vector3d<f32>& a = triangle.pointA;
+			const vector3d<f32>& b = triangle.pointB;
+			const vector3d<f32>& c = triangle.pointC;
+
+			const vector3d<f32> ab = b - a;
+			const vector3d<f32> ac = c - a;
+			const vector3d<f32> ap = point - a;
+
+			// regions of vertices, edges and face are checked one by one
+			const f32 d1 = ab.dotProduct(ap);
+			const f32 d2 = ac.dotProduct(ap);
+
+			if (d1 <= 0.0f && d2 <= 0.0f)
+				return a;
+
+			const vector3d<f32> bp = point - b;
+			const f32 d3 = ab.dotProduct(bp);
+			const f32 d4 = ac.dotProduct(bp);
+
+			if (d3 >= 0.0f && d4 <= d3)
+				return b;
+
+			const f32 vc = d1 * d4 - d3 * d2;
+
+			if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+				return a + ab * (d1 / (d1 - d3));
+
+			const vector3d<f32> cp = point - c;
+			const f32 d5 = ab.dotProduct(cp);
+			const f32 d6 = ac.dotProduct(cp);
+
+			if (d6 >= 0.0f && d5 <= d6)
+				return c;
+
+			const f32 vb = d5 * d2 - d1 * d6;
+
+			if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+				return a + ac * (d2 / (d2 - d6));
+
+			const f32 va = d3 * d6 - d5 * d4;
+
+			if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f)
+				return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+			const f32 denominator = 1.0f / (va + vb + vc);
+
+			return a + ab * (vb * denominator) + ac * (vc * denominator);
+		}
+
+		/*
+		 * Tests of 4 children of node. Every test returns bit mask of children,
+		 * which may contain result.
+		 */
+
+		//! Ray with reciprocal direction
+		struct SRay
+		{
+				f32 Origin[3];
+				f32 InvertedDirection[3];
+		};
+
+		//! Prepares ray for slab tests
+		inline void setRay(SRay& ray, const vector3d<f32>& origin,
+				const vector3d<f32>& direction)
+		{
+			const f32 d[3] =
+			{ direction.X, direction.Y, direction.Z };
+
+			ray.Origin[0] = origin.X;
+			ray.Origin[1] = origin.Y;
+			ray.Origin[2] = origin.Z;
+
+			for (u32 a = 0; a < 3; ++a)
+			{
+				f32 value = d[a];
+
+				if (fabsf(value) < MinRayDirection)
+					value = value < 0.0f ? -MinRayDirection : MinRayDirection;
+
+				ray.InvertedDirection[a] = 1.0f / value;
+			}
+		}
+
+		//! Scalar tests of children
+		struct SNodeTests_Scalar
+		{
+				//! Tests ray [tMin; tMax] with children, writes distances to
+				//! children, where ray enters them.
+				static u32 intersectRay(const SBVHNode& node, const SRay& ray,
+						f32 tMin, f32 tMax, f32* outNear)
+				{
+					u32 result = 0;
+
+					for (u32 i = 0; i < 4; ++i)
+					{
+						f32 enter = tMin;
+						f32 leave = SharedMath::MaxFloat;
+
+						for (u32 a = 0; a < 3; ++a)
+						{
+							const f32 t1 = (node.Bounds[a][i] - ray.Origin[a])
+									* ray.InvertedDirection[a];
+							const f32 t2 = (node.Bounds[a + 3][i]
+									- ray.Origin[a]) * ray.InvertedDirection[a];
+
+							const f32 t1a = t1 < t2 ? t1 : t2;
+							const f32 t2a = t1 < t2 ? t2 : t1;
+
+							if (t1a > enter)
+								enter = t1a;
+
+							if (t2a < leave)
+								leave = t2a;
+						}
+
+						leave *= RayBoxTolerance;
+
+						if (leave > tMax)
+							leave = tMax;
+
+						outNear[i] = enter;
+
+						if (enter <= leave)
+							result |= 1 << i;
+					}
+
+					return result;
+				}
+
+				//! Tests box with children
+				static u32 intersectBox(const SBVHNode& node,
+						const aabbox3d<f32>& box)
+				{
+					u32 result = 0;
+
+					for (u32 i = 0; i < 4; ++i)
+					{
+						if (node.Bounds[0][i] <= box.MaxEdge.X
+								&& node.Bounds[1][i] <= box.MaxEdge.Y
+								&& node.Bounds[2][i] <= box.MaxEdge.Z
+								&& node.Bounds[3][i] >= box.MinEdge.X
+								&& node.Bounds[4][i] >= box.MinEdge.Y
+								&& node.Bounds[5][i] >= box.MinEdge.Z)
+							result |= 1 << i;
+					}
+
+					return result;
+				}
+
+				//! Writes squared distances from point to children, which are
+				//! not farther than maxDistanceSQ
+				static u32 getDistanceSQ(const SBVHNode& node,
+						const vector3d<f32>& point, f32 maxDistanceSQ,
+						f32* outDistanceSQ)
+				{
+					const f32 p[3] =
+					{ point.X, point.Y, point.Z };
+
+					u32 result = 0;
+
+					for (u32 i = 0; i < 4; ++i)
+					{
+						f32 distance = 0.0f;
+
+						for (u32 a = 0; a < 3; ++a)
+						{
+							f32 d = node.Bounds[a][i] - p[a];
+
+							if (p[a] - node.Bounds[a + 3][i] > d)
+								d = p[a] - node.Bounds[a + 3][i];
+
+							if (d > 0.0f)
+								distance += d * d;
+						}
+
+						outDistanceSQ[i] = distance;
+
+						if (distance <= maxDistanceSQ)
+							result |= 1 << i;
+					}
+
+					return result;
+				}
+		};
+
+#if defined(IRR_SIMD_BVH) && defined(IRR_X86_SIMD)
+
+		//! SSE2 tests of children. Every test handles all 4 children at once.
+		struct SNodeTests_SSE2
+		{
+				static IRR_TARGET_SSE2 u32 intersectRay(const SBVHNode& node,
+						const SRay& ray, f32 tMin, f32 tMax, f32* outNear)
+				{
+					__m128 enter = _mm_set1_ps(tMin);
+					__m128 leave = _mm_set1_ps(SharedMath::MaxFloat);
+
+					for (u32 a = 0; a < 3; ++a)
+					{
+						const __m128 origin = _mm_set1_ps(ray.Origin[a]);
+						const __m128 inverted = _mm_set1_ps(
+								ray.InvertedDirection[a]);
+
+						const __m128 t1 = _mm_mul_ps(
+								_mm_sub_ps(_mm_loadu_ps(node.Bounds[a]),
+										origin),
+								inverted);
+						const __m128 t2 = _mm_mul_ps(
+								_mm_sub_ps(_mm_loadu_ps(node.Bounds[a + 3]),
+										origin), inverted);
+
+						enter = _mm_max_ps(enter, _mm_min_ps(t1, t2));
+						leave = _mm_min_ps(leave, _mm_max_ps(t1, t2));
+					}
+
+					leave = _mm_min_ps(
+							_mm_mul_ps(leave, _mm_set1_ps(RayBoxTolerance)),
+							_mm_set1_ps(tMax));
+
+					_mm_storeu_ps(outNear, enter);
+
+					return (u32) _mm_movemask_ps(_mm_cmple_ps(enter, leave));
+				}
+
+				static IRR_TARGET_SSE2 u32 intersectBox(const SBVHNode& node,
+						const aabbox3d<f32>& box)
+				{
+					__m128 inside = _mm_and_ps(
+							_mm_cmple_ps(_mm_loadu_ps(node.Bounds[0]),
+									_mm_set1_ps(box.MaxEdge.X)),
+							_mm_cmpge_ps(_mm_loadu_ps(node.Bounds[3]),
+									_mm_set1_ps(box.MinEdge.X)));
+
+					inside = _mm_and_ps(inside,
+							_mm_cmple_ps(_mm_loadu_ps(node.Bounds[1]),
+									_mm_set1_ps(box.MaxEdge.Y)));
+
+					inside = _mm_and_ps(inside,
+							_mm_cmpge_ps(_mm_loadu_ps(node.Bounds[4]),
+									_mm_set1_ps(box.MinEdge.Y)));
+
+					inside = _mm_and_ps(inside,
+							_mm_cmple_ps(_mm_loadu_ps(node.Bounds[2]),
+									_mm_set1_ps(box.MaxEdge.Z)));
+
+					inside = _mm_and_ps(inside,
+							_mm_cmpge_ps(_mm_loadu_ps(node.Bounds[5]),
+									_mm_set1_ps(box.MinEdge.Z)));
+
+					return (u32) _mm_movemask_ps(inside);
+				}
+
+				static IRR_TARGET_SSE2 u32 getDistanceSQ(const SBVHNode& node,
+						const vector3d<f32>& point, f32 maxDistanceSQ,
+						f32* outDistanceSQ)
+				{
+					const f32 p[3] =
+					{ point.X, point.Y, point.Z };
+
+					const __m128 zero = _mm_setzero_ps();
+					__m128 distance = zero;
+
+					for (u32 a = 0; a < 3; ++a)
+					{
+						const __m128 coordinate = _mm_set1_ps(p[a]);
+
+						__m128 d = _mm_max_ps(
+								_mm_sub_ps(_mm_loadu_ps(node.Bounds[a]),
+										coordinate),
+								_mm_sub_ps(coordinate,
+										_mm_loadu_ps(node.Bounds[a + 3])));
+
+						d = _mm_max_ps(d, zero);
+						distance = _mm_add_ps(distance, _mm_mul_ps(d, d));
+					}
+
+					_mm_storeu_ps(outDistanceSQ, distance);
+
+					return (u32) _mm_movemask_ps(
+							_mm_cmple_ps(distance, _mm_set1_ps(maxDistanceSQ)));
+				}
+		};
+
+		//! Returns True if processor supports SSE2 tests
+		static bool isSIMDSupported()
+		{
+			static const bool result =
+					SharedCPUFeatures::getInstance().hasSSE2();
+			return result;
+		}
+
+#endif /* IRR_SIMD_BVH && IRR_X86_SIMD */
+
+		/*
+		 * Traversals
+		 */
+
+		//! Child, which is not visited yet, and its distance from query
+		struct STraversalEntry
+		{
+				u32 Child;
+				f32 Distance;
+		};
+
+		//! Stack of traversal. Trees of usual depth do not allocate.
+		typedef smallarray<STraversalEntry, 64> TraversalStack;
+
+		//! Pushes children of mask, nearest is pushed last, so it is
+		//! visited first
+		inline void pushSorted(TraversalStack& stack, const SBVHNode& node,
+				u32 mask, const f32* distance)
+		{
+			STraversalEntry entries[4];
+			u32 count = 0;
+
+			for (u32 i = 0; i < 4; ++i)
+			{
+				if (!(mask & (1 << i)) || node.Child[i] == EmptyChild)
+					continue;
+
+				// insertion sort by distance, farthest first
+				u32 j = count++;
+
+				for (; j > 0 && entries[j - 1].Distance < distance[i]; --j)
+					entries[j] = entries[j - 1];
+
+				entries[j].Child = node.Child[i];
+				entries[j].Distance = distance[i];
+			}
+
+			for (u32 i = 0; i < count; ++i)
+				stack.pushBack(entries[i]);
+		}
+
+		//! Finds intersection of line origin + t * direction for t in
+		//! [0; tMax], which is nearest to origin. If TAnyHit, any one is found.
+		template<class TTests, bool TAnyHit>
+		bool intersectLine(const SBVHNode* nodes,
+				const triangle3d<f32>* triangles, const vector3d<f32>& origin,
+				const vector3d<f32>& direction, f32 tMax, u32& outTriangle,
+				f32& outT)
+		{
+			SRay ray;
+			setRay(ray, origin, direction);
+
+			TraversalStack stack;
+
+			STraversalEntry root;
+			root.Child = 0;
+			root.Distance = 0.0f;
+			stack.pushBack(root);
+
+			bool result = false;
+			f32 best = tMax;
+
+			while (!stack.empty())
+			{
+				const STraversalEntry entry = stack[stack.size() - 1];
+				stack.erase(stack.size() - 1);
+
+				if (entry.Distance > best)
+					continue;
+
+				if (entry.Child & LeafFlag)
+				{
+					const u32 first = getLeafFirst(entry.Child);
+					const u32 last = first + getLeafCount(entry.Child);
+
+					for (u32 i = first; i < last; ++i)
+					{
+						if (intersectTriangle(triangles[i], origin, direction,
+								0.0f, best, outT))
+						{
+							best = outT;
+							outTriangle = i;
+							result = true;
+
+							if (TAnyHit)
+								return true;
+						}
+					}
+
+					continue;
+				}
+
+				const SBVHNode& node = nodes[entry.Child];
+
+				f32 enter[4];
+				const u32 mask = TTests::intersectRay(node, ray, 0.0f, best,
+						enter);
+
+				if (mask)
+					pushSorted(stack, node, mask, enter);
+			}
+
+			outT = best;
+			return result;
+		}
+
+		//! Appends indices of triangles, which intersect box
+		template<class TTests>
+		u32 findTrianglesInBox(const SBVHNode* nodes,
+				const triangle3d<f32>* triangles, const u32* indices,
+				const aabbox3d<f32>& box, array<u32>& outTriangles)
+		{
+			const vector3d<f32> center = box.getCenter();
+			const vector3d<f32> half = box.getExtent() * 0.5f;
+
+			smallarray<u32, 64> stack;
+			stack.pushBack(0);
+
+			u32 result = 0;
+
+			while (!stack.empty())
+			{
+				const u32 child = stack[stack.size() - 1];
+				stack.erase(stack.size() - 1);
+
+				if (child & LeafFlag)
+				{
+					const u32 first = getLeafFirst(child);
+					const u32 last = first + getLeafCount(child);
+
+					for (u32 i = first; i < last; ++i)
+					{
+						if (intersectsTriangleBox(triangles[i], center, half))
+						{
+							outTriangles.pushBack(indices[i]);
+							++result;
+						}
+					}
+
+					continue;
+				}
+
+				const SBVHNode& node = nodes[child];
+				const u32 mask = TTests::intersectBox(node, box);
+
+				for (u32 i = 0; i < 4; ++i)
+				{
+					if ((mask & (1 << i)) && node.Child[i] != EmptyChild)
+						stack.pushBack(node.Child[i]);
+				}
+			}
+
+			return result;
+		}
+
+		//! Finds point of triangles, which is closest to point
+		template<class TTests>
+		bool findClosestPoint(const SBVHNode* nodes,
+				const triangle3d<f32>* triangles, const vector3d<f32>& point,
+				f32 maxDistanceSQ, u32& outTriangle, vector3d<f32>& outPoint,
+				f32& outDistanceSQ)
+		{
+			TraversalStack stack;
+
+			STraversalEntry root;
+			root.Child = 0;
+			root.Distance = 0.0f;
+			stack.pushBack(root);
+
+			bool result = false;
+			f32 best = maxDistanceSQ;
+
+			while (!stack.empty())
+			{
+				const STraversalEntry entry = stack[stack.size() - 1];
+				stack.erase(stack.size() - 1);
+
+				if (entry.Distance > best)
+					continue;
+
+				if (entry.Child & LeafFlag)
+				{
+					const u32 first = getLeafFirst(entry.Child);
+					const u32 last = first + getLeafCount(entry.Child);
+
+					for (u32 i = first; i < last; ++i)
+					{
+						const vector3d<f32> closest = getClosestPointOfTriangle(
+								triangles[i], point);
+						const f32 distance = closest.getDistanceFromSQ(point);
+
+						if (distance <= best)
+						{
+							best = distance;
+							outTriangle = i;
+							outPoint = closest;
+							result = true;
+						}
+					}
+
+					continue;
+				}
+
+				const SBVHNode& node = nodes[entry.Child];
+
+				f32 distance[4];
+				const u32 mask = TTests::getDistanceSQ(node, point, best,
+						distance);
+
+				if (mask)
+					pushSorted(stack, node, mask, distance);
+			}
+
+			outDistanceSQ = best;
+			return result;
+		}
+
+		/*
+		 * TriangleBVH
+		 */
+
+		//! Default constructor. Does not allocate.
+		TriangleBVH::TriangleBVH() :
+				BoundingBox(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f)
+		{
+		}
+
+		//! Destructor
+		TriangleBVH::~TriangleBVH()
+		{
+		}
+
+		//! Builds tree over triangles.
+		void TriangleBVH::build(const triangle3d<f32>* triangles, u32 count,
+				bool parallel)
+		{
+			Triangles.clear();
+			Triangles.reallocate(count);
+
+			for (u32 i = 0; i < count; ++i)
+				Triangles.pushBack(triangles[i]);
+
+			buildTree(parallel);
+		}
+
+		//! Builds tree over indexed triangle list.
+		void TriangleBVH::build(const vector3d<f32>* positions, u32 stride,
+				const u16* indices, u32 indexCount, bool parallel)
+		{
+			fillTriangles(Triangles, positions, stride, indices, indexCount);
+			buildTree(parallel);
+		}
+
+		//! Builds tree over indexed triangle list with 32 bit indices.
+		void TriangleBVH::build(const vector3d<f32>* positions, u32 stride,
+				const u32* indices, u32 indexCount, bool parallel)
+		{
+			fillTriangles(Triangles, positions, stride, indices, indexCount);
+			buildTree(parallel);
+		}
+
+		//! Frees tree and triangles
+		void TriangleBVH::clear()
+		{
+			Nodes.clear();
+			Triangles.clear();
+			Indices.clear();
+
+			BoundingBox.reset(0.0f, 0.0f, 0.0f);
+		}
+
+		//! Returns count of triangles
+		u32 TriangleBVH::getTriangleCount() const
+		{
+			return Triangles.size();
+		}
+
+		//! Returns count of nodes
+		u32 TriangleBVH::getNodeCount() const
+		{
+			return Nodes.size();
+		}
+
+		//! Returns box of all triangles
+		const aabbox3d<f32>& TriangleBVH::getBoundingBox() const
+		{
+			return BoundingBox;
+		}
+
+		//! Finds nearest intersection of ray with triangles.
+		bool TriangleBVH::getIntersectionWithRay(const vector3d<f32>& origin,
+				const vector3d<f32>& direction, SBVHHit& outHit,
+				f32 maxDistance) const
+		{
+			if (Nodes.empty())
+				return false;
+
+			u32 triangle;
+			f32 t;
+			bool result;
+
+#if defined(IRR_SIMD_BVH) && defined(IRR_X86_SIMD)
+			if (isSIMDSupported())
+				result = intersectLine<SNodeTests_SSE2, false>(
+						Nodes.constPointer(), Triangles.constPointer(), origin,
+						direction, maxDistance, triangle, t);
+			else
+#endif
+				result = intersectLine<SNodeTests_Scalar, false>(
+						Nodes.constPointer(), Triangles.constPointer(), origin,
+						direction, maxDistance, triangle, t);
+
+			if (!result)
+				return false;
+
+			outHit.Triangle = Indices[triangle];
+			outHit.Distance = t;
+			outHit.Point = origin + direction * t;
+
+			return true;
+		}
+
+		//! Finds intersection with line, which is nearest to its start.
+		bool TriangleBVH::getIntersectionWithLimitedLine(
+				const line3d<f32>& line, SBVHHit& outHit) const
+		{
+			return getIntersectionWithRay(line.Start, line.getVector(), outHit,
+					1.0f);
+		}
+
+		//! Returns True if line intersects any triangle between its start
+		//! and end
+		bool TriangleBVH::intersectsWithLimitedLine(
+				const line3d<f32>& line) const
+		{
+			if (Nodes.empty())
+				return false;
+
+			const vector3d<f32> direction = line.getVector();
+
+			u32 triangle;
+			f32 t;
+
+#if defined(IRR_SIMD_BVH) && defined(IRR_X86_SIMD)
+			if (isSIMDSupported())
+				return intersectLine<SNodeTests_SSE2, true>(
+						Nodes.constPointer(), Triangles.constPointer(),
+						line.Start, direction, 1.0f, triangle, t);
+#endif
+
+			return intersectLine<SNodeTests_Scalar, true>(Nodes.constPointer(),
+					Triangles.constPointer(), line.Start, direction, 1.0f,
+					triangle, t);
+		}
+
+		//! Appends indices of triangles, which intersect box.
+		u32 TriangleBVH::getTrianglesInBox(const aabbox3d<f32>& box,
+				array<u32>& outTriangles) const
+		{
+			if (Nodes.empty())
+				return 0;
+
+#if defined(IRR_SIMD_BVH) && defined(IRR_X86_SIMD)
+			if (isSIMDSupported())
+				return findTrianglesInBox<SNodeTests_SSE2>(Nodes.constPointer(),
+						Triangles.constPointer(), Indices.constPointer(), box,
+						outTriangles);
+#endif
+
+			return findTrianglesInBox<SNodeTests_Scalar>(Nodes.constPointer(),
+					Triangles.constPointer(), Indices.constPointer(), box,
+					outTriangles);
+		}
+
+		//! Finds point of triangles, which is closest to point.
+		bool TriangleBVH::getClosestPoint(const vector3d<f32>& point,
+				SBVHClosestPoint& outClosest, f32 maxDistance) const
+		{
+			if (Nodes.empty())
+				return false;
+
+			const f32 maxDistanceSQ =
+					maxDistance < SharedMath::MaxFloat ?
+							maxDistance * maxDistance : SharedMath::MaxFloat;
+
+			u32 triangle;
+			bool result;
+
+#if defined(IRR_SIMD_BVH) && defined(IRR_X86_SIMD)
+			if (isSIMDSupported())
+				result = findClosestPoint<SNodeTests_SSE2>(
+						Nodes.constPointer(), Triangles.constPointer(), point,
+						maxDistanceSQ, triangle, outClosest.Point,
+						outClosest.DistanceSQ);
+			else
+#endif
+				result = findClosestPoint<SNodeTests_Scalar>(
+						Nodes.constPointer(), Triangles.constPointer(), point,
+						maxDistanceSQ, triangle, outClosest.Point,
+						outClosest.DistanceSQ);
+
+			if (result)
+				outClosest.Triangle = Indices[triangle];
+
+			return result;
+		}
+
+		//! Builds tree over Triangles, which are filled already
+		void TriangleBVH::buildTree(bool parallel)
+		{
+			Nodes.clear();
+			Indices.clear();
+
+			const u32 count = Triangles.size();
+
+			if (count == 0)
+			{
+				BoundingBox.reset(0.0f, 0.0f, 0.0f);
+				return;
+			}
+
+			IRR_ASSERT(count < (LeafFlag >> LeafCountBits));
+
+			irrAllocator<SBuildTriangle> allocator;
+			SBuildTriangle* buildTriangles = allocator.allocate(count);
+
+			const triangle3d<f32>* triangles = Triangles.constPointer();
+
+			SBuildRange root;
+			root.Begin = 0;
+			root.End = count;
+			resetBounds(root.Min, root.Max);
+			resetBounds(root.CentroidMin, root.CentroidMax);
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				const triangle3d<f32>& triangle = triangles[i];
+				SBuildTriangle& t = buildTriangles[i];
+
+				t.Min[0] = t.Max[0] = triangle.pointA.X;
+				t.Min[1] = t.Max[1] = triangle.pointA.Y;
+				t.Min[2] = t.Max[2] = triangle.pointA.Z;
+
+				const f32 b[3] =
+				{ triangle.pointB.X, triangle.pointB.Y, triangle.pointB.Z };
+				const f32 c[3] =
+				{ triangle.pointC.X, triangle.pointC.Y, triangle.pointC.Z };
+
+				addBounds(t.Min, t.Max, b, b);
+				addBounds(t.Min, t.Max, c, c);
+
+				for (u32 a = 0; a < 3; ++a)
+					t.Centroid[a] = (t.Min[a] + t.Max[a]) * 0.5f;
+
+				t.Index = i;
+
+				addBounds(root.Min, root.Max, t.Min, t.Max);
+				addBounds(root.CentroidMin, root.CentroidMax, t.Centroid,
+						t.Centroid);
+			}
+
+			BoundingBox = aabbox3d<f32>(root.Min[0], root.Min[1], root.Min[2],
+					root.Max[0], root.Max[1], root.Max[2]);
+
+			SBuilder builder;
+			builder.Triangles = buildTriangles;
+			builder.Tasks = 0;
+			builder.TaskTriangles = 0;
+
+			array<SBuildTask> tasks;
+
+			if (parallel)
+			{
+				const u32 threadsCount =
+						threads::SharedJobPool::getInstance().getWorkersCount()
+								+ 1;
+
+				builder.TaskTriangles = count
+						/ (threadsCount * BuildTasksPerThread);
+
+				// too small subtrees are built faster by one thread
+				if (builder.TaskTriangles >= MinBuildTaskTriangles)
+					builder.Tasks = &tasks;
+			}
+
+			// about one node per 2 triangles
+			Nodes.reallocate(count / 2 + 1);
+
+			buildNode(builder, Nodes, root);
+
+			if (!tasks.empty())
+			{
+				SBuildTasks context;
+				context.Builder = builder;
+				context.Builder.Tasks = 0;
+				context.Tasks = tasks.pointer();
+
+				threads::SharedJobPool::getInstance().parallelFor(buildTasks,
+						&context, tasks.size());
+
+				// subtrees are appended after top of tree
+				for (u32 i = 0; i < tasks.size(); ++i)
+				{
+					const SBuildTask& task = tasks[i];
+					const u32 offset = Nodes.size();
+
+					for (u32 n = 0; n < task.Nodes->size(); ++n)
+					{
+						SBVHNode node = (*task.Nodes)[n];
+
+						for (u32 c = 0; c < 4; ++c)
+						{
+							if (!(node.Child[c] & LeafFlag))
+								node.Child[c] += offset;
+						}
+
+						Nodes.pushBack(node);
+					}
+
+					Nodes[task.Parent].Child[task.Slot] = offset;
+
+					delete task.Nodes;
+				}
+			}
+
+			// triangles are ordered by leaves
+			array<triangle3d<f32> > ordered;
+			ordered.reallocate(count);
+			Indices.reallocate(count);
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				ordered.pushBack(triangles[buildTriangles[i].Index]);
+				Indices.pushBack(buildTriangles[i].Index);
+			}
+
+			Triangles.swap(ordered);
+
+			allocator.deallocate(buildTriangles);
+		}
+
+	}  // namespace core
+}  // namespace irrgame
@@ -0,0 +1,103 @@
+/*
+ * SharedCPUFeatures.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#include "core/utils/SharedCPUFeatures.h"
+
+#ifdef IRR_X86_SIMD
+#include <cpuid.h>
+#endif
+
+namespace irrgame
+{
+	namespace core
+	{
+		//! Singleton realization
+		SharedCPUFeatures& SharedCPUFeatures::getInstance()
+		{
+			static SharedCPUFeatures instance;
+			return instance;
+		}
+
+		//! Default constructor. Should use only one time.
+		SharedCPUFeatures::SharedCPUFeatures() :
+				SSE2(false), SSSE3(false), SSE41(false), AVX(false), AVX2(false)
+		{
+#ifdef IRR_X86_SIMD
+			u32 eax = 0;
+			u32 ebx = 0;
+			u32 ecx = 0;
+			u32 edx = 0;
+
+			if (!__get_cpuid(0, &eax, &ebx, &ecx, &edx))
+				return;
+
+			const u32 maxLeaf = eax;
+
+			if (maxLeaf < 1)
+				return;
+
+			__cpuid(1, eax, ebx, ecx, edx);
+
+			SSE2 = (edx & bit_SSE2) != 0;
+			SSSE3 = (ecx & bit_SSSE3) != 0;
+			SSE41 = (ecx & bit_SSE4_1) != 0;
+
+			// AVX registers are usable only if OS saves them on context switch
+			if ((ecx & bit_OSXSAVE) && (ecx & bit_AVX))
+			{
+				u32 xcr0Low = 0;
+				u32 xcr0High = 0;
+				__asm__ __volatile__ ("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+
+				// XMM and YMM state
+				AVX = (xcr0Low & 0x6) == 0x6;
+			}
+
+			if (AVX && maxLeaf >= 7)
+			{
+				__cpuid_count(7, 0, eax, ebx, ecx, edx);
+				AVX2 = (ebx & bit_AVX2) != 0;
+			}
+#endif
+		}
+
+		//! Destructor. Should use only one time.
+		SharedCPUFeatures::~SharedCPUFeatures()
+		{
+		}
+
+		//! Returns true if processor supports SSE2
+		bool SharedCPUFeatures::hasSSE2() const
+		{
+			return SSE2;
+		}
+
+		//! Returns true if processor supports SSSE3
+		bool SharedCPUFeatures::hasSSSE3() const
+		{
+			return SSSE3;
+		}
+
+		//! Returns true if processor supports SSE4.1
+		bool SharedCPUFeatures::hasSSE41() const
+		{
+			return SSE41;
+		}
+
+		//! Returns true if processor and OS support AVX
+		bool SharedCPUFeatures::hasAVX() const
+		{
+			return AVX;
+		}
+
+		//! Returns true if processor and OS support AVX2
+		bool SharedCPUFeatures::hasAVX2() const
+		{
+			return AVX2;
+		}
+	}  // namespace core
+}  // namespace irrgame
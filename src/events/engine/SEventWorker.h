@@ -0,0 +1,63 @@
+/*
+ * SEventWorker.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SEVENTWORKER_H_
+#define SEVENTWORKER_H_
+
+#include "events/engine/SharedEventScheduler.h"
+#include "threads/irrgameThread.h"
+#include "threads/CWorkStealingDeque.h"
+
+namespace irrgame
+{
+	namespace events
+	{
+		//! Worker thread of event scheduler with own event deques.
+		struct SEventWorker
+		{
+			public:
+				//! Default constructor
+				SEventWorker(u32 index);
+
+				//! Destructor
+				~SEventWorker();
+
+			public:
+				//! Index of worker in scheduler
+				u32 Index;
+
+				//! System thread
+				threads::irrgameThread* Thread;
+
+				//! Thread function
+				threads::delegateThreadCallback* Callback;
+
+				//! Events added by this worker. One deque per priority.
+				//! Realtime deque is not used.
+				threads::CWorkStealingDeque<delegateEvent*> Events[EAP_COUNT];
+		};
+
+		//! Default constructor
+		inline SEventWorker::SEventWorker(u32 index) :
+				Index(index), Thread(0), Callback(0)
+		{
+		}
+
+		//! Destructor
+		inline SEventWorker::~SEventWorker()
+		{
+			if (Thread)
+				Thread->drop();
+
+			if (Callback)
+				Callback->drop();
+		}
+
+	}  // namespace events
+}  // namespace irrgame
+
+#endif /* SEVENTWORKER_H_ */
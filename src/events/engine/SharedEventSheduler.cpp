@@ -7,6 +7,9 @@
 
 #include "events/engine/SharedEventScheduler.h"
 #include "threads/irrgameThread.h"
+#include "threads/irrgameSemaphore.h"
+#include "threads/irrgameAtomic.h"
+#include "SEventWorker.h"
 
 using namespace irrgame::threads;
 
@@ -14,6 +17,8 @@ namespace irrgame
 {
 	namespace events
 	{
+		//! Worker which runs in current thread. 0 for non worker threads.
+		static IRR_THREAD_LOCAL SEventWorker* CurrentWorker = 0;
 
 		//! Singleton realization
 		SharedEventScheduler& SharedEventScheduler::getInstance()
@@ -23,13 +28,22 @@ namespace irrgame
 		}
 
 		//! Default constructor. Should use only one time.
-		SharedEventScheduler::SharedEventScheduler()
+		SharedEventScheduler::SharedEventScheduler() :
+				WakeUp(0), SleepingWorkers(0), IsRunning(0)
 		{
+			for (u32 i = 0; i < EAP_COUNT; ++i)
+				OverflowEventsCount[i] = 0;
+
+			WakeUp = createIrrgameSemaphore();
 		}
 
 		//! Destructor. Should use only one time.
 		SharedEventScheduler::~SharedEventScheduler()
 		{
+			stopProcess();
+
+			if (WakeUp)
+				WakeUp->drop();
 		}
 
 		//! Adds event to specify queue
@@ -37,115 +51,270 @@ namespace irrgame
 				EEventPriority qType)
 		{
 			IRR_ASSERT(e != 0);
+			IRR_ASSERT(qType < EAP_COUNT);
 
-			switch (qType)
+			// workers keep own events in lock-free deque
+			if (qType != EAP_REALTIME && CurrentWorker != 0
+					&& CurrentWorker->Events[qType].push(e))
 			{
-				case EAP_REALTIME:
-					this->RealtimeEvents.pushBack(e);
-					break;
-
-				case EAP_HIGHPRIORITY:
-					this->HighpriorityEvents.pushBack(e);
-					break;
-
-				case EAP_BACKGROUND:
-					this->BackgroundEvents.pushBack(e);
-					break;
-				default:
-				{
-					//Not implemented
-					IRR_ASSERT(false);
-					break;
-				}
+				wakeUpWorker();
+				return;
 			}
+
+			addSharedEvent(e, qType);
+
+			if (qType != EAP_REALTIME)
+				wakeUpWorker();
 		}
 
 		//! Start process events.
 		void SharedEventScheduler::startProcess()
 		{
-			delegateThreadCallback* callback1 = new delegateThreadCallback;
-			(*callback1) += NewDelegate(this,
-					&SharedEventScheduler::proceedHPEvents);
+			// already started
+			if (irrgameAtomic::exchange(&IsRunning, 1) != 0)
+				return;
+
+			u32 count = irrgameThread::getProcessorsCount();
+
+			if (count == 0)
+				count = 1;
+
+			Workers.reallocate(count);
 
-			irrgameThread* thread1 = createIrrgameThread(callback1, 0,
-					ETP_NORMAL);
+			for (u32 i = 0; i < count; ++i)
+			{
+				SEventWorker* worker = new SEventWorker(i);
+
+				worker->Callback = new delegateThreadCallback;
+				(*worker->Callback) += NewDelegate(this,
+						&SharedEventScheduler::proceedWorkerEvents);
 
-			delegateThreadCallback* callback2 = new delegateThreadCallback;
-			(*callback2) += NewDelegate(this,
-					&SharedEventScheduler::proceedBGEvents);
+				// every worker runs both lanes, background events only when
+				// there are no high priority ones, so priority is applied by
+				// order of lanes, not by the OS
+				worker->Thread = createIrrgameThread(worker->Callback, worker,
+						ETP_NORMAL);
 
-			irrgameThread* thread2 = createIrrgameThread(callback2, 0, ETP_LOW);
+				Workers.pushBack(worker);
+			}
 
-			thread1->start();
-			thread2->start();
+			// all workers must exists before first steal
+			for (u32 i = 0; i < count; ++i)
+				Workers[i]->Thread->start();
 		}
 
-		//! Proceed next real time event in main thread.
-		void SharedEventScheduler::proceedNextRealTimeEvent()
+		//! Stop process events. Blocks until all workers are finished.
+		void SharedEventScheduler::stopProcess()
 		{
-			if (RealtimeEvents.empty())
-			{
+			// not started
+			if (irrgameAtomic::exchange(&IsRunning, 0) == 0)
 				return;
+
+			WakeUp->post(Workers.size());
+
+			for (u32 i = 0; i < Workers.size(); ++i)
+				Workers[i]->Thread->join();
+
+			// workers steal from each other, so delete only after all are finished.
+			// Events left in their deques wait in shared queues for next start.
+			for (u32 i = 0; i < Workers.size(); ++i)
+			{
+				for (u32 qType = EAP_HIGHPRIORITY; qType < EAP_COUNT; ++qType)
+				{
+					delegateEvent* e = Workers[i]->Events[qType].steal();
+
+					while (e)
+					{
+						addSharedEvent(e, (EEventPriority) qType);
+						e = Workers[i]->Events[qType].steal();
+					}
+				}
+
+				delete Workers[i];
 			}
 
-			core::list<delegateEvent*>::Iterator it = RealtimeEvents.begin();
+			Workers.clear();
+			irrgameAtomic::storeRelaxed(&SleepingWorkers, 0);
+		}
 
-			(*(*it))((void*) 0);
+		//! Proceed next real time event in main thread.
+		void SharedEventScheduler::proceedNextRealTimeEvent()
+		{
+			delegateEvent* e = takeSharedEvent(EAP_REALTIME);
 
-			//remove event from list
-			RealtimeEvents.erase(it);
+			if (e)
+				(*e)((void*) 0);
+		}
 
-			printf("proceedRTEvents\n");
+		//! Returns count of worker threads
+		u32 SharedEventScheduler::getWorkersCount() const
+		{
+			return Workers.size();
 		}
 
-		int SharedEventScheduler::proceedHPEvents(void* stub)
+		//! Worker thread function
+		s32 SharedEventScheduler::proceedWorkerEvents(void* arg)
 		{
-			while (true)
+			SEventWorker* worker = (SEventWorker*) arg;
+
+			CurrentWorker = worker;
+
+			while (irrgameAtomic::loadAcquire(&IsRunning))
 			{
-				if (HighpriorityEvents.empty())
+				delegateEvent* e = takeEvent(worker, EAP_HIGHPRIORITY);
+
+				if (!e)
+					e = takeEvent(worker, EAP_BACKGROUND);
+
+				if (e)
 				{
-					irrgameThread::sleep(50);
+					(*e)((void*) 0);
 					continue;
 				}
 
-				core::list<delegateEvent*>::Iterator it =
-						HighpriorityEvents.begin();
+				// nothing to do. Announce sleep, then check again to not miss
+				// event which was added before announcement.
+				irrgameAtomic::fetchAdd(&SleepingWorkers, 1);
+				irrgameAtomic::fence();
 
-				(*(*it))((void*) 0);
+				if (haveWorkerEvents() || !irrgameAtomic::loadAcquire(&IsRunning))
+				{
+					// try to cancel announcement. If somebody already took it,
+					// wake up signal is on the way and must be consumed.
+					s32 sleeping = irrgameAtomic::loadAcquire(&SleepingWorkers);
 
-				//remove event from list
-				HighpriorityEvents.erase(it);
+					while (sleeping > 0
+							&& !irrgameAtomic::compareExchange(&SleepingWorkers,
+									sleeping, sleeping - 1))
+						;
 
-				printf("proceedHPEvents\n");
+					if (sleeping > 0)
+						continue;
+				}
+
+				WakeUp->wait();
 			}
 
+			CurrentWorker = 0;
+
 			return 0;
 		}
 
-		int SharedEventScheduler::proceedBGEvents(void* stub)
+		//! Takes next event with specify priority for worker.
+		delegateEvent* SharedEventScheduler::takeEvent(SEventWorker* worker,
+				EEventPriority qType)
+		{
+			delegateEvent* result = worker->Events[qType].pop();
+
+			if (result)
+				return result;
+
+			result = takeSharedEvent(qType);
+
+			if (result)
+				return result;
+
+			// steal from neighbours
+			u32 count = Workers.size();
+
+			for (u32 i = 1; i < count && !result; ++i)
+			{
+				SEventWorker* victim = Workers[(worker->Index + i) % count];
+				result = victim->Events[qType].steal();
+			}
+
+			return result;
+		}
+
+		//! Adds event to shared queue
+		void SharedEventScheduler::addSharedEvent(delegateEvent* e,
+				EEventPriority qType)
 		{
-			while (true)
+			// while overflow queue is not empty, events go after it to keep order
+			if (irrgameAtomic::loadAcquire(&OverflowEventsCount[qType]) != 0
+					|| !SharedEvents[qType].push(e))
 			{
-				if (BackgroundEvents.empty())
-				{
-					irrgameThread::sleep(50);
-					continue;
-				}
+				OverflowEventsLock.enter();
+
+				OverflowEvents[qType].pushBack(e);
+				irrgameAtomic::storeRelease(&OverflowEventsCount[qType],
+						OverflowEventsCount[qType] + 1);
+
+				OverflowEventsLock.exit();
+			}
+		}
+
+		//! Takes next event from shared queue
+		delegateEvent* SharedEventScheduler::takeSharedEvent(
+				EEventPriority qType)
+		{
+			delegateEvent* result = 0;
+
+			if (SharedEvents[qType].pop(result))
+				return result;
 
+			if (irrgameAtomic::loadAcquire(&OverflowEventsCount[qType]) == 0)
+				return 0;
+
+			OverflowEventsLock.enter();
+
+			if (!OverflowEvents[qType].empty())
+			{
 				core::list<delegateEvent*>::Iterator it =
-						BackgroundEvents.begin();
+						OverflowEvents[qType].begin();
 
-				(*(*it))((void*) 0);
+				result = *it;
 
 				//remove event from list
-				BackgroundEvents.erase(it);
+				OverflowEvents[qType].erase(it);
 
-				printf("proceedBGEvents\n");
+				irrgameAtomic::storeRelease(&OverflowEventsCount[qType],
+						OverflowEventsCount[qType] - 1);
 			}
 
-			return 0;
+			OverflowEventsLock.exit();
+
+			return result;
+		}
+
+		//! Return True if any worker event is waiting.
+		bool SharedEventScheduler::haveWorkerEvents() const
+		{
+			if (!SharedEvents[EAP_HIGHPRIORITY].empty()
+					|| !SharedEvents[EAP_BACKGROUND].empty()
+					|| irrgameAtomic::loadAcquire(
+							&OverflowEventsCount[EAP_HIGHPRIORITY])
+					|| irrgameAtomic::loadAcquire(
+							&OverflowEventsCount[EAP_BACKGROUND]))
+				return true;
+
+			for (u32 i = 0; i < Workers.size(); ++i)
+			{
+				if (!Workers[i]->Events[EAP_HIGHPRIORITY].empty()
+						|| !Workers[i]->Events[EAP_BACKGROUND].empty())
+					return true;
+			}
+
+			return false;
+		}
+
+		//! Wakes up one sleeping worker if exists.
+		void SharedEventScheduler::wakeUpWorker()
+		{
+			irrgameAtomic::fence();
+
+			s32 sleeping = irrgameAtomic::loadAcquire(&SleepingWorkers);
+
+			while (sleeping > 0)
+			{
+				if (irrgameAtomic::compareExchange(&SleepingWorkers, sleeping,
+						sleeping - 1))
+				{
+					WakeUp->post();
+					return;
+				}
+			}
 		}
 
 	}
 }
-
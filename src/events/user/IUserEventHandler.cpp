@@ -208,13 +208,14 @@ namespace irrgame
 
 		void IUserEventHandler::initKeyStates()
 		{
-			//drops all cursors info
-			core::map<s32, EUserKeys>::ParentFirstIterator it =
-					KeyMap.getParentFirstIterator();
+			// key map is filled by initKeyMap, it is read by key events only
+			KeyMap.build();
 
-			for (; it.atEnd(); it++)
+			const u32 count = KeyMap.size();
+
+			for (u32 i = 0; i < count; ++i)
 			{
-				KeyStates.insert((*it).getValue(), EUKS_RELEASED);
+				KeyStates.insert(KeyMap.getNode(i).getValue(), EUKS_RELEASED);
 			}
 		}
 
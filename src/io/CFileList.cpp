@@ -36,6 +36,17 @@ namespace irrgame
 		void CFileList::sort()
 		{
 			Files.sort();
+
+			// indices are changed by sort
+			FileIndices.clear();
+			FileIndices.reallocate(Files.size());
+
+			for (u32 i = 0; i < Files.size(); ++i)
+				FileIndices.append(
+						getIndexKey(Files[i].FullName, Files[i].IsDirectory), i);
+
+			// sort ends batch of addItem calls, findFile must not build indices
+			FileIndices.build();
 		}
 
 		const core::stringc& CFileList::getFileName(u32 index) const
@@ -92,6 +103,9 @@ namespace irrgame
 
 			Files.pushBack(entry);
 
+			FileIndices.append(getIndexKey(entry.FullName, entry.IsDirectory),
+					Files.size() - 1);
+
 			return Files.size() - 1;
 		}
 
@@ -121,30 +135,30 @@ namespace irrgame
 		s32 CFileList::findFile(const core::stringc& filename,
 				bool isDirectory = false) const
 		{
-			SFileListEntry entry;
-			entry.FullName = filename;
-			entry.IsDirectory = isDirectory;
+			core::stringc fullName(filename);
 
 			// swap
-			entry.FullName.replace('\\', '/');
+			fullName.replace('\\', '/');
 
 			// remove trailing slash
-			if (entry.Name.lastChar() == '/')
+			if (fullName.lastChar() == '/')
 			{
-				entry.IsDirectory = true;
-				entry.Name[entry.Name.size() - 1] = 0;
-//				entry.Name.validate();
+				isDirectory = true;
+				fullName = fullName.subString(0, fullName.size() - 1);
 			}
 
 			if (IgnoreCase)
-				entry.FullName.makeLower();
+				fullName.makeLower();
 
 			if (IgnorePaths)
 			{
-				io::ioutils::deletePathFromFilename(entry.FullName);
+				io::ioutils::deletePathFromFilename(fullName);
 			}
 
-			return Files.linearReverseSearch(entry);
+			const core::flatmap<core::stringc, u32>::Node* node =
+					FileIndices.find(getIndexKey(fullName, isDirectory));
+
+			return node ? (s32) node->getValue() : -1;
 		}
 
 		//! Returns the base path of the file list
@@ -153,6 +167,18 @@ namespace irrgame
 			return Path;
 		}
 
+		//! Returns key of file in FileIndices. Folders end with slash.
+		core::stringc CFileList::getIndexKey(const core::stringc& fullName,
+				bool isDirectory) const
+		{
+			core::stringc result(fullName);
+
+			if (isDirectory)
+				result.append('/');
+
+			return result;
+		}
+
 		//! IFileList creator
 		IFileList* createFileList(const core::stringc& path, bool ignoreCase,
 				bool ignorePaths)
@@ -8,6 +8,7 @@
 #include "io/IFileList.h"
 #include "io/SFileListEntry.h"
 #include "core/collections/array.h"
+#include "core/collections/flatmap/flatmap.h"
 
 
 namespace irrgame
@@ -66,6 +67,10 @@ namespace irrgame
 
 			protected:
 
+				//! Returns key of file in FileIndices. Folders end with slash.
+				core::stringc getIndexKey(const core::stringc& fullName,
+						bool isDirectory) const;
+
 				//! Ignore paths when adding or searching for files
 				bool IgnorePaths;
 
@@ -77,6 +82,9 @@ namespace irrgame
 
 				//! List of files
 				core::array<SFileListEntry> Files;
+
+				//! Indices of files by full name, used by findFile
+				core::flatmap<core::stringc, u32> FileIndices;
 		};
 
 	} // end namespace irr
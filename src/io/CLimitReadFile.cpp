@@ -75,6 +75,14 @@ namespace irrgame
 			return Filename;
 		}
 
+		//! returns data of area, if whole file is in memory
+		const void* CLimitReadFile::getBuffer() const
+		{
+			const c8* buffer = static_cast<const c8*>(File->getBuffer());
+
+			return buffer ? buffer + AreaStart : 0;
+		}
+
 		IReadFile* createLimitReadFile(const core::stringc& fileName,
 				IReadFile* alreadyOpenedFile, long pos, long areaSize)
 		{
@@ -47,6 +47,9 @@ namespace irrgame
 				//! returns name of file
 				virtual const core::stringc& getFileName() const;
 
+				//! returns data of area, if whole file is in memory
+				virtual const void* getBuffer() const;
+
 			private:
 
 				core::stringc Filename;
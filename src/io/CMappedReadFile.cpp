@@ -0,0 +1,162 @@
+/*
+ * CMappedReadFile.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#include "CMappedReadFile.h"
+
+#ifdef IRR_MEMORY_MAPPED_FILES
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace irrgame
+{
+	namespace io
+	{
+
+		CMappedReadFile::CMappedReadFile(const core::stringc& fileName) :
+				Data(0), FileSize(0), Pos(0), Filename(fileName)
+		{
+#ifdef DEBUG
+			setDebugName("CMappedReadFile");
+#endif
+			openFile();
+		}
+
+		CMappedReadFile::~CMappedReadFile()
+		{
+			if (Data)
+				munmap(Data, FileSize);
+		}
+
+		//! returns how much was read
+		s32 CMappedReadFile::read(void* buffer, u32 sizeToRead)
+		{
+			IRR_ASSERT(buffer != 0);
+
+			long amount = FileSize - Pos;
+			if ((long) sizeToRead < amount)
+				amount = sizeToRead;
+
+			if (amount <= 0)
+				return 0;
+
+			memcpy(buffer, Data + Pos, amount);
+			Pos += amount;
+
+			return (s32) amount;
+		}
+
+		//! changes position in file, returns true if successful
+		//! if relativeMovement==true, the pos is changed relative to current pos,
+		//! otherwise from begin of file
+		bool CMappedReadFile::seek(long finalPos, bool relativeMovement)
+		{
+			const long pos = relativeMovement ? Pos + finalPos : finalPos;
+
+			if (pos < 0 || pos > FileSize)
+				return false;
+
+			Pos = pos;
+
+			return true;
+		}
+
+		//! returns size of file
+		long CMappedReadFile::getSize() const
+		{
+			return FileSize;
+		}
+
+		//! returns if file is open
+		bool CMappedReadFile::isOpen() const
+		{
+			return Data != 0;
+		}
+
+		//! returns where in the file we are.
+		long CMappedReadFile::getPos() const
+		{
+			return Pos;
+		}
+
+		//! returns name of file
+		const core::stringc& CMappedReadFile::getFileName() const
+		{
+			return Filename;
+		}
+
+		//! returns whole file data
+		const void* CMappedReadFile::getBuffer() const
+		{
+			return Data;
+		}
+
+		//! maps the file for read
+		void CMappedReadFile::openFile()
+		{
+			const s32 descriptor = open(Filename.cStr(), O_RDONLY);
+
+			if (descriptor < 0)
+				return;
+
+			struct stat info;
+
+			// empty files can not be mapped, they are read by CReadFile
+			if (fstat(descriptor, &info) == 0 && info.st_size > 0)
+			{
+				void* data = mmap(0, info.st_size, PROT_READ, MAP_PRIVATE,
+						descriptor, 0);
+
+				if (data != MAP_FAILED)
+				{
+					// loaders mostly read file from begin to end
+					madvise(data, info.st_size, MADV_SEQUENTIAL);
+
+					Data = static_cast<u8*>(data);
+					FileSize = info.st_size;
+				}
+			}
+
+			// mapping stays valid after descriptor is closed
+			close(descriptor);
+		}
+
+		//! Internal function, please do not use.
+		IReadFile* createMappedReadFile(const core::stringc& fileName)
+		{
+			CMappedReadFile* file = new CMappedReadFile(fileName);
+
+			if (file->isOpen())
+				return file;
+
+			file->drop();
+
+			return 0;
+		}
+
+	} // end namespace io
+} // end namespace irrgame
+
+#else
+
+namespace irrgame
+{
+	namespace io
+	{
+		//! Internal function, please do not use.
+		IReadFile* createMappedReadFile(const core::stringc&)
+		{
+			return 0;
+		}
+
+	} // end namespace io
+} // end namespace irrgame
+
+#endif /* IRR_MEMORY_MAPPED_FILES */
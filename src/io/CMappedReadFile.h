@@ -0,0 +1,66 @@
+/*
+ * CMappedReadFile.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef CMAPPEDREADFILE_H_
+#define CMAPPEDREADFILE_H_
+
+#include "io/IReadFile.h"
+
+namespace irrgame
+{
+	namespace io
+	{
+		/*!
+		 Class for reading a real file from disk through memory mapping.
+		 Whole file is mapped on open, reads are copies from mapping and
+		 getBuffer() gives file data without any copy.
+		 */
+		class CMappedReadFile: public IReadFile
+		{
+			public:
+
+				CMappedReadFile(const core::stringc& fileName);
+
+				virtual ~CMappedReadFile();
+
+				//! returns how much was read
+				virtual s32 read(void* buffer, u32 sizeToRead);
+
+				//! changes position in file, returns true if successful
+				virtual bool seek(long finalPos, bool relativeMovement = false);
+
+				//! returns size of file
+				virtual long getSize() const;
+
+				//! returns if file is open
+				virtual bool isOpen() const;
+
+				//! returns where in the file we are.
+				virtual long getPos() const;
+
+				//! returns name of file
+				virtual const core::stringc& getFileName() const;
+
+				//! returns whole file data
+				virtual const void* getBuffer() const;
+
+			private:
+
+				//! maps the file
+				void openFile();
+
+			private:
+				u8* Data;
+				long FileSize;
+				long Pos;
+				core::stringc Filename;
+		};
+
+	} // end namespace io
+} // end namespace irrgame
+
+#endif /* CMAPPEDREADFILE_H_ */
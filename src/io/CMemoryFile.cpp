@@ -108,6 +108,12 @@ namespace irrgame
 			return Filename;
 		}
 
+		//! returns whole file data
+		const void* CMemoryFile::getBuffer() const
+		{
+			return Buffer;
+		}
+
 		//! Internal function, please do not use.
 		IReadFile* createMemoryReadFile(void* memory, long size,
 				const core::stringc& fileName, bool deleteMemoryWhenDropped)
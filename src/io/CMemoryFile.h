@@ -46,6 +46,9 @@ namespace irrgame
 				//! returns name of file
 				virtual const core::stringc& getFileName() const;
 
+				//! returns whole file data
+				virtual const void* getBuffer() const;
+
 			private:
 
 				void *Buffer;
@@ -20,7 +20,7 @@ namespace irrgame
 
 			if ((IsDirectory == other.IsDirectory))
 			{
-				FullName.equalsIgnoreCase(other.FullName);
+				result = FullName.equalsIgnoreCase(other.FullName);
 			}
 
 			return result;
@@ -139,6 +139,12 @@ namespace irrgame
 		IReadFile* SharedFileSystem::createReadFile(
 				const core::stringc& filename)
 		{
+#ifdef IRR_MEMORY_MAPPED_FILES
+			IReadFile* file = io::createMappedReadFile(filename);
+
+			if (file)
+				return file;
+#endif
 			return io::createReadFile(filename);
 		}
 
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in irrlicht.h
 
 #include "io/serialize/CAttributes.h"
+#include "core/collections/SharedStringPool.h"
 
 #include "io/xml/IXMLWriter.h"
 
@@ -31,6 +32,67 @@ namespace irrgame
 {
 	namespace io
 	{
+		//! Xml element which stores attribute of type
+		struct SAttributeTag
+		{
+				const c8* Name;
+				EAttributeType Type;
+		};
+
+		static const SAttributeTag AttributeTags[] =
+		{
+		{ "int", EAT_INT },
+		{ "float", EAT_FLOAT },
+		{ "string", EAT_STRING },
+		{ "binary", EAT_BINARY },
+		{ "stringarray", EAT_STRINGARRAY },
+		{ "enum", EAT_ENUM },
+		{ "bool", EAT_BOOL },
+		{ "color", EAT_COLOR },
+		{ "colorf", EAT_COLORF },
+		{ "vector2d", EAT_VECTOR2D },
+		{ "vector3d", EAT_VECTOR3D },
+		{ "rect", EAT_RECT },
+		{ "dimension2d", EAT_DIMENSION2D },
+		{ "matrix", EAT_MATRIX },
+		{ "quaternion", EAT_QUATERNION },
+		{ "box3d", EAT_BBOX },
+		{ "plane", EAT_PLANE },
+		{ "triangle", EAT_TRIANGLE3D },
+		{ "line2d", EAT_LINE2D },
+		{ "line3d", EAT_LINE3D } };
+
+		static const u32 AttributeTagsCount = sizeof(AttributeTags)
+				/ sizeof(AttributeTags[0]);
+
+		//! Interned names of AttributeTags. Same order as AttributeTags.
+		struct SInternedAttributeTags
+		{
+				SInternedAttributeTags()
+				{
+					for (u32 i = 0; i < AttributeTagsCount; ++i)
+						Names[i] = AttributeTags[i].Name;
+				}
+
+				core::InternedString Names[AttributeTagsCount];
+		};
+
+		//! Returns type of attribute stored in xml element with name tag
+		static EAttributeType getAttributeTypeByTag(
+				const core::InternedString& tag)
+		{
+			// tags are interned once, then elements are compared by pointers
+			static const SInternedAttributeTags tags;
+
+			for (u32 i = 0; i < AttributeTagsCount; ++i)
+			{
+				if (tags.Names[i] == tag)
+					return AttributeTags[i].Type;
+			}
+
+			return EAT_UNKNOWN;
+		}
+
 		//! Default constructor
 		CAttributes::CAttributes()
 		{
@@ -52,6 +114,7 @@ namespace irrgame
 				Attributes[i]->drop();
 
 			Attributes.clear();
+			NameIndex.clear();
 		}
 
 		//! Returns amount of string attributes set in this scene manager.
@@ -69,11 +132,9 @@ namespace irrgame
 
 		IAttribute* CAttributes::getAttributeByName(const c8* name)
 		{
-			for (u32 i = 0; i < Attributes.size(); ++i)
-				if (Attributes[i]->Name == name)
-					return Attributes[i];
+			const s32 index = findAttribute(name);
 
-			return 0;
+			return index < 0 ? 0 : Attributes[index];
 		}
 
 		//! Returns the type of an attribute
@@ -119,11 +180,96 @@ namespace irrgame
 		//! Returns attribute index from name, -1 if not found
 		s32 CAttributes::findAttribute(const c8* attributeName)
 		{
-			for (u32 i = 0; i < Attributes.size(); ++i)
-				if (Attributes[i]->Name == attributeName)
-					return i;
+			if (NameIndex.empty())
+				return -1;
 
-			return -1;
+			// name which was never interned can't be a name of attribute
+			core::InternedString name;
+
+			if (!core::SharedStringPool::getInstance().find(attributeName, name))
+				return -1;
+
+			return findAttribute(name);
+		}
+
+		//! Returns attribute index from interned name, -1 if not found
+		s32 CAttributes::findAttribute(const core::InternedString& attributeName)
+		{
+			if (NameIndex.empty())
+				return -1;
+
+			const u32 mask = NameIndex.size() - 1;
+
+			for (u32 slot = attributeName.getHash() & mask;;
+					slot = (slot + 1) & mask)
+			{
+				const s32 index = NameIndex[slot];
+
+				if (index < 0)
+					return -1;
+
+				if (Attributes[index]->Name == attributeName)
+					return index;
+			}
+		}
+
+		//! Adds attribute to the end of list and to the name index
+		void CAttributes::addAttribute(IAttribute* attribute)
+		{
+			Attributes.pushBack(attribute);
+
+			// keep index at most half full, so probe sequences stay short
+			if (Attributes.size() * 2 > NameIndex.size())
+				rebuildNameIndex();
+			else
+				indexAttribute(Attributes.size() - 1);
+		}
+
+		//! Removes attribute from list and name index
+		void CAttributes::removeAttribute(u32 index)
+		{
+			Attributes[index]->drop();
+			Attributes.erase(index);
+
+			// positions of following attributes are changed
+			rebuildNameIndex();
+		}
+
+		//! Adds attribute to name index. First one of same named attributes is found.
+		void CAttributes::indexAttribute(u32 index)
+		{
+			const core::InternedString& name = Attributes[index]->Name;
+			const u32 mask = NameIndex.size() - 1;
+
+			for (u32 slot = name.getHash() & mask;; slot = (slot + 1) & mask)
+			{
+				const s32 other = NameIndex[slot];
+
+				if (other < 0)
+				{
+					NameIndex[slot] = index;
+					return;
+				}
+
+				if (Attributes[other]->Name == name)
+					return;
+			}
+		}
+
+		//! Recreates name index for current attributes
+		void CAttributes::rebuildNameIndex()
+		{
+			u32 size = 16;
+			while (size < Attributes.size() * 2)
+				size <<= 1;
+
+			NameIndex.setUsed(size);
+
+			for (u32 i = 0; i < size; ++i)
+				NameIndex[i] = -1;
+
+			for (u32 i = 0; i < Attributes.size(); ++i)
+				indexAttribute(i);
 		}
 
 		//! Reads attributes from a xml file.
@@ -136,14 +282,13 @@ namespace irrgame
 
 			clear();
 
-			core::stringc elementName = XML_TAG_ATTRIBUTES;
-
-			if (nonDefaultElementName)
-				elementName = nonDefaultElementName;
+			const core::InternedString elementName(
+					nonDefaultElementName ?
+							nonDefaultElementName : XML_TAG_ATTRIBUTES);
 
 			if (readCurrentElementOnly)
 			{
-				if (elementName != reader->getNodeName())
+				if (elementName != reader->getInternedNodeName())
 					return false;
 			}
 
@@ -155,7 +300,7 @@ namespace irrgame
 						readAttributeFromXML(reader);
 						break;
 					case io::EXNT_ELEMENT_END:
-						if (elementName == reader->getNodeName())
+						if (elementName == reader->getInternedNodeName())
 							return true;
 						break;
 					default:
@@ -233,34 +378,35 @@ namespace irrgame
 		{
 			IRR_ASSERT(reader != 0);
 
-			core::stringc element = reader->getNodeName();
-			core::stringc name = reader->getAttributeValue("name");
+			const EAttributeType type = getAttributeTypeByTag(
+					reader->getInternedNodeName());
+			const c8* name = reader->getAttributeValue("name");
 
-			if (element == "int")
+			if (type == EAT_INT)
 			{
-				addInt(name.cStr(), 0);
+				addInt(name, 0);
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "float")
+			else if (type == EAT_FLOAT)
 			{
-				addFloat(name.cStr(), 0);
+				addFloat(name, 0);
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "string")
+			else if (type == EAT_STRING)
 			{
-				addString(name.cStr(), "");
+				addString(name, "");
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "binary")
+			else if (type == EAT_BINARY)
 			{
-				addBinary(name.cStr(), 0, 0);
+				addBinary(name, 0, 0);
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "stringarray")
+			else if (type == EAT_STRINGARRAY)
 			{
 				arraystr tmpArray;
 
@@ -273,95 +419,95 @@ namespace irrgame
 							reader->getAttributeValue(
 									(tmpName + core::stringc(n)).cStr()));
 				}
-				addArray(name.cStr(), tmpArray);
+				addArray(name, tmpArray);
 			}
-			else if (element == "enum")
+			else if (type == EAT_ENUM)
 			{
-				addEnum(name.cStr(), 0, 0);
+				addEnum(name, 0, 0);
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "bool")
+			else if (type == EAT_BOOL)
 			{
-				addBool(name.cStr(), 0);
+				addBool(name, 0);
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "color")
+			else if (type == EAT_COLOR)
 			{
-				addColor(name.cStr(), video::SColor());
+				addColor(name, video::SColor());
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "colorf")
+			else if (type == EAT_COLORF)
 			{
-				addColorf(name.cStr(), video::SColorf());
+				addColorf(name, video::SColorf());
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "vector2d")
+			else if (type == EAT_VECTOR2D)
 			{
-				addVector2d(name.cStr(), vector2df());
+				addVector2d(name, vector2df());
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "vector3d")
+			else if (type == EAT_VECTOR3D)
 			{
-				addVector3d(name.cStr(), vector3df());
+				addVector3d(name, vector3df());
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "rect")
+			else if (type == EAT_RECT)
 			{
-				addRect(name.cStr(), recti());
+				addRect(name, recti());
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "dimension2d")
+			else if (type == EAT_DIMENSION2D)
 			{
-				addDimension2d(name.cStr(), dimension2df());
+				addDimension2d(name, dimension2df());
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "matrix")
+			else if (type == EAT_MATRIX)
 			{
-				addMatrix(name.cStr(), matrix4f());
+				addMatrix(name, matrix4f());
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "quaternion")
+			else if (type == EAT_QUATERNION)
 			{
-				addQuaternion(name.cStr(), core::quaternion());
+				addQuaternion(name, core::quaternion());
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "box3d")
+			else if (type == EAT_BBOX)
 			{
-				addBox3d(name.cStr(), aabbox3df());
+				addBox3d(name, aabbox3df());
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "plane")
+			else if (type == EAT_PLANE)
 			{
-				addPlane3d(name.cStr(), plane3df());
+				addPlane3d(name, plane3df());
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "triangle")
+			else if (type == EAT_TRIANGLE3D)
 			{
-				addTriangle3d(name.cStr(), triangle3df());
+				addTriangle3d(name, triangle3df());
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "line2d")
+			else if (type == EAT_LINE2D)
 			{
-				addLine2d(name.cStr(), line2df());
+				addLine2d(name, line2df());
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
-			else if (element == "line3d")
+			else if (type == EAT_LINE3D)
 			{
-				addLine3d(name.cStr(), line3df());
+				addLine3d(name, line3df());
 				Attributes.getLast()->setString(
 						reader->getAttributeValue("value"));
 			}
@@ -376,7 +522,7 @@ namespace irrgame
 		//! Adds an attribute as integer
 		void CAttributes::addInt(const c8* attributeName, s32 value)
 		{
-			Attributes.pushBack(new CIntAttribute(attributeName, value));
+			addAttribute(new CIntAttribute(attributeName, value));
 		}
 
 		//! Sets a attribute as integer value
@@ -387,7 +533,7 @@ namespace irrgame
 			if (att)
 				att->setInt(value);
 			else
-				Attributes.pushBack(new CIntAttribute(attributeName, value));
+				addAttribute(new CIntAttribute(attributeName, value));
 		}
 
 		//! Gets a attribute as integer value
@@ -425,7 +571,7 @@ namespace irrgame
 		//! Adds an attribute as float
 		void CAttributes::addFloat(const c8* attributeName, f32 value)
 		{
-			Attributes.pushBack(new CFloatAttribute(attributeName, value));
+			addAttribute(new CFloatAttribute(attributeName, value));
 		}
 
 		//! Sets a attribute as float value
@@ -436,7 +582,7 @@ namespace irrgame
 			if (att)
 				att->setFloat(value);
 			else
-				Attributes.pushBack(new CFloatAttribute(attributeName, value));
+				addAttribute(new CFloatAttribute(attributeName, value));
 		}
 
 		//! Gets a attribute as integer value
@@ -474,7 +620,7 @@ namespace irrgame
 		//! Adds an attribute as string
 		void CAttributes::addString(const c8* attributeName, const c8* value)
 		{
-			Attributes.pushBack(new CStringAttribute(attributeName, value));
+			addAttribute(new CStringAttribute(attributeName, value));
 		}
 
 		//! Sets a string attribute.
@@ -482,21 +628,19 @@ namespace irrgame
 		//! \param value: Value for the attribute. Set this to 0 to delete the attribute
 		void CAttributes::setAttribute(const c8* attributeName, const c8* value)
 		{
-			for (u32 i = 0; i < Attributes.size(); ++i)
-				if (Attributes[i]->Name == attributeName)
-				{
-					if (!value)
-					{
-						Attributes[i]->drop();
-						Attributes.erase(i);
-					}
-					else
-						Attributes[i]->setString(value);
+			const s32 index = findAttribute(attributeName);
 
-					return;
-				}
+			if (index >= 0)
+			{
+				if (!value)
+					removeAttribute(index);
+				else
+					Attributes[index]->setString(value);
+
+				return;
+			}
 
-			Attributes.pushBack(new CStringAttribute(attributeName, value));
+			addAttribute(new CStringAttribute(attributeName, value));
 
 		}
 
@@ -551,7 +695,7 @@ namespace irrgame
 		void CAttributes::addBinary(const c8* attributeName, void* data,
 				s32 dataSizeInBytes)
 		{
-			Attributes.pushBack(
+			addAttribute(
 					new CBinaryAttribute(attributeName, data, dataSizeInBytes));
 		}
 
@@ -564,7 +708,7 @@ namespace irrgame
 			if (att)
 				att->setBinary(data, dataSizeInBytes);
 			else
-				Attributes.pushBack(
+				addAttribute(
 						new CBinaryAttribute(attributeName, data,
 								dataSizeInBytes));
 		}
@@ -612,7 +756,7 @@ namespace irrgame
 		void CAttributes::addArray(const c8* attributeName,
 				const arraystr& value)
 		{
-			Attributes.pushBack(
+			addAttribute(
 					new CStringArrayAttribute(attributeName, value));
 		}
 
@@ -625,7 +769,7 @@ namespace irrgame
 			if (att)
 				att->setArray(value);
 			else
-				Attributes.pushBack(
+				addAttribute(
 						new CStringArrayAttribute(attributeName, value));
 		}
 
@@ -660,7 +804,7 @@ namespace irrgame
 		//! Adds an attribute as bool
 		void CAttributes::addBool(const c8* attributeName, bool value)
 		{
-			Attributes.pushBack(new CBoolAttribute(attributeName, value));
+			addAttribute(new CBoolAttribute(attributeName, value));
 		}
 
 		//! Sets a attribute as boolean value
@@ -671,7 +815,7 @@ namespace irrgame
 			if (att)
 				att->setBool(value);
 			else
-				Attributes.pushBack(new CBoolAttribute(attributeName, value));
+				addAttribute(new CBoolAttribute(attributeName, value));
 		}
 
 		//! Sets an attribute as boolean value
@@ -715,7 +859,7 @@ namespace irrgame
 		void CAttributes::addEnum(const c8* attributeName, const c8* enumValue,
 				const c8* const * enumerationLiterals)
 		{
-			Attributes.pushBack(
+			addAttribute(
 					new CEnumAttribute(attributeName, enumValue,
 							enumerationLiterals));
 		}
@@ -737,7 +881,7 @@ namespace irrgame
 			if (att)
 				att->setEnum(enumValue, enumerationLiterals);
 			else
-				Attributes.pushBack(
+				addAttribute(
 						new CEnumAttribute(attributeName, enumValue,
 								enumerationLiterals));
 		}
@@ -843,7 +987,7 @@ namespace irrgame
 		//! Adds an attribute as color
 		void CAttributes::addColor(const c8* attributeName, video::SColor value)
 		{
-			Attributes.pushBack(new CColorAttribute(attributeName, value));
+			addAttribute(new CColorAttribute(attributeName, value));
 		}
 
 		//! Sets a attribute as color
@@ -855,7 +999,7 @@ namespace irrgame
 			if (att)
 				att->setColor(value);
 			else
-				Attributes.pushBack(new CColorAttribute(attributeName, value));
+				addAttribute(new CColorAttribute(attributeName, value));
 		}
 
 		//! Sets a attribute as color
@@ -893,7 +1037,7 @@ namespace irrgame
 		void CAttributes::addColorf(const c8* attributeName,
 				video::SColorf value)
 		{
-			Attributes.pushBack(new CColorfAttribute(attributeName, value));
+			addAttribute(new CColorfAttribute(attributeName, value));
 		}
 
 		//! Sets a attribute as floating point color
@@ -905,7 +1049,7 @@ namespace irrgame
 			if (att)
 				att->setColor(value);
 			else
-				Attributes.pushBack(
+				addAttribute(
 						new CColorfAttribute(attributeName, value));
 		}
 
@@ -944,7 +1088,7 @@ namespace irrgame
 		//! Adds an attribute as 3d vector
 		void CAttributes::addVector2d(const c8* attributeName, vector2df value)
 		{
-			Attributes.pushBack(new CVector2DAttribute(attributeName, value));
+			addAttribute(new CVector2DAttribute(attributeName, value));
 		}
 
 		//! Sets a attribute as vector
@@ -961,7 +1105,7 @@ namespace irrgame
 			if (att)
 				att->setVector2d(value);
 			else
-				Attributes.pushBack(
+				addAttribute(
 						new CVector2DAttribute(attributeName, value));
 		}
 
@@ -993,7 +1137,7 @@ namespace irrgame
 		//! Adds an attribute as 3d vector
 		void CAttributes::addVector3d(const c8* attributeName, vector3df value)
 		{
-			Attributes.pushBack(new CVector3DAttribute(attributeName, value));
+			addAttribute(new CVector3DAttribute(attributeName, value));
 		}
 
 		//! Sets a attribute as vector
@@ -1010,7 +1154,7 @@ namespace irrgame
 			if (att)
 				att->setVector3d(value);
 			else
-				Attributes.pushBack(
+				addAttribute(
 						new CVector3DAttribute(attributeName, value));
 		}
 
@@ -1042,7 +1186,7 @@ namespace irrgame
 		//! Adds an attribute as rectangle
 		void CAttributes::addRect(const c8* attributeName, recti value)
 		{
-			Attributes.pushBack(new CRectAttribute(attributeName, value));
+			addAttribute(new CRectAttribute(attributeName, value));
 		}
 
 		//! Sets a attribute as rectangle
@@ -1053,7 +1197,7 @@ namespace irrgame
 			if (att)
 				att->setRect(value);
 			else
-				Attributes.pushBack(new CRectAttribute(attributeName, value));
+				addAttribute(new CRectAttribute(attributeName, value));
 		}
 
 		//! Sets a attribute as rectangle
@@ -1091,7 +1235,7 @@ namespace irrgame
 		void CAttributes::addDimension2d(const c8* attributeName,
 				dimension2df value)
 		{
-			Attributes.pushBack(
+			addAttribute(
 					new CDimension2dAttribute(attributeName, value));
 		}
 
@@ -1104,7 +1248,7 @@ namespace irrgame
 			if (att)
 				att->setDimension2d(value);
 			else
-				Attributes.pushBack(
+				addAttribute(
 						new CDimension2dAttribute(attributeName, value));
 		}
 
@@ -1143,7 +1287,7 @@ namespace irrgame
 		//! Adds an attribute as matrix
 		void CAttributes::addMatrix(const c8* attributeName, const matrix4f& v)
 		{
-			Attributes.pushBack(new CMatrixAttribute(attributeName, v));
+			addAttribute(new CMatrixAttribute(attributeName, v));
 		}
 
 		//! Sets an attribute as matrix
@@ -1154,7 +1298,7 @@ namespace irrgame
 			if (att)
 				att->setMatrix(v);
 			else
-				Attributes.pushBack(new CMatrixAttribute(attributeName, v));
+				addAttribute(new CMatrixAttribute(attributeName, v));
 		}
 
 		//! Sets an attribute as matrix
@@ -1189,7 +1333,7 @@ namespace irrgame
 		void CAttributes::addQuaternion(const c8* attributeName,
 				core::quaternion v)
 		{
-			Attributes.pushBack(new CQuaternionAttribute(attributeName, v));
+			addAttribute(new CQuaternionAttribute(attributeName, v));
 		}
 
 		//! Sets an attribute as quaternion
@@ -1202,7 +1346,7 @@ namespace irrgame
 				att->setQuaternion(v);
 			else
 
-				Attributes.pushBack(
+				addAttribute(
 						new CQuaternionAttribute(attributeName, v));
 		}
 
@@ -1239,7 +1383,7 @@ namespace irrgame
 		//! Adds an attribute as axis aligned bounding box
 		void CAttributes::addBox3d(const c8* attributeName, aabbox3df v)
 		{
-			Attributes.pushBack(new CBBoxAttribute(attributeName, v));
+			addAttribute(new CBBoxAttribute(attributeName, v));
 		}
 
 		//! Sets an attribute as axis aligned bounding box
@@ -1250,7 +1394,7 @@ namespace irrgame
 			if (att)
 				att->setBBox(v);
 			else
-				Attributes.pushBack(new CBBoxAttribute(attributeName, v));
+				addAttribute(new CBBoxAttribute(attributeName, v));
 		}
 
 		//! Sets an attribute as axis aligned bounding box
@@ -1284,7 +1428,7 @@ namespace irrgame
 		//! Adds an attribute as 3d plane
 		void CAttributes::addPlane3d(const c8* attributeName, plane3df v)
 		{
-			Attributes.pushBack(new CPlaneAttribute(attributeName, v));
+			addAttribute(new CPlaneAttribute(attributeName, v));
 		}
 
 		//! Sets an attribute as 3d plane
@@ -1296,7 +1440,7 @@ namespace irrgame
 				att->setPlane(v);
 			else
 
-				Attributes.pushBack(new CPlaneAttribute(attributeName, v));
+				addAttribute(new CPlaneAttribute(attributeName, v));
 		}
 
 		//! Sets an attribute as 3d plane
@@ -1330,7 +1474,7 @@ namespace irrgame
 		//! Adds an attribute as 3d triangle
 		void CAttributes::addTriangle3d(const c8* attributeName, triangle3df v)
 		{
-			Attributes.pushBack(new CTriangleAttribute(attributeName, v));
+			addAttribute(new CTriangleAttribute(attributeName, v));
 		}
 
 		//! Sets an attribute as 3d triangle
@@ -1341,7 +1485,7 @@ namespace irrgame
 			if (att)
 				att->setTriangle(v);
 			else
-				Attributes.pushBack(new CTriangleAttribute(attributeName, v));
+				addAttribute(new CTriangleAttribute(attributeName, v));
 		}
 
 		//! Sets an attribute as 3d triangle
@@ -1376,7 +1520,7 @@ namespace irrgame
 		//! Adds an attribute as a 2d line
 		void CAttributes::addLine2d(const c8* attributeName, line2df v)
 		{
-			Attributes.pushBack(new CLine2dAttribute(attributeName, v));
+			addAttribute(new CLine2dAttribute(attributeName, v));
 		}
 
 		//! Sets an attribute as a 2d line
@@ -1387,7 +1531,7 @@ namespace irrgame
 			if (att)
 				att->setLine2d(v);
 			else
-				Attributes.pushBack(new CLine2dAttribute(attributeName, v));
+				addAttribute(new CLine2dAttribute(attributeName, v));
 		}
 
 		//! Sets an attribute as a 2d line
@@ -1421,7 +1565,7 @@ namespace irrgame
 		//! Adds an attribute as a 3d line
 		void CAttributes::addLine3d(const c8* attributeName, line3df v)
 		{
-			Attributes.pushBack(new CLine3dAttribute(attributeName, v));
+			addAttribute(new CLine3dAttribute(attributeName, v));
 		}
 
 		//! Sets an attribute as a 3d line
@@ -1432,7 +1576,7 @@ namespace irrgame
 			if (att)
 				att->setLine3d(v);
 			else
-				Attributes.pushBack(new CLine3dAttribute(attributeName, v));
+				addAttribute(new CLine3dAttribute(attributeName, v));
 		}
 
 		//! Sets an attribute as a 3d line
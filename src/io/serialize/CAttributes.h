@@ -58,6 +58,10 @@ namespace irrgame
 				//! Returns attribute index from name, -1 if not found
 				virtual s32 findAttribute(const c8* attributeName);
 
+				//! Returns attribute index from interned name, -1 if not found
+				virtual s32 findAttribute(
+						const core::InternedString& attributeName);
+
 				//! Reads attributes from a xml file.
 				//! \param readCurrentElementOnly: If set to true, reading only works if current element has the name 'attributes'.
 				//! IF set to false, the first appearing list attributes are read.
@@ -640,10 +644,26 @@ namespace irrgame
 
 				void readAttributeFromXML(io::IXMLReader* reader);
 
+				//! Adds attribute to the end of list and to the name index
+				void addAttribute(IAttribute* attribute);
+
+				//! Removes attribute from list and name index
+				void removeAttribute(u32 index);
+
+				//! Adds attribute to name index. First one of same named attributes is found.
+				void indexAttribute(u32 index);
+
+				//! Recreates name index for current attributes
+				void rebuildNameIndex();
+
 			protected:
 
 				core::array<IAttribute*> Attributes;
 
+				//! Open addressing table of positions in Attributes. Empty slot is -1.
+				//! Size is power of two.
+				core::array<s32> NameIndex;
+
 		};
 
 	}
@@ -24,6 +24,9 @@ namespace irrgame
 		{
 			int literalCount = 0;
 
+			EnumLiterals.clear();
+			LiteralIndices.clear();
+
 			if (enumerationLiterals)
 			{
 				s32 i;
@@ -31,8 +34,19 @@ namespace irrgame
 					++literalCount;
 
 				EnumLiterals.reallocate(literalCount);
+				LiteralIndices.reallocate(literalCount);
+
 				for (i = 0; enumerationLiterals[i]; ++i)
+				{
 					EnumLiterals.pushBack(enumerationLiterals[i]);
+
+					core::stringc key(enumerationLiterals[i]);
+					key.makeLower();
+
+					LiteralIndices.append(key, i);
+				}
+
+				LiteralIndices.build();
 			}
 
 			setString(enumValue);
@@ -40,13 +54,13 @@ namespace irrgame
 
 		s32 CEnumAttribute::getInt()
 		{
-			for (s32 i = 0; EnumLiterals.size(); ++i)
-				if (Value.equalsIgnoreCase(EnumLiterals[i]))
-				{
-					return i;
-				}
+			core::stringc key(Value);
+			key.makeLower();
+
+			const core::flatmap<core::stringc, s32>::Node* node =
+					LiteralIndices.find(key);
 
-			return -1;
+			return node ? node->getValue() : -1;
 		}
 
 		f32 CEnumAttribute::getFloat()
@@ -10,6 +10,7 @@
 
 #include "io/serialize/IAttribute.h"
 #include "core/collections/stringc.h"
+#include "core/collections/flatmap/flatmap.h"
 
 namespace irrgame
 {
@@ -50,6 +51,10 @@ namespace irrgame
 			public:
 				core::stringc Value;
 				arraystr EnumLiterals;
+
+			private:
+				//! Indices of literals by lower case literal
+				core::flatmap<core::stringc, s32> LiteralIndices;
 		};
 	}
 }
@@ -6,16 +6,23 @@
  */
 #include "CXMLReader.h"
 #include "core/math/SharedConverter.h"
+#include "core/collections/SharedStringPool.h"
 #include "io/IReadFile.h"
 #include "io/utils/ioutils.h"
+#include <string.h>
 namespace irrgame
 {
 	namespace io
 	{
+		//! Name of node before first one. Never changed.
+		static c8 EmptyText[] = "";
+
 		//! Default constructor
 		CXMLReader::CXMLReader(IReadFile* file) :
 				TextData(0), P(0), TextBegin(0), TextSize(0), CurrentNodeType(
-						EXNT_NONE), IsEmptyElement(true)
+						EXNT_NONE), NodeName(EmptyText), IsNodeNameEncoded(
+						false), IsNodeNameInterned(true), IsTagStarted(false), IsEmptyElement(
+						true)
 		{
 			IRR_ASSERT(file != 0);
 
@@ -210,7 +217,8 @@ namespace irrgame
 		bool CXMLReader::read()
 		{
 			// if not end reached, parse the node
-			if (P && (u32) (P - TextBegin) < TextSize - 1 && *P != 0)
+			if (P && (u32) (P - TextBegin) < TextSize - 1
+					&& (*P != 0 || IsTagStarted))
 			{
 				return parseCurrentNode();
 			}
@@ -234,34 +242,34 @@ namespace irrgame
 		//! Returns name of an attribute.
 		const c8* CXMLReader::getAttributeName(int idx) const
 		{
-			return Attributes[idx].Name.cStr();
+			return Attributes[idx].Name;
 		}
 
 		//! Returns the value of an attribute.
 		const c8* CXMLReader::getAttributeValue(int idx) const
 		{
-			return Attributes[idx].Value.cStr();
+			return getDecodedValue(Attributes[idx]);
 		}
 
 		//! Returns the value of an attribute.
 		const c8* CXMLReader::getAttributeValue(const c8* name) const
 		{
-			const SAttribute* attr = getAttributeByName(name);
+			SAttribute* attr = getAttributeByName(name);
 
 			IRR_ASSERT(attr != 0);
 
-			return attr->Value.cStr();
+			return getDecodedValue(*attr);
 		}
 
 		//! Returns the value of an attribute
 		const c8* CXMLReader::getAttributeValueSafe(const c8* name) const
 		{
-			const SAttribute* attr = getAttributeByName(name);
+			SAttribute* attr = getAttributeByName(name);
 
 			if (!attr)
-				return EmptyString.cStr();
+				return EmptyText;
 
-			return attr->Value.cStr();
+			return getDecodedValue(*attr);
 		}
 
 		//! Returns the value of an attribute as integer.
@@ -279,12 +287,12 @@ namespace irrgame
 		//! Returns the value of an attribute as float.
 		f32 CXMLReader::getAttributeValueAsFloat(const c8* name) const
 		{
-			const SAttribute* attr = getAttributeByName(name);
+			SAttribute* attr = getAttributeByName(name);
 
 			IRR_ASSERT(attr != 0);
 
-			core::stringc c = attr->Value.cStr();
-			return core::SharedConverter::getInstance().convertToFloat(c.cStr());
+			return core::SharedConverter::getInstance().convertToFloat(
+					getDecodedValue(*attr));
 		}
 
 		//! Returns the value of an attribute as float.
@@ -294,20 +302,39 @@ namespace irrgame
 
 			IRR_ASSERT(sizeof(attrvalue) > 0);
 
-			core::stringc c = attrvalue;
-			return core::SharedConverter::getInstance().convertToFloat(c.cStr());
+			return core::SharedConverter::getInstance().convertToFloat(attrvalue);
 		}
 
 		//! Returns the name of the current node.
 		const c8* CXMLReader::getNodeName() const
 		{
-			return NodeName.cStr();
+			if (IsNodeNameEncoded)
+			{
+				replaceSpecialCharacters(NodeName);
+				IsNodeNameEncoded = false;
+			}
+
+			return NodeName;
+		}
+
+		//! Returns the name of the current node as interned string.
+		core::InternedString CXMLReader::getInternedNodeName() const
+		{
+			if (!IsNodeNameInterned)
+			{
+				InternedNodeName =
+						core::SharedStringPool::getInstance().intern(
+								getNodeName());
+				IsNodeNameInterned = true;
+			}
+
+			return InternedNodeName;
 		}
 
 		//! Returns data of the current node.
 		const c8* CXMLReader::getNodeData() const
 		{
-			return NodeName.cStr();
+			return getNodeName();
 		}
 
 		//! Returns if an element is an empty element, like <foo />
@@ -320,23 +347,30 @@ namespace irrgame
 		// return false if no further node is found
 		bool CXMLReader::parseCurrentNode()
 		{
-			c8* start = P;
+			// every parsed node changes NodeName
+			IsNodeNameInterned = false;
 
-			// more forward until '<' found
-			while (*P != '<' && *P)
-				++P;
+			if (!IsTagStarted)
+			{
+				c8* start = P;
 
-			// not a node, so return false
-			if (!*P)
-				return false;
+				// more forward until '<' found
+				while (*P != '<' && *P)
+					++P;
 
-			if (P - start > 0)
-			{
-				// we found some text, store it
-				if (setText(start, P))
-					return true;
+				// not a node, so return false
+				if (!*P)
+					return false;
+
+				if (P - start > 0)
+				{
+					// we found some text, store it
+					if (setText(start, P))
+						return true;
+				}
 			}
 
+			IsTagStarted = false;
 			++P;
 
 			// based on current token, parse and report next element
@@ -375,9 +409,14 @@ namespace irrgame
 					return false;
 			}
 
-			// set current text to the parsed text, and replace xml special characters
-			core::stringc s(start, (int) (end - start));
-			NodeName = replaceSpecialCharacters(s);
+			// set current text to the parsed text, xml special characters
+			// are replaced on first access
+			NodeName = start;
+			IsNodeNameEncoded = hasSpecialCharacters(start, end);
+
+			// end is '<' of next tag, it is skipped by next parseCurrentNode
+			*end = 0;
+			IsTagStarted = true;
 
 			// current XML node type is text
 			CurrentNodeType = EXNT_TEXT;
@@ -385,6 +424,17 @@ namespace irrgame
 			return true;
 		}
 
+		//! Returns true if text contains xml special characters
+		bool CXMLReader::hasSpecialCharacters(const c8* start,
+				const c8* end) const
+		{
+			for (; start != end; ++start)
+				if (*start == '&')
+					return true;
+
+			return false;
+		}
+
 		//! ignores an xml definition like <?xml something />
 		void CXMLReader::ignoreDefinition()
 		{
@@ -419,8 +469,9 @@ namespace irrgame
 			}
 
 			P -= 3;
-			NodeName = core::stringc(pCommentBegin + 2,
-					(int) (P - pCommentBegin - 2));
+			NodeName = pCommentBegin + 2;
+			IsNodeNameEncoded = false;
+			*P = 0;
 			P += 3;
 		}
 
@@ -429,16 +480,16 @@ namespace irrgame
 		{
 			CurrentNodeType = EXNT_ELEMENT;
 			IsEmptyElement = false;
-			Attributes.clear();
+			Attributes.setUsed(0);
 
 			// find name
-			const c8* startName = P;
+			c8* startName = P;
 
 			// find end of element
 			while (*P != '>' && !ioutils::isWhiteSpace(*P))
 				++P;
 
-			const c8* endName = P;
+			c8* endName = P;
 
 			// find Attributes
 			while (*P != '>')
@@ -454,14 +505,14 @@ namespace irrgame
 						// we've got an attribute
 
 						// read the attribute names
-						const c8* attributeNameBegin = P;
+						c8* attributeNameBegin = P;
 
 						while (!ioutils::isWhiteSpace(*P) && *P != '=')
 						{
 							++P;
 						}
 
-						const c8* attributeNameEnd = P;
+						c8* attributeNameEnd = P;
 						++P;
 
 						// read the attribute value
@@ -479,7 +530,7 @@ namespace irrgame
 						const c8 attributeQuoteChar = *P;
 
 						++P;
-						const c8* attributeValueBegin = P;
+						c8* attributeValueBegin = P;
 
 						while (*P != attributeQuoteChar && *P)
 						{
@@ -491,17 +542,19 @@ namespace irrgame
 							return;
 						}
 
-						const c8* attributeValueEnd = P;
+						c8* attributeValueEnd = P;
 						++P;
 
 						SAttribute attr;
-						attr.Name = core::stringc(attributeNameBegin,
-								(int) (attributeNameEnd - attributeNameBegin));
+						attr.Name = attributeNameBegin;
+						attr.Value = attributeValueBegin;
+						attr.IsValueEncoded = hasSpecialCharacters(
+								attributeValueBegin, attributeValueEnd);
 
-						core::stringc s(attributeValueBegin,
-								(int) (attributeValueEnd - attributeValueBegin));
+						// parser is already behind both ends
+						*attributeNameEnd = 0;
+						*attributeValueEnd = 0;
 
-						attr.Value = replaceSpecialCharacters(s);
 						Attributes.pushBack(attr);
 					}
 					else
@@ -522,7 +575,11 @@ namespace irrgame
 				endName--;
 			}
 
-			NodeName = core::stringc(startName, (int) (endName - startName));
+			NodeName = startName;
+			IsNodeNameEncoded = false;
+
+			// end of name may be '>', so it is terminated after attributes are read
+			*endName = 0;
 
 			++P;
 		}
@@ -532,15 +589,17 @@ namespace irrgame
 		{
 			CurrentNodeType = EXNT_ELEMENT_END;
 			IsEmptyElement = false;
-			Attributes.clear();
+			Attributes.setUsed(0);
 
 			++P;
-			const c8* pBeginClose = P;
+			c8* pBeginClose = P;
 
 			while (*P != '>')
 				++P;
 
-			NodeName = core::stringc(pBeginClose, (int) (P - pBeginClose));
+			NodeName = pBeginClose;
+			IsNodeNameEncoded = false;
+			*P = 0;
 			++P;
 		}
 
@@ -577,80 +636,83 @@ namespace irrgame
 				++P;
 			}
 
+			IsNodeNameEncoded = false;
+
 			if (cDataEnd)
-				NodeName = core::stringc(cDataBegin,
-						(int) (cDataEnd - cDataBegin));
+			{
+				NodeName = cDataBegin;
+				*cDataEnd = 0;
+			}
 			else
-				NodeName = "";
+			{
+				// P is at the end of text
+				NodeName = P;
+			}
 
 			return true;
 		}
 
 		// finds a current attribute by name, returns 0 if not found
-		const SAttribute* CXMLReader::getAttributeByName(const c8* name) const
+		SAttribute* CXMLReader::getAttributeByName(const c8* name) const
 		{
 			IRR_ASSERT(sizeof(name) > 0);
 
-			core::stringc n = name;
-
-			for (int i = 0; i < (int) Attributes.size(); ++i)
-				if (Attributes[i].Name == n)
+			for (u32 i = 0; i < Attributes.size(); ++i)
+				if (strcmp(Attributes[i].Name, name) == 0)
 					return &Attributes[i];
 
 			return 0;
 		}
 
-		// replaces xml special characters in a string and creates a new one
-		core::stringc CXMLReader::replaceSpecialCharacters(
-				core::stringc& origstr)
+		//! Returns value of attribute with replaced xml special characters
+		const c8* CXMLReader::getDecodedValue(SAttribute& attr) const
 		{
-			int pos = origstr.findFirst('&');
-			int oldPos = 0;
+			if (attr.IsValueEncoded)
+			{
+				replaceSpecialCharacters(attr.Value);
+				attr.IsValueEncoded = false;
+			}
 
-			if (pos == -1)
-				return origstr;
+			return attr.Value;
+		}
 
-			core::stringc newstr;
+		// replaces xml special characters in place. Result is never longer.
+		void CXMLReader::replaceSpecialCharacters(c8* str) const
+		{
+			c8* dest = str;
 
-			while (pos != -1 && pos < (int) origstr.size() - 2)
+			while (*str)
 			{
-				// check if it is one of the special characters
-
-				int specialChar = -1;
-				for (int i = 0; i < (int) SpecialCharacters.size(); ++i)
+				if (*str == '&')
 				{
-					const c8* p = &origstr.cStr()[pos] + 1;
+					// check if it is one of the special characters
+					s32 specialChar = -1;
 
-					if (SpecialCharacters[i].equalsn(p,
-							SpecialCharacters[i].size() - 1))
+					for (u32 i = 0; i < SpecialCharacters.size(); ++i)
 					{
-						specialChar = i;
-						break;
+						// symbol is stored after the special character
+						const c8* symbol = SpecialCharacters[i].cStr() + 1;
+
+						if (strncmp(str + 1, symbol,
+								SpecialCharacters[i].size() - 1) == 0)
+						{
+							specialChar = i;
+							break;
+						}
 					}
-				}
 
-				if (specialChar != -1)
-				{
-					newstr.append(origstr.subString(oldPos, pos - oldPos));
-					newstr.append(SpecialCharacters[specialChar][0]);
-					pos += SpecialCharacters[specialChar].size();
-				}
-				else
-				{
-					newstr.append(origstr.subString(oldPos, pos - oldPos + 1));
-					pos += 1;
+					if (specialChar != -1)
+					{
+						*dest++ = SpecialCharacters[specialChar][0];
+						str += SpecialCharacters[specialChar].size();
+						continue;
+					}
 				}
 
-				// find next &
-				oldPos = pos;
-				pos = origstr.findFirst('&', pos);
+				*dest++ = *str++;
 			}
 
-			if (oldPos < (int) origstr.size() - 1)
-				newstr.append(
-						origstr.subString(oldPos, origstr.size() - oldPos));
-
-			return newstr;
+			*dest = 0;
 		}
 
 		//! Creates an instance of an UFT-8 or ASCII character xml parser. Internal function. Please do not use.
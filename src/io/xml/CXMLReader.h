@@ -18,7 +18,11 @@ namespace irrgame
 {
 	namespace io
 	{
-		//! Implementation of IXMLReader
+		//! Implementation of IXMLReader.
+		//! Parses in situ: node names, attribute names and values point into text
+		//! of file, which is zero terminated in place. Xml special characters are
+		//! replaced in place on first access. Returned strings are valid while
+		//! reader exists.
 		class CXMLReader: public IXMLReader
 		{
 			public:
@@ -66,6 +70,9 @@ namespace irrgame
 				//! Returns the name of the current node.
 				virtual const c8* getNodeName() const;
 
+				//! Returns the name of the current node as interned string.
+				virtual core::InternedString getInternedNodeName() const;
+
 				//! Returns data of the current node.
 				virtual const c8* getNodeData() const;
 
@@ -84,6 +91,9 @@ namespace irrgame
 				//! sets the state that text was found. Returns true if set should be set
 				bool setText(c8* start, c8* end);
 
+				//! Returns true if text contains xml special characters
+				bool hasSpecialCharacters(const c8* start, const c8* end) const;
+
 				//! ignores an xml definition like <?xml something />
 				void ignoreDefinition();
 
@@ -100,10 +110,13 @@ namespace irrgame
 				bool parseCDATA();
 
 				// finds a current attribute by name, returns 0 if not found
-				const SAttribute* getAttributeByName(const c8* name) const;
+				SAttribute* getAttributeByName(const c8* name) const;
+
+				//! Returns value of attribute with replaced xml special characters
+				const c8* getDecodedValue(SAttribute& attr) const;
 
-				// replaces xml special characters in a string and creates a new one
-				core::stringc replaceSpecialCharacters(core::stringc& origstr);
+				// replaces xml special characters in place. Result is never longer.
+				void replaceSpecialCharacters(c8* str) const;
 
 				//! converts the text file into the desired format.
 				//! \param source: begin of the text (without byte order mark)
@@ -135,14 +148,19 @@ namespace irrgame
 				EXML_NODE_TYPE CurrentNodeType; // type of the currently parsed node
 				// source format of the xml file
 
-				core::stringc NodeName; // name of the node currently in
-				core::stringc EmptyString; // empty string to be returned by getSafe() methods
+				c8* NodeName; // name or data of the node currently in
+				mutable bool IsNodeNameEncoded; // node data contains not replaced special characters
+
+				mutable core::InternedString InternedNodeName; // interned NodeName, valid if IsNodeNameInterned
+				mutable bool IsNodeNameInterned; // NodeName was interned after current node was parsed
+
+				bool IsTagStarted; // '<' of next tag is replaced by end of text node
 
 				bool IsEmptyElement; // is the currently parsed node empty?
 
 				arraystr SpecialCharacters; // see createSpecialCharacterList()
 
-				core::array<SAttribute> Attributes; // attributes of current element
+				mutable core::array<SAttribute> Attributes; // attributes of current element
 		};
 	}
 }
@@ -6,6 +6,7 @@
  */
 
 #include "SAttribute.h"
+#include <string.h>
 
 namespace irrgame
 {
@@ -14,7 +15,7 @@ namespace irrgame
 		//! Equality operator
 		bool SAttribute::operator ==(const SAttribute& other) const
 		{
-			return this->Name == other.Name;
+			return strcmp(Name, other.Name) == 0;
 		}
 
 		//! Inequality operator
@@ -23,13 +24,13 @@ namespace irrgame
 			return !(*this == other);
 		}
 
-		//! Is smaller comparator. Copmared only attributes lengths.
+		//! Is smaller comparator. Copmared only attributes names.
 		bool SAttribute::operator <(const SAttribute& other) const
 		{
-			return (this->Name < other.Name && this->Value < other.Value);
+			return strcmp(Name, other.Name) < 0;
 		}
 
-		//! Is bigger comparator. Copmared only attributes lengths.
+		//! Is bigger comparator. Copmared only attributes names.
 		bool SAttribute::operator >(const SAttribute& other) const
 		{
 			return !(*this < other);
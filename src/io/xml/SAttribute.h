@@ -8,13 +8,14 @@
 #ifndef SATTRIBUTE_H_
 #define SATTRIBUTE_H_
 
-#include "core/collections/stringc.h"
+#include "compileConfig.h"
 
 namespace irrgame
 {
 	namespace io
 	{
-		// structure for storing attribute-name pairs
+		// structure for storing attribute-name pairs.
+		// Name and value point into text of xml file, they are not copied.
 		struct SAttribute
 		{
 			public:
@@ -27,15 +28,18 @@ namespace irrgame
 				//! Inequality operator
 				bool operator !=(const SAttribute& other) const;
 
-				//! Is smaller comparator. Copmared only attributes lengths.
+				//! Is smaller comparator. Copmared only attributes names.
 				bool operator <(const SAttribute& other) const;
 
-				//! Is bigger comparator. Copmared only attributes lengths.
+				//! Is bigger comparator. Copmared only attributes names.
 				bool operator >(const SAttribute& other) const;
 
 			public:
-				core::stringc Name;
-				core::stringc Value;
+				c8* Name;
+				c8* Value;
+
+				//! Value contains xml special characters, which are not replaced yet
+				bool IsValueEncoded;
 		};
 	}  // namespace io
 }  // namespace irrgame
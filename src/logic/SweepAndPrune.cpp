@@ -0,0 +1,651 @@
+/*
+ * SweepAndPrune.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#include "logic/SweepAndPrune.h"
+#include "core/math/SharedIntrosort.h"
+#include "core/math/SharedMath.h"
+
+namespace irrgame
+{
+	namespace logic
+	{
+		//! State of pair in SweepAndPrune::Pairs
+		enum EPairState
+		{
+			//! Pair overlapped by previous update
+			EPS_WAS_OVERLAPPING = 1,
+
+			//! Pair overlaps now
+			EPS_OVERLAPPING = 2,
+
+			//! Pair is in ChangedPairs
+			EPS_CHANGED = 4
+		};
+
+		//! Returns key of pair in SweepAndPrune::Pairs
+		inline u64 getPairKey(u32 first, u32 second)
+		{
+			return first < second ?
+					((u64) first << 32) | second : ((u64) second << 32) | first;
+		}
+
+		//! Returns True if box may be added to SweepAndPrune
+		inline bool isBoxValid(const core::aabbox3d<f32>& box)
+		{
+			return box.MinEdge.X > -core::SharedMath::MaxFloat
+					&& box.MinEdge.Y > -core::SharedMath::MaxFloat
+					&& box.MinEdge.Z > -core::SharedMath::MaxFloat
+					&& box.MaxEdge.X < core::SharedMath::MaxFloat
+					&& box.MaxEdge.Y < core::SharedMath::MaxFloat
+					&& box.MaxEdge.Z < core::SharedMath::MaxFloat
+					&& box.MinEdge.X <= box.MaxEdge.X
+					&& box.MinEdge.Y <= box.MaxEdge.Y
+					&& box.MinEdge.Z <= box.MaxEdge.Z;
+		}
+
+		//! Default constructor. Does not allocate.
+		SweepAndPrune::SweepAndPrune() :
+				ChangedPairs(Scratch), ObjectsCount(0)
+		{
+		}
+
+		//! Destructor
+		SweepAndPrune::~SweepAndPrune()
+		{
+		}
+
+		//! Adds object with box. Object is inserted by next update.
+		u32 SweepAndPrune::addObject(const core::aabbox3d<f32>& box,
+				IGameObject* object)
+		{
+			IRR_ASSERT(isBoxValid(box));
+
+			u32 handle;
+
+			if (FreeHandles.empty())
+			{
+				handle = Proxies.size();
+				Proxies.pushBack(SProxy());
+			}
+			else
+			{
+				handle = FreeHandles.getLast();
+				FreeHandles.erase(FreeHandles.size() - 1);
+			}
+
+			// lowest bit of endpoint is taken by flag of maximum
+			IRR_ASSERT(handle < (InvalidHandle >> 1));
+
+			SProxy& proxy = Proxies[handle];
+			proxy.Box = box;
+			proxy.Object = object;
+			proxy.Flags = EPF_USED;
+
+			Added.pushBack(handle);
+			++ObjectsCount;
+
+			return handle;
+		}
+
+		//! Removes object. Object is removed by next update.
+		void SweepAndPrune::removeObject(u32 handle)
+		{
+			IRR_ASSERT(handle < Proxies.size());
+
+			SProxy& proxy = Proxies[handle];
+
+			IRR_ASSERT(
+					(proxy.Flags & EPF_USED) && !(proxy.Flags & EPF_REMOVED));
+
+			proxy.Flags |= EPF_REMOVED;
+
+			Removed.pushBack(handle);
+			--ObjectsCount;
+		}
+
+		//! Sets box of object. Object is moved by next update.
+		void SweepAndPrune::setBox(u32 handle, const core::aabbox3d<f32>& box)
+		{
+			IRR_ASSERT(handle < Proxies.size());
+			IRR_ASSERT(isBoxValid(box));
+
+			SProxy& proxy = Proxies[handle];
+
+			IRR_ASSERT(
+					(proxy.Flags & EPF_USED) && !(proxy.Flags & EPF_REMOVED));
+
+			proxy.Box = box;
+
+			// objects, which are not inserted yet, are inserted with new box
+			if ((proxy.Flags & (EPF_INSERTED | EPF_MOVED)) == EPF_INSERTED)
+			{
+				proxy.Flags |= EPF_MOVED;
+				Moved.pushBack(handle);
+			}
+		}
+
+		//! Returns box of object
+		const core::aabbox3d<f32>& SweepAndPrune::getBox(u32 handle) const
+		{
+			IRR_ASSERT(handle < Proxies.size());
+
+			return Proxies[handle].Box;
+		}
+
+		//! Returns game object of handle
+		IGameObject* SweepAndPrune::getObject(u32 handle) const
+		{
+			IRR_ASSERT(handle < Proxies.size());
+
+			return Proxies[handle].Object;
+		}
+
+		//! Returns count of objects, which are added and not removed
+		u32 SweepAndPrune::getObjectsCount() const
+		{
+			return ObjectsCount;
+		}
+
+		//! Applies added, removed and moved objects.
+		void SweepAndPrune::update(core::array<SOverlapPair>& outBegun,
+				core::array<SOverlapPair>& outEnded)
+		{
+			outBegun.setUsed(0);
+			outEnded.setUsed(0);
+
+			// every object is inserted or removed by insertion sort through
+			// whole list, so many of them are faster sorted at once
+			if (Added.size() + Removed.size()
+					> IRR_SWEEP_AND_PRUNE_REBUILD_THRESHOLD)
+				rebuild();
+			else
+				updateIncremental();
+
+			for (u32 i = 0; i < Moved.size(); ++i)
+				Proxies[Moved[i]].Flags &= ~EPF_MOVED;
+
+			// handles are reused only after update, so reported pairs of
+			// removed objects are not confused with new objects
+			for (u32 i = 0; i < Removed.size(); ++i)
+			{
+				Proxies[Removed[i]].Flags = 0;
+				FreeHandles.pushBack(Removed[i]);
+			}
+
+			Added.setUsed(0);
+			Moved.setUsed(0);
+			Removed.setUsed(0);
+
+			flushPairs(outBegun, outEnded);
+
+			// temporary lists are not freed one by one
+			Scratch.reset();
+		}
+
+		//! Returns True if boxes of objects overlapped by last update
+		bool SweepAndPrune::isOverlapping(u32 first, u32 second) const
+		{
+			return Pairs.find(getPairKey(first, second)) != 0;
+		}
+
+		//! Returns count of pairs, which overlapped by last update
+		u32 SweepAndPrune::getPairsCount() const
+		{
+			return Pairs.size();
+		}
+
+		//! Removes all objects without reporting their pairs
+		void SweepAndPrune::clear()
+		{
+			Proxies.clear();
+			FreeHandles.clear();
+
+			Added.clear();
+			Moved.clear();
+			Removed.clear();
+
+			for (u32 axis = 0; axis < 3; ++axis)
+				Endpoints[axis].clear();
+
+			Pairs.clear();
+			ChangedPairs.clear();
+			Scratch.reset();
+
+			ObjectsCount = 0;
+		}
+
+		//! Returns True if objects overlap on axes other than axis
+		bool SweepAndPrune::overlapsOnOtherAxes(const SProxy& a,
+				const SProxy& b, u32 axis) const
+		{
+			const u32 first = axis == 0 ? 1 : 0;
+			const u32 second = axis == 2 ? 1 : 2;
+
+			// ends are compared by their order in lists. Result is rarely
+			// True, so it is evaluated without branches.
+			return (a.Ends[0][first] < b.Ends[1][first])
+					& (b.Ends[0][first] < a.Ends[1][first])
+					& (a.Ends[0][second] < b.Ends[1][second])
+					& (b.Ends[0][second] < a.Ends[1][second]);
+		}
+
+		//! Inserts, moves and removes objects one by one
+		void SweepAndPrune::updateIncremental()
+		{
+			if (Endpoints[0].empty())
+			{
+				for (u32 axis = 0; axis < 3; ++axis)
+				{
+					SEndpoint sentinel;
+					sentinel.Value = -core::SharedMath::MaxFloat;
+					sentinel.Data = 0;
+					Endpoints[axis].pushBack(sentinel);
+
+					sentinel.Value = core::SharedMath::MaxFloat;
+					sentinel.Data = 1;
+					Endpoints[axis].pushBack(sentinel);
+				}
+			}
+
+			// removed objects are moved behind all others, so all their
+			// pairs end, and their ends are cut from lists
+			for (u32 i = 0; i < Removed.size(); ++i)
+			{
+				const u32 handle = Removed[i];
+				SProxy& proxy = Proxies[handle];
+
+				if (!(proxy.Flags & EPF_INSERTED))
+					continue;
+
+				proxy.Box.reset(core::SharedMath::MaxFloat,
+						core::SharedMath::MaxFloat, core::SharedMath::MaxFloat);
+
+				moveProxy(handle);
+
+				for (u32 axis = 0; axis < 3; ++axis)
+				{
+					core::array<SEndpoint>& endpoints = Endpoints[axis];
+					const u32 size = endpoints.size();
+
+					endpoints[size - 3] = endpoints[size - 1];
+					endpoints.setUsed(size - 2);
+				}
+
+				proxy.Flags &= ~EPF_INSERTED;
+			}
+
+			for (u32 i = 0; i < Moved.size(); ++i)
+			{
+				if (!(Proxies[Moved[i]].Flags & EPF_REMOVED))
+					moveProxy(Moved[i]);
+			}
+
+			// added objects are put behind all others and moved to their box
+			for (u32 i = 0; i < Added.size(); ++i)
+			{
+				const u32 handle = Added[i];
+				SProxy& proxy = Proxies[handle];
+
+				if (proxy.Flags & EPF_REMOVED)
+					continue;
+
+				for (u32 axis = 0; axis < 3; ++axis)
+				{
+					core::array<SEndpoint>& endpoints = Endpoints[axis];
+					const u32 position = endpoints.size() - 1;
+					const SEndpoint sentinel = endpoints[position];
+
+					SEndpoint end;
+					end.Value = core::SharedMath::MaxFloat;
+					end.Data = handle << 1;
+					endpoints[position] = end;
+
+					end.Data |= 1;
+					endpoints.pushBack(end);
+					endpoints.pushBack(sentinel);
+
+					proxy.Ends[0][axis] = position;
+					proxy.Ends[1][axis] = position + 1;
+				}
+
+				proxy.Flags |= EPF_INSERTED;
+
+				moveProxy(handle);
+			}
+		}
+
+		//! Sorts Endpoints of all objects and finds overlapping pairs
+		//! from scratch
+		void SweepAndPrune::rebuild()
+		{
+			for (u32 i = 0; i < Removed.size(); ++i)
+				Proxies[Removed[i]].Flags &= ~EPF_INSERTED;
+
+			for (u32 i = 0; i < Added.size(); ++i)
+			{
+				if (!(Proxies[Added[i]].Flags & EPF_REMOVED))
+					Proxies[Added[i]].Flags |= EPF_INSERTED;
+			}
+
+			SProxy* proxies = Proxies.pointer();
+			const u32 proxiesCount = Proxies.size();
+
+			for (u32 axis = 0; axis < 3; ++axis)
+			{
+				core::array<SEndpoint>& endpoints = Endpoints[axis];
+				endpoints.setUsed(0);
+				endpoints.reallocate(ObjectsCount * 2 + 2);
+
+				SEndpoint end;
+				end.Value = -core::SharedMath::MaxFloat;
+				end.Data = 0;
+				endpoints.pushBack(end);
+
+				for (u32 handle = 0; handle < proxiesCount; ++handle)
+				{
+					const SProxy& proxy = proxies[handle];
+
+					if (!(proxy.Flags & EPF_INSERTED))
+						continue;
+
+					const core::vector3d<f32>& min = proxy.Box.MinEdge;
+					const core::vector3d<f32>& max = proxy.Box.MaxEdge;
+
+					end.Value = axis == 0 ? min.X : (axis == 1 ? min.Y : min.Z);
+					end.Data = handle << 1;
+					endpoints.pushBack(end);
+
+					end.Value = axis == 0 ? max.X : (axis == 1 ? max.Y : max.Z);
+					end.Data |= 1;
+					endpoints.pushBack(end);
+				}
+
+				end.Value = core::SharedMath::MaxFloat;
+				end.Data = 1;
+				endpoints.pushBack(end);
+
+				SEndpoint* sorted = endpoints.pointer();
+				const u32 size = endpoints.size();
+
+				core::SharedIntrosort<SEndpoint>::getInstance().sort(sorted + 1,
+						(s32) size - 2);
+
+				for (u32 i = 1; i + 1 < size; ++i)
+				{
+					const u32 data = sorted[i].Data;
+					proxies[data >> 1].Ends[data & 1][axis] = i;
+				}
+			}
+
+			// pairs, which do not overlap anymore, end
+			core::array<u64, threads::NullLock,
+					core::LinearArenaAllocator<u64> > keys(Scratch);
+			keys.reallocate(Pairs.size());
+
+			for (core::hashmap<u64, u8>::Iterator it = Pairs.getIterator();
+					!it.atEnd(); it++)
+				keys.pushBack(it->getKey());
+
+			for (u32 i = 0; i < keys.size(); ++i)
+			{
+				const u32 first = (u32) (keys[i] >> 32);
+				const u32 second = (u32) keys[i];
+
+				const SProxy& a = proxies[first];
+				const SProxy& b = proxies[second];
+
+				if (!(a.Flags & EPF_INSERTED) || !(b.Flags & EPF_INSERTED)
+						|| !(a.Ends[0][0] < b.Ends[1][0]
+								&& b.Ends[0][0] < a.Ends[1][0]
+								&& overlapsOnOtherAxes(a, b, 0)))
+					removePair(first, second);
+			}
+
+			// sweep along first axis, every object is tested with objects,
+			// which began and did not end before its minimum
+			const SEndpoint* endpoints = Endpoints[0].constPointer();
+			const u32 size = Endpoints[0].size();
+
+			core::array<u32, threads::NullLock,
+					core::LinearArenaAllocator<u32> > active(Scratch);
+			core::array<u32, threads::NullLock,
+					core::LinearArenaAllocator<u32> > activeIndices(Scratch);
+			activeIndices.setUsed(proxiesCount);
+
+			for (u32 i = 1; i + 1 < size; ++i)
+			{
+				const u32 handle = endpoints[i].Data >> 1;
+
+				if (endpoints[i].Data & 1)
+				{
+					const u32 last = active.getLast();
+					const u32 index = activeIndices[handle];
+
+					active[index] = last;
+					activeIndices[last] = index;
+					active.setUsed(active.size() - 1);
+
+					continue;
+				}
+
+				const SProxy& proxy = proxies[handle];
+
+				for (u32 j = 0; j < active.size(); ++j)
+				{
+					if (overlapsOnOtherAxes(proxy, proxies[active[j]], 0))
+						addPair(handle, active[j]);
+				}
+
+				activeIndices[handle] = active.size();
+				active.pushBack(handle);
+			}
+		}
+
+		//! Moves ends of object to edges of its box
+		void SweepAndPrune::moveProxy(u32 handle)
+		{
+			SProxy& proxy = Proxies[handle];
+
+			const f32 mins[3] =
+			{ proxy.Box.MinEdge.X, proxy.Box.MinEdge.Y, proxy.Box.MinEdge.Z };
+			const f32 maxs[3] =
+			{ proxy.Box.MaxEdge.X, proxy.Box.MaxEdge.Y, proxy.Box.MaxEdge.Z };
+
+			for (u32 axis = 0; axis < 3; ++axis)
+			{
+				SEndpoint* endpoints = Endpoints[axis].pointer();
+
+				SEndpoint& min = endpoints[proxy.Ends[0][axis]];
+				SEndpoint& max = endpoints[proxy.Ends[1][axis]];
+
+				const bool minDown = mins[axis] < min.Value;
+				const bool minUp = mins[axis] > min.Value;
+				const bool maxDown = maxs[axis] < max.Value;
+				const bool maxUp = maxs[axis] > max.Value;
+
+				min.Value = mins[axis];
+				max.Value = maxs[axis];
+
+				// growing ends are moved first, so minimum never passes own
+				// maximum
+				if (minDown)
+					sortDown(axis, proxy.Ends[0][axis]);
+
+				if (maxUp)
+					sortUp(axis, proxy.Ends[1][axis]);
+
+				if (minUp)
+					sortUp(axis, proxy.Ends[0][axis]);
+
+				if (maxDown)
+					sortDown(axis, proxy.Ends[1][axis]);
+			}
+		}
+
+		//! Moves end at index down, until it is sorted
+		void SweepAndPrune::sortDown(u32 axis, u32 index)
+		{
+			SEndpoint* endpoints = Endpoints[axis].pointer();
+			SProxy* proxies = Proxies.pointer();
+
+			const SEndpoint moving = endpoints[index];
+			const u32 handle = moving.Data >> 1;
+			const u32 isMax = moving.Data & 1;
+
+			SProxy& proxy = proxies[handle];
+
+			// first end is sentinel, which is never passed
+			SEndpoint* previous = endpoints + index - 1;
+
+			while (moving < *previous)
+			{
+				const u32 other = previous->Data >> 1;
+				const u32 isOtherMax = previous->Data & 1;
+
+				SProxy& otherProxy = proxies[other];
+
+				// minimum passes maximum, so objects begin to overlap on
+				// axis, maximum passes minimum, so they end
+				if ((isMax ^ isOtherMax)
+						& overlapsOnOtherAxes(proxy, otherProxy, axis))
+				{
+					if (isMax)
+						removePair(handle, other);
+					else
+						addPair(handle, other);
+				}
+
+				previous[1] = *previous;
+				++otherProxy.Ends[isOtherMax][axis];
+
+				--previous;
+			}
+
+			previous[1] = moving;
+			proxy.Ends[isMax][axis] = (u32) (previous + 1 - endpoints);
+		}
+
+		//! Moves end at index up, until it is sorted
+		void SweepAndPrune::sortUp(u32 axis, u32 index)
+		{
+			SEndpoint* endpoints = Endpoints[axis].pointer();
+			SProxy* proxies = Proxies.pointer();
+
+			const SEndpoint moving = endpoints[index];
+			const u32 handle = moving.Data >> 1;
+			const u32 isMax = moving.Data & 1;
+
+			SProxy& proxy = proxies[handle];
+
+			// last end is sentinel, which is never passed
+			SEndpoint* next = endpoints + index + 1;
+
+			while (*next < moving)
+			{
+				const u32 other = next->Data >> 1;
+				const u32 isOtherMax = next->Data & 1;
+
+				SProxy& otherProxy = proxies[other];
+
+				// maximum passes minimum, so objects begin to overlap on
+				// axis, minimum passes maximum, so they end
+				if ((isMax ^ isOtherMax)
+						& overlapsOnOtherAxes(proxy, otherProxy, axis))
+				{
+					if (isMax)
+						addPair(handle, other);
+					else
+						removePair(handle, other);
+				}
+
+				next[-1] = *next;
+				--otherProxy.Ends[isOtherMax][axis];
+
+				++next;
+			}
+
+			next[-1] = moving;
+			proxy.Ends[isMax][axis] = (u32) (next - 1 - endpoints);
+		}
+
+		//! Marks pair as overlapping
+		void SweepAndPrune::addPair(u32 first, u32 second)
+		{
+			const u64 key = getPairKey(first, second);
+
+			core::hashmap<u64, u8>::Node* node = Pairs.find(key);
+
+			if (node)
+			{
+				// pair which does not overlap is kept only until flush
+				node->getValue() |= EPS_OVERLAPPING;
+				return;
+			}
+
+			Pairs.insert(key, EPS_OVERLAPPING | EPS_CHANGED);
+			ChangedPairs.pushBack(key);
+		}
+
+		//! Marks pair as not overlapping
+		void SweepAndPrune::removePair(u32 first, u32 second)
+		{
+			const u64 key = getPairKey(first, second);
+
+			core::hashmap<u64, u8>::Node* node = Pairs.find(key);
+
+			if (!node)
+				return;
+
+			u8& state = node->getValue();
+
+			if (state & EPS_CHANGED)
+			{
+				state &= ~EPS_OVERLAPPING;
+				return;
+			}
+
+			state = EPS_WAS_OVERLAPPING | EPS_CHANGED;
+			ChangedPairs.pushBack(key);
+		}
+
+		//! Reports changed pairs and forgets pairs, which ended
+		void SweepAndPrune::flushPairs(core::array<SOverlapPair>& outBegun,
+				core::array<SOverlapPair>& outEnded)
+		{
+			for (u32 i = 0; i < ChangedPairs.size(); ++i)
+			{
+				const u64 key = ChangedPairs[i];
+
+				core::hashmap<u64, u8>::Node* node = Pairs.find(key);
+				const u8 state = node->getValue();
+
+				SOverlapPair pair;
+				pair.First = (u32) (key >> 32);
+				pair.Second = (u32) key;
+
+				if (state & EPS_OVERLAPPING)
+				{
+					if (!(state & EPS_WAS_OVERLAPPING))
+						outBegun.pushBack(pair);
+
+					node->getValue() = EPS_WAS_OVERLAPPING | EPS_OVERLAPPING;
+				}
+				else
+				{
+					if (state & EPS_WAS_OVERLAPPING)
+						outEnded.pushBack(pair);
+
+					Pairs.remove(key);
+				}
+			}
+
+			// memory of list is released by reset of Scratch
+			ChangedPairs.clear();
+		}
+
+	}  // namespace logic
+}  // namespace irrgame
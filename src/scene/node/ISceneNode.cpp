@@ -11,6 +11,26 @@ namespace irrgame
 {
 	namespace scene
 	{
+		//! Visitor which updates absolute transformations of nodes
+		struct SSceneNodeUpdater
+		{
+				bool operator()(ISceneNode* node)
+				{
+					node->updateAbsoluteTransformation();
+					return true;
+				}
+		};
+
+		//! Visitor which renders nodes
+		struct SSceneNodeRenderer
+		{
+				bool operator()(ISceneNode* node)
+				{
+					node->render();
+					return true;
+				}
+		};
+
 		//! Default constructor
 		ISceneNode::ISceneNode(ISceneNode* parent) :
 				core::ILeafNode<ISceneNode>(parent)
@@ -22,6 +42,20 @@ namespace irrgame
 		{
 		}
 
+		//! Updates absolute transformations of this node and all its descendants.
+		void ISceneNode::updateAbsoluteTransformations()
+		{
+			SSceneNodeUpdater updater;
+			traverse(updater);
+		}
+
+		//! Renders this node and all its descendants in depth-first order.
+		void ISceneNode::renderAll()
+		{
+			SSceneNodeRenderer renderer;
+			traverse(renderer);
+		}
+
 	}  // namespace scene
 
 }  // namespace irrgame
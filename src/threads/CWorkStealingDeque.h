@@ -0,0 +1,164 @@
+/*
+ * CWorkStealingDeque.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef CWORKSTEALINGDEQUE_H_
+#define CWORKSTEALINGDEQUE_H_
+
+#include "threads/irrgameAtomic.h"
+
+namespace irrgame
+{
+	namespace threads
+	{
+		//! Bounded lock-free work stealing deque (Chase-Lev).
+		//! Only owner thread may call push() and pop(). Any thread may call steal().
+		//! T must be a pointer type, 0 means "no element".
+		template<class T>
+		class CWorkStealingDeque
+		{
+			public:
+				//! Default constructor
+				//@ param0 - capacity, must be power of two
+				CWorkStealingDeque(u32 capacity = 4096);
+
+				//! Destructor
+				~CWorkStealingDeque();
+
+				//! Adds element to the bottom. Owner thread only.
+				//! Return False if deque is full.
+				bool push(T element);
+
+				//! Takes element from the bottom. Owner thread only.
+				//! Return 0 if deque is empty.
+				T pop();
+
+				//! Takes element from the top. Any thread.
+				//! Return 0 if deque is empty or other thread won the race.
+				T steal();
+
+				//! Return True if deque looks empty. Result may be outdated immediately.
+				bool empty() const;
+
+			private:
+
+				//! Copy constructor. Do not implement.
+				CWorkStealingDeque(const CWorkStealingDeque& other);
+
+				//! Override equal operator. Do not implement.
+				CWorkStealingDeque& operator=(const CWorkStealingDeque& other);
+
+			private:
+				T* Buffer;
+				s64 Mask;
+
+				//! Index of next element to steal
+				s64 Top;
+				//! Index of next element to push
+				s64 Bottom;
+		};
+
+		//! Default constructor
+		template<class T>
+		inline CWorkStealingDeque<T>::CWorkStealingDeque(u32 capacity) :
+				Buffer(0), Mask(capacity - 1), Top(0), Bottom(0)
+		{
+			// capacity must be power of two
+			IRR_ASSERT(capacity > 0 && (capacity & (capacity - 1)) == 0);
+
+			Buffer = new T[capacity];
+		}
+
+		//! Destructor
+		template<class T>
+		inline CWorkStealingDeque<T>::~CWorkStealingDeque()
+		{
+			delete[] Buffer;
+		}
+
+		//! Adds element to the bottom. Owner thread only.
+		template<class T>
+		inline bool CWorkStealingDeque<T>::push(T element)
+		{
+			s64 bottom = irrgameAtomic::loadRelaxed(&Bottom);
+			s64 top = irrgameAtomic::loadAcquire(&Top);
+
+			if (bottom - top > Mask)
+				return false;
+
+			irrgameAtomic::storeRelaxed(&Buffer[bottom & Mask], element);
+
+			// element must be visible before new bottom
+			irrgameAtomic::storeRelease(&Bottom, bottom + 1);
+
+			return true;
+		}
+
+		//! Takes element from the bottom. Owner thread only.
+		template<class T>
+		inline T CWorkStealingDeque<T>::pop()
+		{
+			s64 bottom = irrgameAtomic::loadRelaxed(&Bottom) - 1;
+			irrgameAtomic::storeRelaxed(&Bottom, bottom);
+
+			irrgameAtomic::fence();
+
+			s64 top = irrgameAtomic::loadRelaxed(&Top);
+
+			if (top > bottom)
+			{
+				// empty
+				irrgameAtomic::storeRelaxed(&Bottom, bottom + 1);
+				return 0;
+			}
+
+			T result = irrgameAtomic::loadRelaxed(&Buffer[bottom & Mask]);
+
+			if (top == bottom)
+			{
+				// last element, race with thieves
+				if (!irrgameAtomic::compareExchange(&Top, top, top + 1))
+					result = 0;
+
+				irrgameAtomic::storeRelaxed(&Bottom, bottom + 1);
+			}
+
+			return result;
+		}
+
+		//! Takes element from the top. Any thread.
+		template<class T>
+		inline T CWorkStealingDeque<T>::steal()
+		{
+			s64 top = irrgameAtomic::loadAcquire(&Top);
+
+			irrgameAtomic::fence();
+
+			s64 bottom = irrgameAtomic::loadAcquire(&Bottom);
+
+			if (top >= bottom)
+				return 0;
+
+			T result = irrgameAtomic::loadRelaxed(&Buffer[top & Mask]);
+
+			if (!irrgameAtomic::compareExchange(&Top, top, top + 1))
+				return 0;
+
+			return result;
+		}
+
+		//! Return True if deque looks empty.
+		template<class T>
+		inline bool CWorkStealingDeque<T>::empty() const
+		{
+			return irrgameAtomic::loadAcquire(&Bottom)
+					<= irrgameAtomic::loadAcquire(&Top);
+		}
+
+	}  // namespace threads
+}  // namespace irrgame
+
+#endif /* CWORKSTEALINGDEQUE_H_ */
@@ -0,0 +1,201 @@
+/*
+ * SharedJobPool.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#include "threads/SharedJobPool.h"
+#include "threads/irrgameThread.h"
+#include "threads/irrgameSemaphore.h"
+#include "threads/irrgameAtomic.h"
+
+namespace irrgame
+{
+	namespace threads
+	{
+		//! True if current thread proceed job bands. Nested jobs are not split.
+		static IRR_THREAD_LOCAL bool InsideJob = false;
+
+		//! Singleton realization
+		SharedJobPool& SharedJobPool::getInstance()
+		{
+			static SharedJobPool instance;
+			return instance;
+		}
+
+		//! Default constructor. Should use only one time.
+		SharedJobPool::SharedJobPool() :
+				Workers(0), WorkersCount(0), WorkerCallback(0), WakeUp(0), Done(0), Job(0), Context(0), Count(
+						0), BandSize(0), BandsCount(0), NextBand(0), IsRunning(0)
+		{
+			WakeUp = createIrrgameSemaphore();
+			Done = createIrrgameSemaphore();
+		}
+
+		//! Destructor. Should use only one time.
+		SharedJobPool::~SharedJobPool()
+		{
+			if (irrgameAtomic::exchange(&IsRunning, 0) != 0)
+			{
+				WakeUp->post(WorkersCount);
+
+				for (u32 i = 0; i < WorkersCount; ++i)
+				{
+					Workers[i]->join();
+					Workers[i]->drop();
+				}
+
+				delete[] Workers;
+
+				Workers = 0;
+				WorkersCount = 0;
+			}
+
+			if (WorkerCallback)
+				WorkerCallback->drop();
+
+			WakeUp->drop();
+			Done->drop();
+		}
+
+		//! Proceed [0; count) in parallel. Blocks until whole job is done.
+		void SharedJobPool::parallelFor(tParallelJob job, void* context,
+				u32 count, u32 minBandSize)
+		{
+			IRR_ASSERT(job != 0);
+
+			if (count == 0)
+				return;
+
+			if (minBandSize == 0)
+				minBandSize = 1;
+
+			// nested job. All threads are busy with outer one.
+			if (InsideJob)
+			{
+				job(context, 0, count);
+				return;
+			}
+
+			const u32 workers = getWorkersCount();
+
+			// few bands per thread, so fast threads help slow ones
+			u32 bandSize = count / ((workers + 1) * 4);
+
+			if (bandSize < minBandSize)
+				bandSize = minBandSize;
+
+			const u32 bandsCount = (count + bandSize - 1) / bandSize;
+
+			if (workers == 0 || bandsCount < 2)
+			{
+				job(context, 0, count);
+				return;
+			}
+
+			JobLock.enter();
+
+			Job = job;
+			Context = context;
+			Count = count;
+			BandSize = bandSize;
+			BandsCount = bandsCount;
+			NextBand = 0;
+
+			// calling thread takes one band too
+			const u32 helpers = workers < bandsCount - 1 ? workers : bandsCount - 1;
+
+			WakeUp->post(helpers);
+
+			InsideJob = true;
+			proceedBands();
+			InsideJob = false;
+
+			// workers must not touch job after it is replaced by next one
+			for (u32 i = 0; i < helpers; ++i)
+				Done->wait();
+
+			JobLock.exit();
+		}
+
+		//! Returns count of worker threads. Calling thread is not counted.
+		u32 SharedJobPool::getWorkersCount()
+		{
+			startWorkers();
+
+			return WorkersCount;
+		}
+
+		//! Creates worker threads if not created yet
+		void SharedJobPool::startWorkers()
+		{
+			if (irrgameAtomic::loadAcquire(&IsRunning) != 0)
+				return;
+
+			StartLock.enter();
+
+			if (IsRunning == 0)
+			{
+				const u32 processors = irrgameThread::getProcessorsCount();
+				const u32 count = processors > 1 ? processors - 1 : 0;
+
+				WorkerCallback = new delegateThreadCallback;
+				(*WorkerCallback) += NewDelegate(this,
+						&SharedJobPool::proceedWorker);
+
+				Workers = new irrgameThread*[count ? count : 1];
+
+				for (u32 i = 0; i < count; ++i)
+				{
+					irrgameThread* worker = createIrrgameThread(WorkerCallback,
+							0, ETP_NORMAL, "job worker");
+					worker->start();
+
+					Workers[WorkersCount++] = worker;
+				}
+
+				irrgameAtomic::storeRelease(&IsRunning, 1);
+			}
+
+			StartLock.exit();
+		}
+
+		//! Worker thread function
+		s32 SharedJobPool::proceedWorker(void*)
+		{
+			InsideJob = true;
+
+			while (true)
+			{
+				WakeUp->wait();
+
+				if (irrgameAtomic::loadAcquire(&IsRunning) == 0)
+					break;
+
+				proceedBands();
+
+				Done->post();
+			}
+
+			return 0;
+		}
+
+		//! Proceed bands of current job until all are taken
+		void SharedJobPool::proceedBands()
+		{
+			while (true)
+			{
+				const u32 band = irrgameAtomic::fetchAdd(&NextBand, 1u);
+
+				if (band >= BandsCount)
+					break;
+
+				const u32 begin = band * BandSize;
+				const u32 end = Count - begin < BandSize ? Count : begin + BandSize;
+
+				Job(Context, begin, end);
+			}
+		}
+	}  // namespace threads
+}  // namespace irrgame
@@ -6,6 +6,7 @@
  */
 
 #include "threads/irrgameThread.h"
+#include "core/allocator/SharedSlabAllocator.h"
 
 namespace irrgame
 {
@@ -29,6 +30,17 @@ namespace irrgame
 		{
 			return Name;
 		}
+
+		//! Runs callback, then releases caches of current thread.
+		s32 irrgameThread::proceedCallback()
+		{
+			const s32 result = (*Callback)(CallbackArg);
+
+			// blocks cached by exiting thread would be lost otherwise
+			core::SharedSlabAllocator::getInstance().flushThreadCache();
+
+			return result;
+		}
 	}
 }
 
@@ -9,6 +9,9 @@
 #include "video/image/IImage.h"
 #include "video/color/SharedColorConverter.h"
 #include "video/utils/SharedVideoUtils.h"
+#include "core/utils/SharedCPUFeatures.h"
+#include "threads/SharedJobPool.h"
+#include "blitSIMD.h"
 #include "blitterTable.h"
 
 //for memcpy
@@ -145,7 +148,7 @@ namespace irrgame
 		 return alpha in [0;256] Granularity from 32-Bit ARGB
 		 add highbit alpha ( alpha > 127 ? + 1 )
 		 */
-		inline u32 extractAlpha(const u32 c)
+		u32 extractAlpha(const u32 c)
 		{
 			return (c >> 24) + (c >> 31);
 		}
@@ -751,14 +754,25 @@ namespace irrgame
 			}
 		}
 
-		inline tExecuteBlit getBlitter2(eBlitter operation,
-				const video::IImage * dest, const video::IImage * source)
+		//! Returns fastest version of blitter supported by current processor
+		inline tExecuteBlit selectBlitter(const blitterTable * b)
 		{
-			video::EColorFormat sourceFormat = (video::EColorFormat) (
-					source ? source->getColorFormat() : -1);
-			video::EColorFormat destFormat = (video::EColorFormat) (
-					dest ? dest->getColorFormat() : -1);
+			const core::SharedCPUFeatures& cpu =
+					core::SharedCPUFeatures::getInstance();
+
+			if (b->funcAVX2 && cpu.hasAVX2())
+				return b->funcAVX2;
+
+			if (b->funcSSE2 && cpu.hasSSE2())
+				return b->funcSSE2;
+
+			return b->func;
+		}
 
+		//! Linear search in blitTable. -1 format means no image.
+		tExecuteBlit findBlitter(eBlitter operation, s32 destFormat,
+				s32 sourceFormat)
+		{
 			const blitterTable * b = blitTable;
 
 			while (b->operation != BLITTER_INVALID)
@@ -768,16 +782,99 @@ namespace irrgame
 					if ((b->destFormat == -1 || b->destFormat == destFormat)
 							&& (b->sourceFormat == -1
 									|| b->sourceFormat == sourceFormat))
-						return b->func;
+						return selectBlitter(b);
 					else if (b->destFormat == -2
 							&& (sourceFormat == destFormat))
-						return b->func;
+						return selectBlitter(b);
 				}
 				b += 1;
 			}
 			return 0;
 		}
 
+		//! Singleton realization
+		const SBlitterDispatchTable& SBlitterDispatchTable::getInstance()
+		{
+			static const SBlitterDispatchTable instance;
+			return instance;
+		}
+
+		//! Default constructor. Resolves every combination with findBlitter.
+		SBlitterDispatchTable::SBlitterDispatchTable()
+		{
+			for (s32 operation = 0; operation != BLITTER_COUNT; ++operation)
+			{
+				for (s32 dest = 0; dest <= ECF_COUNT; ++dest)
+				{
+					for (s32 source = 0; source <= ECF_COUNT; ++source)
+					{
+						Blitters[operation][dest][source] = findBlitter(
+								(eBlitter) operation,
+								dest == ECF_COUNT ? -1 : dest,
+								source == ECF_COUNT ? -1 : source);
+					}
+				}
+			}
+		}
+
+		//! Index of image format in SBlitterDispatchTable
+		inline s32 getDispatchFormat(const video::IImage * image)
+		{
+			if (!image)
+				return ECF_COUNT;
+
+			const s32 format = image->getColorFormat();
+
+			IRR_ASSERT(format >= 0 && format < ECF_COUNT);
+
+			return format;
+		}
+
+		inline tExecuteBlit getBlitter2(eBlitter operation,
+				const video::IImage * dest, const video::IImage * source)
+		{
+			IRR_ASSERT(operation >= 0 && operation < BLITTER_COUNT);
+
+			const s32 destFormat = getDispatchFormat(dest);
+			const s32 sourceFormat = getDispatchFormat(source);
+
+			const SBlitterDispatchTable& table =
+					SBlitterDispatchTable::getInstance();
+
+			return table.Blitters[operation][destFormat][sourceFormat];
+		}
+
+		//! Same as SharedMath::s32Clamp. Inlined, because it is used per sprite
+		inline s32 clampBlit(s32 value, s32 low, s32 high)
+		{
+			if (value < low)
+				value = low;
+
+			return value > high ? high : value;
+		}
+
+		//! Same as SharedVideoUtils::intersect. Inlined, because it is used per sprite
+		inline bool intersectBlit(AbsRectangle &dest, const AbsRectangle& a,
+				const AbsRectangle& b)
+		{
+			dest.x0 = a.x0 > b.x0 ? a.x0 : b.x0;
+			dest.y0 = a.y0 > b.y0 ? a.y0 : b.y0;
+			dest.x1 = a.x1 < b.x1 ? a.x1 : b.x1;
+			dest.y1 = a.y1 < b.y1 ? a.y1 : b.y1;
+
+			return dest.x0 < dest.x1 && dest.y0 < dest.y1;
+		}
+
+		//! Clamps rectangle to image with given size
+		inline void clampToImage(AbsRectangle &out, const AbsRectangle& rect,
+				s32 w, s32 h)
+		{
+			out.x0 = clampBlit(rect.x0, 0, w);
+			out.x1 = clampBlit(rect.x1, out.x0, w);
+			out.y0 = clampBlit(rect.y0, 0, h);
+			out.y1 = clampBlit(rect.y1, out.y0, h);
+		}
+
 		// bounce clipping to texture
 		inline void setClip(AbsRectangle &out, const recti *clip,
 				const IImage * tex, s32 passnative)
@@ -795,14 +892,13 @@ namespace irrgame
 			const s32 h = tex ? tex->getDimension().Height : 0;
 			if (clip)
 			{
-				out.x0 = core::SharedMath::getInstance().s32Clamp(
-						clip->UpperLeftCorner.X, 0, w);
-				out.x1 = core::SharedMath::getInstance().s32Clamp(
-						clip->LowerRightCorner.X, out.x0, w);
-				out.y0 = core::SharedMath::getInstance().s32Clamp(
-						clip->UpperLeftCorner.Y, 0, h);
-				out.y1 = core::SharedMath::getInstance().s32Clamp(
-						clip->LowerRightCorner.Y, out.y0, h);
+				AbsRectangle rect;
+				rect.x0 = clip->UpperLeftCorner.X;
+				rect.x1 = clip->LowerRightCorner.X;
+				rect.y0 = clip->UpperLeftCorner.Y;
+				rect.y1 = clip->LowerRightCorner.Y;
+
+				clampToImage(out, rect, w, h);
 			}
 			else
 			{
@@ -814,6 +910,101 @@ namespace irrgame
 
 		}
 
+		//! Minimal count of pixels of parallel blit
+		static u32 ParallelBlitThreshold = IRR_PARALLEL_BLIT_THRESHOLD;
+
+		//! Sets minimal count of pixels in blit or image scaling, which is
+		//! split into row bands and proceed in parallel. 0 - always parallel.
+		void setParallelBlitThreshold(u32 pixels)
+		{
+			ParallelBlitThreshold = pixels;
+		}
+
+		//! Returns minimal count of pixels of parallel blit
+		u32 getParallelBlitThreshold()
+		{
+			return ParallelBlitThreshold;
+		}
+
+		//! Returns minimal count of rows in one band of parallel blit
+		u32 getParallelBlitBandRows(u32 width)
+		{
+			const u32 rows = width ? IRR_PARALLEL_BLIT_BAND_PIXELS / width : 0;
+
+			return rows ? rows : 1;
+		}
+
+		//! Context of parallel blit
+		struct SBlitBands
+		{
+			public:
+				tExecuteBlit Blitter;
+				const SBlitJob* Job;
+		};
+
+		//! Executes rows [begin; end) of blit job
+		void executeBlitBands(void* context, u32 begin, u32 end)
+		{
+			const SBlitBands* bands = (const SBlitBands*) context;
+
+			SBlitJob job = *bands->Job;
+
+			if (job.src)
+				job.src = (void*) ((u8*) job.src + begin * job.srcPitch);
+
+			job.dst = (void*) ((u8*) job.dst + begin * job.dstPitch);
+			job.height = end - begin;
+
+			bands->Blitter(&job);
+		}
+
+		//! Executes blitter. Large jobs are split into row bands proceed in parallel.
+		void executeBlit(tExecuteBlit blitter, const SBlitJob& job)
+		{
+			if ((u32) (job.width * job.height) < ParallelBlitThreshold
+					|| job.height < 2)
+			{
+				blitter(&job);
+				return;
+			}
+
+			SBlitBands bands;
+			bands.Blitter = blitter;
+			bands.Job = &job;
+
+			threads::SharedJobPool::getInstance().parallelFor(executeBlitBands,
+					&bands, job.height, getParallelBlitBandRows(job.width));
+		}
+
+		/*!
+		 Clips job to dest and computes its size and source rectangle.
+		 @return: false if nothing to blit
+		 */
+		inline bool clipBlitJob(SBlitJob& job, const AbsRectangle& destClip,
+				const AbsRectangle& sourceClip, s32 destX, s32 destY)
+		{
+			AbsRectangle v;
+
+			v.x0 = destX;
+			v.y0 = destY;
+			v.x1 = v.x0 + (sourceClip.x1 - sourceClip.x0);
+			v.y1 = v.y0 + (sourceClip.y1 - sourceClip.y0);
+
+			if (!intersectBlit(job.Dest, destClip, v))
+				return false;
+
+			job.width = job.Dest.x1 - job.Dest.x0;
+			job.height = job.Dest.y1 - job.Dest.y0;
+
+			job.Source.x0 = sourceClip.x0 + (job.Dest.x0 - v.x0);
+			job.Source.x1 = job.Source.x0 + job.width;
+
+			job.Source.y0 = sourceClip.y0 + (job.Dest.y0 - v.y0);
+			job.Source.y1 = job.Source.y0 + job.height;
+
+			return true;
+		}
+
 		/*!
 		 a generic 2D Blitter
 		 */
@@ -830,31 +1021,16 @@ namespace irrgame
 			// Clipping
 			AbsRectangle sourceClip;
 			AbsRectangle destClip;
-			AbsRectangle v;
 
 			SBlitJob job;
 
 			setClip(sourceClip, sourceClipping, source, 1);
 			setClip(destClip, destClipping, dest, 0);
 
-			v.x0 = destPos ? destPos->X : 0;
-			v.y0 = destPos ? destPos->Y : 0;
-			v.x1 = v.x0 + (sourceClip.x1 - sourceClip.x0);
-			v.y1 = v.y0 + (sourceClip.y1 - sourceClip.y0);
-
-			if (!SharedVideoUtils::getInstance().intersect(job.Dest, destClip,
-					v))
+			if (!clipBlitJob(job, destClip, sourceClip,
+					destPos ? destPos->X : 0, destPos ? destPos->Y : 0))
 				return 0;
 
-			job.width = job.Dest.x1 - job.Dest.x0;
-			job.height = job.Dest.y1 - job.Dest.y0;
-
-			job.Source.x0 = sourceClip.x0 + (job.Dest.x0 - v.x0);
-			job.Source.x1 = job.Source.x0 + job.width;
-
-			job.Source.y0 = sourceClip.y0 + (job.Dest.y0 - v.y0);
-			job.Source.y1 = job.Source.y0 + job.height;
-
 			job.argb = argb;
 
 			if (source)
@@ -869,6 +1045,7 @@ namespace irrgame
 			{
 				// use srcPitch for color operation on dest
 				job.srcPitch = job.width * dest->getBytesPerPixel();
+				job.src = 0;
 			}
 
 			job.dstPitch = dest->getPitch();
@@ -876,7 +1053,7 @@ namespace irrgame
 			job.dst = (void*) ((u8*) dest->lock() + (job.Dest.y0 * job.dstPitch)
 					+ (job.Dest.x0 * job.dstPixelMul));
 
-			blitter(&job);
+			executeBlit(blitter, job);
 
 			if (source)
 				source->unlock();
@@ -886,6 +1063,85 @@ namespace irrgame
 
 			return 1;
 		}
+
+		/*!
+		 a batched 2D Blitter
+		 */
+		s32 Blit(eBlitter operation, IImage * dest, const recti *destClipping,
+				IImage * const source, const SBlitJob * jobs, u32 count)
+		{
+			tExecuteBlit blitter = getBlitter2(operation, dest, source);
+			if (0 == blitter || 0 == count)
+			{
+				return 0;
+			}
+
+			AbsRectangle destClip;
+			setClip(destClip, destClipping, dest, 0);
+
+			const s32 sourceWidth = source ? source->getDimension().Width : 0;
+			const s32 sourceHeight = source ? source->getDimension().Height : 0;
+
+			const u32 srcPitch = source ? source->getPitch() : 0;
+			const u32 srcPixelMul = source ? source->getBytesPerPixel() : 0;
+			u8 * srcBase = source ? (u8*) source->lock() : 0;
+
+			const u32 dstPitch = dest->getPitch();
+			const u32 dstPixelMul = dest->getBytesPerPixel();
+			u8 * dstBase = (u8*) dest->lock();
+
+			s32 result = 0;
+
+			SBlitJob job;
+			AbsRectangle sourceClip;
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				const SBlitJob& request = jobs[i];
+
+				if (source)
+					clampToImage(sourceClip, request.Source, sourceWidth,
+							sourceHeight);
+				else
+					sourceClip = request.Source;
+
+				if (!clipBlitJob(job, destClip, sourceClip, request.Dest.x0,
+						request.Dest.y0))
+					continue;
+
+				job.argb = request.argb;
+
+				if (source)
+				{
+					job.srcPitch = srcPitch;
+					job.srcPixelMul = srcPixelMul;
+					job.src = (void*) (srcBase + (job.Source.y0 * srcPitch)
+							+ (job.Source.x0 * srcPixelMul));
+				}
+				else
+				{
+					// use srcPitch for color operation on dest
+					job.srcPitch = job.width * dstPixelMul;
+					job.src = 0;
+				}
+
+				job.dstPitch = dstPitch;
+				job.dstPixelMul = dstPixelMul;
+				job.dst = (void*) (dstBase + (job.Dest.y0 * dstPitch)
+						+ (job.Dest.x0 * dstPixelMul));
+
+				executeBlit(blitter, job);
+
+				result += 1;
+			}
+
+			if (source)
+				source->unlock();
+
+			dest->unlock();
+
+			return result;
+		}
 	}  // namespace video
 }  // namespace irrgame
 
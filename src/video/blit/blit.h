@@ -94,6 +94,19 @@ namespace irrgame
 
 		void executeBlit_ColorAlpha_32_to_32(const SBlitJob * job);
 
+		//! Sets minimal count of pixels in blit or image scaling, which is
+		//! split into row bands and proceed in parallel. 0 - always parallel.
+		void setParallelBlitThreshold(u32 pixels);
+
+		//! Returns minimal count of pixels of parallel blit
+		u32 getParallelBlitThreshold();
+
+		//! Returns minimal count of rows in one band of parallel blit
+		u32 getParallelBlitBandRows(u32 width);
+
+		//! Executes blitter. Large jobs are split into row bands proceed in parallel.
+		void executeBlit(tExecuteBlit blitter, const SBlitJob& job);
+
 		tExecuteBlit getBlitter2(eBlitter operation, const video::IImage * dest,
 				const video::IImage * source);
 
@@ -108,6 +121,16 @@ namespace irrgame
 				const vector2di *destPos, IImage * const source,
 				const recti *sourceClipping, u32 argb);
 
+		/*!
+		 a batched 2D Blitter. Dispatch, dest clipping and locking are done
+		 once for all jobs. For each job set Source - rectangle in source
+		 image (or rectangle to fill for color operations), Dest.x0 and Dest.y0 -
+		 position in dest and argb. Other fields are ignored.
+		 @return: count of executed jobs
+		 */
+		s32 Blit(eBlitter operation, IImage * dest, const recti *destClipping,
+				IImage * const source, const SBlitJob * jobs, u32 count);
+
 	}  // namespace video
 }  // namespace irrgame
 
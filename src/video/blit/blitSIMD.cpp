@@ -0,0 +1,1013 @@
+/*
+ * blitSIMD.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#include "blitSIMD.h"
+
+#if defined(IRR_SIMD_BLITTERS) && defined(IRR_X86_SIMD)
+
+#include "video/color/SharedColorConverter.h"
+#include "video/utils/SharedVideoUtils.h"
+#include "core/math/SharedMath.h"
+
+#include <immintrin.h>
+
+//for memcpy
+#include "string.h"
+
+/*
+ * Kernels are compiled for their instruction set with target attribute,
+ * so whole engine is not required to be built with -mavx2.
+ */
+#define IRR_TARGET_SSE2 __attribute__((target("sse2")))
+#define IRR_TARGET_AVX2 __attribute__((target("avx2")))
+
+namespace irrgame
+{
+	namespace video
+	{
+		/*
+		 * Common helpers
+		 */
+
+		//! Same as extractAlpha from blit.cpp. Alpha in [0;256]
+		inline u32 extractAlphaSIMD(const u32 c)
+		{
+			return (c >> 24) + (c >> 31);
+		}
+
+		//! Unaligned load of 4 bytes
+		inline u32 loadU32(const u8* p)
+		{
+			u32 result;
+			memcpy(&result, p, sizeof(u32));
+			return result;
+		}
+
+		/*
+		 * SSE2 helpers
+		 */
+
+		/*!
+		 Per channel blend of 16 bit lanes with alpha in [0;256]:
+		 Pixel = ( dest * ( 256 - alpha ) + source * alpha ) >> 8
+		 Same result as PixelBlend32. Sum is never greater than 255 * 256.
+		 */
+		IRR_TARGET_SSE2 inline __m128i blendChannels_SSE2(const __m128i d,
+				const __m128i s, const __m128i alpha)
+		{
+			const __m128i invAlpha = _mm_sub_epi16(_mm_set1_epi16(256), alpha);
+
+			return _mm_srli_epi16(
+					_mm_add_epi16(_mm_mullo_epi16(s, alpha),
+							_mm_mullo_epi16(d, invAlpha)), 8);
+		}
+
+		//! Alpha of each pixel in all 4 lanes with highbit added. Same as extractAlpha
+		IRR_TARGET_SSE2 inline __m128i broadcastAlpha_SSE2(const __m128i s)
+		{
+			const __m128i alpha = _mm_shufflehi_epi16(
+					_mm_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)),
+					_MM_SHUFFLE(3, 3, 3, 3));
+
+			return _mm_add_epi16(alpha, _mm_srli_epi16(alpha, 7));
+		}
+
+		//! 4 pixels of PixelBlend32(dest, source)
+		IRR_TARGET_SSE2 inline __m128i pixelBlend32_SSE2(const __m128i d,
+				const __m128i s)
+		{
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i alphaMask = _mm_set1_epi32(0xFF000000);
+
+			const __m128i sLow = _mm_unpacklo_epi8(s, zero);
+			const __m128i sHigh = _mm_unpackhi_epi8(s, zero);
+
+			const __m128i low = blendChannels_SSE2(_mm_unpacklo_epi8(d, zero),
+					sLow, broadcastAlpha_SSE2(sLow));
+			const __m128i high = blendChannels_SSE2(_mm_unpackhi_epi8(d, zero),
+					sHigh, broadcastAlpha_SSE2(sHigh));
+
+			const __m128i sourceAlpha = _mm_and_si128(s, alphaMask);
+
+			const __m128i blended = _mm_or_si128(
+					_mm_andnot_si128(alphaMask, _mm_packus_epi16(low, high)),
+					sourceAlpha);
+
+			// fully transparent source keeps dest untouched
+			const __m128i transparent = _mm_cmpeq_epi32(sourceAlpha, zero);
+
+			return _mm_or_si128(_mm_and_si128(transparent, d),
+					_mm_andnot_si128(transparent, blended));
+		}
+
+		//! 4 pixels of PixelMul32_2(source, color). color16 - color in 16 bit lanes
+		IRR_TARGET_SSE2 inline __m128i pixelMul32_SSE2(const __m128i s,
+				const __m128i color16)
+		{
+			const __m128i zero = _mm_setzero_si128();
+
+			const __m128i low = _mm_srli_epi16(
+					_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), color16), 8);
+			const __m128i high = _mm_srli_epi16(
+					_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), color16), 8);
+
+			return _mm_packus_epi16(low, high);
+		}
+
+		//! a more useful memset for pixel. Writes count of u32 values
+		IRR_TARGET_SSE2 inline void fill32_SSE2(u32* dst, const u32 value,
+				u32 count)
+		{
+			const __m128i v = _mm_set1_epi32(value);
+
+			while (count >= 4)
+			{
+				_mm_storeu_si128((__m128i *) dst, v);
+				dst += 4;
+				count -= 4;
+			}
+
+			while (count)
+			{
+				*dst++ = value;
+				count -= 1;
+			}
+		}
+
+		/*
+		 * AVX2 helpers. Same as SSE2 ones, but for 8 pixels.
+		 */
+
+		IRR_TARGET_AVX2 inline __m256i blendChannels_AVX2(const __m256i d,
+				const __m256i s, const __m256i alpha)
+		{
+			const __m256i invAlpha = _mm256_sub_epi16(_mm256_set1_epi16(256),
+					alpha);
+
+			return _mm256_srli_epi16(
+					_mm256_add_epi16(_mm256_mullo_epi16(s, alpha),
+							_mm256_mullo_epi16(d, invAlpha)), 8);
+		}
+
+		IRR_TARGET_AVX2 inline __m256i broadcastAlpha_AVX2(const __m256i s)
+		{
+			const __m256i alpha = _mm256_shufflehi_epi16(
+					_mm256_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)),
+					_MM_SHUFFLE(3, 3, 3, 3));
+
+			return _mm256_add_epi16(alpha, _mm256_srli_epi16(alpha, 7));
+		}
+
+		IRR_TARGET_AVX2 inline __m256i pixelBlend32_AVX2(const __m256i d,
+				const __m256i s)
+		{
+			const __m256i zero = _mm256_setzero_si256();
+			const __m256i alphaMask = _mm256_set1_epi32(0xFF000000);
+
+			const __m256i sLow = _mm256_unpacklo_epi8(s, zero);
+			const __m256i sHigh = _mm256_unpackhi_epi8(s, zero);
+
+			const __m256i low = blendChannels_AVX2(
+					_mm256_unpacklo_epi8(d, zero), sLow,
+					broadcastAlpha_AVX2(sLow));
+			const __m256i high = blendChannels_AVX2(
+					_mm256_unpackhi_epi8(d, zero), sHigh,
+					broadcastAlpha_AVX2(sHigh));
+
+			const __m256i sourceAlpha = _mm256_and_si256(s, alphaMask);
+
+			const __m256i blended = _mm256_or_si256(
+					_mm256_andnot_si256(alphaMask,
+							_mm256_packus_epi16(low, high)), sourceAlpha);
+
+			const __m256i transparent = _mm256_cmpeq_epi32(sourceAlpha, zero);
+
+			return _mm256_blendv_epi8(blended, d, transparent);
+		}
+
+		IRR_TARGET_AVX2 inline __m256i pixelMul32_AVX2(const __m256i s,
+				const __m256i color16)
+		{
+			const __m256i zero = _mm256_setzero_si256();
+
+			const __m256i low = _mm256_srli_epi16(
+					_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), color16),
+					8);
+			const __m256i high = _mm256_srli_epi16(
+					_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), color16),
+					8);
+
+			return _mm256_packus_epi16(low, high);
+		}
+
+		IRR_TARGET_AVX2 inline void fill32_AVX2(u32* dst, const u32 value,
+				u32 count)
+		{
+			const __m256i v = _mm256_set1_epi32(value);
+
+			while (count >= 8)
+			{
+				_mm256_storeu_si256((__m256i *) dst, v);
+				dst += 8;
+				count -= 8;
+			}
+
+			while (count)
+			{
+				*dst++ = value;
+				count -= 1;
+			}
+		}
+
+		/*
+		 * 16 bit helpers. Channels of A1R5G5B5 are processed in separate 16 bit lanes.
+		 */
+
+		/*!
+		 Pixel = dest * ( 1 - alpha ) + source * alpha
+		 alpha [0;32]. Alpha bit of result is cleared. Same as PixelBlend16
+		 */
+		IRR_TARGET_SSE2 inline __m128i pixelBlend16_SSE2(const __m128i d,
+				const __m128i s, const __m128i alpha)
+		{
+			const __m128i mask = _mm_set1_epi16(0x1F);
+			const __m128i invAlpha = _mm_sub_epi16(_mm_set1_epi16(32), alpha);
+
+			const __m128i r = _mm_srli_epi16(
+					_mm_add_epi16(
+							_mm_mullo_epi16(
+									_mm_and_si128(_mm_srli_epi16(s, 10), mask),
+									alpha),
+							_mm_mullo_epi16(
+									_mm_and_si128(_mm_srli_epi16(d, 10), mask),
+									invAlpha)), 5);
+			const __m128i g = _mm_srli_epi16(
+					_mm_add_epi16(
+							_mm_mullo_epi16(
+									_mm_and_si128(_mm_srli_epi16(s, 5), mask),
+									alpha),
+							_mm_mullo_epi16(
+									_mm_and_si128(_mm_srli_epi16(d, 5), mask),
+									invAlpha)), 5);
+			const __m128i b = _mm_srli_epi16(
+					_mm_add_epi16(
+							_mm_mullo_epi16(_mm_and_si128(s, mask), alpha),
+							_mm_mullo_epi16(_mm_and_si128(d, mask), invAlpha)),
+					5);
+
+			return _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 10),
+					_mm_slli_epi16(g, 5)), b);
+		}
+
+		//! Pixel = c0 * (c1/31). Same as PixelMul16_2
+		IRR_TARGET_SSE2 inline __m128i pixelMul16_SSE2(const __m128i c0,
+				const __m128i c1)
+		{
+			const __m128i mask = _mm_set1_epi16(0x1F);
+
+			const __m128i r = _mm_srli_epi16(
+					_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(c0, 10), mask),
+							_mm_and_si128(_mm_srli_epi16(c1, 10), mask)), 5);
+			const __m128i g = _mm_srli_epi16(
+					_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(c0, 5), mask),
+							_mm_and_si128(_mm_srli_epi16(c1, 5), mask)), 5);
+			const __m128i b = _mm_srli_epi16(
+					_mm_mullo_epi16(_mm_and_si128(c0, mask),
+							_mm_and_si128(c1, mask)), 5);
+
+			const __m128i a = _mm_and_si128(_mm_and_si128(c0, c1),
+					_mm_set1_epi16((s16) 0x8000));
+
+			return _mm_or_si128(
+					_mm_or_si128(_mm_slli_epi16(r, 10), _mm_slli_epi16(g, 5)),
+					_mm_or_si128(b, a));
+		}
+
+		IRR_TARGET_AVX2 inline __m256i pixelBlend16_AVX2(const __m256i d,
+				const __m256i s, const __m256i alpha)
+		{
+			const __m256i mask = _mm256_set1_epi16(0x1F);
+			const __m256i invAlpha = _mm256_sub_epi16(_mm256_set1_epi16(32),
+					alpha);
+
+			const __m256i r = _mm256_srli_epi16(
+					_mm256_add_epi16(
+							_mm256_mullo_epi16(
+									_mm256_and_si256(_mm256_srli_epi16(s, 10),
+											mask), alpha),
+							_mm256_mullo_epi16(
+									_mm256_and_si256(_mm256_srli_epi16(d, 10),
+											mask), invAlpha)), 5);
+			const __m256i g = _mm256_srli_epi16(
+					_mm256_add_epi16(
+							_mm256_mullo_epi16(
+									_mm256_and_si256(_mm256_srli_epi16(s, 5),
+											mask), alpha),
+							_mm256_mullo_epi16(
+									_mm256_and_si256(_mm256_srli_epi16(d, 5),
+											mask), invAlpha)), 5);
+			const __m256i b = _mm256_srli_epi16(
+					_mm256_add_epi16(
+							_mm256_mullo_epi16(_mm256_and_si256(s, mask),
+									alpha),
+							_mm256_mullo_epi16(_mm256_and_si256(d, mask),
+									invAlpha)), 5);
+
+			return _mm256_or_si256(
+					_mm256_or_si256(_mm256_slli_epi16(r, 10),
+							_mm256_slli_epi16(g, 5)), b);
+		}
+
+		IRR_TARGET_AVX2 inline __m256i pixelMul16_AVX2(const __m256i c0,
+				const __m256i c1)
+		{
+			const __m256i mask = _mm256_set1_epi16(0x1F);
+
+			const __m256i r = _mm256_srli_epi16(
+					_mm256_mullo_epi16(
+							_mm256_and_si256(_mm256_srli_epi16(c0, 10), mask),
+							_mm256_and_si256(_mm256_srli_epi16(c1, 10), mask)),
+					5);
+			const __m256i g = _mm256_srli_epi16(
+					_mm256_mullo_epi16(
+							_mm256_and_si256(_mm256_srli_epi16(c0, 5), mask),
+							_mm256_and_si256(_mm256_srli_epi16(c1, 5), mask)),
+					5);
+			const __m256i b = _mm256_srli_epi16(
+					_mm256_mullo_epi16(_mm256_and_si256(c0, mask),
+							_mm256_and_si256(c1, mask)), 5);
+
+			const __m256i a = _mm256_and_si256(_mm256_and_si256(c0, c1),
+					_mm256_set1_epi16((s16) 0x8000));
+
+			return _mm256_or_si256(
+					_mm256_or_si256(_mm256_slli_epi16(r, 10),
+							_mm256_slli_epi16(g, 5)), _mm256_or_si256(b, a));
+		}
+
+		/*
+		 * Blitters
+		 */
+
+		IRR_TARGET_SSE2 void executeBlit_TextureCopy_24_to_32_SSE2(
+				const SBlitJob * job)
+		{
+			const u8 *src = (u8*) job->src;
+			u32 *dst = (u32*) job->dst;
+
+			const __m128i lowMask = _mm_set1_epi32(0x000000FF);
+			const __m128i middleMask = _mm_set1_epi32(0x0000FF00);
+			const __m128i alpha = _mm_set1_epi32(0xFF000000);
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				// last load reads one byte after 4 pixels, so keep one pixel in reserve
+				for (; dx + 5 <= job->width; dx += 4)
+				{
+					const u8 * s = src + dx * 3;
+
+					const __m128i v = _mm_set_epi32(loadU32(s + 9),
+							loadU32(s + 6), loadU32(s + 3), loadU32(s));
+
+					// swap first and third byte, set alpha
+					const __m128i result = _mm_or_si128(
+							_mm_or_si128(
+									_mm_slli_epi32(_mm_and_si128(v, lowMask),
+											16), _mm_and_si128(v, middleMask)),
+							_mm_or_si128(
+									_mm_and_si128(_mm_srli_epi32(v, 16),
+											lowMask), alpha));
+
+					_mm_storeu_si128((__m128i *) (dst + dx), result);
+				}
+
+				for (; dx != job->width; ++dx)
+				{
+					const u8 * s = src + dx * 3;
+					dst[dx] = 0xFF000000 | s[0] << 16 | s[1] << 8 | s[2];
+				}
+
+				src += job->srcPitch;
+				dst = (u32*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_AVX2 void executeBlit_TextureCopy_24_to_32_AVX2(
+				const SBlitJob * job)
+		{
+			const u8 *src = (u8*) job->src;
+			u32 *dst = (u32*) job->dst;
+
+			// 4 pixels in each 128 bit lane: BGR order to ARGB word
+			const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1,
+					8, 7, 6, -1, 11, 10, 9, -1, 2, 1, 0, -1, 5, 4, 3, -1, 8, 7,
+					6, -1, 11, 10, 9, -1);
+			const __m256i alpha = _mm256_set1_epi32(0xFF000000);
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				// second load reads 4 bytes after 8 pixels
+				for (; dx + 10 <= job->width; dx += 8)
+				{
+					const u8 * s = src + dx * 3;
+
+					const __m256i v = _mm256_inserti128_si256(
+							_mm256_castsi128_si256(
+									_mm_loadu_si128((const __m128i *) s)),
+							_mm_loadu_si128((const __m128i *) (s + 12)), 1);
+
+					_mm256_storeu_si256((__m256i *) (dst + dx),
+							_mm256_or_si256(_mm256_shuffle_epi8(v, shuffle),
+									alpha));
+				}
+
+				for (; dx != job->width; ++dx)
+				{
+					const u8 * s = src + dx * 3;
+					dst[dx] = 0xFF000000 | s[0] << 16 | s[1] << 8 | s[2];
+				}
+
+				src += job->srcPitch;
+				dst = (u32*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_SSE2 void executeBlit_TextureBlend_16_to_16_SSE2(
+				const SBlitJob * job)
+		{
+			u16 *src = (u16*) job->src;
+			u16 *dst = (u16*) job->dst;
+
+			// scalar version blends pixel pairs and at last the odd one
+			const s32 count = job->width & ~1;
+			const u32 off = core::SharedMath::getInstance().ifCONDThanAelseB(
+					job->width & 1, job->width - 1, 0);
+
+			const __m128i halfMask = _mm_set1_epi16(0x7fff);
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				for (; dx + 8 <= count; dx += 8)
+				{
+					const __m128i s = _mm_loadu_si128((__m128i *) (src + dx));
+					const __m128i d = _mm_loadu_si128((__m128i *) (dst + dx));
+
+					const __m128i mask = _mm_add_epi16(_mm_srli_epi16(s, 15),
+							halfMask);
+
+					_mm_storeu_si128((__m128i *) (dst + dx),
+							_mm_or_si128(_mm_and_si128(mask, d),
+									_mm_andnot_si128(mask, s)));
+				}
+
+				for (; dx != count; ++dx)
+				{
+					dst[dx] = SharedVideoUtils::getInstance().PixelBlend16(
+							dst[dx], src[dx]);
+				}
+
+				if (off)
+				{
+					dst[off] = SharedVideoUtils::getInstance().PixelBlend16(
+							dst[off], src[off]);
+				}
+
+				src = (u16*) ((u8*) (src) + job->srcPitch);
+				dst = (u16*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_AVX2 void executeBlit_TextureBlend_16_to_16_AVX2(
+				const SBlitJob * job)
+		{
+			u16 *src = (u16*) job->src;
+			u16 *dst = (u16*) job->dst;
+
+			const s32 count = job->width & ~1;
+			const u32 off = core::SharedMath::getInstance().ifCONDThanAelseB(
+					job->width & 1, job->width - 1, 0);
+
+			const __m256i halfMask = _mm256_set1_epi16(0x7fff);
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				for (; dx + 16 <= count; dx += 16)
+				{
+					const __m256i s = _mm256_loadu_si256(
+							(__m256i *) (src + dx));
+					const __m256i d = _mm256_loadu_si256(
+							(__m256i *) (dst + dx));
+
+					const __m256i mask = _mm256_add_epi16(
+							_mm256_srli_epi16(s, 15), halfMask);
+
+					_mm256_storeu_si256((__m256i *) (dst + dx),
+							_mm256_or_si256(_mm256_and_si256(mask, d),
+									_mm256_andnot_si256(mask, s)));
+				}
+
+				for (; dx != count; ++dx)
+				{
+					dst[dx] = SharedVideoUtils::getInstance().PixelBlend16(
+							dst[dx], src[dx]);
+				}
+
+				if (off)
+				{
+					dst[off] = SharedVideoUtils::getInstance().PixelBlend16(
+							dst[off], src[off]);
+				}
+
+				src = (u16*) ((u8*) (src) + job->srcPitch);
+				dst = (u16*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_SSE2 void executeBlit_TextureBlend_32_to_32_SSE2(
+				const SBlitJob * job)
+		{
+			u32 *src = (u32*) job->src;
+			u32 *dst = (u32*) job->dst;
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				for (; dx + 4 <= job->width; dx += 4)
+				{
+					const __m128i s = _mm_loadu_si128((__m128i *) (src + dx));
+					const __m128i d = _mm_loadu_si128((__m128i *) (dst + dx));
+
+					_mm_storeu_si128((__m128i *) (dst + dx),
+							pixelBlend32_SSE2(d, s));
+				}
+
+				for (; dx != job->width; ++dx)
+				{
+					dst[dx] = SharedVideoUtils::getInstance().PixelBlend32(
+							dst[dx], src[dx]);
+				}
+
+				src = (u32*) ((u8*) (src) + job->srcPitch);
+				dst = (u32*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_AVX2 void executeBlit_TextureBlend_32_to_32_AVX2(
+				const SBlitJob * job)
+		{
+			u32 *src = (u32*) job->src;
+			u32 *dst = (u32*) job->dst;
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				for (; dx + 8 <= job->width; dx += 8)
+				{
+					const __m256i s = _mm256_loadu_si256(
+							(__m256i *) (src + dx));
+					const __m256i d = _mm256_loadu_si256(
+							(__m256i *) (dst + dx));
+
+					_mm256_storeu_si256((__m256i *) (dst + dx),
+							pixelBlend32_AVX2(d, s));
+				}
+
+				for (; dx != job->width; ++dx)
+				{
+					dst[dx] = SharedVideoUtils::getInstance().PixelBlend32(
+							dst[dx], src[dx]);
+				}
+
+				src = (u32*) ((u8*) (src) + job->srcPitch);
+				dst = (u32*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_SSE2 void executeBlit_TextureBlendColor_16_to_16_SSE2(
+				const SBlitJob * job)
+		{
+			u16 *src = (u16*) job->src;
+			u16 *dst = (u16*) job->dst;
+
+			const u16 blend =
+					SharedColorConverter::getInstance().A8R8G8B8toA1R5G5B5(
+							job->argb);
+			const __m128i blend16 = _mm_set1_epi16((s16) blend);
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				for (; dx + 8 <= job->width; dx += 8)
+				{
+					const __m128i s = _mm_loadu_si128((__m128i *) (src + dx));
+					const __m128i d = _mm_loadu_si128((__m128i *) (dst + dx));
+
+					// only pixels with alpha bit are written
+					const __m128i opaque = _mm_srai_epi16(s, 15);
+
+					_mm_storeu_si128((__m128i *) (dst + dx),
+							_mm_or_si128(
+									_mm_and_si128(opaque,
+											pixelMul16_SSE2(s, blend16)),
+									_mm_andnot_si128(opaque, d)));
+				}
+
+				for (; dx != job->width; ++dx)
+				{
+					if (0 == (src[dx] & 0x8000))
+						continue;
+
+					dst[dx] = SharedVideoUtils::getInstance().PixelMul16_2(
+							src[dx], blend);
+				}
+
+				src = (u16*) ((u8*) (src) + job->srcPitch);
+				dst = (u16*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_AVX2 void executeBlit_TextureBlendColor_16_to_16_AVX2(
+				const SBlitJob * job)
+		{
+			u16 *src = (u16*) job->src;
+			u16 *dst = (u16*) job->dst;
+
+			const u16 blend =
+					SharedColorConverter::getInstance().A8R8G8B8toA1R5G5B5(
+							job->argb);
+			const __m256i blend16 = _mm256_set1_epi16((s16) blend);
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				for (; dx + 16 <= job->width; dx += 16)
+				{
+					const __m256i s = _mm256_loadu_si256(
+							(__m256i *) (src + dx));
+					const __m256i d = _mm256_loadu_si256(
+							(__m256i *) (dst + dx));
+
+					const __m256i opaque = _mm256_srai_epi16(s, 15);
+
+					_mm256_storeu_si256((__m256i *) (dst + dx),
+							_mm256_blendv_epi8(d, pixelMul16_AVX2(s, blend16),
+									opaque));
+				}
+
+				for (; dx != job->width; ++dx)
+				{
+					if (0 == (src[dx] & 0x8000))
+						continue;
+
+					dst[dx] = SharedVideoUtils::getInstance().PixelMul16_2(
+							src[dx], blend);
+				}
+
+				src = (u16*) ((u8*) (src) + job->srcPitch);
+				dst = (u16*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_SSE2 void executeBlit_TextureBlendColor_32_to_32_SSE2(
+				const SBlitJob * job)
+		{
+			u32 *src = (u32*) job->src;
+			u32 *dst = (u32*) job->dst;
+
+			const __m128i color16 = _mm_unpacklo_epi8(
+					_mm_set1_epi32(job->argb), _mm_setzero_si128());
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				for (; dx + 4 <= job->width; dx += 4)
+				{
+					const __m128i s = _mm_loadu_si128((__m128i *) (src + dx));
+					const __m128i d = _mm_loadu_si128((__m128i *) (dst + dx));
+
+					_mm_storeu_si128((__m128i *) (dst + dx),
+							pixelBlend32_SSE2(d, pixelMul32_SSE2(s, color16)));
+				}
+
+				for (; dx != job->width; ++dx)
+				{
+					dst[dx] = SharedVideoUtils::getInstance().PixelBlend32(
+							dst[dx],
+							SharedVideoUtils::getInstance().PixelMul32_2(
+									src[dx], job->argb));
+				}
+
+				src = (u32*) ((u8*) (src) + job->srcPitch);
+				dst = (u32*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_AVX2 void executeBlit_TextureBlendColor_32_to_32_AVX2(
+				const SBlitJob * job)
+		{
+			u32 *src = (u32*) job->src;
+			u32 *dst = (u32*) job->dst;
+
+			const __m256i color16 = _mm256_unpacklo_epi8(
+					_mm256_set1_epi32(job->argb), _mm256_setzero_si256());
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				for (; dx + 8 <= job->width; dx += 8)
+				{
+					const __m256i s = _mm256_loadu_si256(
+							(__m256i *) (src + dx));
+					const __m256i d = _mm256_loadu_si256(
+							(__m256i *) (dst + dx));
+
+					_mm256_storeu_si256((__m256i *) (dst + dx),
+							pixelBlend32_AVX2(d, pixelMul32_AVX2(s, color16)));
+				}
+
+				for (; dx != job->width; ++dx)
+				{
+					dst[dx] = SharedVideoUtils::getInstance().PixelBlend32(
+							dst[dx],
+							SharedVideoUtils::getInstance().PixelMul32_2(
+									src[dx], job->argb));
+				}
+
+				src = (u32*) ((u8*) (src) + job->srcPitch);
+				dst = (u32*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_SSE2 void executeBlit_Color_16_to_16_SSE2(
+				const SBlitJob * job)
+		{
+			u16 *dst = (u16*) job->dst;
+
+			const u16 c0 =
+					SharedColorConverter::getInstance().A8R8G8B8toA1R5G5B5(
+							job->argb);
+			const u32 c = c0 | c0 << 16;
+
+			// srcPitch is a row size in bytes for color operations
+			const u32 count = job->srcPitch >> 2;
+			const s32 dx = job->width - 1;
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				fill32_SSE2((u32*) dst, c, count);
+
+				if (job->srcPitch & 3)
+					dst[dx] = c0;
+
+				dst = (u16*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_AVX2 void executeBlit_Color_16_to_16_AVX2(
+				const SBlitJob * job)
+		{
+			u16 *dst = (u16*) job->dst;
+
+			const u16 c0 =
+					SharedColorConverter::getInstance().A8R8G8B8toA1R5G5B5(
+							job->argb);
+			const u32 c = c0 | c0 << 16;
+
+			const u32 count = job->srcPitch >> 2;
+			const s32 dx = job->width - 1;
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				fill32_AVX2((u32*) dst, c, count);
+
+				if (job->srcPitch & 3)
+					dst[dx] = c0;
+
+				dst = (u16*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_SSE2 void executeBlit_Color_32_to_32_SSE2(
+				const SBlitJob * job)
+		{
+			u32 *dst = (u32*) job->dst;
+
+			const u32 count = job->srcPitch >> 2;
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				fill32_SSE2(dst, job->argb, count);
+				dst = (u32*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_AVX2 void executeBlit_Color_32_to_32_AVX2(
+				const SBlitJob * job)
+		{
+			u32 *dst = (u32*) job->dst;
+
+			const u32 count = job->srcPitch >> 2;
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				fill32_AVX2(dst, job->argb, count);
+				dst = (u32*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_SSE2 void executeBlit_ColorAlpha_16_to_16_SSE2(
+				const SBlitJob * job)
+		{
+			u16 *dst = (u16*) job->dst;
+
+			const u16 alpha = extractAlphaSIMD(job->argb) >> 3;
+			if (0 == alpha)
+				return;
+			const u32 src =
+					SharedColorConverter::getInstance().A8R8G8B8toA1R5G5B5(
+							job->argb);
+
+			const __m128i alpha16 = _mm_set1_epi16(alpha);
+			const __m128i src16 = _mm_set1_epi16((s16) src);
+			const __m128i alphaBit = _mm_set1_epi16((s16) 0x8000);
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				for (; dx + 8 <= job->width; dx += 8)
+				{
+					const __m128i d = _mm_loadu_si128((__m128i *) (dst + dx));
+
+					_mm_storeu_si128((__m128i *) (dst + dx),
+							_mm_or_si128(pixelBlend16_SSE2(d, src16, alpha16),
+									alphaBit));
+				}
+
+				for (; dx != job->width; ++dx)
+				{
+					dst[dx] = 0x8000
+							| SharedVideoUtils::getInstance().PixelBlend16(
+									dst[dx], src, alpha);
+				}
+
+				dst = (u16*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_AVX2 void executeBlit_ColorAlpha_16_to_16_AVX2(
+				const SBlitJob * job)
+		{
+			u16 *dst = (u16*) job->dst;
+
+			const u16 alpha = extractAlphaSIMD(job->argb) >> 3;
+			if (0 == alpha)
+				return;
+			const u32 src =
+					SharedColorConverter::getInstance().A8R8G8B8toA1R5G5B5(
+							job->argb);
+
+			const __m256i alpha16 = _mm256_set1_epi16(alpha);
+			const __m256i src16 = _mm256_set1_epi16((s16) src);
+			const __m256i alphaBit = _mm256_set1_epi16((s16) 0x8000);
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				for (; dx + 16 <= job->width; dx += 16)
+				{
+					const __m256i d = _mm256_loadu_si256(
+							(__m256i *) (dst + dx));
+
+					_mm256_storeu_si256((__m256i *) (dst + dx),
+							_mm256_or_si256(
+									pixelBlend16_AVX2(d, src16, alpha16),
+									alphaBit));
+				}
+
+				for (; dx != job->width; ++dx)
+				{
+					dst[dx] = 0x8000
+							| SharedVideoUtils::getInstance().PixelBlend16(
+									dst[dx], src, alpha);
+				}
+
+				dst = (u16*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_SSE2 void executeBlit_ColorAlpha_32_to_32_SSE2(
+				const SBlitJob * job)
+		{
+			u32 *dst = (u32*) job->dst;
+
+			const u32 alpha = extractAlphaSIMD(job->argb);
+			const u32 src = job->argb;
+
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i alpha16 = _mm_set1_epi16(alpha);
+			const __m128i src16 = _mm_unpacklo_epi8(_mm_set1_epi32(src), zero);
+			const __m128i alphaMask = _mm_set1_epi32(0xFF000000);
+			const __m128i packA = _mm_set1_epi32(src & 0xFF000000);
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				for (; dx + 4 <= job->width; dx += 4)
+				{
+					const __m128i d = _mm_loadu_si128((__m128i *) (dst + dx));
+
+					const __m128i low = blendChannels_SSE2(
+							_mm_unpacklo_epi8(d, zero), src16, alpha16);
+					const __m128i high = blendChannels_SSE2(
+							_mm_unpackhi_epi8(d, zero), src16, alpha16);
+
+					_mm_storeu_si128((__m128i *) (dst + dx),
+							_mm_or_si128(
+									_mm_andnot_si128(alphaMask,
+											_mm_packus_epi16(low, high)),
+									packA));
+				}
+
+				for (; dx != job->width; ++dx)
+				{
+					dst[dx] = (job->argb & 0xFF000000)
+							| SharedVideoUtils::getInstance().PixelBlend32(
+									dst[dx], src, alpha);
+				}
+
+				dst = (u32*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+		IRR_TARGET_AVX2 void executeBlit_ColorAlpha_32_to_32_AVX2(
+				const SBlitJob * job)
+		{
+			u32 *dst = (u32*) job->dst;
+
+			const u32 alpha = extractAlphaSIMD(job->argb);
+			const u32 src = job->argb;
+
+			const __m256i zero = _mm256_setzero_si256();
+			const __m256i alpha16 = _mm256_set1_epi16(alpha);
+			const __m256i src16 = _mm256_unpacklo_epi8(_mm256_set1_epi32(src),
+					zero);
+			const __m256i alphaMask = _mm256_set1_epi32(0xFF000000);
+			const __m256i packA = _mm256_set1_epi32(src & 0xFF000000);
+
+			for (s32 dy = 0; dy != job->height; ++dy)
+			{
+				s32 dx = 0;
+
+				for (; dx + 8 <= job->width; dx += 8)
+				{
+					const __m256i d = _mm256_loadu_si256(
+							(__m256i *) (dst + dx));
+
+					const __m256i low = blendChannels_AVX2(
+							_mm256_unpacklo_epi8(d, zero), src16, alpha16);
+					const __m256i high = blendChannels_AVX2(
+							_mm256_unpackhi_epi8(d, zero), src16, alpha16);
+
+					_mm256_storeu_si256((__m256i *) (dst + dx),
+							_mm256_or_si256(
+									_mm256_andnot_si256(alphaMask,
+											_mm256_packus_epi16(low, high)),
+									packA));
+				}
+
+				for (; dx != job->width; ++dx)
+				{
+					dst[dx] = (job->argb & 0xFF000000)
+							| SharedVideoUtils::getInstance().PixelBlend32(
+									dst[dx], src, alpha);
+				}
+
+				dst = (u32*) ((u8*) (dst) + job->dstPitch);
+			}
+		}
+
+	}  // namespace video
+}  // namespace irrgame
+
+#endif /* IRR_SIMD_BLITTERS && IRR_X86_SIMD */
@@ -0,0 +1,57 @@
+/*
+ * blitSIMD.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef BLITSIMD_H_
+#define BLITSIMD_H_
+
+#include "SBlitJob.h"
+
+#if defined(IRR_SIMD_BLITTERS) && defined(IRR_X86_SIMD)
+
+namespace irrgame
+{
+	namespace video
+	{
+		/*
+		 * SSE2/AVX2 versions of blitters from blit.h.
+		 * Each one produces exactly the same pixels as its scalar reference.
+		 * Call them only if SharedCPUFeatures reports the instruction set.
+		 */
+
+		void executeBlit_TextureCopy_24_to_32_SSE2(const SBlitJob * job);
+		void executeBlit_TextureCopy_24_to_32_AVX2(const SBlitJob * job);
+
+		void executeBlit_TextureBlend_16_to_16_SSE2(const SBlitJob * job);
+		void executeBlit_TextureBlend_16_to_16_AVX2(const SBlitJob * job);
+
+		void executeBlit_TextureBlend_32_to_32_SSE2(const SBlitJob * job);
+		void executeBlit_TextureBlend_32_to_32_AVX2(const SBlitJob * job);
+
+		void executeBlit_TextureBlendColor_16_to_16_SSE2(const SBlitJob * job);
+		void executeBlit_TextureBlendColor_16_to_16_AVX2(const SBlitJob * job);
+
+		void executeBlit_TextureBlendColor_32_to_32_SSE2(const SBlitJob * job);
+		void executeBlit_TextureBlendColor_32_to_32_AVX2(const SBlitJob * job);
+
+		void executeBlit_Color_16_to_16_SSE2(const SBlitJob * job);
+		void executeBlit_Color_16_to_16_AVX2(const SBlitJob * job);
+
+		void executeBlit_Color_32_to_32_SSE2(const SBlitJob * job);
+		void executeBlit_Color_32_to_32_AVX2(const SBlitJob * job);
+
+		void executeBlit_ColorAlpha_16_to_16_SSE2(const SBlitJob * job);
+		void executeBlit_ColorAlpha_16_to_16_AVX2(const SBlitJob * job);
+
+		void executeBlit_ColorAlpha_32_to_32_SSE2(const SBlitJob * job);
+		void executeBlit_ColorAlpha_32_to_32_AVX2(const SBlitJob * job);
+
+	}  // namespace video
+}  // namespace irrgame
+
+#endif /* IRR_SIMD_BLITTERS && IRR_X86_SIMD */
+
+#endif /* BLITSIMD_H_ */
@@ -18,40 +18,81 @@ namespace irrgame
 				s32 destFormat;
 				s32 sourceFormat;
 				tExecuteBlit func;
+				tExecuteBlit funcSSE2;
+				tExecuteBlit funcAVX2;
 		};
 
+		/*
+		 * SIMD versions of blitter. Zero if there is no such version,
+		 * scalar func is used then.
+		 */
+#if defined(IRR_SIMD_BLITTERS) && defined(IRR_X86_SIMD)
+#define BLITTER_SIMD(func) func##_SSE2, func##_AVX2
+#else
+#define BLITTER_SIMD(func) 0, 0
+#endif
+
 		static const blitterTable blitTable[] =
 		{
-		{ BLITTER_TEXTURE, -2, -2, executeBlit_TextureCopy_x_to_x },
+		{ BLITTER_TEXTURE, -2, -2, executeBlit_TextureCopy_x_to_x, 0, 0 },
 		{ BLITTER_TEXTURE, video::ECF_A1R5G5B5, video::ECF_A8R8G8B8,
-				executeBlit_TextureCopy_32_to_16 },
+				executeBlit_TextureCopy_32_to_16, 0, 0 },
 		{ BLITTER_TEXTURE, video::ECF_A1R5G5B5, video::ECF_R8G8B8,
-				executeBlit_TextureCopy_24_to_16 },
+				executeBlit_TextureCopy_24_to_16, 0, 0 },
 		{ BLITTER_TEXTURE, video::ECF_A8R8G8B8, video::ECF_A1R5G5B5,
-				executeBlit_TextureCopy_16_to_32 },
+				executeBlit_TextureCopy_16_to_32, 0, 0 },
 		{ BLITTER_TEXTURE, video::ECF_A8R8G8B8, video::ECF_R8G8B8,
-				executeBlit_TextureCopy_24_to_32 },
+				executeBlit_TextureCopy_24_to_32,
+				BLITTER_SIMD(executeBlit_TextureCopy_24_to_32) },
 		{ BLITTER_TEXTURE, video::ECF_R8G8B8, video::ECF_A1R5G5B5,
-				executeBlit_TextureCopy_16_to_24 },
+				executeBlit_TextureCopy_16_to_24, 0, 0 },
 		{ BLITTER_TEXTURE, video::ECF_R8G8B8, video::ECF_A8R8G8B8,
-				executeBlit_TextureCopy_32_to_24 },
+				executeBlit_TextureCopy_32_to_24, 0, 0 },
 		{ BLITTER_TEXTURE_ALPHA_BLEND, video::ECF_A1R5G5B5, video::ECF_A1R5G5B5,
-				executeBlit_TextureBlend_16_to_16 },
+				executeBlit_TextureBlend_16_to_16,
+				BLITTER_SIMD(executeBlit_TextureBlend_16_to_16) },
 		{ BLITTER_TEXTURE_ALPHA_BLEND, video::ECF_A8R8G8B8, video::ECF_A8R8G8B8,
-				executeBlit_TextureBlend_32_to_32 },
+				executeBlit_TextureBlend_32_to_32,
+				BLITTER_SIMD(executeBlit_TextureBlend_32_to_32) },
 		{ BLITTER_TEXTURE_ALPHA_COLOR_BLEND, video::ECF_A1R5G5B5,
-				video::ECF_A1R5G5B5, executeBlit_TextureBlendColor_16_to_16 },
+				video::ECF_A1R5G5B5, executeBlit_TextureBlendColor_16_to_16,
+				BLITTER_SIMD(executeBlit_TextureBlendColor_16_to_16) },
 		{ BLITTER_TEXTURE_ALPHA_COLOR_BLEND, video::ECF_A8R8G8B8,
-				video::ECF_A8R8G8B8, executeBlit_TextureBlendColor_32_to_32 },
-		{ BLITTER_COLOR, video::ECF_A1R5G5B5, -1, executeBlit_Color_16_to_16 },
-		{ BLITTER_COLOR, video::ECF_A8R8G8B8, -1, executeBlit_Color_32_to_32 },
+				video::ECF_A8R8G8B8, executeBlit_TextureBlendColor_32_to_32,
+				BLITTER_SIMD(executeBlit_TextureBlendColor_32_to_32) },
+		{ BLITTER_COLOR, video::ECF_A1R5G5B5, -1, executeBlit_Color_16_to_16,
+				BLITTER_SIMD(executeBlit_Color_16_to_16) },
+		{ BLITTER_COLOR, video::ECF_A8R8G8B8, -1, executeBlit_Color_32_to_32,
+				BLITTER_SIMD(executeBlit_Color_32_to_32) },
 		{ BLITTER_COLOR_ALPHA, video::ECF_A1R5G5B5, -1,
-				executeBlit_ColorAlpha_16_to_16 },
+				executeBlit_ColorAlpha_16_to_16,
+				BLITTER_SIMD(executeBlit_ColorAlpha_16_to_16) },
 		{ BLITTER_COLOR_ALPHA, video::ECF_A8R8G8B8, -1,
-				executeBlit_ColorAlpha_32_to_32 },
-		{ BLITTER_INVALID, -1, -1, 0 } };
+				executeBlit_ColorAlpha_32_to_32,
+				BLITTER_SIMD(executeBlit_ColorAlpha_32_to_32) },
+		{ BLITTER_INVALID, -1, -1, 0, 0, 0 } };
+
+		//! Dense table of blitters: [operation][dest format][source format].
+		//! Built from blitTable with the same wildcard rules.
+		//! Format slot ECF_COUNT is used when there is no image.
+		struct SBlitterDispatchTable
+		{
+			public:
+				//! Singleton realization. Table is built on first use, so
+				//! it is ready for blits from static initializers too.
+				static const SBlitterDispatchTable& getInstance();
+
+			private:
+				//! Default constructor. Should use only one time.
+				SBlitterDispatchTable();
+
+			public:
+				tExecuteBlit Blitters[BLITTER_COUNT][ECF_COUNT + 1][ECF_COUNT + 1];
+		};
 
 	} // namespace video
 } // namespace irrgame
 
+#undef BLITTER_SIMD
+
 #endif /* BLITTERTABLE_H_ */
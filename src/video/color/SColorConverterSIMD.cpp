@@ -0,0 +1,829 @@
+/*
+ * SColorConverterSIMD.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#include "SColorConverterSIMD.h"
+
+#if defined(IRR_SIMD_COLOR_CONVERTER) && defined(IRR_X86_SIMD)
+
+#include "core/utils/SharedCPUFeatures.h"
+
+#include <immintrin.h>
+
+/*
+ * Conversions are compiled for their instruction set with target attribute,
+ * so whole engine is not required to be built with -mssse3 or -mavx2.
+ */
+#define IRR_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define IRR_TARGET_AVX2 __attribute__((target("avx2")))
+
+namespace irrgame
+{
+	namespace video
+	{
+		/*
+		 * Kernels for 32 bit lanes. Each one has SSSE3 and AVX2 version.
+		 */
+
+		//! A8R8G8B8 <-> A8B8G8R8
+		struct SSwapRedBlue
+		{
+				static IRR_TARGET_SSSE3 __m128i apply(const __m128i v)
+				{
+					const __m128i middle = _mm_set1_epi32(0xFF00FF00);
+					const __m128i low = _mm_set1_epi32(0x000000FF);
+
+					return _mm_or_si128(_mm_and_si128(v, middle),
+							_mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 16), low),
+									_mm_slli_epi32(_mm_and_si128(v, low), 16)));
+				}
+
+				static IRR_TARGET_AVX2 __m256i apply(const __m256i v)
+				{
+					const __m256i middle = _mm256_set1_epi32(0xFF00FF00);
+					const __m256i low = _mm256_set1_epi32(0x000000FF);
+
+					return _mm256_or_si256(_mm256_and_si256(v, middle),
+							_mm256_or_si256(
+									_mm256_and_si256(_mm256_srli_epi32(v, 16),
+											low),
+									_mm256_slli_epi32(_mm256_and_si256(v, low),
+											16)));
+				}
+		};
+
+		//! B8G8R8A8 -> A8R8G8B8
+		struct SByteSwap
+		{
+				static IRR_TARGET_SSSE3 __m128i apply(const __m128i v)
+				{
+					const __m128i mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11,
+							10, 9, 8, 15, 14, 13, 12);
+
+					return _mm_shuffle_epi8(v, mask);
+				}
+
+				static IRR_TARGET_AVX2 __m256i apply(const __m256i v)
+				{
+					const __m256i mask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+							11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4,
+							11, 10, 9, 8, 15, 14, 13, 12);
+
+					return _mm256_shuffle_epi8(v, mask);
+				}
+		};
+
+		//! A8R8G8B8 -> R8G8B8A8
+		struct SRotateAlpha
+		{
+				static IRR_TARGET_SSSE3 __m128i apply(const __m128i v)
+				{
+					return _mm_or_si128(_mm_slli_epi32(v, 8),
+							_mm_srli_epi32(v, 24));
+				}
+
+				static IRR_TARGET_AVX2 __m256i apply(const __m256i v)
+				{
+					return _mm256_or_si256(_mm256_slli_epi32(v, 8),
+							_mm256_srli_epi32(v, 24));
+				}
+		};
+
+		//! A1R5G5B5 in low 16 bits -> A8R8G8B8. Same as A1R5G5B5toA8R8G8B8
+		struct SUnpackA1R5G5B5
+		{
+				static IRR_TARGET_SSSE3 __m128i apply(const __m128i v)
+				{
+					const __m128i a = _mm_and_si128(
+							_mm_srai_epi32(_mm_slli_epi32(v, 16), 31),
+							_mm_set1_epi32(0xFF000000));
+					const __m128i r = _mm_or_si128(
+							_mm_slli_epi32(
+									_mm_and_si128(v, _mm_set1_epi32(0x7C00)), 9),
+							_mm_slli_epi32(
+									_mm_and_si128(v, _mm_set1_epi32(0x7000)), 4));
+					const __m128i g = _mm_or_si128(
+							_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0x3E0)),
+									6),
+							_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0x380)),
+									1));
+					const __m128i b = _mm_or_si128(
+							_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0x1F)),
+									3),
+							_mm_srli_epi32(_mm_and_si128(v, _mm_set1_epi32(0x1C)),
+									2));
+
+					return _mm_or_si128(_mm_or_si128(a, r), _mm_or_si128(g, b));
+				}
+
+				static IRR_TARGET_AVX2 __m256i apply(const __m256i v)
+				{
+					const __m256i a = _mm256_and_si256(
+							_mm256_srai_epi32(_mm256_slli_epi32(v, 16), 31),
+							_mm256_set1_epi32(0xFF000000));
+					const __m256i r = _mm256_or_si256(
+							_mm256_slli_epi32(
+									_mm256_and_si256(v,
+											_mm256_set1_epi32(0x7C00)), 9),
+							_mm256_slli_epi32(
+									_mm256_and_si256(v,
+											_mm256_set1_epi32(0x7000)), 4));
+					const __m256i g = _mm256_or_si256(
+							_mm256_slli_epi32(
+									_mm256_and_si256(v, _mm256_set1_epi32(0x3E0)),
+									6),
+							_mm256_slli_epi32(
+									_mm256_and_si256(v, _mm256_set1_epi32(0x380)),
+									1));
+					const __m256i b = _mm256_or_si256(
+							_mm256_slli_epi32(
+									_mm256_and_si256(v, _mm256_set1_epi32(0x1F)),
+									3),
+							_mm256_srli_epi32(
+									_mm256_and_si256(v, _mm256_set1_epi32(0x1C)),
+									2));
+
+					return _mm256_or_si256(_mm256_or_si256(a, r),
+							_mm256_or_si256(g, b));
+				}
+		};
+
+		//! R5G6B5 in low 16 bits -> A8R8G8B8. Same as R5G6B5toA8R8G8B8
+		struct SUnpackR5G6B5
+		{
+				static IRR_TARGET_SSSE3 __m128i apply(const __m128i v)
+				{
+					return _mm_or_si128(
+							_mm_or_si128(_mm_set1_epi32(0xFF000000),
+									_mm_slli_epi32(
+											_mm_and_si128(v,
+													_mm_set1_epi32(0xF800)), 8)),
+							_mm_or_si128(
+									_mm_slli_epi32(
+											_mm_and_si128(v,
+													_mm_set1_epi32(0x07E0)), 5),
+									_mm_slli_epi32(
+											_mm_and_si128(v,
+													_mm_set1_epi32(0x001F)), 3)));
+				}
+
+				static IRR_TARGET_AVX2 __m256i apply(const __m256i v)
+				{
+					return _mm256_or_si256(
+							_mm256_or_si256(_mm256_set1_epi32(0xFF000000),
+									_mm256_slli_epi32(
+											_mm256_and_si256(v,
+													_mm256_set1_epi32(0xF800)),
+											8)),
+							_mm256_or_si256(
+									_mm256_slli_epi32(
+											_mm256_and_si256(v,
+													_mm256_set1_epi32(0x07E0)),
+											5),
+									_mm256_slli_epi32(
+											_mm256_and_si256(v,
+													_mm256_set1_epi32(0x001F)),
+											3)));
+				}
+		};
+
+		//! A8R8G8B8 -> A1R5G5B5 in low 16 bits. Same as A8R8G8B8toA1R5G5B5
+		struct SPackA1R5G5B5
+		{
+				static IRR_TARGET_SSSE3 __m128i apply(const __m128i v)
+				{
+					return _mm_or_si128(
+							_mm_or_si128(
+									_mm_and_si128(_mm_srli_epi32(v, 16),
+											_mm_set1_epi32(0x8000)),
+									_mm_and_si128(_mm_srli_epi32(v, 9),
+											_mm_set1_epi32(0x7C00))),
+							_mm_or_si128(
+									_mm_and_si128(_mm_srli_epi32(v, 6),
+											_mm_set1_epi32(0x03E0)),
+									_mm_and_si128(_mm_srli_epi32(v, 3),
+											_mm_set1_epi32(0x001F))));
+				}
+
+				static IRR_TARGET_AVX2 __m256i apply(const __m256i v)
+				{
+					return _mm256_or_si256(
+							_mm256_or_si256(
+									_mm256_and_si256(_mm256_srli_epi32(v, 16),
+											_mm256_set1_epi32(0x8000)),
+									_mm256_and_si256(_mm256_srli_epi32(v, 9),
+											_mm256_set1_epi32(0x7C00))),
+							_mm256_or_si256(
+									_mm256_and_si256(_mm256_srli_epi32(v, 6),
+											_mm256_set1_epi32(0x03E0)),
+									_mm256_and_si256(_mm256_srli_epi32(v, 3),
+											_mm256_set1_epi32(0x001F))));
+				}
+		};
+
+		//! A8R8G8B8 -> R5G6B5 in low 16 bits. Same as A8R8G8B8toR5G6B5
+		struct SPackR5G6B5
+		{
+				static IRR_TARGET_SSSE3 __m128i apply(const __m128i v)
+				{
+					return _mm_or_si128(
+							_mm_and_si128(_mm_srli_epi32(v, 8),
+									_mm_set1_epi32(0xF800)),
+							_mm_or_si128(
+									_mm_and_si128(_mm_srli_epi32(v, 5),
+											_mm_set1_epi32(0x07E0)),
+									_mm_and_si128(_mm_srli_epi32(v, 3),
+											_mm_set1_epi32(0x001F))));
+				}
+
+				static IRR_TARGET_AVX2 __m256i apply(const __m256i v)
+				{
+					return _mm256_or_si256(
+							_mm256_and_si256(_mm256_srli_epi32(v, 8),
+									_mm256_set1_epi32(0xF800)),
+							_mm256_or_si256(
+									_mm256_and_si256(_mm256_srli_epi32(v, 5),
+											_mm256_set1_epi32(0x07E0)),
+									_mm256_and_si256(_mm256_srli_epi32(v, 3),
+											_mm256_set1_epi32(0x001F))));
+				}
+		};
+
+		/*
+		 * Kernels for 16 bit lanes
+		 */
+
+		//! Same as A1R5G5B5toR5G6B5
+		struct SA1R5G5B5toR5G6B5
+		{
+				static IRR_TARGET_SSSE3 __m128i apply(const __m128i v)
+				{
+					return _mm_or_si128(
+							_mm_slli_epi16(
+									_mm_and_si128(v, _mm_set1_epi16(0x7FE0)), 1),
+							_mm_and_si128(v, _mm_set1_epi16(0x1F)));
+				}
+
+				static IRR_TARGET_AVX2 __m256i apply(const __m256i v)
+				{
+					return _mm256_or_si256(
+							_mm256_slli_epi16(
+									_mm256_and_si256(v,
+											_mm256_set1_epi16(0x7FE0)), 1),
+							_mm256_and_si256(v, _mm256_set1_epi16(0x1F)));
+				}
+		};
+
+		//! Same as R5G6B5toA1R5G5B5
+		struct SR5G6B5toA1R5G5B5
+		{
+				static IRR_TARGET_SSSE3 __m128i apply(const __m128i v)
+				{
+					return _mm_or_si128(_mm_set1_epi16((s16) 0x8000),
+							_mm_or_si128(
+									_mm_srli_epi16(
+											_mm_and_si128(v,
+													_mm_set1_epi16(
+															(s16) 0xFFC0)), 1),
+									_mm_and_si128(v, _mm_set1_epi16(0x1F))));
+				}
+
+				static IRR_TARGET_AVX2 __m256i apply(const __m256i v)
+				{
+					return _mm256_or_si256(_mm256_set1_epi16((s16) 0x8000),
+							_mm256_or_si256(
+									_mm256_srli_epi16(
+											_mm256_and_si256(v,
+													_mm256_set1_epi16(
+															(s16) 0xFFC0)), 1),
+									_mm256_and_si256(v,
+											_mm256_set1_epi16(0x1F))));
+				}
+		};
+
+		//! A1R5G5B5 -> R5G5B5A1
+		struct SA1R5G5B5toR5G5B5A1
+		{
+				static IRR_TARGET_SSSE3 __m128i apply(const __m128i v)
+				{
+					return _mm_or_si128(_mm_slli_epi16(v, 1),
+							_mm_srli_epi16(v, 15));
+				}
+
+				static IRR_TARGET_AVX2 __m256i apply(const __m256i v)
+				{
+					return _mm256_or_si256(_mm256_slli_epi16(v, 1),
+							_mm256_srli_epi16(v, 15));
+				}
+		};
+
+		/*
+		 * Byte orders of 24 bit formats. Masks are for one 128 bit lane of
+		 * 4 pixels: 12 bytes of 24 bit pixels <-> 16 bytes of A8R8G8B8 pixels.
+		 */
+
+		//! R8G8B8 bytes are R, G, B
+		struct SR8G8B8
+		{
+				static IRR_TARGET_SSSE3 __m128i expand()
+				{
+					return _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11,
+							10, 9, -1);
+				}
+
+				static IRR_TARGET_SSSE3 __m128i compact()
+				{
+					return _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+							-1, -1, -1, -1);
+				}
+		};
+
+		//! B8G8R8 bytes are B, G, R. Same as little endian A8R8G8B8 without alpha
+		struct SB8G8R8
+		{
+				static IRR_TARGET_SSSE3 __m128i expand()
+				{
+					return _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9,
+							10, 11, -1);
+				}
+
+				static IRR_TARGET_SSSE3 __m128i compact()
+				{
+					return _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1,
+							-1, -1, -1);
+				}
+		};
+
+		/*
+		 * SSSE3 loops
+		 */
+
+		//! Loads 4 pixels of 24 bit format as A8R8G8B8. Reads 16 bytes.
+		template<class TFormat>
+		IRR_TARGET_SSSE3 inline __m128i load24_SSSE3(const u8* s)
+		{
+			return _mm_or_si128(
+					_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) s),
+							TFormat::expand()), _mm_set1_epi32(0xFF000000));
+		}
+
+		template<class TKernel>
+		IRR_TARGET_SSSE3 s32 convert32to32_SSSE3(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u32* sB = (const u32*) sP;
+			u32* dB = (u32*) dP;
+
+			s32 x = 0;
+			for (; x + 4 <= sN; x += 4)
+			{
+				_mm_storeu_si128((__m128i *) (dB + x),
+						TKernel::apply(_mm_loadu_si128((const __m128i *) (sB + x))));
+			}
+
+			return x;
+		}
+
+		template<class TKernel>
+		IRR_TARGET_SSSE3 s32 convert16to16_SSSE3(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u16* sB = (const u16*) sP;
+			u16* dB = (u16*) dP;
+
+			s32 x = 0;
+			for (; x + 8 <= sN; x += 8)
+			{
+				_mm_storeu_si128((__m128i *) (dB + x),
+						TKernel::apply(_mm_loadu_si128((const __m128i *) (sB + x))));
+			}
+
+			return x;
+		}
+
+		template<class TUnpack>
+		IRR_TARGET_SSSE3 s32 convert16to32_SSSE3(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u16* sB = (const u16*) sP;
+			u32* dB = (u32*) dP;
+
+			const __m128i zero = _mm_setzero_si128();
+
+			s32 x = 0;
+			for (; x + 8 <= sN; x += 8)
+			{
+				const __m128i v = _mm_loadu_si128((const __m128i *) (sB + x));
+
+				_mm_storeu_si128((__m128i *) (dB + x),
+						TUnpack::apply(_mm_unpacklo_epi16(v, zero)));
+				_mm_storeu_si128((__m128i *) (dB + x + 4),
+						TUnpack::apply(_mm_unpackhi_epi16(v, zero)));
+			}
+
+			return x;
+		}
+
+		//! Low 16 bits of each 32 bit lane of two vectors to one vector
+		IRR_TARGET_SSSE3 inline __m128i pack32to16_SSSE3(const __m128i a,
+				const __m128i b)
+		{
+			const __m128i mask = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1,
+					-1, -1, -1, -1, -1, -1);
+
+			return _mm_unpacklo_epi64(_mm_shuffle_epi8(a, mask),
+					_mm_shuffle_epi8(b, mask));
+		}
+
+		template<class TPack>
+		IRR_TARGET_SSSE3 s32 convert32to16_SSSE3(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u32* sB = (const u32*) sP;
+			u16* dB = (u16*) dP;
+
+			s32 x = 0;
+			for (; x + 8 <= sN; x += 8)
+			{
+				const __m128i a = TPack::apply(
+						_mm_loadu_si128((const __m128i *) (sB + x)));
+				const __m128i b = TPack::apply(
+						_mm_loadu_si128((const __m128i *) (sB + x + 4)));
+
+				_mm_storeu_si128((__m128i *) (dB + x), pack32to16_SSSE3(a, b));
+			}
+
+			return x;
+		}
+
+		template<class TFormat>
+		IRR_TARGET_SSSE3 s32 convert24to32_SSSE3(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u8* sB = (const u8*) sP;
+			u32* dB = (u32*) dP;
+
+			s32 x = 0;
+			// load reads 4 bytes after 4 pixels
+			for (; x + 6 <= sN; x += 4)
+			{
+				_mm_storeu_si128((__m128i *) (dB + x),
+						load24_SSSE3<TFormat>(sB + x * 3));
+			}
+
+			return x;
+		}
+
+		template<class TFormat, class TPack>
+		IRR_TARGET_SSSE3 s32 convert24to16_SSSE3(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u8* sB = (const u8*) sP;
+			u16* dB = (u16*) dP;
+
+			s32 x = 0;
+			for (; x + 10 <= sN; x += 8)
+			{
+				const __m128i a = TPack::apply(
+						load24_SSSE3<TFormat>(sB + x * 3));
+				const __m128i b = TPack::apply(
+						load24_SSSE3<TFormat>(sB + x * 3 + 12));
+
+				_mm_storeu_si128((__m128i *) (dB + x), pack32to16_SSSE3(a, b));
+			}
+
+			return x;
+		}
+
+		template<class TFormat>
+		IRR_TARGET_SSSE3 s32 convert32to24_SSSE3(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u32* sB = (const u32*) sP;
+			u8* dB = (u8*) dP;
+
+			s32 x = 0;
+			// store writes 4 bytes after 4 pixels, they are overwritten later
+			for (; x + 6 <= sN; x += 4)
+			{
+				_mm_storeu_si128((__m128i *) (dB + x * 3),
+						_mm_shuffle_epi8(
+								_mm_loadu_si128((const __m128i *) (sB + x)),
+								TFormat::compact()));
+			}
+
+			return x;
+		}
+
+		IRR_TARGET_SSSE3 s32 convert_R8G8B8toB8G8R8_SSSE3(const void* sP,
+				s32 sN, void* dP)
+		{
+			const u8* sB = (const u8*) sP;
+			u8* dB = (u8*) dP;
+
+			// last 4 bytes are copied unchanged, next pixels overwrite them
+			const __m128i mask = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11,
+					10, 9, 12, 13, 14, 15);
+
+			s32 x = 0;
+			for (; x + 6 <= sN; x += 4)
+			{
+				_mm_storeu_si128((__m128i *) (dB + x * 3),
+						_mm_shuffle_epi8(
+								_mm_loadu_si128((const __m128i *) (sB + x * 3)),
+								mask));
+			}
+
+			return x;
+		}
+
+		/*
+		 * AVX2 loops. Same as SSSE3 ones, but for 8 pixels per register.
+		 */
+
+		//! Loads 8 pixels of 24 bit format as A8R8G8B8. Reads 28 bytes.
+		template<class TFormat>
+		IRR_TARGET_AVX2 inline __m256i load24_AVX2(const u8* s)
+		{
+			const __m128i mask = TFormat::expand();
+
+			const __m256i v = _mm256_inserti128_si256(
+					_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) s)),
+					_mm_loadu_si128((const __m128i *) (s + 12)), 1);
+
+			return _mm256_or_si256(
+					_mm256_shuffle_epi8(v,
+							_mm256_inserti128_si256(
+									_mm256_castsi128_si256(mask), mask, 1)),
+					_mm256_set1_epi32(0xFF000000));
+		}
+
+		//! Low 16 bits of each 32 bit lane of two vectors to one vector
+		IRR_TARGET_AVX2 inline __m256i pack32to16_AVX2(const __m256i a,
+				const __m256i b)
+		{
+			// values are less than 0x10000, so saturation does nothing
+			return _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b),
+					_MM_SHUFFLE(3, 1, 2, 0));
+		}
+
+		template<class TKernel>
+		IRR_TARGET_AVX2 s32 convert32to32_AVX2(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u32* sB = (const u32*) sP;
+			u32* dB = (u32*) dP;
+
+			s32 x = 0;
+			for (; x + 8 <= sN; x += 8)
+			{
+				_mm256_storeu_si256((__m256i *) (dB + x),
+						TKernel::apply(
+								_mm256_loadu_si256((const __m256i *) (sB + x))));
+			}
+
+			return x;
+		}
+
+		template<class TKernel>
+		IRR_TARGET_AVX2 s32 convert16to16_AVX2(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u16* sB = (const u16*) sP;
+			u16* dB = (u16*) dP;
+
+			s32 x = 0;
+			for (; x + 16 <= sN; x += 16)
+			{
+				_mm256_storeu_si256((__m256i *) (dB + x),
+						TKernel::apply(
+								_mm256_loadu_si256((const __m256i *) (sB + x))));
+			}
+
+			return x;
+		}
+
+		template<class TUnpack>
+		IRR_TARGET_AVX2 s32 convert16to32_AVX2(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u16* sB = (const u16*) sP;
+			u32* dB = (u32*) dP;
+
+			s32 x = 0;
+			for (; x + 16 <= sN; x += 16)
+			{
+				const __m128i low = _mm_loadu_si128((const __m128i *) (sB + x));
+				const __m128i high = _mm_loadu_si128(
+						(const __m128i *) (sB + x + 8));
+
+				_mm256_storeu_si256((__m256i *) (dB + x),
+						TUnpack::apply(_mm256_cvtepu16_epi32(low)));
+				_mm256_storeu_si256((__m256i *) (dB + x + 8),
+						TUnpack::apply(_mm256_cvtepu16_epi32(high)));
+			}
+
+			return x;
+		}
+
+		template<class TPack>
+		IRR_TARGET_AVX2 s32 convert32to16_AVX2(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u32* sB = (const u32*) sP;
+			u16* dB = (u16*) dP;
+
+			s32 x = 0;
+			for (; x + 16 <= sN; x += 16)
+			{
+				const __m256i a = TPack::apply(
+						_mm256_loadu_si256((const __m256i *) (sB + x)));
+				const __m256i b = TPack::apply(
+						_mm256_loadu_si256((const __m256i *) (sB + x + 8)));
+
+				_mm256_storeu_si256((__m256i *) (dB + x), pack32to16_AVX2(a, b));
+			}
+
+			return x;
+		}
+
+		template<class TFormat>
+		IRR_TARGET_AVX2 s32 convert24to32_AVX2(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u8* sB = (const u8*) sP;
+			u32* dB = (u32*) dP;
+
+			s32 x = 0;
+			// load reads 4 bytes after 8 pixels
+			for (; x + 10 <= sN; x += 8)
+			{
+				_mm256_storeu_si256((__m256i *) (dB + x),
+						load24_AVX2<TFormat>(sB + x * 3));
+			}
+
+			return x;
+		}
+
+		template<class TFormat, class TPack>
+		IRR_TARGET_AVX2 s32 convert24to16_AVX2(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u8* sB = (const u8*) sP;
+			u16* dB = (u16*) dP;
+
+			s32 x = 0;
+			for (; x + 18 <= sN; x += 16)
+			{
+				const __m256i a = TPack::apply(load24_AVX2<TFormat>(sB + x * 3));
+				const __m256i b = TPack::apply(
+						load24_AVX2<TFormat>(sB + x * 3 + 24));
+
+				_mm256_storeu_si256((__m256i *) (dB + x), pack32to16_AVX2(a, b));
+			}
+
+			return x;
+		}
+
+		template<class TFormat>
+		IRR_TARGET_AVX2 s32 convert32to24_AVX2(const void* sP, s32 sN,
+				void* dP)
+		{
+			const u32* sB = (const u32*) sP;
+			u8* dB = (u8*) dP;
+
+			const __m128i mask = TFormat::compact();
+			const __m256i mask2 = _mm256_inserti128_si256(
+					_mm256_castsi128_si256(mask), mask, 1);
+
+			// 12 bytes of each lane to 24 continuous bytes
+			const __m256i join = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+
+			s32 x = 0;
+			// store writes 8 bytes after 8 pixels, they are overwritten later
+			for (; x + 11 <= sN; x += 8)
+			{
+				const __m256i v = _mm256_shuffle_epi8(
+						_mm256_loadu_si256((const __m256i *) (sB + x)), mask2);
+
+				_mm256_storeu_si256((__m256i *) (dB + x * 3),
+						_mm256_permutevar8x32_epi32(v, join));
+			}
+
+			return x;
+		}
+
+		/*
+		 * Tables
+		 */
+
+		static const SColorConverterSIMD ColorConverterSSSE3 =
+		{
+		convert16to32_SSSE3<SUnpackA1R5G5B5>,
+		convert16to16_SSSE3<SA1R5G5B5toR5G6B5>,
+		convert16to16_SSSE3<SA1R5G5B5toR5G5B5A1>,
+
+		convert32to24_SSSE3<SR8G8B8>,
+		convert32to24_SSSE3<SB8G8R8>,
+		convert32to16_SSSE3<SPackA1R5G5B5>,
+		convert32to16_SSSE3<SPackR5G6B5>,
+		convert32to32_SSSE3<SRotateAlpha>,
+		convert32to32_SSSE3<SSwapRedBlue>,
+
+		convert24to32_SSSE3<SR8G8B8>,
+		convert24to16_SSSE3<SR8G8B8, SPackA1R5G5B5>,
+		convert_R8G8B8toB8G8R8_SSSE3,
+		convert24to16_SSSE3<SR8G8B8, SPackR5G6B5>,
+
+		convert24to32_SSSE3<SB8G8R8>,
+		convert32to32_SSSE3<SByteSwap>,
+
+		convert16to32_SSSE3<SUnpackR5G6B5>,
+		convert16to16_SSSE3<SR5G6B5toA1R5G5B5> };
+
+		static const SColorConverterSIMD ColorConverterAVX2 =
+		{
+		convert16to32_AVX2<SUnpackA1R5G5B5>,
+		convert16to16_AVX2<SA1R5G5B5toR5G6B5>,
+		convert16to16_AVX2<SA1R5G5B5toR5G5B5A1>,
+
+		convert32to24_AVX2<SR8G8B8>,
+		convert32to24_AVX2<SB8G8R8>,
+		convert32to16_AVX2<SPackA1R5G5B5>,
+		convert32to16_AVX2<SPackR5G6B5>,
+		convert32to32_AVX2<SRotateAlpha>,
+		convert32to32_AVX2<SSwapRedBlue>,
+
+		convert24to32_AVX2<SR8G8B8>,
+		convert24to16_AVX2<SR8G8B8, SPackA1R5G5B5>,
+		// 24 bit swizzle does not gain from wider registers
+		convert_R8G8B8toB8G8R8_SSSE3,
+		convert24to16_AVX2<SR8G8B8, SPackR5G6B5>,
+
+		convert24to32_AVX2<SB8G8R8>,
+		convert32to32_AVX2<SByteSwap>,
+
+		convert16to32_AVX2<SUnpackR5G6B5>,
+		convert16to16_AVX2<SR5G6B5toA1R5G5B5> };
+
+		//! Returns SIMD conversions supported by current processor.
+		const SColorConverterSIMD* getColorConverterSIMD()
+		{
+			const core::SharedCPUFeatures& cpu =
+					core::SharedCPUFeatures::getInstance();
+
+			if (cpu.hasAVX2())
+				return &ColorConverterAVX2;
+
+			if (cpu.hasSSSE3())
+				return &ColorConverterSSSE3;
+
+			return 0;
+		}
+
+		//! Returns conversions of SSSE3 instruction set
+		const SColorConverterSIMD* getColorConverterSSSE3()
+		{
+			return &ColorConverterSSSE3;
+		}
+
+		//! Returns conversions of AVX2 instruction set
+		const SColorConverterSIMD* getColorConverterAVX2()
+		{
+			return &ColorConverterAVX2;
+		}
+
+	}  // namespace video
+}  // namespace irrgame
+
+#else
+
+namespace irrgame
+{
+	namespace video
+	{
+		//! Returns SIMD conversions supported by current processor.
+		const SColorConverterSIMD* getColorConverterSIMD()
+		{
+			return 0;
+		}
+
+		//! Returns conversions of SSSE3 instruction set
+		const SColorConverterSIMD* getColorConverterSSSE3()
+		{
+			return 0;
+		}
+
+		//! Returns conversions of AVX2 instruction set
+		const SColorConverterSIMD* getColorConverterAVX2()
+		{
+			return 0;
+		}
+
+	}  // namespace video
+}  // namespace irrgame
+
+#endif /* IRR_SIMD_COLOR_CONVERTER && IRR_X86_SIMD */
@@ -0,0 +1,63 @@
+/*
+ * SColorConverterSIMD.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef SCOLORCONVERTERSIMD_H_
+#define SCOLORCONVERTERSIMD_H_
+
+#include "compileConfig.h"
+
+namespace irrgame
+{
+	namespace video
+	{
+		//! SIMD part of color conversion.
+		//! Converts as many pixels from beginning as fit to vector registers.
+		//! Returns count of converted pixels. Rest must be converted by scalar code.
+		//! Following pixels may be overwritten, bytes after sN pixels are not.
+		typedef s32 (*tConvertColorsSIMD)(const void* sP, s32 sN, void* dP);
+
+		//! SIMD versions of SharedColorConverter bulk conversions for one instruction set.
+		//! Each one produces exactly the same pixels as its scalar reference.
+		struct SColorConverterSIMD
+		{
+			public:
+				tConvertColorsSIMD A1R5G5B5toA8R8G8B8;
+				tConvertColorsSIMD A1R5G5B5toR5G6B5;
+				tConvertColorsSIMD A1R5G5B5toR5G5B5A1;
+
+				tConvertColorsSIMD A8R8G8B8toR8G8B8;
+				tConvertColorsSIMD A8R8G8B8toB8G8R8;
+				tConvertColorsSIMD A8R8G8B8toA1R5G5B5;
+				tConvertColorsSIMD A8R8G8B8toR5G6B5;
+				tConvertColorsSIMD A8R8G8B8toR8G8B8A8;
+				tConvertColorsSIMD A8R8G8B8toA8B8G8R8;
+
+				tConvertColorsSIMD R8G8B8toA8R8G8B8;
+				tConvertColorsSIMD R8G8B8toA1R5G5B5;
+				tConvertColorsSIMD R8G8B8toB8G8R8;
+				tConvertColorsSIMD R8G8B8toR5G6B5;
+
+				tConvertColorsSIMD B8G8R8toA8R8G8B8;
+				tConvertColorsSIMD B8G8R8A8toA8R8G8B8;
+
+				tConvertColorsSIMD R5G6B5toA8R8G8B8;
+				tConvertColorsSIMD R5G6B5toA1R5G5B5;
+		};
+
+		//! Returns SIMD conversions supported by current processor.
+		//! 0 if there are no such or they are disabled by config.
+		const SColorConverterSIMD* getColorConverterSIMD();
+
+		//! Returns conversions of one instruction set, 0 if they are disabled
+		//! by config. Use them only if SharedCPUFeatures reports the set.
+		const SColorConverterSIMD* getColorConverterSSSE3();
+		const SColorConverterSIMD* getColorConverterAVX2();
+
+	}  // namespace video
+}  // namespace irrgame
+
+#endif /* SCOLORCONVERTERSIMD_H_ */
@@ -7,6 +7,7 @@
 #include "utils/StaticByteSwap.h"
 #include "video/utils/SharedVideoUtils.h"
 #include "string.h"
+#include "SColorConverterSIMD.h"
 
 namespace irrgame
 {
@@ -20,8 +21,10 @@ namespace irrgame
 		}
 
 		//! Default constructor. Should use only one time.
-		SharedColorConverter::SharedColorConverter()
+		SharedColorConverter::SharedColorConverter() :
+				SIMD(0)
 		{
+			SIMD = getColorConverterSIMD();
 		}
 
 		//! Destructor. Should use only one time.
@@ -29,6 +32,19 @@ namespace irrgame
 		{
 		}
 
+		//! Selects SIMD part of bulk conversions
+		void SharedColorConverter::setSIMD(
+				const SColorConverterSIMD* conversions)
+		{
+			SIMD = conversions;
+		}
+
+		//! Returns SIMD part of bulk conversions, 0 if there is none
+		const SColorConverterSIMD* SharedColorConverter::getSIMD() const
+		{
+			return SIMD;
+		}
+
 		//! Creates a 16 bit A1R5G5B5 color
 		u16 SharedColorConverter::RGBA16(u32 r, u32 g, u32 b, u32 a)
 		{
@@ -363,7 +379,11 @@ namespace irrgame
 			const u16* sB = (const u16*) sP;
 			u16* dB = (u16*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->A1R5G5B5toR5G5B5A1(sP, sN, dP) : 0;
+			sB += done;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 			{
 				*dB = (*sB << 1) | (*sB >> 15);
 				++sB;
@@ -377,7 +397,11 @@ namespace irrgame
 			u16* sB = (u16*) sP;
 			u32* dB = (u32*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->A1R5G5B5toA8R8G8B8(sP, sN, dP) : 0;
+			sB += done;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 				*dB++ = A1R5G5B5toA8R8G8B8(*sB++);
 		}
 
@@ -393,7 +417,11 @@ namespace irrgame
 			u16* sB = (u16*) sP;
 			u16* dB = (u16*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->A1R5G5B5toR5G6B5(sP, sN, dP) : 0;
+			sB += done;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 				*dB++ = A1R5G5B5toR5G6B5(*sB++);
 		}
 
@@ -403,7 +431,11 @@ namespace irrgame
 			u8* sB = (u8*) sP;
 			u8* dB = (u8*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->A8R8G8B8toR8G8B8(sP, sN, dP) : 0;
+			sB += done * 4;
+			dB += done * 3;
+
+			for (s32 x = done; x < sN; ++x)
 			{
 				// sB[3] is alpha
 				dB[0] = sB[2];
@@ -421,7 +453,11 @@ namespace irrgame
 			u8* sB = (u8*) sP;
 			u8* dB = (u8*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->A8R8G8B8toB8G8R8(sP, sN, dP) : 0;
+			sB += done * 4;
+			dB += done * 3;
+
+			for (s32 x = done; x < sN; ++x)
 			{
 				// sB[3] is alpha
 				dB[0] = sB[0];
@@ -445,7 +481,11 @@ namespace irrgame
 			u32* sB = (u32*) sP;
 			u16* dB = (u16*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->A8R8G8B8toA1R5G5B5(sP, sN, dP) : 0;
+			sB += done;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 				*dB++ = A8R8G8B8toA1R5G5B5(*sB++);
 		}
 
@@ -455,7 +495,11 @@ namespace irrgame
 			u8 * sB = (u8 *) sP;
 			u16* dB = (u16*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->A8R8G8B8toR5G6B5(sP, sN, dP) : 0;
+			sB += done * 4;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 			{
 				s32 r = sB[2] >> 3;
 				s32 g = sB[1] >> 2;
@@ -499,7 +543,11 @@ namespace irrgame
 			u8* sB = (u8*) sP;
 			u32* dB = (u32*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->R8G8B8toA8R8G8B8(sP, sN, dP) : 0;
+			sB += done * 3;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 			{
 				*dB = 0xff000000 | (sB[0] << 16) | (sB[1] << 8) | sB[2];
 
@@ -514,7 +562,11 @@ namespace irrgame
 			u8 * sB = (u8 *) sP;
 			u16* dB = (u16*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->R8G8B8toA1R5G5B5(sP, sN, dP) : 0;
+			sB += done * 3;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 			{
 				s32 r = sB[0] >> 3;
 				s32 g = sB[1] >> 3;
@@ -533,7 +585,11 @@ namespace irrgame
 			u8* sB = (u8*) sP;
 			u32* dB = (u32*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->B8G8R8toA8R8G8B8(sP, sN, dP) : 0;
+			sB += done * 3;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 			{
 				*dB = 0xff000000 | (sB[2] << 16) | (sB[1] << 8) | sB[0];
 
@@ -548,7 +604,11 @@ namespace irrgame
 			const u32* sB = (const u32*) sP;
 			u32* dB = (u32*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->A8R8G8B8toR8G8B8A8(sP, sN, dP) : 0;
+			sB += done;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 			{
 				*dB++ = (*sB << 8) | (*sB >> 24);
 				++sB;
@@ -561,7 +621,11 @@ namespace irrgame
 			const u32* sB = (const u32*) sP;
 			u32* dB = (u32*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->A8R8G8B8toA8B8G8R8(sP, sN, dP) : 0;
+			sB += done;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 			{
 				*dB++ = (*sB & 0xff00ff00) | ((*sB & 0x00ff0000) >> 16)
 						| ((*sB & 0x000000ff) << 16);
@@ -575,7 +639,11 @@ namespace irrgame
 			const u32* sB = static_cast<const u32*>(sP);
 			u32* dB = static_cast<u32*>(dP);
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->B8G8R8A8toA8R8G8B8(sP, sN, dP) : 0;
+			sB += done;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 			{
 
 				*dB++ = utils::StaticByteSwap::byteswap(*sB);
@@ -591,7 +659,11 @@ namespace irrgame
 			u8* sB = (u8*) sP;
 			u8* dB = (u8*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->R8G8B8toB8G8R8(sP, sN, dP) : 0;
+			sB += done * 3;
+			dB += done * 3;
+
+			for (s32 x = done; x < sN; ++x)
 			{
 				dB[2] = sB[0];
 				dB[1] = sB[1];
@@ -608,7 +680,11 @@ namespace irrgame
 			u8 * sB = (u8 *) sP;
 			u16* dB = (u16*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->R8G8B8toR5G6B5(sP, sN, dP) : 0;
+			sB += done * 3;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 			{
 				s32 r = sB[0] >> 3;
 				s32 g = sB[1] >> 2;
@@ -667,7 +743,11 @@ namespace irrgame
 			u16* sB = (u16*) sP;
 			u32* dB = (u32*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->R5G6B5toA8R8G8B8(sP, sN, dP) : 0;
+			sB += done;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 				*dB++ = R5G6B5toA8R8G8B8(*sB++);
 		}
 
@@ -677,7 +757,11 @@ namespace irrgame
 			u16* sB = (u16*) sP;
 			u16* dB = (u16*) dP;
 
-			for (s32 x = 0; x < sN; ++x)
+			const s32 done = SIMD ? SIMD->R5G6B5toA1R5G5B5(sP, sN, dP) : 0;
+			sB += done;
+			dB += done;
+
+			for (s32 x = done; x < sN; ++x)
 				*dB++ = R5G6B5toA1R5G5B5(*sB++);
 		}
 
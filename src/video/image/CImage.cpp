@@ -7,9 +7,11 @@
 #include "video/blit/blit.h"
 #include "video/utils/SharedVideoUtils.h"
 #include "core/math/SharedFastMath.h"
+#include "core/collections/array.h"
 #include "core/collections/stringc.h"
 #include "io/utils/ioutils.h"
 #include "io/IReadFile.h"
+#include "threads/SharedJobPool.h"
 
 //for memcpy
 #include "string.h"
@@ -360,24 +362,30 @@ namespace irrgame
 				}
 			}
 
-			const f32 sourceXStep = (f32) Size.Width / (f32) width;
+			SScalingJob job;
+			job.Image = this;
+			job.Target = (u8*) target;
+			job.TargetImage = 0;
+			job.Width = width;
+			job.Format = format;
+			job.Pitch = pitch;
+			job.BytesPerPixel = bpp;
+			job.SourceXStep = (f32) Size.Width / (f32) width;
+
+			// offsets of source rows are accumulated like in sequential version
 			const f32 sourceYStep = (f32) Size.Height / (f32) height;
-			s32 yval = 0, syval = 0;
+			core::array<s32> sourceRows(height);
+			s32 syval = 0;
 			f32 sy = 0.0f;
 			for (u32 y = 0; y < height; ++y)
 			{
-				f32 sx = 0.0f;
-				for (u32 x = 0; x < width; ++x)
-				{
-					SharedColorConverter::getInstance().convert_viaFormat(
-							Data + syval + ((s32) sx) * BytesPerPixel, Format,
-							1, ((u8*) target) + yval + (x * bpp), format);
-					sx += sourceXStep;
-				}
+				sourceRows.pushBack(syval);
 				sy += sourceYStep;
 				syval = ((s32) sy) * Pitch;
-				yval += pitch;
 			}
+			job.SourceRows = sourceRows.pointer();
+
+			executeScalingJob(copyToScalingRows, job, height);
 		}
 
 		//! copies this surface into another, scaling it to the target image size
@@ -406,34 +414,98 @@ namespace irrgame
 		{
 			const core::dimension2d<u32> destSize = target->getDimension();
 
-			const f32 sourceXStep = (f32) Size.Width / (f32) destSize.Width;
+			SScalingJob job;
+			job.Image = this;
+			job.Target = 0;
+			job.TargetImage = target;
+			job.Width = destSize.Width;
+			job.SourceXStep = (f32) Size.Width / (f32) destSize.Width;
+			job.Bias = bias;
+			job.Blend = blend;
+
 			const f32 sourceYStep = (f32) Size.Height / (f32) destSize.Height;
 
+			job.BoxWidth = core::SharedFastMath::getInstance().ceil32(
+					job.SourceXStep);
+			job.BoxHeight = core::SharedFastMath::getInstance().ceil32(
+					sourceYStep);
+
+			// source rows are accumulated like in sequential version
+			core::array<s32> sourceRows(destSize.Height);
+			f32 sy = 0.f;
+			for (u32 y = 0; y != destSize.Height; ++y)
+			{
+				sourceRows.pushBack(
+						core::SharedFastMath::getInstance().floor32(sy));
+				sy += sourceYStep;
+			}
+			job.SourceRows = sourceRows.pointer();
+
 			target->lock();
 
-			s32 fx = core::SharedFastMath::getInstance().ceil32(sourceXStep);
-			s32 fy = core::SharedFastMath::getInstance().ceil32(sourceYStep);
-			f32 sx;
-			f32 sy;
+			executeScalingJob(copyToScalingBoxFilterRows, job, destSize.Height);
 
-			sy = 0.f;
-			for (u32 y = 0; y != destSize.Height; ++y)
+			target->unlock();
+		}
+
+		//! Proceed rows [begin; end) of copyToScaling. Context is SScalingJob
+		void CImage::copyToScalingRows(void* context, u32 begin, u32 end)
+		{
+			const SScalingJob* job = (const SScalingJob*) context;
+			const CImage* image = job->Image;
+
+			for (u32 y = begin; y < end; ++y)
+			{
+				u8* target = job->Target + y * job->Pitch;
+				const u8* source = image->Data + job->SourceRows[y];
+
+				f32 sx = 0.0f;
+				for (u32 x = 0; x < job->Width; ++x)
+				{
+					SharedColorConverter::getInstance().convert_viaFormat(
+							source + ((s32) sx) * image->BytesPerPixel,
+							image->Format, 1, target + (x * job->BytesPerPixel),
+							job->Format);
+					sx += job->SourceXStep;
+				}
+			}
+		}
+
+		//! Proceed rows [begin; end) of copyToScalingBoxFilter. Context is SScalingJob
+		void CImage::copyToScalingBoxFilterRows(void* context, u32 begin,
+				u32 end)
+		{
+			const SScalingJob* job = (const SScalingJob*) context;
+			const CImage* image = job->Image;
+
+			for (u32 y = begin; y < end; ++y)
 			{
-				sx = 0.f;
-				for (u32 x = 0; x != destSize.Width; ++x)
+				f32 sx = 0.f;
+				for (u32 x = 0; x != job->Width; ++x)
 				{
-					target->setPixel(x, y,
-							getPixelBox(
+					job->TargetImage->setPixel(x, y,
+							image->getPixelBox(
 									core::SharedFastMath::getInstance().floor32(
-											sx),
-									core::SharedFastMath::getInstance().floor32(
-											sy), fx, fy, bias), blend);
-					sx += sourceXStep;
+											sx), job->SourceRows[y],
+									job->BoxWidth, job->BoxHeight, job->Bias),
+							job->Blend);
+					sx += job->SourceXStep;
 				}
-				sy += sourceYStep;
 			}
+		}
 
-			target->unlock();
+		//! Proceed rows of scaling. Large images are proceed in parallel by row bands.
+		void CImage::executeScalingJob(threads::tParallelJob rows,
+				SScalingJob& job, u32 height)
+		{
+			if (job.Width * height < getParallelBlitThreshold())
+			{
+				rows(&job, 0, height);
+				return;
+			}
+
+			threads::SharedJobPool::getInstance().parallelFor(rows, &job,
+					height, getParallelBlitBandRows(job.Width));
 		}
 
 		//! fills the surface with given color
@@ -7,6 +7,7 @@
 
 #include "video/image/IImage.h"
 #include "core/shapes/dimension2d.h"
+#include "threads/SharedJobPool.h"
 
 namespace irrgame
 {
@@ -126,6 +127,47 @@ namespace irrgame
 				inline SColor getPixelBox(s32 x, s32 y, s32 fx, s32 fy,
 						s32 bias) const;
 
+				//! Rows of copyToScaling and copyToScalingBoxFilter.
+				//! Each row depends only on job, so rows can be proceed in parallel.
+				struct SScalingJob
+				{
+					public:
+						const CImage* Image;
+
+						//! Target of copyToScaling
+						u8* Target;
+						u32 Pitch;
+						u32 BytesPerPixel;
+						EColorFormat Format;
+
+						//! Target of copyToScalingBoxFilter
+						IImage* TargetImage;
+						s32 BoxWidth;
+						s32 BoxHeight;
+						s32 Bias;
+						bool Blend;
+
+						//! Width of target
+						u32 Width;
+
+						f32 SourceXStep;
+
+						//! Source row of each target row
+						const s32* SourceRows;
+				};
+
+				//! Proceed rows [begin; end) of copyToScaling. Context is SScalingJob
+				static void copyToScalingRows(void* context, u32 begin,
+						u32 end);
+
+				//! Proceed rows [begin; end) of copyToScalingBoxFilter. Context is SScalingJob
+				static void copyToScalingBoxFilterRows(void* context,
+						u32 begin, u32 end);
+
+				//! Proceed rows of scaling. Large images are proceed in parallel by row bands.
+				static void executeScalingJob(threads::tParallelJob rows,
+						SScalingJob& job, u32 height);
+
 			private:
 
 				u8* Data;
@@ -91,8 +91,29 @@ namespace irrgame
 			s32 lineData = widthInBytes + ((4 - (widthInBytes % 4))) % 4;
 			pitch = lineData - widthInBytes;
 
-			u8* bmpData = new u8[header.BitmapDataSize];
-			file->read(bmpData, header.BitmapDataSize);
+			u8* bmpData = 0;
+
+			// uncompressed data of memory and memory mapped files is used in
+			// place, if it is aligned for pixels which converter reads
+			const u8* bmpPointer = 0;
+
+			if (header.Compression == 0
+					&& (long) header.BitmapDataOffset + header.BitmapDataSize
+							<= file->getSize())
+			{
+				const u8* pointer = static_cast<const u8*>(file->getPointer());
+				const size_t alignment =
+						header.BPP == 32 ? 4 : (header.BPP == 16 ? 2 : 1);
+
+				if (((size_t) pointer & (alignment - 1)) == 0)
+					bmpPointer = pointer;
+			}
+
+			if (!bmpPointer)
+			{
+				bmpData = new u8[header.BitmapDataSize];
+				file->read(bmpData, header.BitmapDataSize);
+			}
 
 			// decompress data if needed
 			switch (header.Compression)
@@ -111,6 +132,9 @@ namespace irrgame
 				}
 			}
 
+			if (bmpData)
+				bmpPointer = bmpData;
+
 			/*
 			 * create surface
 			 */
@@ -129,7 +153,7 @@ namespace irrgame
 					result = IImage::createEmptyImage(ECF_A1R5G5B5, dim);//new CImage(ECF_A1R5G5B5, dim);
 
 					SharedColorConverter::getInstance().convert1BitTo16Bit(
-							bmpData, (s16*) result->lock(), header.Width,
+							bmpPointer, (s16*) result->lock(), header.Width,
 							header.Height, pitch, true);
 
 					break;
@@ -139,7 +163,7 @@ namespace irrgame
 					result = IImage::createEmptyImage(ECF_A1R5G5B5, dim);
 
 					SharedColorConverter::getInstance().convert4BitTo16Bit(
-							bmpData, (s16*) result->lock(), header.Width,
+							bmpPointer, (s16*) result->lock(), header.Width,
 							header.Height, paletteData, pitch, true);
 
 					break;
@@ -149,7 +173,7 @@ namespace irrgame
 					result = IImage::createEmptyImage(ECF_A1R5G5B5, dim);
 
 					SharedColorConverter::getInstance().convert8BitTo16Bit(
-							bmpData, (s16*) result->lock(), header.Width,
+							bmpPointer, (s16*) result->lock(), header.Width,
 							header.Height, paletteData, pitch, true);
 
 					break;
@@ -159,7 +183,7 @@ namespace irrgame
 					result = IImage::createEmptyImage(ECF_A1R5G5B5, dim);
 
 					SharedColorConverter::getInstance().convert16BitTo16Bit(
-							(s16*) bmpData, (s16*) result->lock(), header.Width,
+							(const s16*) bmpPointer, (s16*) result->lock(), header.Width,
 							header.Height, pitch, true);
 					break;
 				}
@@ -168,7 +192,7 @@ namespace irrgame
 					result = IImage::createEmptyImage(ECF_R8G8B8, dim);
 
 					SharedColorConverter::getInstance().convert24BitTo24Bit(
-							bmpData, (u8*) result->lock(), header.Width,
+							bmpPointer, (u8*) result->lock(), header.Width,
 							header.Height, pitch, true, true);
 
 					break;
@@ -178,7 +202,7 @@ namespace irrgame
 					result = IImage::createEmptyImage(ECF_A8R8G8B8, dim);
 
 					SharedColorConverter::getInstance().convert32BitTo32Bit(
-							(s32*) bmpData, (s32*) result->lock(), header.Width,
+							(const s32*) bmpPointer, (s32*) result->lock(), header.Width,
 							header.Height, pitch, true);
 
 					break;
@@ -58,9 +58,19 @@ namespace irrgame
 
 			file->seek(0);
 
-			u8 **rowPtr = 0;
-			u8* input = new u8[file->getSize()];
-			file->read(input, file->getSize());
+			// freed after longjmp, so they must not be cached in registers
+			u8** volatile rowPtr = 0;
+
+			// memory and memory mapped files are decoded in place
+			const u8* input = static_cast<const u8*>(file->getBuffer());
+			u8* volatile inputCopy = 0;
+
+			if (!input)
+			{
+				inputCopy = new u8[file->getSize()];
+				file->read(inputCopy, file->getSize());
+				input = inputCopy;
+			}
 
 			// allocate and initialize JPEG decompression object
 			struct jpeg_decompress_struct cinfo;
@@ -87,7 +97,7 @@ namespace irrgame
 
 				jpeg_destroy_decompress(&cinfo);
 
-				delete[] input;
+				delete[] inputCopy;
 
 				// if the row pointer was created, we delete it.
 				if (rowPtr)
@@ -209,7 +219,7 @@ namespace irrgame
 						dimension2du(width, height), output);
 			}
 
-			delete[] input;
+			delete[] inputCopy;
 
 			return result;
 		}
@@ -0,0 +1,385 @@
+/*
+ * testLinearArena.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Blocks of LinearArena must be aligned and must not overlap, ScopedArena
+// must release only its own blocks, and steady per frame workload, also of
+// arrays bound to arena, must stop calling system allocator after reset.
+
+#include "core/allocator/LinearArena.h"
+#include "core/allocator/ScopedArena.h"
+#include "core/allocator/LinearArenaAllocator.h"
+#include "core/collections/array.h"
+#include "core/collections/stringc.h"
+#include "core/shapes/vector3d.h"
+
+#include "testUtils.h"
+
+#include <string.h>
+
+using namespace irrgame;
+
+namespace
+{
+	//! Block of arena filled with own pattern
+	struct SBlock
+	{
+		public:
+			u8* Pointer;
+			u32 Size;
+			u8 Pattern;
+	};
+
+	//! Allocates random blocks, returns count of failures
+	s32 allocateBlocks(core::LinearArena& arena, core::array<SBlock>& blocks,
+			u32 count, tests::CTestRandom& random)
+	{
+		s32 failures = 0;
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			const size_t alignment = (size_t) 1 << random.next(8);
+
+			SBlock block;
+			block.Size = random.next(10) ? 1 + random.next(200)
+					: 1 + random.next(20000);
+			block.Pointer = (u8*) arena.allocate(block.Size, alignment);
+			block.Pattern = (u8) random.next(256);
+
+			if ((size_t) block.Pointer & (alignment - 1))
+				++failures;
+
+			memset(block.Pointer, block.Pattern, block.Size);
+			blocks.pushBack(block);
+		}
+
+		return failures;
+	}
+
+	//! Returns count of blocks, which were overwritten by other blocks
+	s32 checkBlocks(const core::array<SBlock>& blocks)
+	{
+		s32 failures = 0;
+
+		for (u32 i = 0; i < blocks.size(); ++i)
+		{
+			for (u32 k = 0; k < blocks[i].Size; ++k)
+			{
+				if (blocks[i].Pointer[k] != blocks[i].Pattern)
+				{
+					++failures;
+					break;
+				}
+			}
+		}
+
+		return failures;
+	}
+
+	s32 checkBlocks(tests::CTestRandom& random)
+	{
+		core::LinearArena arena(4096);
+		core::array<SBlock> blocks;
+
+		s32 failures = allocateBlocks(arena, blocks, 2000, random);
+		failures += checkBlocks(blocks);
+
+		if (arena.getUsedSize() > arena.getAllocatedSize())
+			++failures;
+
+		arena.reset();
+
+		if (arena.getUsedSize() != 0)
+			++failures;
+
+		return failures;
+	}
+
+	s32 checkScopes(tests::CTestRandom& random)
+	{
+		core::LinearArena arena(4096);
+		core::array<SBlock> blocks;
+
+		s32 failures = allocateBlocks(arena, blocks, 100, random);
+		const size_t used = arena.getUsedSize();
+
+		{
+			core::ScopedArena outer(arena);
+			u32* values = outer.allocate<u32>(1000);
+
+			for (u32 i = 0; i < 1000; ++i)
+				values[i] = i;
+
+			const size_t outerUsed = arena.getUsedSize();
+
+			{
+				// big block takes new chunk
+				core::ScopedArena inner(arena);
+				inner.allocate(100000);
+			}
+
+			if (arena.getUsedSize() != outerUsed)
+				++failures;
+
+			for (u32 i = 0; i < 1000; ++i)
+			{
+				if (values[i] != i)
+				{
+					++failures;
+					break;
+				}
+			}
+		}
+
+		if (arena.getUsedSize() != used)
+			++failures;
+
+		// blocks after rewind reuse memory, older blocks stay intact
+		core::array<SBlock> scoped;
+
+		for (u32 i = 0; i < 10; ++i)
+		{
+			core::ScopedArena scope(arena);
+			failures += allocateBlocks(arena, scoped, 50, random);
+			scoped.clear();
+		}
+
+		failures += checkBlocks(blocks);
+
+		return failures;
+	}
+
+	//! Position of three doubles, 24 bytes
+	struct SPosition
+	{
+		public:
+			double X;
+			double Y;
+			double Z;
+	};
+
+	//! Color of three bytes
+	struct SColor3
+	{
+		public:
+			u8 Channels[3];
+	};
+
+	//! Allocates objects, which size is not power of two, from scope
+	template<class T>
+	s32 checkScopedType(core::ScopedArena& scope, size_t alignment)
+	{
+		s32 failures = 0;
+
+		for (u32 count = 1; count < 20; ++count)
+		{
+			T* values = scope.allocate<T>(count);
+
+			if ((size_t) values & (alignment - 1))
+				++failures;
+
+			memset((void*) values, (s32) count, count * sizeof(T));
+		}
+
+		return failures;
+	}
+
+	s32 checkScopedTypes()
+	{
+		core::LinearArena arena(4096);
+		core::ScopedArena scope(arena);
+
+		s32 failures = 0;
+
+		// 12 bytes of vector3df are aligned by 4
+		failures += checkScopedType<vector3df>(scope, 4);
+		failures += checkScopedType<SColor3>(scope, 1);
+		failures += checkScopedType<SPosition>(scope, 8);
+		failures += checkScopedType<SBlock>(scope, sizeof(void*));
+
+		vector3df* positions = scope.allocate<vector3df>(100);
+
+		for (u32 i = 0; i < 100; ++i)
+			positions[i].set((f32) i, 1.f, 2.f);
+
+		SColor3* colors = scope.allocate<SColor3>(100);
+		memset(colors, 0xFF, 100 * sizeof(SColor3));
+
+		for (u32 i = 0; i < 100; ++i)
+		{
+			if (positions[i] != vector3df((f32) i, 1.f, 2.f))
+			{
+				++failures;
+				break;
+			}
+		}
+
+		return failures;
+	}
+
+	s32 checkFrames()
+	{
+		core::LinearArena arena(4096);
+		core::array<SBlock> blocks;
+
+		s32 failures = 0;
+		u32 count = 0;
+
+		for (u32 frame = 0; frame < 50; ++frame)
+		{
+			// same workload every frame
+			tests::CTestRandom frameRandom(7);
+
+			failures += allocateBlocks(arena, blocks, 500, frameRandom);
+			failures += checkBlocks(blocks);
+
+			blocks.clear();
+			arena.reset();
+
+			if (frame == 1)
+				count = arena.getSystemAllocationCount();
+		}
+
+		// chunks are merged on reset, so later frames fit in one chunk
+		if (arena.getSystemAllocationCount() != count)
+			++failures;
+
+		return failures;
+	}
+
+	s32 checkReallocate()
+	{
+		core::LinearArena arena(4096);
+
+		s32 failures = 0;
+
+		u8* first = (u8*) arena.reallocate(0, 0, 100);
+		memset(first, 1, 100);
+
+		const size_t used = arena.getUsedSize();
+
+		// last block grows and shrinks in place
+		if (arena.reallocate(first, 100, 1000) != first
+				|| arena.getUsedSize() != used + 900
+				|| arena.reallocate(first, 1000, 50) != first
+				|| arena.getUsedSize() != used - 50)
+			++failures;
+
+		memset(first + 50, 1, 150);
+
+		u8* second = (u8*) arena.allocate(10);
+		memset(second, 2, 10);
+
+		// older block is copied
+		u8* moved = (u8*) arena.reallocate(first, 200, 300);
+
+		if (moved == first || moved[0] != 1 || moved[199] != 1
+				|| second[0] != 2)
+			++failures;
+
+		// block which does not fit into chunk is copied to new chunk
+		memset(moved, 3, 300);
+		u8* big = (u8*) arena.reallocate(moved, 300, 10000);
+
+		if (big == moved || big[0] != 3 || big[299] != 3
+				|| ((size_t) big & 15))
+			++failures;
+
+		return failures;
+	}
+
+	typedef core::array<u32, threads::NullLock,
+			core::LinearArenaAllocator<u32> > arena_array;
+
+	typedef core::array<core::stringc, threads::NullLock,
+			core::LinearArenaAllocator<core::stringc> > arena_stringc_array;
+
+	//! Copies, assigns, swaps and grows arrays of arena
+	s32 fillArrays(core::LinearArena& arena)
+	{
+		s32 failures = 0;
+
+		arena_array a(arena);
+
+		for (u32 i = 0; i < 10000; ++i)
+			a.pushBack(i);
+
+		arena_array b(a);
+		arena_array c(arena);
+		c = b;
+		c.swap(a);
+
+		for (u32 i = 0; i < 10000; ++i)
+		{
+			if (a[i] != i || b[i] != i || c[i] != i)
+			{
+				++failures;
+				break;
+			}
+		}
+
+		// strings are destructed by array, their text is on heap
+		arena_stringc_array strings(arena);
+
+		for (s32 i = 0; i < 100; ++i)
+		{
+			strings.pushBack(
+					core::stringc("string longer than inline buffer ")
+							+ core::stringc(i));
+		}
+
+		if (strings[99] != "string longer than inline buffer 99")
+			++failures;
+
+		return failures;
+	}
+
+	s32 checkArrays()
+	{
+		core::LinearArena arena(4096);
+
+		s32 failures = 0;
+		u32 count = 0;
+
+		for (u32 frame = 0; frame < 50; ++frame)
+		{
+			// arrays must be destroyed before reset
+			failures += fillArrays(arena);
+
+			if (arena.getUsedSize() == 0)
+				++failures;
+
+			arena.reset();
+
+			if (frame == 1)
+				count = arena.getSystemAllocationCount();
+		}
+
+		if (arena.getSystemAllocationCount() != count)
+			++failures;
+
+		return failures;
+	}
+}
+
+int main()
+{
+	tests::CTestRandom random;
+	s32 failures = 0;
+
+	failures += tests::report("arena blocks are aligned and separate",
+			checkBlocks(random));
+	failures += tests::report("scoped arena releases own blocks",
+			checkScopes(random));
+	failures += tests::report("scoped arena objects of any size",
+			checkScopedTypes());
+	failures += tests::report("arena frames without system allocations",
+			checkFrames());
+	failures += tests::report("arena blocks reallocate", checkReallocate());
+	failures += tests::report("arrays bound to arena", checkArrays());
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,264 @@
+/*
+ * testSlabAllocator.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Blocks of SharedSlabAllocator must be aligned and must not overlap when
+// threads allocate and free them at random, also blocks freed by other
+// thread. Exiting threads must return their caches, so short threads do
+// not take new spans.
+
+#include "core/allocator/SharedSlabAllocator.h"
+#include "core/collections/list/list.h"
+#include "core/collections/map/map.h"
+#include "threads/irrgameThread.h"
+#include "threads/lock/MonitorLock.h"
+
+#include "testUtils.h"
+
+#include <string.h>
+
+using namespace irrgame;
+
+namespace
+{
+	const u32 Threads = 4;
+	const u32 Slots = 512;
+
+	const u32 MaxBlockSize = core::SharedSlabAllocator::MaxBlockSize;
+	const u32 ClassStep = core::SharedSlabAllocator::ClassStep;
+
+	//! Allocated block filled with own pattern
+	struct SBlock
+	{
+		public:
+			u8* Pointer;
+			u32 Size;
+	};
+
+	//! Returns true if block holds its pattern
+	bool isIntact(const SBlock& block)
+	{
+		for (u32 i = 0; i < block.Size; ++i)
+		{
+			if (block.Pointer[i] != (u8) block.Size)
+				return false;
+		}
+
+		return true;
+	}
+
+	class CStress
+	{
+		public:
+
+			CStress() :
+					Failures(0)
+			{
+			}
+
+			//! Allocates and frees blocks at random, leaves some to main
+			//! thread
+			s32 run(void* /* arg */)
+			{
+				core::SharedSlabAllocator& slab =
+						core::SharedSlabAllocator::getInstance();
+
+				SBlock blocks[Slots];
+				memset(blocks, 0, sizeof(blocks));
+
+				// seed differs for each thread
+				tests::CTestRandom random((u32) (size_t) blocks);
+				s32 failures = 0;
+
+				for (u32 i = 0; i < 200000; ++i)
+				{
+					SBlock& block = blocks[random.next(Slots)];
+
+					if (block.Pointer)
+					{
+						if (!isIntact(block))
+							++failures;
+
+						slab.deallocate(block.Pointer, block.Size);
+						block.Pointer = 0;
+					}
+					else
+					{
+						// bigger blocks go to operator new
+						block.Size = 1 + random.next(300);
+						block.Pointer = (u8*) slab.allocate(block.Size);
+
+						if (block.Size <= MaxBlockSize
+								&& (size_t) block.Pointer & (ClassStep - 1))
+							++failures;
+
+						memset(block.Pointer, (u8) block.Size, block.Size);
+					}
+				}
+
+				Lock.enter();
+
+				Failures += failures;
+
+				for (u32 i = 0; i < Slots; ++i)
+				{
+					if (blocks[i].Pointer)
+						Left.pushBack(blocks[i]);
+				}
+
+				Lock.exit();
+
+				return 0;
+			}
+
+			//! Frees blocks left by threads
+			s32 freeLeft()
+			{
+				core::SharedSlabAllocator& slab =
+						core::SharedSlabAllocator::getInstance();
+
+				s32 failures = Failures;
+
+				for (u32 i = 0; i < Left.size(); ++i)
+				{
+					if (!isIntact(Left[i]))
+						++failures;
+
+					slab.deallocate(Left[i].Pointer, Left[i].Size);
+				}
+
+				Left.clear();
+
+				return failures;
+			}
+
+		private:
+
+			threads::MonitorLock Lock;
+			core::array<SBlock> Left;
+			s32 Failures;
+	};
+
+	s32 checkThreads(u32 count)
+	{
+		CStress stress;
+
+		threads::delegateThreadCallback callback;
+		callback += NewDelegate(&stress, &CStress::run);
+
+		tests::runThreads(&callback, count);
+
+		return stress.freeLeft();
+	}
+
+	//! Short thread, which cycles blocks of one size class
+	class CShortThread
+	{
+		public:
+
+			s32 run(void* /* arg */)
+			{
+				core::SharedSlabAllocator& slab =
+						core::SharedSlabAllocator::getInstance();
+
+				void* blocks[100];
+
+				for (u32 i = 0; i < 10; ++i)
+				{
+					for (u32 k = 0; k < 100; ++k)
+						blocks[k] = slab.allocate(BlockSize);
+
+					for (u32 k = 0; k < 100; ++k)
+						slab.deallocate(blocks[k], BlockSize);
+				}
+
+				return 0;
+			}
+
+		public:
+
+			//! Size of blocks, all of them are in one size class
+			static const u32 BlockSize = 248;
+	};
+
+	s32 checkThreadExit()
+	{
+		core::SharedSlabAllocator& slab =
+				core::SharedSlabAllocator::getInstance();
+
+		// main thread cache must not serve this class
+		slab.flushThreadCache();
+
+		CShortThread worker;
+
+		threads::delegateThreadCallback callback;
+		callback += NewDelegate(&worker, &CShortThread::run);
+
+		tests::runThreads(&callback, 1);
+
+		const u32 spans = slab.getSpansCount();
+
+		for (u32 i = 0; i < 200; ++i)
+			tests::runThreads(&callback, 1);
+
+		// blocks of exited threads are taken from depot
+		return slab.getSpansCount() != spans ? 1 : 0;
+	}
+
+	s32 checkContainers()
+	{
+		s32 failures = 0;
+
+		core::list<s32> values;
+
+		for (s32 i = 0; i < 1000; ++i)
+			values.pushBack(i);
+
+		s32 expected = 0;
+
+		for (core::list<s32>::Iterator it = values.begin(); it != values.end();
+				++it)
+		{
+			if (*it != expected++)
+				++failures;
+		}
+
+		values.clear();
+
+		core::map<s32, s32> nodes;
+
+		for (s32 i = 0; i < 1000; ++i)
+			nodes.insert(i, i * 2);
+
+		for (s32 i = 0; i < 500; ++i)
+			nodes.remove(i);
+
+		if (nodes.size() != 500 || nodes.find(100)
+				|| !nodes.find(700) || nodes.find(700)->getValue() != 1400)
+			++failures;
+
+		return failures;
+	}
+}
+
+int main()
+{
+	s32 failures = 0;
+	c8 name[128];
+
+	failures += tests::report("slab list and map nodes", checkContainers());
+
+	for (u32 count = 1; count <= Threads; count *= 2)
+	{
+		sprintf(name, "slab random blocks, %u threads", count);
+		failures += tests::report(name, checkThreads(count));
+	}
+
+	failures += tests::report("slab caches of exited threads are reused",
+			checkThreadExit());
+
+	return failures ? 1 : 0;
+}
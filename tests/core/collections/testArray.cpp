@@ -0,0 +1,318 @@
+/*
+ * testArray.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// array must hold the same elements as std::vector after random pushes,
+// inserts and erases of trivially copyable elements, which are relocated
+// by memcpy, and of other elements, which are moved. Every constructed
+// element must be destructed exactly once.
+
+#include "core/collections/array.h"
+#include "core/collections/stringc.h"
+#include "core/utils/typeTraits.h"
+#include "video/vertex/vertex3dTangents.h"
+#include "video/color/SColor.h"
+
+#include "testUtils.h"
+
+#include <vector>
+
+using namespace irrgame;
+
+namespace
+{
+	//! Element with own copy and destructor, counts living objects
+	class CCounted
+	{
+		public:
+
+			CCounted(s32 value = 0) :
+					Value(value), Self(this)
+			{
+				++Alive;
+			}
+
+			CCounted(const CCounted& other) :
+					Value(other.Value), Self(this)
+			{
+				++Alive;
+			}
+
+			~CCounted()
+			{
+				// memcpy relocation would break it
+				if (Self != this)
+					++Broken;
+
+				--Alive;
+			}
+
+			CCounted& operator=(const CCounted& other)
+			{
+				Value = other.Value;
+				return *this;
+			}
+
+			bool operator==(const CCounted& other) const
+			{
+				return Value == other.Value && Self == this;
+			}
+
+		public:
+
+			static s32 Alive;
+			static s32 Broken;
+
+		private:
+
+			s32 Value;
+			CCounted* Self;
+	};
+
+	s32 CCounted::Alive = 0;
+	s32 CCounted::Broken = 0;
+
+	s32 createInt(u32 index)
+	{
+		return index;
+	}
+
+	core::stringc createString(u32 index)
+	{
+		core::stringc result((s32) index);
+
+		if (index % 3 == 0)
+			result.append("_suffix_which_moves_string_to_heap");
+
+		return result;
+	}
+
+	video::vertex3dTangents createVertex(u32 index)
+	{
+		return video::vertex3dTangents((f32) index, 1, 2);
+	}
+
+	CCounted createCounted(u32 index)
+	{
+		return CCounted(index);
+	}
+
+	template<class T>
+	s32 compare(const core::array<T>& values, const std::vector<T>& reference)
+	{
+		if (values.size() != reference.size())
+			return 1;
+
+		for (u32 i = 0; i < reference.size(); ++i)
+		{
+			if (!(values[i] == reference[i]))
+				return 1;
+		}
+
+		return 0;
+	}
+
+	template<class T>
+	s32 checkRandomOperations(T (*create)(u32), tests::CTestRandom& random)
+	{
+		core::array<T> values;
+		std::vector<T> reference;
+
+		s32 failures = 0;
+
+		for (u32 i = 0; i < 20000; ++i)
+		{
+			const u32 size = reference.size();
+
+			switch (random.next(7))
+			{
+				case 0:
+				case 1:
+					values.pushBack(create(i));
+					reference.push_back(create(i));
+					break;
+				case 2:
+				{
+					const u32 index = random.next(size + 1);
+					values.insert(create(i), index);
+					reference.insert(reference.begin() + index, create(i));
+					break;
+				}
+				case 3:
+				{
+					if (!size)
+						break;
+
+					const u32 index = random.next(size);
+					values.erase(index);
+					reference.erase(reference.begin() + index);
+					break;
+				}
+				case 4:
+				{
+					if (size < 4)
+						break;
+
+					const u32 index = random.next(size - 3);
+					const u32 count = 1 + random.next(3);
+					values.erase(index, count);
+					reference.erase(reference.begin() + index,
+							reference.begin() + index + count);
+					break;
+				}
+				case 5:
+				{
+					// element of array itself is pushed during growth
+					if (!size)
+						break;
+
+					values.pushBack(values[0]);
+					reference.push_back(reference[0]);
+					break;
+				}
+				default:
+				{
+					const u32 newSize = size + random.next(100);
+					values.reallocate(newSize);
+					break;
+				}
+			}
+
+			if (values.size() != reference.size())
+			{
+				++failures;
+				break;
+			}
+		}
+
+		failures += compare(values, reference);
+
+		core::array<T> copy(values);
+		failures += compare(copy, reference);
+
+		core::array<T> assigned;
+		assigned.pushBack(create(0));
+		assigned = values;
+		failures += compare(assigned, reference);
+
+#if __cplusplus >= 201103L
+		core::array<T> moved(static_cast<core::array<T>&&>(copy));
+
+		if (copy.size())
+			++failures;
+
+		failures += compare(moved, reference);
+
+		copy = static_cast<core::array<T>&&>(moved);
+
+		if (moved.size())
+			++failures;
+
+		failures += compare(copy, reference);
+#endif
+
+		// shrinking drops elements at end
+		if (reference.size() > 10)
+		{
+			values.reallocate(10);
+			reference.resize(10);
+			failures += compare(values, reference);
+		}
+
+		return failures;
+	}
+
+	s32 checkCounted(tests::CTestRandom& random)
+	{
+		s32 failures = checkRandomOperations(createCounted, random);
+
+		if (CCounted::Alive || CCounted::Broken)
+			++failures;
+
+		return failures;
+	}
+
+	s32 checkTraits()
+	{
+		s32 failures = 0;
+
+		if (!core::isTriviallyCopyable<u16>::value
+				|| !core::isTriviallyCopyable<video::vertex3d>::value
+				|| !core::isTriviallyCopyable<video::vertex3dTangents>::value
+				|| !core::isTriviallyCopyable<video::SColor>::value
+				|| !core::isTriviallyCopyable<vector3df>::value)
+			++failures;
+
+		if (core::isTriviallyCopyable<core::stringc>::value
+				|| core::isTriviallyCopyable<CCounted>::value)
+			++failures;
+
+		return failures;
+	}
+
+#if __cplusplus >= 201103L
+	s32 checkEmplace()
+	{
+		s32 failures = 0;
+
+		core::array<core::stringc> strings;
+
+		for (u32 i = 0; i < 100; ++i)
+			strings.emplaceBack("abc", 2);
+
+		// argument refers to element, which is relocated on growth
+		strings.emplaceBack(strings[0]);
+
+		if (strings.size() != 101 || strings[0] != "ab"
+				|| strings.getLast() != "ab")
+			++failures;
+
+		core::array<video::vertex3dTangents> vertices;
+		vertices.emplaceBack(1.f, 2.f, 3.f);
+
+		if (vertices[0].Pos != vector3df(1.f, 2.f, 3.f))
+			++failures;
+
+		{
+			core::array<CCounted> counted;
+
+			for (s32 i = 0; i < 100; ++i)
+				counted.emplaceBack(i);
+
+			if (!(counted[99] == CCounted(99)))
+				++failures;
+		}
+
+		if (CCounted::Alive || CCounted::Broken)
+			++failures;
+
+		return failures;
+	}
+#endif
+}
+
+int main()
+{
+	tests::CTestRandom random;
+	s32 failures = 0;
+
+	failures += tests::report("array trivially copyable types",
+			checkTraits());
+	failures += tests::report("array of s32",
+			checkRandomOperations(createInt, random));
+	failures += tests::report("array of vertex3dTangents",
+			checkRandomOperations(createVertex, random));
+	failures += tests::report("array of stringc",
+			checkRandomOperations(createString, random));
+	failures += tests::report("array of counted objects",
+			checkCounted(random));
+
+#if __cplusplus >= 201103L
+	failures += tests::report("array emplaceBack", checkEmplace());
+#endif
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,213 @@
+/*
+ * testFlatMap.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// flatmap must hold the same nodes in the same order as std::map after
+// random inserts, appends, removals and lookups. Of appended nodes with
+// equal keys the first one must be kept. CFileList must find files by
+// the flatmap index before and after sort.
+
+#include "core/collections/flatmap/flatmap.h"
+#include "core/collections/stringc.h"
+#include "io/CFileList.h"
+
+#include "testUtils.h"
+
+#include <map>
+
+using namespace irrgame;
+
+namespace
+{
+	//! Compares nodes and their order with reference
+	s32 compareNodes(core::flatmap<s32, s32>& map,
+			std::map<s32, s32>& reference)
+	{
+		if (map.size() != reference.size()
+				|| map.empty() != reference.empty())
+			return 1;
+
+		u32 index = 0;
+
+		for (std::map<s32, s32>::iterator it = reference.begin();
+				it != reference.end(); ++it, ++index)
+		{
+			core::flatmap<s32, s32>::Node& node = map.getNode(index);
+
+			if (node.getKey() != it->first || node.getValue() != it->second)
+				return 1;
+		}
+
+		return 0;
+	}
+
+	s32 checkRandomOperations(u32 keys, tests::CTestRandom& random)
+	{
+		core::flatmap<s32, s32> map;
+		std::map<s32, s32> reference;
+
+		s32 failures = 0;
+
+		for (u32 i = 0; i < 20000; ++i)
+		{
+			const s32 key = (s32) random.next(keys) - (s32) keys / 2;
+			const s32 value = random.next();
+
+			switch (random.next(6))
+			{
+				case 0:
+					map.insert(key, value);
+					reference[key] = value;
+					break;
+				case 1:
+					// appended node of present key would be dropped
+					if (reference.count(key))
+						break;
+
+					map.append(key, value);
+					reference[key] = value;
+					break;
+				case 2:
+					if (map.remove(key) != (reference.erase(key) == 1))
+						++failures;
+					break;
+				case 3:
+					map[key] = value;
+					reference[key] = value;
+					break;
+				default:
+				{
+					core::flatmap<s32, s32>::Node* node = map.find(key);
+					std::map<s32, s32>::iterator it = reference.find(key);
+
+					if ((node != 0) != (it != reference.end())
+							|| (node && node->getValue() != it->second))
+						++failures;
+					break;
+				}
+			}
+		}
+
+		failures += compareNodes(map, reference);
+
+		core::flatmap<s32, s32> other;
+		other.swap(map);
+
+		if (!map.empty())
+			++failures;
+
+		failures += compareNodes(other, reference);
+
+		other.clear();
+
+		if (!other.empty() || other.find(0))
+			++failures;
+
+		return failures;
+	}
+
+	//! Appends many equal keys, first appended value must stay
+	s32 checkDuplicates(tests::CTestRandom& random)
+	{
+		s32 failures = 0;
+
+		for (u32 run = 0; run < 50; ++run)
+		{
+			const u32 keys = 1 + random.next(200);
+			const u32 count = 1 + random.next(5000);
+
+			core::flatmap<s32, s32> map;
+			std::map<s32, s32> first;
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				const s32 key = random.next(keys);
+
+				map.append(key, i);
+				first.insert(std::make_pair(key, (s32) i));
+			}
+
+			map.build();
+			failures += compareNodes(map, first);
+		}
+
+		core::flatmap<core::stringc, s32> strings;
+
+		for (s32 i = 0; i < 3000; ++i)
+		{
+			core::stringc key("key_");
+			key += i % 37;
+			strings.append(key, i);
+		}
+
+		strings.build();
+
+		if (strings.size() != 37 || strings.find("missing"))
+			++failures;
+
+		for (s32 i = 0; i < 37; ++i)
+		{
+			core::stringc key("key_");
+			key += i;
+
+			core::flatmap<core::stringc, s32>::Node* node = strings.find(key);
+
+			if (!node || node->getValue() != i)
+				++failures;
+		}
+
+		return failures;
+	}
+
+	s32 checkFileList()
+	{
+		s32 failures = 0;
+
+		io::CFileList list("base", true, false);
+		list.addItem("Dir/File.TXT", 10, false, 1);
+		list.addItem("dir/sub/", 0, true, 2);
+		list.addItem("a.bin", 3, false, 3);
+
+		for (u32 sorted = 0; sorted < 2; ++sorted)
+		{
+			if (sorted)
+				list.sort();
+
+			const s32 file = list.findFile("dir/file.txt", false);
+
+			if (file < 0 || list.getID(file) != 1)
+				++failures;
+
+			const s32 folder = list.findFile("dir/sub", true);
+
+			if (folder < 0 || list.getID(folder) != 2)
+				++failures;
+
+			if (list.findFile("A.BIN", false) < 0
+					|| list.findFile("missing", false) >= 0)
+				++failures;
+		}
+
+		return failures;
+	}
+}
+
+int main()
+{
+	tests::CTestRandom random;
+	s32 failures = 0;
+
+	failures += tests::report("flatmap with few keys",
+			checkRandomOperations(50, random));
+	failures += tests::report("flatmap with many keys",
+			checkRandomOperations(100000, random));
+	failures += tests::report("flatmap keeps first appended duplicate",
+			checkDuplicates(random));
+	failures += tests::report("file list finds files by index",
+			checkFileList());
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,217 @@
+/*
+ * testHashMap.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// hashmap must hold the same nodes as std::map after random inserts,
+// removals and lookups, with good hash and with colliding hashes, which
+// make long probe sequences and backward shifts on removal.
+
+#include "core/collections/hashmap/hashmap.h"
+#include "core/collections/stringc.h"
+
+#include "testUtils.h"
+
+#include <map>
+
+using namespace irrgame;
+
+namespace
+{
+	//! Puts all keys into few probe sequences, zero hash included
+	struct SCollidingHash
+	{
+		public:
+			u32 operator()(s32 value) const
+			{
+				return (u32) value % 3;
+			}
+	};
+
+	//! Compares all nodes of hashmap with reference
+	template<class THashMap>
+	s32 compareNodes(THashMap& map, std::map<s32, s32>& reference)
+	{
+		if (map.size() != reference.size()
+				|| map.empty() != reference.empty())
+			return 1;
+
+		u32 count = 0;
+
+		for (typename THashMap::Iterator it = map.getIterator(); !it.atEnd();
+				it++)
+		{
+			std::map<s32, s32>::iterator node = reference.find(it->getKey());
+
+			if (node == reference.end() || node->second != it->getValue())
+				return 1;
+
+			++count;
+		}
+
+		return count != reference.size() ? 1 : 0;
+	}
+
+	template<class THashMap>
+	s32 checkRandomOperations(u32 keys, tests::CTestRandom& random)
+	{
+		THashMap map;
+		std::map<s32, s32> reference;
+
+		s32 failures = 0;
+
+		for (u32 i = 0; i < 50000; ++i)
+		{
+			const s32 key = (s32) random.next(keys) - (s32) keys / 2;
+
+			switch (random.next(4))
+			{
+				case 0:
+				{
+					const s32 value = random.next();
+					map.insert(key, value);
+					reference[key] = value;
+					break;
+				}
+				case 1:
+				{
+					const s32 value = random.next();
+					map[key] = value;
+					reference[key] = value;
+					break;
+				}
+				case 2:
+				{
+					if (map.remove(key) != (reference.erase(key) == 1))
+						++failures;
+					break;
+				}
+				default:
+				{
+					typename THashMap::Node* node = map.find(key);
+					std::map<s32, s32>::iterator it = reference.find(key);
+
+					if ((node != 0) != (it != reference.end())
+							|| (node && node->getValue() != it->second))
+						++failures;
+					break;
+				}
+			}
+
+			if (map.size() != reference.size())
+			{
+				++failures;
+				break;
+			}
+		}
+
+		failures += compareNodes(map, reference);
+
+		// growth of table keeps nodes
+		map.reallocate(map.size() * 4 + 100);
+		failures += compareNodes(map, reference);
+
+		THashMap other;
+		other.swap(map);
+
+		if (!map.empty())
+			++failures;
+
+		failures += compareNodes(other, reference);
+
+		other.clear();
+
+		if (!other.empty() || other.find(0))
+			++failures;
+
+		return failures;
+	}
+
+	s32 checkKeyTypes()
+	{
+		s32 failures = 0;
+
+		core::hashmap<core::stringc, s32> strings;
+
+		for (s32 i = 0; i < 1000; ++i)
+		{
+			// short keys are inline, long ones are on heap
+			core::stringc key(i);
+
+			if (i & 1)
+				key += "_key_which_is_long_enough_for_heap";
+
+			strings[key] = i;
+		}
+
+		for (s32 i = 0; i < 1000; ++i)
+		{
+			core::stringc key(i);
+
+			if (i & 1)
+				key += "_key_which_is_long_enough_for_heap";
+
+			core::hashmap<core::stringc, s32>::Node* node = strings.find(key);
+
+			if (!node || node->getValue() != i)
+				++failures;
+		}
+
+		if (strings.find("missing") || strings.size() != 1000)
+			++failures;
+
+		s32 values[100];
+		core::hashmap<s32*, s32> pointers;
+
+		for (s32 i = 0; i < 100; ++i)
+			pointers.insert(values + i, i);
+
+		for (s32 i = 0; i < 100; ++i)
+		{
+			if (pointers[values + i] != i)
+				++failures;
+		}
+
+		core::hashmap<u32, u32> integers;
+		integers.reallocate(10000);
+
+		for (u32 i = 0; i < 10000; ++i)
+			integers.insert(i * 2654435761u, i);
+
+		for (u32 i = 0; i < 10000; ++i)
+		{
+			core::hashmap<u32, u32>::Node* node = integers.find(
+					i * 2654435761u);
+
+			if (!node || node->getValue() != i)
+				++failures;
+		}
+
+		return failures;
+	}
+}
+
+int main()
+{
+	tests::CTestRandom random;
+	s32 failures = 0;
+
+	failures += tests::report("hashmap random operations",
+			checkRandomOperations<core::hashmap<s32, s32> >(5000, random));
+	failures += tests::report("hashmap random operations, few keys",
+			checkRandomOperations<core::hashmap<s32, s32> >(20, random));
+	failures += tests::report("hashmap random operations, collisions",
+			checkRandomOperations<
+					core::hashmap<s32, s32, threads::NullLock,
+							SCollidingHash> >(500, random));
+	failures += tests::report("hashmap with MonitorLock",
+			checkRandomOperations<
+					core::hashmap<s32, s32, threads::MonitorLock> >(5000,
+					random));
+	failures += tests::report("hashmap string, pointer and integer keys",
+			checkKeyTypes());
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,202 @@
+/*
+ * testInternedString.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Threads which intern the same names in different order must get the same
+// handles, whose text and hash match the names. find must not intern new
+// names. XML reader and attributes must use the same handles for names.
+
+#include "core/collections/InternedString.h"
+#include "core/collections/SharedStringPool.h"
+#include "core/utils/hash.h"
+#include "io/serialize/IAttributes.h"
+#include "io/xml/IXMLReader.h"
+#include "io/IReadFile.h"
+#include "threads/irrgameAtomic.h"
+#include "threads/irrgameThread.h"
+
+#include "testUtils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+using namespace irrgame;
+
+namespace
+{
+	const u32 Names = 20000;
+	const u32 Threads = 8;
+
+	//! Threads intern all names starting from different positions
+	class CInterning
+	{
+		public:
+
+			CInterning() :
+					NextThread(0), Failures(0)
+			{
+			}
+
+			s32 run(void* /* arg */)
+			{
+				const u32 thread = threads::irrgameAtomic::fetchAdd(
+						&NextThread, 1u);
+
+				core::SharedStringPool& pool =
+						core::SharedStringPool::getInstance();
+
+				s32 failures = 0;
+				c8 name[32];
+
+				for (u32 i = 0; i < Names; ++i)
+				{
+					const u32 index = (i * 7 + thread * 2731) % Names;
+					sprintf(name, "interned_name_%u", index);
+
+					core::InternedString handle(name);
+					core::InternedString found;
+
+					if (!pool.find(name, found) || found != handle
+							|| strcmp(handle.cStr(), name)
+							|| handle.size() != strlen(name)
+							|| handle.getHash() != core::hashString(name))
+						++failures;
+
+					Handles[thread][index] = handle;
+				}
+
+				threads::irrgameAtomic::fetchAdd(&Failures, failures);
+
+				return 0;
+			}
+
+			s32 check()
+			{
+				threads::delegateThreadCallback callback;
+				callback += NewDelegate(this, &CInterning::run);
+
+				tests::runThreads(&callback, Threads);
+
+				s32 failures = Failures;
+
+				for (u32 thread = 1; thread < Threads; ++thread)
+				{
+					for (u32 i = 0; i < Names; ++i)
+					{
+						if (Handles[thread][i] != Handles[0][i])
+							++failures;
+					}
+				}
+
+				return failures;
+			}
+
+		private:
+
+			u32 NextThread;
+			s32 Failures;
+
+			core::InternedString Handles[Threads][Names];
+	};
+
+	s32 checkThreads()
+	{
+		CInterning* interning = new CInterning();
+		s32 failures = interning->check();
+		delete interning;
+
+		return failures;
+	}
+
+	s32 checkPool()
+	{
+		core::SharedStringPool& pool = core::SharedStringPool::getInstance();
+		s32 failures = 0;
+
+		core::InternedString empty;
+
+		if (empty != core::InternedString("") || !empty.empty()
+				|| empty.size() || strcmp(empty.cStr(), ""))
+			++failures;
+
+		const u32 count = pool.getStringsCount();
+		core::InternedString found;
+
+		if (pool.find("name_which_is_never_interned", found)
+				|| pool.getStringsCount() != count)
+			++failures;
+
+		core::InternedString first("same_name");
+		core::InternedString second;
+		second = "same_name";
+
+		if (first != second || first.cStr() != second.cStr()
+				|| first == core::InternedString("other_name"))
+			++failures;
+
+		return failures;
+	}
+
+	s32 checkXML()
+	{
+		const c8 text[] = "<?xml version=\"1.0\"?>\n"
+				"<attributes>\n"
+				"<int name=\"Health\" value=\"100\"/>\n"
+				"<string name=\"Mesh\" value=\"box.obj\"/>\n"
+				"</attributes>\n";
+
+		c8* memory = new c8[sizeof(text) - 1];
+		memcpy(memory, text, sizeof(text) - 1);
+
+		io::IReadFile* file = io::createMemoryReadFile(memory,
+				sizeof(text) - 1, "test.xml", true);
+		io::IXMLReader* reader = io::createXMLReader(file);
+		file->drop();
+
+		io::IAttributes* attributes = io::createAttributes();
+		s32 failures = 0;
+
+		while (reader->read())
+		{
+			if (reader->getNodeType() != io::EXNT_ELEMENT)
+				continue;
+
+			if (reader->getInternedNodeName()
+					!= core::InternedString(reader->getNodeName()))
+				++failures;
+
+			if (!strcmp(reader->getNodeName(), "attributes"))
+				attributes->read(reader, true);
+		}
+
+		reader->drop();
+
+		if (attributes->getAttributeCount() != 2
+				|| attributes->findAttribute(core::InternedString("Mesh")) != 1
+				|| attributes->findAttribute("Health") != 0
+				|| attributes->getAttributeAsInt("Health") != 100
+				|| attributes->findAttribute("Missing") != -1)
+			++failures;
+
+		attributes->drop();
+
+		return failures;
+	}
+}
+
+int main()
+{
+	s32 failures = 0;
+
+	failures += tests::report("interned strings of empty and same names",
+			checkPool());
+	failures += tests::report("threads get same interned strings",
+			checkThreads());
+	failures += tests::report("xml and attribute names are interned",
+			checkXML());
+
+	return failures ? 1 : 0;
+}
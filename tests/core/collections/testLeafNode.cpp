@@ -0,0 +1,367 @@
+/*
+ * testLeafNode.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// smallarray must hold the same elements as std::vector inside the object
+// and on heap. Children and parents of leaf nodes must match a reference
+// hierarchy after random moves and removals, traverse and getSubtree must
+// visit nodes in depth-first order, and every node must be deleted once.
+
+#include "core/collections/ILeafNode.h"
+#include "core/collections/smallarray.h"
+#include "core/collections/array.h"
+
+#include "testUtils.h"
+
+#include <vector>
+
+using namespace irrgame;
+
+namespace
+{
+	class CNode: public core::ILeafNode<CNode>
+	{
+		public:
+
+			CNode(CNode* parent, s32 id) :
+					core::ILeafNode<CNode>(parent), Id(id)
+			{
+				++Alive;
+			}
+
+			virtual ~CNode()
+			{
+				--Alive;
+			}
+
+		public:
+
+			static s32 Alive;
+
+			s32 Id;
+	};
+
+	s32 CNode::Alive = 0;
+
+	//! Collects ids, skips children of every third node if asked
+	struct SVisitor
+	{
+		public:
+			std::vector<s32>* Ids;
+			bool Skip;
+
+			bool operator()(CNode* node)
+			{
+				Ids->push_back(node->Id);
+
+				return !Skip || node->Id % 3;
+			}
+	};
+
+	//! Hierarchy, which is changed together with nodes
+	struct SReference
+	{
+		public:
+			std::vector<s32> Parents;
+			std::vector<std::vector<s32> > Children;
+
+			void detach(s32 id)
+			{
+				if (Parents[id] < 0)
+					return;
+
+				std::vector<s32>& siblings = Children[Parents[id]];
+
+				for (u32 i = 0; i < siblings.size(); ++i)
+				{
+					if (siblings[i] == id)
+					{
+						siblings.erase(siblings.begin() + i);
+						break;
+					}
+				}
+
+				Parents[id] = -1;
+			}
+
+			bool isAncestor(s32 ancestor, s32 id) const
+			{
+				for (s32 i = id; i >= 0; i = Parents[i])
+				{
+					if (i == ancestor)
+						return true;
+				}
+
+				return false;
+			}
+
+			void collect(s32 id, bool skip, std::vector<s32>& result) const
+			{
+				result.push_back(id);
+
+				if (skip && id % 3 == 0)
+					return;
+
+				for (u32 i = 0; i < Children[id].size(); ++i)
+					collect(Children[id][i], skip, result);
+			}
+	};
+
+	s32 checkSmallArray(tests::CTestRandom& random)
+	{
+		core::smallarray<s32, 4> values;
+		std::vector<s32> reference;
+
+		s32 failures = 0;
+
+		for (u32 i = 0; i < 20000; ++i)
+		{
+			const u32 size = reference.size();
+
+			switch (random.next(8))
+			{
+				case 0:
+				case 1:
+				case 2:
+					values.pushBack(i);
+					reference.push_back(i);
+					break;
+				case 3:
+				{
+					const u32 index = random.next(size + 1);
+					values.insert(i, index);
+					reference.insert(reference.begin() + index, i);
+					break;
+				}
+				case 4:
+				case 5:
+				{
+					if (!size)
+						break;
+
+					const u32 index = random.next(size);
+					values.erase(index);
+					reference.erase(reference.begin() + index);
+					break;
+				}
+				case 6:
+				{
+					// back to inline storage now and then
+					if (random.next(20))
+						break;
+
+					values.clear();
+					reference.clear();
+
+					if (!values.isInline())
+						++failures;
+					break;
+				}
+				default:
+				{
+					if (!size)
+						break;
+
+					const s32 value = reference[random.next(size)];
+
+					if (reference[values.linearSearch(value)] != value)
+						++failures;
+					break;
+				}
+			}
+
+			if (values.size() != reference.size()
+					|| values.end() - values.begin() != (s32) values.size())
+			{
+				++failures;
+				break;
+			}
+
+			for (u32 k = 0; k < reference.size(); ++k)
+			{
+				if (values[k] != reference[k])
+				{
+					++failures;
+					break;
+				}
+			}
+		}
+
+		if (values.linearSearch(-1) != -1)
+			++failures;
+
+		return failures;
+	}
+
+	s32 compareHierarchy(CNode** nodes, const SReference& reference)
+	{
+		const u32 count = reference.Parents.size();
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			const CNode* parent = nodes[i]->getParent();
+			const std::vector<s32>& children = reference.Children[i];
+
+			if ((parent ? parent->Id : -1) != reference.Parents[i]
+					|| nodes[i]->getChildrenCount() != children.size()
+					|| nodes[i]->getChildren().size() != children.size())
+				return 1;
+
+			for (u32 k = 0; k < children.size(); ++k)
+			{
+				if (nodes[i]->getChild(k)->Id != children[k])
+					return 1;
+			}
+		}
+
+		return 0;
+	}
+
+	s32 checkTraversal(CNode** nodes, const SReference& reference, s32 root)
+	{
+		s32 failures = 0;
+
+		for (u32 skip = 0; skip < 2; ++skip)
+		{
+			std::vector<s32> expected;
+			reference.collect(root, skip != 0, expected);
+
+			std::vector<s32> visited;
+
+			SVisitor visitor;
+			visitor.Ids = &visited;
+			visitor.Skip = skip != 0;
+
+			nodes[root]->traverse(visitor);
+
+			if (visited != expected)
+				++failures;
+		}
+
+		std::vector<s32> expected;
+		reference.collect(root, false, expected);
+
+		core::array<CNode*> subtree;
+		nodes[root]->getSubtree(subtree);
+
+		if (subtree.size() != expected.size())
+			return failures + 1;
+
+		for (u32 i = 0; i < subtree.size(); ++i)
+		{
+			if (subtree[i]->Id != expected[i])
+				return failures + 1;
+		}
+
+		return failures;
+	}
+
+	s32 checkHierarchy(tests::CTestRandom& random)
+	{
+		const s32 count = 300;
+
+		// test keeps own reference, so detached nodes are not deleted
+		CNode* nodes[count];
+		SReference reference;
+
+		for (s32 i = 0; i < count; ++i)
+		{
+			nodes[i] = new CNode(0, i);
+			reference.Parents.push_back(-1);
+			reference.Children.push_back(std::vector<s32>());
+		}
+
+		s32 failures = 0;
+
+		for (u32 i = 0; i < 20000; ++i)
+		{
+			const s32 id = random.next(count);
+			const s32 other = random.next(count);
+
+			switch (random.next(4))
+			{
+				case 0:
+				case 1:
+				{
+					if (reference.isAncestor(id, other))
+						break;
+
+					nodes[other]->addChild(nodes[id]);
+
+					reference.detach(id);
+					reference.Parents[id] = other;
+					reference.Children[other].push_back(id);
+					break;
+				}
+				case 2:
+				{
+					if (reference.isAncestor(id, other))
+						break;
+
+					nodes[id]->setParent(nodes[other]);
+
+					reference.detach(id);
+					reference.Parents[id] = other;
+					reference.Children[other].push_back(id);
+					break;
+				}
+				default:
+				{
+					if (random.next(2))
+					{
+						nodes[id]->remove();
+						reference.detach(id);
+					}
+					else if (!reference.Children[id].empty())
+					{
+						const std::vector<s32>& children =
+								reference.Children[id];
+						const s32 child = children[random.next(
+								children.size())];
+
+						nodes[id]->removeChild(nodes[child]);
+						reference.detach(child);
+					}
+					break;
+				}
+			}
+
+			if (i % 1000 == 0)
+			{
+				failures += compareHierarchy(nodes, reference);
+				failures += checkTraversal(nodes, reference,
+						random.next(count));
+			}
+		}
+
+		failures += compareHierarchy(nodes, reference);
+
+		for (s32 i = 0; i < count; ++i)
+		{
+			if (reference.Parents[i] < 0)
+				failures += checkTraversal(nodes, reference, i);
+		}
+
+		// children are held by parents too, roots delete their subtrees
+		for (s32 i = 0; i < count; ++i)
+			nodes[i]->drop();
+
+		return failures + (CNode::Alive ? 1 : 0);
+	}
+}
+
+int main()
+{
+	tests::CTestRandom random;
+	s32 failures = 0;
+
+	failures += tests::report("smallarray inline and on heap",
+			checkSmallArray(random));
+	failures += tests::report("leaf node hierarchy and traversal",
+			checkHierarchy(random));
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,170 @@
+/*
+ * testLockPolicy.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Collections with threads::MonitorLock must stay consistent when several
+// threads modify them at once, collections with default NullLock must work
+// as before in one thread.
+
+#include "core/irrgamecollections.h"
+#include "threads/lock/MonitorLock.h"
+
+#include "testUtils.h"
+
+using namespace irrgame;
+
+namespace
+{
+	const u32 Threads = 4;
+	const s32 Items = 100000;
+
+	//! Shared collections, every thread adds own range of items
+	class CSharedCollections
+	{
+		public:
+
+			CSharedCollections() :
+					NextThread(0)
+			{
+			}
+
+			s32 fill(void*)
+			{
+				Counter.enter();
+				const s32 first = NextThread++ * Items;
+				Counter.exit();
+
+				for (s32 i = first; i < first + Items; ++i)
+				{
+					Values.pushBack(i);
+					Nodes.pushBack(i);
+					Pairs.insert(i, -i);
+
+					if (i % 1000 == 0)
+						Text += "x";
+				}
+
+				return 0;
+			}
+
+		public:
+
+			core::array<s32, threads::MonitorLock> Values;
+			core::list<s32, threads::MonitorLock> Nodes;
+			core::map<s32, s32, threads::MonitorLock> Pairs;
+			core::stringcSync Text;
+
+		private:
+
+			threads::MonitorLock Counter;
+			s32 NextThread;
+	};
+
+	s32 checkShared()
+	{
+		CSharedCollections collections;
+
+		threads::delegateThreadCallback callback;
+		callback += NewDelegate(&collections, &CSharedCollections::fill);
+
+		tests::runThreads(&callback, Threads);
+
+		const u32 total = Threads * Items;
+
+		s32 failures = 0;
+
+		if (collections.Values.size() != total
+				|| collections.Nodes.size() != total
+				|| collections.Pairs.size() != total
+				|| collections.Text.size() != total / 1000)
+			++failures;
+
+		collections.Values.sort();
+
+		for (u32 i = 0; i < collections.Values.size(); ++i)
+		{
+			if (collections.Values[i] != (s32) i)
+			{
+				++failures;
+				break;
+			}
+		}
+
+		for (s32 i = 0; i < (s32) total; i += 97)
+		{
+			core::map<s32, s32, threads::MonitorLock>::Node* node =
+					collections.Pairs.find(i);
+
+			if (!node || node->getValue() != -i)
+				++failures;
+		}
+
+		return failures;
+	}
+
+	s32 checkDefault()
+	{
+		s32 failures = 0;
+
+		core::array<s32> values;
+
+		for (s32 i = 0; i < 100; ++i)
+			values.pushBack(100 - i);
+
+		values.sort();
+
+		if (values[0] != 1 || values.binarySearchFirst(50) != 49)
+			++failures;
+
+		core::array<s32> copy(values);
+		copy.swap(values);
+
+		if (copy.size() != 100 || values.size() != 100)
+			++failures;
+
+		core::list<s32> nodes;
+		nodes.pushBack(1);
+		nodes.pushFront(0);
+
+		core::list<s32> nodesCopy(nodes);
+
+		if (nodesCopy.size() != 2 || *nodesCopy.begin() != 0)
+			++failures;
+
+		core::map<s32, s32> pairs;
+		pairs.insert(1, 2);
+		pairs.insert(3, 4);
+
+		if (pairs[3] != 4 || pairs.size() != 2)
+			++failures;
+
+		core::stringc text("hello");
+		text += " world";
+		text.append('!');
+
+		if (text != "hello world!")
+			++failures;
+
+		arraystr parts;
+		text.split(parts, " ");
+
+		if (parts.size() != 2 || parts[1] != "world!")
+			++failures;
+
+		return failures;
+	}
+}
+
+int main()
+{
+	s32 failures = 0;
+
+	failures += tests::report("collections with NullLock", checkDefault());
+	failures += tests::report("collections with MonitorLock, 4 threads",
+			checkShared());
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,263 @@
+/*
+ * testString.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// stringc must hold the same text as std::string after random operations
+// on strings around inline buffer size, when storage moves between inline
+// buffer and heap, on self append, copies and moves.
+
+#include "core/collections/stringc.h"
+
+#include "testUtils.h"
+
+#include <string.h>
+#include <string>
+
+using namespace irrgame;
+
+namespace
+{
+	//! Returns random text which may be inline or on heap
+	std::string createText(tests::CTestRandom& random)
+	{
+		const u32 size = random.next(core::stringc::InlineSize * 2);
+
+		std::string result;
+
+		for (u32 i = 0; i < size; ++i)
+			result += (c8) ('a' + random.next(4));
+
+		return result;
+	}
+
+	//! Returns true if string holds text
+	template<class TString>
+	bool isEqual(const TString& value, const std::string& text)
+	{
+		return value.size() == text.size()
+				&& !strcmp(value.cStr(), text.c_str())
+				&& value == text.c_str();
+	}
+
+	//! Applies random operation to string and reference text
+	template<class TString>
+	void apply(TString& value, std::string& text, tests::CTestRandom& random)
+	{
+		const std::string other = createText(random);
+
+		switch (random.next(10))
+		{
+			case 0:
+				value = other.c_str();
+				text = other;
+				break;
+			case 1:
+			{
+				const c8 c = (c8) ('a' + random.next(4));
+				value.append(c);
+				text += c;
+				break;
+			}
+			case 2:
+				value.append(other.c_str());
+				text += other;
+				break;
+			case 3:
+			{
+				// self append must keep trailing NUL
+				value.append(value);
+				text += text;
+
+				if (text.size() > 1000)
+				{
+					value = "";
+					text.clear();
+				}
+				break;
+			}
+			case 4:
+			{
+				// empty substring and begin out of string assert
+				if (text.empty())
+					break;
+
+				const u32 begin = random.next(text.size());
+				const u32 length = 1 + random.next(text.size() - begin);
+
+				value = value.subString(begin, length);
+				text = text.substr(begin, length);
+				break;
+			}
+			case 5:
+			{
+				if (text.empty())
+					break;
+
+				const u32 index = random.next(text.size());
+				value.erase(index);
+				text.erase(index, 1);
+				break;
+			}
+			case 6:
+			{
+				const TString copy(value);
+				value = copy;
+				break;
+			}
+			case 7:
+			{
+				value.remove('a');
+
+				std::string removed;
+
+				for (u32 i = 0; i < text.size(); ++i)
+				{
+					if (text[i] != 'a')
+						removed += text[i];
+				}
+
+				text = removed;
+				break;
+			}
+			case 8:
+			{
+				value = TString(other.c_str(), other.size());
+				text = other;
+				break;
+			}
+			default:
+			{
+				// length must be less than size of other string
+				if (other.empty())
+					break;
+
+				value.append(TString(other.c_str()), other.size() / 2);
+				text += other.substr(0, other.size() / 2);
+				break;
+			}
+		}
+	}
+
+	template<class TString>
+	s32 checkRandomOperations(tests::CTestRandom& random)
+	{
+		s32 failures = 0;
+
+		for (u32 i = 0; i < 100; ++i)
+		{
+			TString value;
+			std::string text;
+
+			for (u32 k = 0; k < 200; ++k)
+			{
+				apply(value, text, random);
+
+				if (!isEqual(value, text))
+				{
+					++failures;
+					break;
+				}
+			}
+		}
+
+		return failures;
+	}
+
+	//! Strings of all sizes around inline buffer
+	s32 checkBoundary()
+	{
+		s32 failures = 0;
+		std::string text;
+
+		for (u32 size = 0; size <= core::stringc::InlineSize + 2; ++size)
+		{
+			core::stringc appended;
+
+			for (u32 i = 0; i < size; ++i)
+				appended.append((c8) ('0' + i % 10));
+
+			const core::stringc constructed(text.c_str());
+			core::stringc assigned("long text, which is stored on heap");
+			assigned = constructed;
+
+			if (!isEqual(appended, text) || !isEqual(constructed, text)
+					|| !isEqual(assigned, text)
+					|| !isEqual(core::stringc(appended), text))
+				++failures;
+
+			text += (c8) ('0' + size % 10);
+		}
+
+		// numbers are short
+		if (!isEqual(core::stringc((s32) -1234), "-1234")
+				|| !isEqual(core::stringc((u32) 4000000000u), "4000000000"))
+			++failures;
+
+		return failures;
+	}
+
+#if __cplusplus >= 201103L
+	s32 checkMoves()
+	{
+		s32 failures = 0;
+
+		const c8* const texts[] =
+		{ "", "tiny", "string which is longer than inline buffer" };
+
+		for (u32 i = 0; i < 3; ++i)
+		{
+			for (u32 k = 0; k < 3; ++k)
+			{
+				core::stringc source(texts[i]);
+				const c8* pointer = source.cStr();
+
+				core::stringc moved(static_cast<core::stringc&&>(source));
+
+				if (!isEqual(moved, texts[i]) || !isEqual(source, ""))
+					++failures;
+
+				// heap storage is stolen
+				if (moved.size() >= core::stringc::InlineSize
+						&& moved.cStr() != pointer)
+					++failures;
+
+				core::stringc target(texts[k]);
+				target = static_cast<core::stringc&&>(moved);
+
+				if (!isEqual(target, texts[i]) || !isEqual(moved, ""))
+					++failures;
+
+				// moved from string is usable
+				moved = texts[k];
+				moved.append(texts[i]);
+
+				if (!isEqual(moved, std::string(texts[k]) + texts[i]))
+					++failures;
+			}
+		}
+
+		return failures;
+	}
+#endif
+}
+
+int main()
+{
+	tests::CTestRandom random;
+	s32 failures = 0;
+
+	failures += tests::report("stringc around inline size", checkBoundary());
+	failures += tests::report("stringc random operations",
+			checkRandomOperations<core::stringc>(random));
+	failures += tests::report("stringcSync random operations",
+			checkRandomOperations<core::stringcSync>(random));
+
+#if __cplusplus >= 201103L
+	failures += tests::report("stringc moves", checkMoves());
+#endif
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+/*
+ * testReferenceCounted.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Reference counter must stay exact when several threads grab and drop one
+// object. Objects dropped by dropDeferred must live until flushDeferredDrops
+// of the same thread, including objects queued by destructors.
+
+#include "core/engine/IReferenceCounted.h"
+#include "threads/irrgameAtomic.h"
+
+#include "testUtils.h"
+
+using namespace irrgame;
+
+namespace
+{
+	const u32 Threads = 4;
+	const s32 Iterations = 500000;
+
+	//! Counts destroyed objects, optionally drops other object on deletion
+	class CCounted: public IReferenceCounted
+	{
+		public:
+
+			CCounted(s32* destroyed, const CCounted* child = 0) :
+					Destroyed(destroyed), Child(child)
+			{
+			}
+
+			virtual ~CCounted()
+			{
+				threads::irrgameAtomic::fetchAdd(Destroyed, 1);
+
+				if (Child)
+					Child->dropDeferred();
+			}
+
+		private:
+
+			s32* Destroyed;
+			const CCounted* Child;
+	};
+
+	//! Grabs and drops shared object
+	class CGrabber
+	{
+		public:
+
+			CGrabber(const IReferenceCounted* object) :
+					Object(object)
+			{
+			}
+
+			s32 run(void*)
+			{
+				for (s32 i = 0; i < Iterations; ++i)
+				{
+					Object->grab();
+					Object->grab();
+					Object->drop();
+					Object->drop();
+				}
+
+				return 0;
+			}
+
+		private:
+
+			const IReferenceCounted* Object;
+	};
+
+	s32 checkThreads()
+	{
+		s32 destroyed = 0;
+		CCounted* object = new CCounted(&destroyed);
+
+		CGrabber grabber(object);
+
+		threads::delegateThreadCallback callback;
+		callback += NewDelegate(&grabber, &CGrabber::run);
+
+		tests::runThreads(&callback, Threads);
+
+		s32 failures = 0;
+
+		if (object->getReferenceCount() != 1 || destroyed != 0)
+			++failures;
+
+		if (!object->drop() || destroyed != 1)
+			++failures;
+
+		return failures;
+	}
+
+	s32 checkDeferred()
+	{
+		s32 failures = 0;
+		s32 destroyed = 0;
+
+		// still referenced object is not queued
+		CCounted* shared = new CCounted(&destroyed);
+		shared->grab();
+
+		if (shared->dropDeferred() || IReferenceCounted::flushDeferredDrops())
+			++failures;
+
+		for (s32 i = 0; i < 1000; ++i)
+		{
+			CCounted* object = new CCounted(&destroyed);
+
+			if (!object->dropDeferred())
+				++failures;
+		}
+
+		if (destroyed != 0)
+			++failures;
+
+		if (IReferenceCounted::flushDeferredDrops() != 1000 || destroyed != 1000)
+			++failures;
+
+		// destructor of parent queues child, same flush deletes it
+		destroyed = 0;
+
+		CCounted* child = new CCounted(&destroyed);
+		CCounted* parent = new CCounted(&destroyed, child);
+		parent->dropDeferred();
+
+		if (IReferenceCounted::flushDeferredDrops() != 2 || destroyed != 2)
+			++failures;
+
+		if (IReferenceCounted::flushDeferredDrops() != 0)
+			++failures;
+
+		destroyed = 0;
+
+		if (!shared->drop() || destroyed != 1)
+			++failures;
+
+		return failures;
+	}
+}
+
+int main()
+{
+	s32 failures = 0;
+
+	failures += tests::report("grab and drop, 4 threads", checkThreads());
+	failures += tests::report("dropDeferred and flushDeferredDrops",
+			checkDeferred());
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,240 @@
+/*
+ * testCulling.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// SharedCulling masks must match aabbox3d::classifyPlaneRelation for frustum
+// culling and per axis overlap for box culling, in one thread and in
+// parallel bands, for counts which are not multiples of register or mask
+// word size.
+
+#include "core/math/SharedCulling.h"
+#include "core/collections/array.h"
+
+#include "testUtils.h"
+
+using namespace irrgame;
+using namespace irrgame::core;
+
+namespace
+{
+	const u32 Guard = 0xDEADBEEF;
+
+	//! Fills boxes. On grid boxes and planes have integer coordinates, so
+	//! boxes touch planes exactly.
+	void fillBoxes(aabbox3darray& boxes, u32 count, bool grid,
+			tests::CTestRandom& random)
+	{
+		boxes.clear();
+		boxes.reallocate(count);
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			vector3df center;
+			vector3df extent;
+
+			if (grid)
+			{
+				center.set((f32) random.next(41) - 20,
+						(f32) random.next(41) - 20, (f32) random.next(41) - 20);
+				extent.set((f32) random.next(4), (f32) random.next(4),
+						(f32) random.next(4));
+			}
+			else
+			{
+				center.set(random.nextFloat(-100, 100),
+						random.nextFloat(-100, 100), random.nextFloat(-100, 100));
+				extent.set(random.nextFloat(0, 7), random.nextFloat(0, 7),
+						random.nextFloat(0, 7));
+			}
+
+			// points are boxes too
+			if (i % 7 == 0)
+				extent.set(0, 0, 0);
+
+			boxes.pushBack(aabbox3df(center - extent, center + extent));
+		}
+	}
+
+	//! Fills planes with normals pointing out of volume around origin
+	void fillPlanes(plane3df* planes, u32 count, bool grid,
+			tests::CTestRandom& random)
+	{
+		for (u32 i = 0; i < count; ++i)
+		{
+			if (grid)
+			{
+				vector3df normal;
+				normal.X = i % 3 == 0 ? 1.0f : 0.0f;
+				normal.Y = i % 3 == 1 ? 1.0f : 0.0f;
+				normal.Z = i % 3 == 2 ? 1.0f : 0.0f;
+
+				if (i & 1)
+					normal = -normal;
+
+				planes[i].Normal = normal;
+				planes[i].D = -(f32) random.next(15);
+			}
+			else
+			{
+				vector3df normal(random.nextFloat(-1, 1),
+						random.nextFloat(-1, 1), random.nextFloat(-1, 1));
+				normal.normalize();
+
+				planes[i].Normal = normal;
+				planes[i].D = -random.nextFloat(20, 60);
+			}
+		}
+	}
+
+	//! Returns true if bit of box is set
+	bool isSet(const array<u32>& mask, u32 index)
+	{
+		return (mask[index >> 5] >> (index & 31)) & 1;
+	}
+
+	//! Checks unused bits of last word and guard word after mask
+	s32 checkTail(const array<u32>& mask, u32 count)
+	{
+		const u32 words = SharedCulling::getInstance().getMaskSize(count);
+
+		s32 failures = mask[words] != Guard ? 1 : 0;
+
+		if ((count & 31) && (mask[count >> 5] >> (count & 31)))
+			++failures;
+
+		return failures;
+	}
+
+	//! Checks frustum culling of count boxes
+	s32 checkFrustum(u32 count, u32 planesCount, bool grid,
+			tests::CTestRandom& random)
+	{
+		SharedCulling& culling = SharedCulling::getInstance();
+
+		aabbox3darray boxes;
+		fillBoxes(boxes, count, grid, random);
+
+		plane3df planes[SharedCulling::MaxPlanes];
+		fillPlanes(planes, planesCount, grid, random);
+
+		array<u32> mask;
+		mask.setUsed(culling.getMaskSize(count) + 1);
+
+		for (u32 i = 0; i < mask.size(); ++i)
+			mask[i] = Guard;
+
+		culling.cullFrustum(boxes, planes, planesCount, mask.pointer());
+
+		s32 failures = checkTail(mask, count);
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			const aabbox3df box = boxes.get(i);
+
+			bool visible = true;
+
+			for (u32 k = 0; k < planesCount; ++k)
+			{
+				if (box.classifyPlaneRelation(planes[k]) == ISREL3D_FRONT)
+					visible = false;
+			}
+
+			if (isSet(mask, i) != visible)
+				++failures;
+		}
+
+		return failures;
+	}
+
+	//! Checks box culling of count boxes
+	s32 checkBox(u32 count, bool grid, tests::CTestRandom& random)
+	{
+		SharedCulling& culling = SharedCulling::getInstance();
+
+		aabbox3darray boxes;
+		fillBoxes(boxes, count, grid, random);
+
+		aabbox3df box(vector3df(-10, -5, -20));
+		box.addInternalPoint(vector3df(30, 25, 10));
+
+		array<u32> mask;
+		mask.setUsed(culling.getMaskSize(count) + 1);
+
+		for (u32 i = 0; i < mask.size(); ++i)
+			mask[i] = Guard;
+
+		culling.cullBox(boxes, box, mask.pointer());
+
+		s32 failures = checkTail(mask, count);
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			const aabbox3df other = boxes.get(i);
+
+			// intersectsWithBox compares vectors, not axes
+			const bool visible = other.MinEdge.X <= box.MaxEdge.X
+					&& other.MinEdge.Y <= box.MaxEdge.Y
+					&& other.MinEdge.Z <= box.MaxEdge.Z
+					&& other.MaxEdge.X >= box.MinEdge.X
+					&& other.MaxEdge.Y >= box.MinEdge.Y
+					&& other.MaxEdge.Z >= box.MinEdge.Z;
+
+			if (isSet(mask, i) != visible)
+				++failures;
+		}
+
+		return failures;
+	}
+}
+
+int main()
+{
+	SharedCulling& culling = SharedCulling::getInstance();
+	const u32 threshold = culling.getParallelThreshold();
+
+	// tails of 4 and 8 box registers, 32 box words and parallel bands
+	const u32 counts[] =
+	{ 0, 1, 3, 4, 5, 7, 8, 9, 31, 32, 33, 63, 65, 1001, 8191, 8193, 70001,
+			200003 };
+
+	const u32 planesCounts[] =
+	{ 1, 3, 6, SharedCulling::MaxPlanes };
+
+	tests::CTestRandom random;
+	s32 failures = 0;
+	c8 name[128];
+
+	for (u32 parallel = 0; parallel < 2; ++parallel)
+	{
+		// 0 splits every array into bands
+		culling.setParallelThreshold(parallel ? 0 : 0xFFFFFFFF);
+
+		for (u32 grid = 0; grid < 2; ++grid)
+		{
+			for (u32 i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+			{
+				s32 result = 0;
+
+				for (u32 k = 0; k < sizeof(planesCounts) / sizeof(u32); ++k)
+					result += checkFrustum(counts[i], planesCounts[k], grid,
+							random);
+
+				sprintf(name, "cullFrustum, %u boxes%s%s", counts[i],
+						grid ? ", grid" : "", parallel ? ", parallel" : "");
+				failures += tests::report(name, result);
+
+				sprintf(name, "cullBox, %u boxes%s%s", counts[i],
+						grid ? ", grid" : "", parallel ? ", parallel" : "");
+				failures += tests::report(name,
+						checkBox(counts[i], grid, random));
+			}
+		}
+	}
+
+	culling.setParallelThreshold(threshold);
+
+	return failures ? 1 : 0;
+}
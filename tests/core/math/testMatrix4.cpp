@@ -0,0 +1,359 @@
+/*
+ * testMatrix4.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Multiplication of matrix4<f32> and its SSE2 and AVX kernels must give
+// exactly the scalar products, also when output is one of the inputs.
+// Inverse of general, affine, camera and projection matrices must match a
+// double precision reference, and singular matrices must not be inverted.
+
+#include "core/math/matrix4.h"
+#include "core/math/SMatrix4SIMD.h"
+#include "core/utils/SharedCPUFeatures.h"
+
+#include "testUtils.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+using namespace irrgame;
+using namespace irrgame::core;
+
+namespace
+{
+	//! Kernels of one set, 0 for public methods of matrix4
+	const SMatrix4SIMD* Kernels = 0;
+
+	//! Allowed error of inverse in units of rounding error of float, which
+	//! is multiplied by condition of matrix
+	const double InverseTolerance = 32. * FLT_EPSILON;
+
+	matrix4f createGeneral(tests::CTestRandom& random)
+	{
+		matrix4f result(EM4CONST_NOTHING);
+
+		for (u32 i = 0; i < 16; ++i)
+			result[i] = random.nextFloat(-3.f, 3.f);
+
+		return result;
+	}
+
+	matrix4f createAffine(tests::CTestRandom& random)
+	{
+		matrix4f result = createGeneral(random);
+
+		result[3] = result[7] = result[11] = 0.f;
+		result[15] = 1.f;
+
+		return result;
+	}
+
+	//! Rotation, scale and translation of scene node
+	matrix4f createTransformation(tests::CTestRandom& random)
+	{
+		matrix4f rotation;
+		rotation.setRotationDegrees(vector3df(random.nextFloat(-180.f, 180.f),
+				random.nextFloat(-180.f, 180.f),
+				random.nextFloat(-180.f, 180.f)));
+
+		matrix4f scale;
+		scale.setScale(vector3df(random.nextFloat(0.1f, 2.f),
+				random.nextFloat(0.1f, 2.f), random.nextFloat(0.1f, 2.f)));
+
+		matrix4f result = scale * rotation;
+		result.setTranslation(vector3df(random.nextFloat(-100.f, 100.f),
+				random.nextFloat(-100.f, 100.f),
+				random.nextFloat(-100.f, 100.f)));
+
+		return result;
+	}
+
+	//! View and projection of camera
+	matrix4f createCamera(tests::CTestRandom& random)
+	{
+		matrix4f view;
+		view.buildCameraLookAtMatrixLH(
+				vector3df(random.nextFloat(-50.f, 50.f),
+						random.nextFloat(-50.f, 50.f),
+						random.nextFloat(-50.f, 50.f)),
+				vector3df(random.nextFloat(-1.f, 1.f),
+						random.nextFloat(-1.f, 1.f),
+						random.nextFloat(-1.f, 1.f)), vector3df(0.f, 1.f, 0.f));
+
+		matrix4f projection;
+		projection.buildProjectionMatrixPerspectiveFovLH(1.f, 1.33f, 0.1f,
+				1000.f);
+
+		return view * projection;
+	}
+
+	//! Product in order of scalar code
+	void multiplyScalar(const matrix4f& a, const matrix4f& b, f32* out)
+	{
+		for (u32 column = 0; column < 4; ++column)
+		{
+			for (u32 row = 0; row < 4; ++row)
+			{
+				out[column * 4 + row] = a[row] * b[column * 4]
+						+ a[4 + row] * b[column * 4 + 1]
+						+ a[8 + row] * b[column * 4 + 2]
+						+ a[12 + row] * b[column * 4 + 3];
+			}
+		}
+	}
+
+	void multiply(const matrix4f& a, const matrix4f& b, matrix4f& out)
+	{
+		if (Kernels)
+			Kernels->Multiply(a.pointer(), b.pointer(), out.pointer());
+		else
+			out.setbyproduct(a, b);
+	}
+
+	bool inverse(const matrix4f& m, matrix4f& out)
+	{
+		if (Kernels)
+			return Kernels->Inverse(m.pointer(), out.pointer());
+
+		return m.getInverse(out);
+	}
+
+	//! Inverts m by Gauss-Jordan elimination in double precision.
+	//! Returns False if m is close to singular.
+	bool inverseReference(const matrix4f& m, double* out)
+	{
+		double a[4][8];
+
+		for (u32 row = 0; row < 4; ++row)
+		{
+			for (u32 column = 0; column < 4; ++column)
+			{
+				a[row][column] = m[row * 4 + column];
+				a[row][4 + column] = row == column ? 1. : 0.;
+			}
+		}
+
+		for (u32 column = 0; column < 4; ++column)
+		{
+			u32 pivot = column;
+
+			for (u32 row = column + 1; row < 4; ++row)
+			{
+				if (fabs(a[row][column]) > fabs(a[pivot][column]))
+					pivot = row;
+			}
+
+			if (fabs(a[pivot][column]) < 1e-3)
+				return false;
+
+			for (u32 k = 0; k < 8; ++k)
+			{
+				const double value = a[column][k];
+				a[column][k] = a[pivot][k];
+				a[pivot][k] = value;
+			}
+
+			const double divisor = a[column][column];
+
+			for (u32 k = 0; k < 8; ++k)
+				a[column][k] /= divisor;
+
+			for (u32 row = 0; row < 4; ++row)
+			{
+				if (row == column)
+					continue;
+
+				const double factor = a[row][column];
+
+				for (u32 k = 0; k < 8; ++k)
+					a[row][k] -= factor * a[column][k];
+			}
+		}
+
+		for (u32 row = 0; row < 4; ++row)
+		{
+			for (u32 column = 0; column < 4; ++column)
+				out[row * 4 + column] = a[row][4 + column];
+		}
+
+		return true;
+	}
+
+	s32 checkMultiply(tests::CTestRandom& random)
+	{
+		s32 failures = 0;
+
+		for (u32 i = 0; i < 20000; ++i)
+		{
+			const matrix4f a = i & 1 ? createAffine(random)
+					: createGeneral(random);
+			const matrix4f b = i & 2 ? createAffine(random)
+					: createGeneral(random);
+
+			f32 expected[16];
+			multiplyScalar(a, b, expected);
+
+			matrix4f product(EM4CONST_NOTHING);
+			multiply(a, b, product);
+
+			// output is same as first or second input
+			matrix4f first(a);
+			multiply(first, b, first);
+
+			matrix4f second(b);
+			multiply(a, second, second);
+
+			if (memcmp(product.pointer(), expected, sizeof(expected))
+					|| memcmp(first.pointer(), expected, sizeof(expected))
+					|| memcmp(second.pointer(), expected, sizeof(expected)))
+				++failures;
+		}
+
+		if (!Kernels)
+		{
+			const matrix4f a = createGeneral(random);
+			const matrix4f b = createGeneral(random);
+			const matrix4f product = a * b;
+
+			matrix4f assigned(a);
+			assigned *= b;
+
+			if (memcmp(&assigned, &product, sizeof(matrix4f)))
+				++failures;
+		}
+
+		return failures;
+	}
+
+	s32 checkInverse(matrix4f (*create)(tests::CTestRandom&),
+			tests::CTestRandom& random)
+	{
+		s32 failures = 0;
+
+		for (u32 i = 0; i < 20000; ++i)
+		{
+			const matrix4f m = create(random);
+
+			double expected[16];
+
+			if (!inverseReference(m, expected))
+				continue;
+
+			matrix4f result(EM4CONST_NOTHING);
+
+			if (!inverse(m, result))
+			{
+				++failures;
+				continue;
+			}
+
+			double error = 0.;
+			double largest = 1.;
+			double largestInput = 1.;
+
+			for (u32 k = 0; k < 16; ++k)
+			{
+				error = fmax(error, fabs(result[k] - expected[k]));
+				largest = fmax(largest, fabs(expected[k]));
+				largestInput = fmax(largestInput, fabs(m[k]));
+			}
+
+			// rough condition of matrix
+			const double condition = largestInput * largest;
+
+			if (error / largest > InverseTolerance * condition)
+				++failures;
+
+			if (!Kernels)
+			{
+				matrix4f inverted(m);
+				inverted.makeInverse();
+
+				if (memcmp(&inverted, &result, sizeof(matrix4f)))
+					++failures;
+			}
+		}
+
+		return failures;
+	}
+
+	s32 checkSingular(tests::CTestRandom& random)
+	{
+		s32 failures = 0;
+
+		matrix4f singular(EM4CONST_NOTHING);
+
+		for (u32 i = 0; i < 16; ++i)
+			singular[i] = (f32) i;
+
+		// third column of affine matrix is twice the first one. Integer
+		// elements keep determinant exactly zero.
+		matrix4f affine = createAffine(random);
+
+		for (u32 i = 0; i < 16; ++i)
+			affine[i] = floorf(affine[i]);
+
+		affine[15] = 1.f;
+		affine[8] = affine[0] * 2.f;
+		affine[9] = affine[1] * 2.f;
+		affine[10] = affine[2] * 2.f;
+
+		const matrix4f original = createGeneral(random);
+
+		matrix4f out(original);
+
+		if (inverse(singular, out) || inverse(affine, out)
+				|| memcmp(&out, &original, sizeof(matrix4f)))
+			++failures;
+
+		return failures;
+	}
+
+	s32 checkSet(tests::CTestRandom& random)
+	{
+		s32 failures = 0;
+
+		failures += checkMultiply(random);
+		failures += checkInverse(createGeneral, random);
+		failures += checkInverse(createAffine, random);
+		failures += checkInverse(createTransformation, random);
+		failures += checkInverse(createCamera, random);
+		failures += checkSingular(random);
+
+		return failures;
+	}
+}
+
+int main()
+{
+	const SharedCPUFeatures& cpu = SharedCPUFeatures::getInstance();
+
+	printf("SSE2 %d, AVX %d, matrix4 kernels %s\n", cpu.hasSSE2(),
+			cpu.hasAVX(), getMatrix4SIMD() ? "SIMD" : "scalar");
+
+	tests::CTestRandom random;
+	s32 failures = 0;
+
+	failures += tests::report("matrix4 multiply and inverse",
+			checkSet(random));
+
+	if (cpu.hasSSE2() && getMatrix4SSE2())
+	{
+		Kernels = getMatrix4SSE2();
+		failures += tests::report("matrix4 multiply and inverse, SSE2",
+				checkSet(random));
+	}
+
+	if (cpu.hasAVX() && getMatrix4AVX())
+	{
+		Kernels = getMatrix4AVX();
+		failures += tests::report("matrix4 multiply and inverse, AVX",
+				checkSet(random));
+	}
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,254 @@
+/*
+ * testMatrixTransform.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Batch transforms of matrix4 and their SSE2 and AVX kernels must produce
+// exactly the same bits as transformVect, rotateVect and normalize of each
+// vector, for positions and normals inside vertex3d and vertex3dTangents,
+// for dense vectors, in place and to other buffer, for counts which are not
+// multiples of register width. Memory after the last vector must be kept.
+
+#include "core/math/matrix4.h"
+#include "core/math/SMatrix4SIMD.h"
+#include "core/utils/SharedCPUFeatures.h"
+#include "video/vertex/vertex3dTangents.h"
+
+#include "testUtils.h"
+
+#include <string.h>
+#include <vector>
+
+using namespace irrgame;
+using namespace irrgame::core;
+
+namespace
+{
+	enum ETransform
+	{
+		ET_TRANSFORM = 0,
+		ET_ROTATE,
+		ET_NORMAL,
+		ET_COUNT
+	};
+
+	//! Kernels of one set, 0 for public methods of matrix4
+	const SMatrix4SIMD* Kernels = 0;
+
+	matrix4f createMatrix(tests::CTestRandom& random)
+	{
+		matrix4f result;
+
+		for (u32 i = 0; i < 16; ++i)
+			result[i] = random.nextFloat(-10.f, 10.f);
+
+		// affine
+		result[3] = result[7] = result[11] = 0.f;
+		result[15] = 1.f;
+
+		return result;
+	}
+
+	vector3df createVector(tests::CTestRandom& random)
+	{
+		// zero vectors must stay zero after normalize
+		if (!random.next(7))
+			return vector3df(0.f, 0.f, 0.f);
+
+		return vector3df(random.nextFloat(-10.f, 10.f),
+				random.nextFloat(-10.f, 10.f), random.nextFloat(-10.f, 10.f));
+	}
+
+	vector3df applyScalar(ETransform transform, const matrix4f& m,
+			const matrix4f& normalMatrix, const vector3df& value)
+	{
+		vector3df result;
+
+		switch (transform)
+		{
+			case ET_TRANSFORM:
+				m.transformVect(result, value);
+				break;
+			case ET_ROTATE:
+				m.rotateVect(result, value);
+				break;
+			default:
+				normalMatrix.rotateVect(result, value);
+				result.normalize();
+				break;
+		}
+
+		return result;
+	}
+
+	void applyArray(ETransform transform, const matrix4f& m,
+			const matrix4f& normalMatrix, vector3df* out, const vector3df* in,
+			u32 count, u32 stride)
+	{
+		if (!Kernels)
+		{
+			if (transform == ET_TRANSFORM)
+				m.transformVectArray(out, in, count, stride);
+			else if (transform == ET_ROTATE)
+				m.rotateVectArray(out, in, count, stride);
+			else
+				m.transformNormalArray(out, in, count, stride);
+
+			return;
+		}
+
+		tTransformVectArraySIMD kernel = Kernels->TransformVectArray;
+
+		if (transform == ET_ROTATE)
+			kernel = Kernels->RotateVectArray;
+		else if (transform == ET_NORMAL)
+			kernel = Kernels->RotateNormalizeVectArray;
+
+		const matrix4f& matrix = transform == ET_NORMAL ? normalMatrix : m;
+
+		kernel(matrix.pointer(), &out->X, &in->X, count, stride);
+	}
+
+	//! Transforms Pos and Normal members of vertices in place and to copy
+	template<class TVertex>
+	s32 checkVertices(u32 count, tests::CTestRandom& random)
+	{
+		const matrix4f m = createMatrix(random);
+		const matrix4f normalMatrix(m, EM4CONST_INVERSE_TRANSPOSED);
+
+		// one more vertex guards memory after the last one
+		std::vector<TVertex> input(count + 1);
+
+		for (u32 i = 0; i <= count; ++i)
+		{
+			input[i].Pos = createVector(random);
+			input[i].Normal = createVector(random);
+		}
+
+		std::vector<TVertex> expected(input);
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			expected[i].Pos = applyScalar(ET_TRANSFORM, m, normalMatrix,
+					input[i].Pos);
+			expected[i].Normal = applyScalar(ET_NORMAL, m, normalMatrix,
+					input[i].Normal);
+		}
+
+		const u32 stride = sizeof(TVertex);
+		const u32 size = sizeof(TVertex) * (count + 1);
+
+		s32 failures = 0;
+
+		std::vector<TVertex> inPlace(input);
+
+		applyArray(ET_TRANSFORM, m, normalMatrix, &inPlace[0].Pos,
+				&inPlace[0].Pos, count, stride);
+		applyArray(ET_NORMAL, m, normalMatrix, &inPlace[0].Normal,
+				&inPlace[0].Normal, count, stride);
+
+		if (memcmp(&inPlace[0], &expected[0], size))
+			++failures;
+
+		std::vector<TVertex> separate(input);
+
+		applyArray(ET_TRANSFORM, m, normalMatrix, &separate[0].Pos,
+				&input[0].Pos, count, stride);
+		applyArray(ET_NORMAL, m, normalMatrix, &separate[0].Normal,
+				&input[0].Normal, count, stride);
+
+		if (memcmp(&separate[0], &expected[0], size))
+			++failures;
+
+		return failures;
+	}
+
+	//! Transforms dense array of vectors by every transform
+	s32 checkDense(u32 count, tests::CTestRandom& random)
+	{
+		const matrix4f m = createMatrix(random);
+		const matrix4f normalMatrix(m, EM4CONST_INVERSE_TRANSPOSED);
+
+		std::vector<vector3df> input(count + 1);
+
+		for (u32 i = 0; i <= count; ++i)
+			input[i] = createVector(random);
+
+		s32 failures = 0;
+
+		for (u32 transform = 0; transform < ET_COUNT; ++transform)
+		{
+			std::vector<vector3df> output(count + 1, vector3df(7.f, 7.f, 7.f));
+
+			applyArray((ETransform) transform, m, normalMatrix, &output[0],
+					&input[0], count, sizeof(vector3df));
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				const vector3df value = applyScalar((ETransform) transform, m,
+						normalMatrix, input[i]);
+
+				if (memcmp(&value, &output[i], sizeof(vector3df)))
+				{
+					++failures;
+					break;
+				}
+			}
+
+			if (output[count] != vector3df(7.f, 7.f, 7.f))
+				++failures;
+		}
+
+		return failures;
+	}
+
+	s32 checkCounts(tests::CTestRandom& random)
+	{
+		const u32 counts[] =
+		{ 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 1001 };
+
+		s32 failures = 0;
+
+		for (u32 i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+		{
+			failures += checkVertices<video::vertex3d>(counts[i], random);
+			failures += checkVertices<video::vertex3dTangents>(counts[i],
+					random);
+			failures += checkDense(counts[i], random);
+		}
+
+		return failures;
+	}
+}
+
+int main()
+{
+	const SharedCPUFeatures& cpu = SharedCPUFeatures::getInstance();
+
+	printf("SSE2 %d, AVX %d, matrix4 kernels %s\n", cpu.hasSSE2(),
+			cpu.hasAVX(), getMatrix4SIMD() ? "SIMD" : "scalar");
+
+	tests::CTestRandom random;
+	s32 failures = 0;
+
+	failures += tests::report("matrix4 batch transforms",
+			checkCounts(random));
+
+	if (cpu.hasSSE2() && getMatrix4SSE2())
+	{
+		Kernels = getMatrix4SSE2();
+		failures += tests::report("matrix4 batch transforms, SSE2",
+				checkCounts(random));
+	}
+
+	if (cpu.hasAVX() && getMatrix4AVX())
+	{
+		Kernels = getMatrix4AVX();
+		failures += tests::report("matrix4 batch transforms, AVX",
+				checkCounts(random));
+	}
+
+	return failures ? 1 : 0;
+}
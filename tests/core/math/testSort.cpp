@@ -0,0 +1,288 @@
+/*
+ * testSort.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Introsort, radix sort, parallel merge sort and array::sort must order
+// random, sorted, reverse sorted and almost equal inputs of integers,
+// floats and strings as std::sort. Radix sort must be stable.
+
+#include "core/collections/array.h"
+#include "core/collections/stringc.h"
+#include "core/math/SharedIntrosort.h"
+#include "core/math/SharedMergesort.h"
+#include "core/math/SharedRadixsort.h"
+
+#include "testUtils.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace irrgame;
+
+namespace
+{
+	//! Render item, which is sorted by key only
+	struct SItem
+	{
+		public:
+			u32 Key;
+			u32 Order;
+
+			bool operator<(const SItem& other) const
+			{
+				return Key < other.Key;
+			}
+	};
+}
+
+namespace irrgame
+{
+	namespace core
+	{
+		template<>
+		struct radixKey<SItem>
+		{
+				typedef u32 Type;
+				static const bool IsDefined = true;
+				static Type get(const SItem& value)
+				{
+					return value.Key;
+				}
+		};
+	}  // namespace core
+}  // namespace irrgame
+
+namespace
+{
+	enum ESortPattern
+	{
+		ESP_RANDOM = 0,
+		ESP_SORTED,
+		ESP_REVERSE,
+		ESP_FEW_VALUES,
+		ESP_COUNT
+	};
+
+	//! Returns value of element for pattern
+	s32 createValue(ESortPattern pattern, u32 index, u32 size,
+			tests::CTestRandom& random)
+	{
+		switch (pattern)
+		{
+			case ESP_SORTED:
+				return index;
+			case ESP_REVERSE:
+				return size - index;
+			case ESP_FEW_VALUES:
+				return random.next(5);
+			default:
+				return (s32) random.next() / 2 - (s32) random.next() / 2;
+		}
+	}
+
+	s32 convert(s32 value, s32*)
+	{
+		return value;
+	}
+
+	f32 convert(s32 value, f32*)
+	{
+		return value * 0.37f;
+	}
+
+	s64 convert(s32 value, s64*)
+	{
+		return (s64) value * 1000000007LL;
+	}
+
+	u8 convert(s32 value, u8*)
+	{
+		return (u8) value;
+	}
+
+	core::stringc convert(s32 value, core::stringc*)
+	{
+		c8 text[64];
+		sprintf(text, value % 3 ? "s%d" : "long string number %d on heap",
+				value);
+
+		return text;
+	}
+
+	//! Returns true if arrays have same order
+	template<class T>
+	bool isEqual(const std::vector<T>& values, const std::vector<T>& reference)
+	{
+		for (u32 i = 0; i < reference.size(); ++i)
+		{
+			if (values[i] < reference[i] || reference[i] < values[i])
+				return false;
+		}
+
+		return true;
+	}
+
+	//! Sorts input by all algorithms, which can sort type
+	template<class T>
+	s32 checkInput(const std::vector<T>& input, tests::CTestRandom& random)
+	{
+		std::vector<T> reference = input;
+		std::sort(reference.begin(), reference.end());
+
+		const u32 size = input.size();
+		s32 failures = 0;
+
+		std::vector<T> values = input;
+
+		if (size)
+			core::SharedIntrosort<T>::getInstance().sort(&values[0], size);
+
+		failures += isEqual(values, reference) ? 0 : 1;
+
+		values = input;
+
+		// runs are merged in several levels
+		if (size)
+		{
+			core::SharedMergesort<T>::getInstance().sort(&values[0], size,
+					1 + random.next(16));
+		}
+
+		failures += isEqual(values, reference) ? 0 : 1;
+
+		core::array<T> array;
+
+		for (u32 i = 0; i < size; ++i)
+			array.pushBack(input[i]);
+
+		array.sort();
+
+		for (u32 i = 0; i < size; ++i)
+			values[i] = array[i];
+
+		failures += isEqual(values, reference) ? 0 : 1;
+
+		return failures;
+	}
+
+	//! Sorts input by radix sort too
+	template<class T>
+	s32 checkRadixInput(const std::vector<T>& input, tests::CTestRandom& random)
+	{
+		std::vector<T> reference = input;
+		std::sort(reference.begin(), reference.end());
+
+		std::vector<T> values = input;
+
+		if (!values.empty())
+		{
+			core::SharedRadixsort<T>::getInstance().sort(&values[0],
+					values.size());
+		}
+
+		return checkInput(input, random) + (isEqual(values, reference) ? 0 : 1);
+	}
+
+	template<class T>
+	std::vector<T> createInput(ESortPattern pattern, u32 size,
+			tests::CTestRandom& random)
+	{
+		std::vector<T> result;
+
+		for (u32 i = 0; i < size; ++i)
+			result.push_back(convert(createValue(pattern, i, size, random),
+					(T*) 0));
+
+		return result;
+	}
+
+	s32 checkSizes(u32 maxSize, u32 count, tests::CTestRandom& random)
+	{
+		s32 failures = 0;
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			const u32 size = random.next(maxSize);
+			const ESortPattern pattern = (ESortPattern) random.next(ESP_COUNT);
+
+			failures += checkRadixInput(createInput<s32>(pattern, size, random),
+					random);
+			failures += checkRadixInput(createInput<f32>(pattern, size, random),
+					random);
+			failures += checkRadixInput(createInput<s64>(pattern, size, random),
+					random);
+			failures += checkRadixInput(createInput<u8>(pattern, size, random),
+					random);
+			failures += checkInput(createInput<core::stringc>(pattern, size,
+					random), random);
+		}
+
+		return failures;
+	}
+
+	//! Arrays above parallel threshold are sorted by merge sort
+	s32 checkBig(tests::CTestRandom& random)
+	{
+		const u32 size = IRR_PARALLEL_SORT_THRESHOLD * 2 + 123;
+
+		s32 failures = 0;
+
+		for (u32 pattern = 0; pattern < ESP_COUNT; ++pattern)
+		{
+			failures += checkRadixInput(createInput<s32>((ESortPattern) pattern,
+					size, random), random);
+			failures += checkInput(createInput<core::stringc>(
+					(ESortPattern) pattern, size, random), random);
+		}
+
+		return failures;
+	}
+
+	s32 checkStability(tests::CTestRandom& random)
+	{
+		core::array<SItem> items;
+
+		for (u32 i = 0; i < 10000; ++i)
+		{
+			SItem item;
+			item.Key = random.next(100) << (random.next(4) * 8);
+			item.Order = i;
+
+			items.pushBack(item);
+		}
+
+		items.sort();
+
+		s32 failures = 0;
+
+		for (u32 i = 1; i < items.size(); ++i)
+		{
+			if (items[i].Key < items[i - 1].Key
+					|| (items[i].Key == items[i - 1].Key
+							&& items[i].Order < items[i - 1].Order))
+				++failures;
+		}
+
+		return failures;
+	}
+}
+
+int main()
+{
+	tests::CTestRandom random;
+	s32 failures = 0;
+
+	failures += tests::report("sort small inputs",
+			checkSizes(300, 300, random));
+	failures += tests::report("sort medium inputs",
+			checkSizes(20000, 20, random));
+	failures += tests::report("sort inputs above parallel threshold",
+			checkBig(random));
+	failures += tests::report("radix sort of records is stable",
+			checkStability(random));
+
+	return failures ? 1 : 0;
+}
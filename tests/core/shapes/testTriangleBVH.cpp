@@ -0,0 +1,522 @@
+/*
+ * testTriangleBVH.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Queries of TriangleBVH must match brute force over all triangles: ray and
+// line hits exactly, triangles in box by exact overlap and by sampling, and
+// closest points up to rounding. Trees built in parallel and from indexed
+// triangle lists must answer the same, with 1 to 30000 triangles, including
+// degenerate ones.
+
+#include "core/shapes/TriangleBVH.h"
+
+#include "testUtils.h"
+
+#include <math.h>
+#include <vector>
+
+using namespace irrgame;
+using namespace irrgame::core;
+
+namespace
+{
+	typedef std::vector<triangle3df> TTriangles;
+
+	f32 createCoordinate(f32 range, tests::CTestRandom& random)
+	{
+		return random.nextFloat(-range, range);
+	}
+
+	vector3df createPoint(f32 range, tests::CTestRandom& random)
+	{
+		return vector3df(createCoordinate(range, random),
+				createCoordinate(range, random),
+				createCoordinate(range, random));
+	}
+
+	//! Terrain of half of triangles and random small triangles
+	void createScene(TTriangles& triangles, u32 count,
+			tests::CTestRandom& random)
+	{
+		triangles.clear();
+
+		const u32 grid = (u32) sqrt(count / 4.);
+		const f32 cell = 400.f / (grid ? grid : 1);
+
+		for (u32 i = 0; i < grid; ++i)
+		{
+			for (u32 j = 0; j < grid; ++j)
+			{
+				vector3df corners[4];
+
+				for (u32 k = 0; k < 4; ++k)
+				{
+					const f32 x = (i + (k & 1)) * cell - 200.f;
+					const f32 z = (j + (k >> 1)) * cell - 200.f;
+
+					corners[k].set(x, 10.f * sinf(x * .05f) * cosf(z * .05f),
+							z);
+				}
+
+				triangles.push_back(
+						triangle3df(corners[0], corners[1], corners[3]));
+				triangles.push_back(
+						triangle3df(corners[0], corners[3], corners[2]));
+			}
+		}
+
+		while (triangles.size() < count)
+		{
+			const vector3df center = createPoint(100.f, random);
+			const f32 size = 2.5f + createCoordinate(2.f, random);
+
+			triangles.push_back(
+					triangle3df(center + createPoint(size, random),
+							center + createPoint(size, random),
+							center + createPoint(size, random)));
+		}
+
+		// point and line triangles
+		if (count > 10)
+		{
+			triangles[count / 2] = triangle3df(vector3df(1.f, 1.f, 1.f),
+					vector3df(1.f, 1.f, 1.f), vector3df(1.f, 1.f, 1.f));
+			triangles[count / 3] = triangle3df(vector3df(0.f, 0.f, 0.f),
+					vector3df(1.f, 1.f, 1.f), vector3df(2.f, 2.f, 2.f));
+		}
+	}
+
+	//! Two sided Moller-Trumbore test in float, same as one of tree
+	bool intersect(const triangle3df& triangle, const vector3df& origin,
+			const vector3df& direction, f32 maxDistance, f32& distance)
+	{
+		const vector3df edgeB = triangle.pointB - triangle.pointA;
+		const vector3df edgeC = triangle.pointC - triangle.pointA;
+		const vector3df p = direction.crossProduct(edgeC);
+		const f32 determinant = edgeB.dotProduct(p);
+
+		if (determinant == 0.f)
+			return false;
+
+		const f32 inverse = 1.f / determinant;
+		const vector3df s = origin - triangle.pointA;
+		const f32 u = s.dotProduct(p) * inverse;
+
+		if (u < 0.f || u > 1.f)
+			return false;
+
+		const vector3df q = s.crossProduct(edgeB);
+		const f32 v = direction.dotProduct(q) * inverse;
+
+		if (v < 0.f || u + v > 1.f)
+			return false;
+
+		const f32 t = edgeC.dotProduct(q) * inverse;
+
+		if (t < 0.f || t > maxDistance)
+			return false;
+
+		distance = t;
+
+		return true;
+	}
+
+	//! Returns index of nearest hit or -1
+	s32 intersectAll(const TTriangles& triangles, const vector3df& origin,
+			const vector3df& direction, f32 maxDistance, f32& distance)
+	{
+		s32 result = -1;
+		distance = maxDistance;
+
+		for (u32 i = 0; i < triangles.size(); ++i)
+		{
+			if (intersect(triangles[i], origin, direction, distance, distance))
+				result = i;
+		}
+
+		return result;
+	}
+
+	double getDistanceSQ(const double* a, const double* b)
+	{
+		return (a[0] - b[0]) * (a[0] - b[0]) + (a[1] - b[1]) * (a[1] - b[1])
+				+ (a[2] - b[2]) * (a[2] - b[2]);
+	}
+
+	double dot(const double* a, const double* b)
+	{
+		return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+	}
+
+	//! Squared distance to closest point of triangle in double precision,
+	//! by regions of vertices, edges and face
+	double getDistanceSQ(const triangle3df& triangle, const vector3df& point)
+	{
+		const double p[3] =
+		{ point.X, point.Y, point.Z };
+		const double a[3] =
+		{ triangle.pointA.X, triangle.pointA.Y, triangle.pointA.Z };
+		const double b[3] =
+		{ triangle.pointB.X, triangle.pointB.Y, triangle.pointB.Z };
+		const double c[3] =
+		{ triangle.pointC.X, triangle.pointC.Y, triangle.pointC.Z };
+
+		double ab[3], ac[3], ap[3];
+
+		for (u32 i = 0; i < 3; ++i)
+		{
+			ab[i] = b[i] - a[i];
+			ac[i] = c[i] - a[i];
+			ap[i] = p[i] - a[i];
+		}
+
+		// distance to edges and vertices covers degenerate triangles
+		const double* edges[3][2] =
+		{
+		{ a, b },
+		{ b, c },
+		{ c, a } };
+
+		double result = getDistanceSQ(p, a);
+
+		for (u32 i = 0; i < 3; ++i)
+		{
+			const double* start = edges[i][0];
+			const double* end = edges[i][1];
+
+			double edge[3], offset[3], closest[3];
+
+			for (u32 k = 0; k < 3; ++k)
+			{
+				edge[k] = end[k] - start[k];
+				offset[k] = p[k] - start[k];
+			}
+
+			const double length = dot(edge, edge);
+			double t = length > 0. ? dot(offset, edge) / length : 0.;
+			t = t < 0. ? 0. : (t > 1. ? 1. : t);
+
+			for (u32 k = 0; k < 3; ++k)
+				closest[k] = start[k] + edge[k] * t;
+
+			result = fmin(result, getDistanceSQ(p, closest));
+		}
+
+		// projection inside face
+		const double d00 = dot(ab, ab);
+		const double d01 = dot(ab, ac);
+		const double d11 = dot(ac, ac);
+		const double d20 = dot(ap, ab);
+		const double d21 = dot(ap, ac);
+		const double denominator = d00 * d11 - d01 * d01;
+
+		if (denominator <= 1e-18 * d00 * d11)
+			return result;
+
+		const double v = (d11 * d20 - d01 * d21) / denominator;
+		const double w = (d00 * d21 - d01 * d20) / denominator;
+
+		if (v < 0. || w < 0. || v + w > 1.)
+			return result;
+
+		double closest[3];
+
+		for (u32 k = 0; k < 3; ++k)
+			closest[k] = a[k] + ab[k] * v + ac[k] * w;
+
+		return fmin(result, getDistanceSQ(p, closest));
+	}
+
+	bool isInsideBox(const vector3df& point, const aabbox3df& box, f32 margin)
+	{
+		return point.X > box.MinEdge.X + margin
+				&& point.Y > box.MinEdge.Y + margin
+				&& point.Z > box.MinEdge.Z + margin
+				&& point.X < box.MaxEdge.X - margin
+				&& point.Y < box.MaxEdge.Y - margin
+				&& point.Z < box.MaxEdge.Z - margin;
+	}
+
+	//! Returns True if sample of triangle is clearly inside box
+	bool hasSampleInBox(const triangle3df& triangle, const aabbox3df& box)
+	{
+		const u32 steps = 20;
+
+		for (u32 i = 0; i <= steps; ++i)
+		{
+			for (u32 k = 0; i + k <= steps; ++k)
+			{
+				const f32 u = i / (f32) steps;
+				const f32 v = k / (f32) steps;
+				const vector3df point = triangle.pointA
+						+ (triangle.pointB - triangle.pointA) * u
+						+ (triangle.pointC - triangle.pointA) * v;
+
+				if (isInsideBox(point, box, 1e-3f))
+					return true;
+			}
+		}
+
+		return false;
+	}
+
+	s32 checkLines(const TTriangles& triangles, const TriangleBVH& tree,
+			tests::CTestRandom& random, u32 query)
+	{
+		s32 failures = 0;
+
+		const vector3df origin = createPoint(150.f, random);
+		vector3df direction = createPoint(1.f, random);
+
+		// axis aligned rays have zero components
+		if (query % 5 == 0)
+			direction.set(0.f, -1.f, 0.f);
+		else if (query % 7 == 0)
+			direction.set(1.f, 0.f, 0.f);
+
+		const f32 maxDistance = query % 3 ? SharedMath::MaxFloat : 50.f;
+
+		f32 expected = 0.f;
+		s32 index = intersectAll(triangles, origin, direction, maxDistance,
+				expected);
+
+		SBVHHit hit;
+		bool result = tree.getIntersectionWithRay(origin, direction, hit,
+				maxDistance);
+
+		if (result != (index >= 0) || (result && hit.Distance != expected))
+			++failures;
+
+		f32 distance = 0.f;
+
+		// other triangle at same distance may be reported
+		if (result && (!intersect(triangles[hit.Triangle], origin, direction,
+				maxDistance, distance) || distance != hit.Distance))
+			++failures;
+
+		const line3df line(origin,
+				origin + direction * (60.f + createCoordinate(60.f, random)));
+
+		index = intersectAll(triangles, origin, line.getVector(), 1.f,
+				expected);
+		result = tree.getIntersectionWithLimitedLine(line, hit);
+
+		if (result != (index >= 0) || (result && hit.Distance != expected))
+			++failures;
+
+		if (tree.intersectsWithLimitedLine(line) != (index >= 0))
+			++failures;
+
+		return failures;
+	}
+
+	s32 checkBox(const TTriangles& triangles, const TriangleBVH& tree,
+			tests::CTestRandom& random)
+	{
+		aabbox3df box(createPoint(120.f, random));
+		box.addInternalPoint(box.MinEdge + vector3df(15.f, 15.f, 15.f)
+				+ createPoint(15.f, random));
+
+		array<u32> found;
+		found.pushBack(0xFFFFFFFF);
+
+		// indices are appended
+		const u32 count = tree.getTrianglesInBox(box, found);
+
+		if (count + 1 != found.size() || found[0] != 0xFFFFFFFF)
+			return 1;
+
+		std::vector<bool> marked(triangles.size(), false);
+
+		for (u32 i = 1; i < found.size(); ++i)
+		{
+			if (found[i] >= triangles.size() || marked[found[i]])
+				return 1;
+
+			marked[found[i]] = true;
+		}
+
+		s32 failures = 0;
+
+		for (u32 i = 0; i < triangles.size(); ++i)
+		{
+			const triangle3df& triangle = triangles[i];
+
+			aabbox3df bounds(triangle.pointA);
+			bounds.addInternalPoint(triangle.pointB);
+			bounds.addInternalPoint(triangle.pointC);
+
+			const bool overlaps = bounds.MinEdge.X <= box.MaxEdge.X
+					&& bounds.MinEdge.Y <= box.MaxEdge.Y
+					&& bounds.MinEdge.Z <= box.MaxEdge.Z
+					&& bounds.MaxEdge.X >= box.MinEdge.X
+					&& bounds.MaxEdge.Y >= box.MinEdge.Y
+					&& bounds.MaxEdge.Z >= box.MinEdge.Z;
+
+			if (marked[i] && !overlaps)
+				++failures;
+			else if (!marked[i] && overlaps && hasSampleInBox(triangle, box))
+				++failures;
+		}
+
+		return failures;
+	}
+
+	s32 checkClosest(const TTriangles& triangles, const TriangleBVH& tree,
+			tests::CTestRandom& random)
+	{
+		const vector3df point = createPoint(150.f, random);
+
+		double expected = SharedMath::MaxFloat;
+
+		for (u32 i = 0; i < triangles.size(); ++i)
+			expected = fmin(expected, getDistanceSQ(triangles[i], point));
+
+		const double tolerance = 1e-3 * (expected + 1.);
+
+		SBVHClosestPoint closest;
+
+		if (!tree.getClosestPoint(point, closest)
+				|| fabs(closest.DistanceSQ - expected) > tolerance
+				|| fabs(getDistanceSQ(triangles[closest.Triangle], point)
+						- closest.DistanceSQ) > tolerance
+				|| fabs(closest.Point.getDistanceFromSQ(point)
+						- closest.DistanceSQ) > tolerance)
+			return 1;
+
+		// all triangles are farther than limit
+		if (tree.getClosestPoint(point, closest, sqrtf(expected) * .99f))
+			return 1;
+
+		return 0;
+	}
+
+	s32 checkQueries(const TTriangles& triangles, const TriangleBVH& tree,
+			u32 queries, tests::CTestRandom& random)
+	{
+		s32 failures = 0;
+
+		if (tree.getTriangleCount() != triangles.size())
+			++failures;
+
+		for (u32 i = 0; i < queries; ++i)
+		{
+			failures += checkLines(triangles, tree, random, i);
+			failures += checkBox(triangles, tree, random);
+			failures += checkClosest(triangles, tree, random);
+		}
+
+		return failures;
+	}
+
+	s32 checkEmpty()
+	{
+		s32 failures = 0;
+
+		TriangleBVH tree;
+		SBVHHit hit;
+		SBVHClosestPoint closest;
+		array<u32> found;
+
+		const vector3df origin(0.f, 0.f, 0.f);
+
+		if (tree.getIntersectionWithRay(origin, vector3df(1.f, 0.f, 0.f), hit)
+				|| tree.intersectsWithLimitedLine(
+						line3df(0.f, 0.f, 0.f, 1.f, 1.f, 1.f))
+				|| tree.getTrianglesInBox(
+						aabbox3df(-1.f, -1.f, -1.f, 1.f, 1.f, 1.f), found)
+				|| tree.getClosestPoint(origin, closest))
+			++failures;
+
+		tree.build((const triangle3df*) 0, 0);
+
+		if (tree.getNodeCount() || tree.getTriangleCount())
+			++failures;
+
+		return failures;
+	}
+
+	s32 checkScenes(tests::CTestRandom& random)
+	{
+		const u32 counts[] =
+		{ 1, 2, 3, 4, 5, 7, 17, 100, 1000, 5000, 30000 };
+
+		s32 failures = 0;
+
+		for (u32 i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+		{
+			const u32 count = counts[i];
+			const u32 queries = count > 5000 ? 20 : 100;
+
+			TTriangles triangles;
+			createScene(triangles, count, random);
+
+			TriangleBVH serial;
+			serial.build(&triangles[0], count);
+
+			TriangleBVH parallel;
+			parallel.build(&triangles[0], count, true);
+
+			if (serial.getNodeCount() != parallel.getNodeCount())
+				++failures;
+
+			failures += checkQueries(triangles, serial, queries, random);
+			failures += checkQueries(triangles, parallel, queries / 4 + 1,
+					random);
+
+			// indexed list, 16 bit indices address first 65535 vertices
+			std::vector<vector3df> positions;
+			std::vector<u16> shortIndices;
+			std::vector<u32> indices;
+
+			for (u32 k = 0; k < count; ++k)
+			{
+				positions.push_back(triangles[k].pointA);
+				positions.push_back(triangles[k].pointB);
+				positions.push_back(triangles[k].pointC);
+			}
+
+			for (u32 k = 0; k < positions.size(); ++k)
+			{
+				indices.push_back(k);
+
+				if (k < 65535)
+					shortIndices.push_back(k);
+			}
+
+			TriangleBVH indexed;
+			indexed.build(&positions[0], sizeof(vector3df), &indices[0],
+					indices.size());
+
+			failures += checkQueries(triangles, indexed, queries / 4 + 1,
+					random);
+
+			TriangleBVH shortIndexed;
+			shortIndexed.build(&positions[0], sizeof(vector3df),
+					&shortIndices[0], shortIndices.size());
+
+			const TTriangles first(triangles.begin(),
+					triangles.begin() + shortIndices.size() / 3);
+
+			failures += checkQueries(first, shortIndexed, queries / 4 + 1,
+					random);
+		}
+
+		return failures;
+	}
+}
+
+int main()
+{
+	tests::CTestRandom random;
+	s32 failures = 0;
+
+	failures += tests::report("empty bvh", checkEmpty());
+	failures += tests::report("bvh queries match brute force",
+			checkScenes(random));
+
+	return failures ? 1 : 0;
+}
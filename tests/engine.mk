@@ -0,0 +1,37 @@
+################################################################################
+# Engine sources, vendored image libraries and POSIX platform layer, built as
+# one static library for tests and benchmarks. Set ROOT and BUILD before
+# including it.
+################################################################################
+
+CPPFLAGS += -I$(ROOT)/include -I$(ROOT)/src -I$(ROOT)/vendors
+LDLIBS += -lpthread
+
+ENGINE_SRCS := $(shell find $(ROOT)/src $(ROOT)/utils -name '*.cpp') \
+	$(ROOT)/tests/platform/posixPlatform.cpp
+VENDOR_SRCS := $(shell find $(ROOT)/vendors -name '*.c')
+ENGINE_OBJS := $(patsubst $(ROOT)/%.cpp,$(BUILD)/engine/%.o,$(ENGINE_SRCS)) \
+	$(patsubst $(ROOT)/%.c,$(BUILD)/engine/%.o,$(VENDOR_SRCS))
+ENGINE_LIB := $(BUILD)/libirrgame_sdk.a
+
+# Vendored libraries are not ours to fix, so their warnings are silenced
+VENDOR_CFLAGS ?= -O2 -w
+
+$(BUILD)/engine/%.o: $(ROOT)/%.cpp
+	@mkdir -p $(dir $@)
+	$(CXX) $(CPPFLAGS) $(CXXFLAGS) -MMD -MP -c $< -o $@
+
+$(BUILD)/engine/%.o: $(ROOT)/%.c
+	@mkdir -p $(dir $@)
+	$(CC) -I$(ROOT)/vendors -I$(ROOT)/vendors/zlib $(VENDOR_CFLAGS) -MMD -MP -c $< -o $@
+
+$(ENGINE_LIB): $(ENGINE_OBJS)
+	@rm -f $@
+	$(AR) rcs $@ $^
+
+# Drivers are linked against the library, so only used engine parts are taken
+$(BUILD)/bin/%: %.cpp $(ENGINE_LIB)
+	@mkdir -p $(dir $@)
+	$(CXX) $(CPPFLAGS) -I. $(CXXFLAGS) -MMD -MP $< $(ENGINE_LIB) $(LDLIBS) -o $@
+
+-include $(ENGINE_OBJS:.o=.d)
@@ -0,0 +1,201 @@
+/*
+ * testEventScheduler.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Every event added to SharedEventScheduler must run exactly once: events
+// added from main thread, events added by workers, and events pending at
+// stopProcess, which must run after next startProcess. Real time events
+// must run only in proceedNextRealTimeEvent.
+
+#include "events/engine/SharedEventScheduler.h"
+#include "threads/irrgameAtomic.h"
+#include "threads/irrgameThread.h"
+
+#include "testUtils.h"
+
+using namespace irrgame;
+using namespace irrgame::events;
+
+namespace
+{
+	//! Counts runs of events
+	class CEventCounter
+	{
+		public:
+
+			CEventCounter() :
+					Count(0), Children(0)
+			{
+				Tick += NewDelegate(this, &CEventCounter::tick);
+				Sleep += NewDelegate(this, &CEventCounter::sleep);
+				Spawn += NewDelegate(this, &CEventCounter::spawn);
+			}
+
+			s32 tick(void*)
+			{
+				threads::irrgameAtomic::fetchAdd(&Count, 1);
+
+				return 0;
+			}
+
+			s32 sleep(void*)
+			{
+				threads::irrgameThread::sleep(1);
+				threads::irrgameAtomic::fetchAdd(&Count, 1);
+
+				return 0;
+			}
+
+			//! Adds Children background events from worker thread
+			s32 spawn(void*)
+			{
+				for (s32 i = 0; i < Children; ++i)
+					SharedEventScheduler::getInstance().addEvent(&Tick,
+							EAP_BACKGROUND);
+
+				return 0;
+			}
+
+			s32 getCount() const
+			{
+				return threads::irrgameAtomic::loadAcquire(&Count);
+			}
+
+			//! Waits until count reaches value, gives up after 20 seconds
+			bool waitCount(s32 value) const
+			{
+				for (s32 i = 0; i < 20000 && getCount() < value; ++i)
+					threads::irrgameThread::sleep(1);
+
+				return getCount() == value;
+			}
+
+		public:
+
+			delegateEvent Tick;
+			delegateEvent Sleep;
+			delegateEvent Spawn;
+
+			s32 Count;
+			s32 Children;
+	};
+
+	s32 checkRealTime()
+	{
+		SharedEventScheduler& scheduler = SharedEventScheduler::getInstance();
+		CEventCounter counter;
+
+		scheduler.startProcess();
+
+		for (s32 i = 0; i < 10; ++i)
+			scheduler.addEvent(&counter.Tick, EAP_REALTIME);
+
+		threads::irrgameThread::sleep(20);
+
+		s32 failures = counter.getCount() != 0 ? 1 : 0;
+
+		for (s32 i = 0; i < 10; ++i)
+			scheduler.proceedNextRealTimeEvent();
+
+		// queue is empty now
+		scheduler.proceedNextRealTimeEvent();
+
+		if (counter.getCount() != 10)
+			++failures;
+
+		scheduler.stopProcess();
+
+		return failures;
+	}
+
+	s32 checkWorkers()
+	{
+		SharedEventScheduler& scheduler = SharedEventScheduler::getInstance();
+		CEventCounter counter;
+		counter.Children = 100;
+
+		scheduler.startProcess();
+
+		s32 failures = scheduler.getWorkersCount()
+				!= threads::irrgameThread::getProcessorsCount() ? 1 : 0;
+
+		const s32 ticks = 200000;
+		const s32 spawns = 2000;
+
+		for (s32 i = 0; i < ticks; ++i)
+			scheduler.addEvent(&counter.Tick,
+					i & 1 ? EAP_HIGHPRIORITY : EAP_BACKGROUND);
+
+		for (s32 i = 0; i < spawns; ++i)
+			scheduler.addEvent(&counter.Spawn, EAP_HIGHPRIORITY);
+
+		if (!counter.waitCount(ticks + spawns * counter.Children))
+			++failures;
+
+		// workers sleep now, single event must wake them up
+		threads::irrgameThread::sleep(50);
+		scheduler.addEvent(&counter.Tick, EAP_BACKGROUND);
+
+		if (!counter.waitCount(ticks + spawns * counter.Children + 1))
+			++failures;
+
+		scheduler.stopProcess();
+
+		if (scheduler.getWorkersCount() != 0)
+			++failures;
+
+		return failures;
+	}
+
+	s32 checkRestart()
+	{
+		SharedEventScheduler& scheduler = SharedEventScheduler::getInstance();
+		CEventCounter counter;
+
+		const s32 events = 400;
+
+		scheduler.startProcess();
+
+		for (s32 i = 0; i < events; ++i)
+			scheduler.addEvent(&counter.Sleep,
+					i & 1 ? EAP_HIGHPRIORITY : EAP_BACKGROUND);
+
+		scheduler.stopProcess();
+
+		const s32 beforeStop = counter.getCount();
+
+		// nothing runs while stopped
+		threads::irrgameThread::sleep(20);
+
+		s32 failures = counter.getCount() != beforeStop ? 1 : 0;
+
+		scheduler.startProcess();
+
+		if (!counter.waitCount(events))
+			++failures;
+
+		scheduler.stopProcess();
+
+		// stop of stopped scheduler does nothing
+		scheduler.stopProcess();
+
+		return failures;
+	}
+}
+
+int main()
+{
+	s32 failures = 0;
+
+	failures += tests::report("real time events run in main thread",
+			checkRealTime());
+	failures += tests::report("worker and spawned events run once",
+			checkWorkers());
+	failures += tests::report("pending events run after restart",
+			checkRestart());
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * testAttributes.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Name index of CAttributes must find the same attribute as linear search
+// by name, the first one of same named attributes, after additions,
+// removals, growth of the index and clear.
+
+#include "io/serialize/IAttributes.h"
+#include "core/collections/InternedString.h"
+
+#include "testUtils.h"
+
+#include <string.h>
+
+using namespace irrgame;
+
+namespace
+{
+	//! Returns index of first attribute with name or -1
+	s32 findLinear(io::IAttributes* attributes, const c8* name)
+	{
+		for (u32 i = 0; i < attributes->getAttributeCount(); ++i)
+		{
+			if (!strcmp(attributes->getAttributeName(i), name))
+				return i;
+		}
+
+		return -1;
+	}
+
+	//! Compares lookups of all names which may exist
+	s32 compareLookups(io::IAttributes* attributes, u32 count)
+	{
+		s32 failures = 0;
+		c8 name[32];
+
+		for (u32 i = 0; i < count * 2; ++i)
+		{
+			sprintf(name, i & 1 ? "int%u" : "text%u", i / 2);
+
+			const s32 expected = findLinear(attributes, name);
+
+			if (attributes->findAttribute(name) != expected
+					|| attributes->findAttribute(core::InternedString(name))
+							!= expected
+					|| attributes->existsAttribute(name) != (expected >= 0))
+				++failures;
+
+			if (expected >= 0 && i & 1
+					&& attributes->getAttributeAsInt(name)
+							!= attributes->getAttributeAsInt(expected))
+				++failures;
+		}
+
+		return failures;
+	}
+
+	s32 checkLookups(u32 count, tests::CTestRandom& random)
+	{
+		io::IAttributes* attributes = io::createAttributes();
+
+		s32 failures = 0;
+		c8 name[32];
+
+		// same names repeat, first one must be found
+		for (u32 i = 0; i < count; ++i)
+		{
+			sprintf(name, "int%u", random.next(count * 2 / 3 + 1));
+			attributes->addInt(name, i);
+		}
+
+		for (u32 i = 0; i < count; i += 3)
+		{
+			sprintf(name, "text%u", i);
+			attributes->setAttribute(name, "value");
+		}
+
+		failures += compareLookups(attributes, count);
+
+		// null value removes attribute, so indices after it move
+		for (u32 i = 0; i < count; i += 7)
+		{
+			sprintf(name, "text%u", i);
+			attributes->setAttribute(name, (const c8*) 0);
+
+			sprintf(name, "int%u", i);
+
+			if (attributes->existsAttribute(name))
+				attributes->setAttribute(name, (const c8*) 0);
+		}
+
+		failures += compareLookups(attributes, count);
+
+		// setting of existing attribute does not add new one
+		const u32 size = attributes->getAttributeCount();
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			sprintf(name, "int%u", i);
+
+			if (attributes->existsAttribute(name))
+				attributes->setAttribute(name, (s32) i);
+		}
+
+		if (attributes->getAttributeCount() != size)
+			++failures;
+
+		failures += compareLookups(attributes, count);
+
+		attributes->clear();
+
+		if (attributes->getAttributeCount() != 0
+				|| attributes->findAttribute("int0") != -1)
+			++failures;
+
+		// index works after clear
+		attributes->addInt("int0", 5);
+
+		if (attributes->findAttribute("int0") != 0
+				|| attributes->getAttributeAsInt("int0") != 5)
+			++failures;
+
+		attributes->drop();
+
+		return failures;
+	}
+}
+
+int main()
+{
+	const u32 counts[] =
+	{ 1, 10, 100, 1000, 5000 };
+
+	tests::CTestRandom random;
+	s32 failures = 0;
+	c8 name[128];
+
+	for (u32 i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+	{
+		sprintf(name, "attribute lookups, %u attributes", counts[i]);
+		failures += tests::report(name, checkLookups(counts[i], random));
+	}
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,271 @@
+/*
+ * testMappedReadFile.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Memory mapped file must read and seek as CReadFile and give pointer to
+// data at current position. BMP loader must decode the same image from
+// mapped file in place, from unaligned memory and from CReadFile copy.
+
+#include "io/IReadFile.h"
+#include "video/image/IImage.h"
+#include "video/image/loader/bmp/SharedImageLoaderBmp.h"
+#include "video/image/loader/bmp/SBMPHeader.h"
+#include "core/collections/array.h"
+
+#include "testUtils.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+using namespace irrgame;
+
+namespace
+{
+	const u32 FileSize = 10000;
+
+	//! Pixels after the header are aligned for 32 bit reads
+	const u32 BmpDataOffset = 56;
+
+	//! Writes bytes to file
+	void writeFile(const c8* name, const void* data, u32 size)
+	{
+		FILE* file = fopen(name, "wb");
+
+		if (size)
+			fwrite(data, 1, size, file);
+
+		fclose(file);
+	}
+
+	//! Compares all methods of mapped and common file
+	s32 checkRead(const c8* name)
+	{
+		io::IReadFile* mapped = io::createMappedReadFile(name);
+		io::IReadFile* common = io::createReadFile(name);
+
+		if (!mapped || !common)
+			return 1;
+
+		s32 failures = 0;
+
+		if (mapped->getSize() != common->getSize() || mapped->getPos() != 0
+				|| mapped->getPointer() != mapped->getBuffer())
+			++failures;
+
+		const long positions[] =
+		{ 0, 1, 4095, 4096, 5000, 9990, 9999, 10000 };
+
+		u8 a[128];
+		u8 b[128];
+
+		for (u32 i = 0; i < sizeof(positions) / sizeof(positions[0]); ++i)
+		{
+			if (mapped->seek(positions[i]) != common->seek(positions[i]))
+				++failures;
+
+			const u8* pointer = (const u8*) mapped->getPointer();
+
+			memset(a, 0, sizeof(a));
+			memset(b, 0, sizeof(b));
+
+			const s32 readMapped = mapped->read(a, sizeof(a));
+			const s32 readCommon = common->read(b, sizeof(b));
+
+			if (readMapped != readCommon || memcmp(a, b, sizeof(a))
+					|| mapped->getPos() != common->getPos())
+				++failures;
+
+			if (readMapped > 0 && memcmp(pointer, a, readMapped))
+				++failures;
+		}
+
+		// out of file, position stays
+		mapped->seek(100);
+
+		if (mapped->seek(FileSize + 1) || mapped->seek(-101, true)
+				|| mapped->getPos() != 100)
+			++failures;
+
+		if (!mapped->seek(-50, true) || mapped->getPos() != 50)
+			++failures;
+
+		// limit file uses buffer of mapped one
+		io::IReadFile* limit = io::createLimitReadFile(name, mapped, 1000, 200);
+
+		if (!limit
+				|| limit->getBuffer() != (const u8*) mapped->getBuffer() + 1000)
+			++failures;
+
+		if (limit)
+			limit->drop();
+
+		mapped->drop();
+		common->drop();
+
+		return failures;
+	}
+
+	//! Writes BMP file in memory
+	void createBmp(core::array<u8>& data, u32 width, u32 height, u16 bpp,
+			tests::CTestRandom& random)
+	{
+		const u32 row = (width * bpp / 8 + 3) & ~3;
+
+		data.setUsed(BmpDataOffset + row * height);
+
+		for (u32 i = 0; i < data.size(); ++i)
+			data[i] = (u8) random.next();
+
+		video::SBMPHeader header;
+		memset(&header, 0, sizeof(header));
+
+		header.Id = 0x4d42;
+		header.FileSize = data.size();
+		header.BitmapDataOffset = BmpDataOffset;
+		header.BitmapHeaderSize = 40;
+		header.Width = width;
+		header.Height = height;
+		header.Planes = 1;
+		header.BPP = bpp;
+		header.BitmapDataSize = row * height;
+
+		memcpy(data.pointer(), &header, sizeof(header));
+	}
+
+	//! Returns true if images have same format, size and bytes
+	bool isEqual(video::IImage* a, video::IImage* b)
+	{
+		if (!a || !b || a->getColorFormat() != b->getColorFormat()
+				|| a->getDimension() != b->getDimension())
+			return false;
+
+		const bool result = !memcmp(a->lock(), b->lock(),
+				a->getImageDataSizeInBytes());
+
+		a->unlock();
+		b->unlock();
+
+		return result;
+	}
+
+	s32 checkBmp(const c8* name, u32 width, u32 height, u16 bpp,
+			tests::CTestRandom& random)
+	{
+		video::SharedImageLoaderBmp& loader =
+				video::SharedImageLoaderBmp::getInstance();
+
+		core::array<u8> data;
+		createBmp(data, width, height, bpp, random);
+		writeFile(name, data.pointer(), data.size());
+
+		io::IReadFile* common = io::createReadFile(name);
+		io::IReadFile* mapped = io::createMappedReadFile(name);
+
+		// pixels after odd offset are not aligned for converter
+		core::array<u8> shifted;
+		shifted.setUsed(data.size() + 1);
+		memcpy(shifted.pointer() + 1, data.pointer(), data.size());
+
+		io::IReadFile* memory = io::createMemoryReadFile(shifted.pointer() + 1,
+				data.size(), name, false);
+
+		video::IImage* reference = loader.createImage(common);
+		video::IImage* inPlace = loader.createImage(mapped);
+		video::IImage* unaligned = loader.createImage(memory);
+
+		s32 failures = 0;
+
+		if (!isEqual(reference, inPlace) || !isEqual(reference, unaligned))
+			++failures;
+
+		// 32 bit pixels are copied as they are, rows from bottom to top
+		if (reference && bpp == 32)
+		{
+			const u8* pixels = (const u8*) reference->lock();
+			const u32 row = width * 4;
+
+			for (u32 y = 0; y < height; ++y)
+			{
+				if (memcmp(pixels + y * row, data.pointer() + BmpDataOffset
+						+ (height - 1 - y) * row, row))
+					++failures;
+			}
+
+			reference->unlock();
+		}
+
+		if (reference)
+			reference->drop();
+
+		if (inPlace)
+			inPlace->drop();
+
+		if (unaligned)
+			unaligned->drop();
+
+		common->drop();
+		mapped->drop();
+		memory->drop();
+
+		return failures;
+	}
+}
+
+int main()
+{
+	c8 directory[] = "/tmp/irrgameXXXXXX";
+
+	if (!mkdtemp(directory))
+		return 1;
+
+	const core::stringc base = core::stringc(directory) + "/";
+	const core::stringc data = base + "data.bin";
+	const core::stringc empty = base + "empty.bin";
+	const core::stringc image = base + "image.bmp";
+
+	core::array<u8> bytes;
+	bytes.setUsed(FileSize);
+
+	for (u32 i = 0; i < FileSize; ++i)
+		bytes[i] = (u8) (i * 7);
+
+	writeFile(data.cStr(), bytes.pointer(), FileSize);
+	writeFile(empty.cStr(), 0, 0);
+
+	tests::CTestRandom random;
+	s32 failures = 0;
+
+	// platform without memory mapping reads every file by CReadFile
+#ifdef IRR_MEMORY_MAPPED_FILES
+	failures += tests::report("mapped file reads as CReadFile",
+			checkRead(data.cStr()));
+
+	// such files are read by CReadFile
+	failures += tests::report("empty and missing files are not mapped",
+			io::createMappedReadFile(empty) != 0
+					|| io::createMappedReadFile(base + "missing.bin") != 0);
+
+	failures += tests::report("BMP 32 bit in place",
+			checkBmp(image.cStr(), 5, 3, 32, random)
+					+ checkBmp(image.cStr(), 64, 17, 32, random));
+	failures += tests::report("BMP 24 bit in place",
+			checkBmp(image.cStr(), 5, 3, 24, random)
+					+ checkBmp(image.cStr(), 63, 17, 24, random));
+
+	// rows without padding, padding of 16 bit rows is counted in pixels
+	failures += tests::report("BMP 16 bit in place",
+			checkBmp(image.cStr(), 6, 3, 16, random)
+					+ checkBmp(image.cStr(), 64, 17, 16, random));
+#endif
+
+	unlink(data.cStr());
+	unlink(empty.cStr());
+	unlink(image.cStr());
+	rmdir(directory);
+
+	return failures ? 1 : 0;
+}
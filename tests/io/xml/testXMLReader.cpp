@@ -0,0 +1,411 @@
+/*
+ * testXMLReader.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// In situ XML reader must return the same nodes, names, decoded values and
+// texts as written to random documents, and every returned string must stay
+// valid until the reader is dropped.
+
+#include "io/xml/IXMLReader.h"
+#include "io/IReadFile.h"
+#include "core/collections/array.h"
+
+#include "testUtils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+using namespace irrgame;
+using namespace irrgame::io;
+
+namespace
+{
+	//! Node, which reader must return
+	struct SExpectedNode
+	{
+		public:
+			EXML_NODE_TYPE Type;
+			core::stringc Name;
+			bool IsEmpty;
+			arraystr AttributeNames;
+			arraystr AttributeValues;
+	};
+
+	//! String returned by reader and its value at the time of read
+	struct SReturnedString
+	{
+		public:
+			const c8* Pointer;
+			core::stringc Value;
+	};
+
+	//! Writes random documents and nodes which they contain
+	class CDocumentGenerator
+	{
+		public:
+
+			CDocumentGenerator(tests::CTestRandom& random) :
+					Random(random)
+			{
+			}
+
+			void generate(u32 elements)
+			{
+				write("<?xml version=\"1.0\"?>");
+
+				SExpectedNode header;
+				header.Type = EXNT_UNKNOWN;
+				header.IsEmpty = false;
+				Nodes.pushBack(header);
+
+				Budget = elements;
+
+				while (Budget)
+					addElement(0);
+			}
+
+		public:
+
+			//! Document, it grows faster than core::stringc
+			core::array<c8> Text;
+			core::array<SExpectedNode> Nodes;
+
+		private:
+
+			void write(const core::stringc& text)
+			{
+				for (u32 i = 0; i < text.size(); ++i)
+					Text.pushBack(text[i]);
+			}
+
+			//! Returns random raw string with xml special characters
+			core::stringc createValue()
+			{
+				const c8 alphabet[] = "abcXYZ019 ._<>&\"'";
+
+				core::stringc result;
+				const u32 size = Random.next(12);
+
+				for (u32 i = 0; i < size; ++i)
+					result.append(alphabet[Random.next(sizeof(alphabet) - 1)]);
+
+				return result;
+			}
+
+			//! Appends value with escaped special characters
+			void appendEscaped(const core::stringc& value)
+			{
+				for (u32 i = 0; i < value.size(); ++i)
+				{
+					switch (value[i])
+					{
+						case '&':
+							write("&amp;");
+							break;
+						case '<':
+							write("&lt;");
+							break;
+						case '>':
+							write("&gt;");
+							break;
+						case '"':
+							write("&quot;");
+							break;
+						case '\'':
+							write("&apos;");
+							break;
+						default:
+							Text.pushBack(value[i]);
+							break;
+					}
+				}
+			}
+
+			void addElement(u32 depth)
+			{
+				const c8* names[] =
+				{ "scene", "node", "mesh", "a", "attributes" };
+
+				--Budget;
+
+				SExpectedNode node;
+				node.Type = EXNT_ELEMENT;
+				node.Name = names[Random.next(5)];
+
+				write("<");
+				write(node.Name);
+
+				const u32 attributes = Random.next(4);
+
+				for (u32 i = 0; i < attributes; ++i)
+				{
+					c8 name[16];
+					sprintf(name, "attr%u", i);
+
+					const core::stringc value = createValue();
+
+					node.AttributeNames.pushBack(name);
+					node.AttributeValues.pushBack(value);
+
+					write(i & 1 ? "\n\t" : " ");
+					write(name);
+					write("=\"");
+					appendEscaped(value);
+					write("\"");
+				}
+
+				const u32 children = depth < 5 ? Random.next(5) : 0;
+
+				node.IsEmpty = !children && Random.next(2);
+				Nodes.pushBack(node);
+
+				if (node.IsEmpty)
+				{
+					write("/>");
+					return;
+				}
+
+				write(">");
+
+				// texts would be merged, so they are never adjacent
+				bool afterText = false;
+
+				for (u32 i = 0; i < children; ++i)
+				{
+					const u32 kind = Random.next(4);
+
+					if (kind == 0 && Budget)
+					{
+						addElement(depth + 1);
+						afterText = false;
+					}
+					else if (kind == 1 && !afterText)
+					{
+						// starts with letter, spaces only texts are skipped
+						const core::stringc value = createValue();
+
+						SExpectedNode text;
+						text.Type = EXNT_TEXT;
+						text.Name = "t";
+						text.Name += value;
+						text.IsEmpty = false;
+
+						write("t");
+						appendEscaped(value);
+
+						Nodes.pushBack(text);
+						afterText = true;
+					}
+					else if (kind == 2)
+					{
+						SExpectedNode comment;
+						comment.Type = EXNT_COMMENT;
+						comment.Name = "comment ";
+						comment.Name += core::stringc((s32) Random.next(100));
+						comment.IsEmpty = false;
+
+						write("<!--");
+						write(comment.Name);
+						write("-->");
+
+						Nodes.pushBack(comment);
+						afterText = false;
+					}
+					else
+					{
+						// cdata is not decoded
+						SExpectedNode cdata;
+						cdata.Type = EXNT_CDATA;
+						cdata.Name = "raw <x> &amp; ";
+						cdata.Name += createValue();
+						cdata.IsEmpty = false;
+
+						if (cdata.Name.find("]]>") >= 0)
+							continue;
+
+						write("<![CDATA[");
+						write(cdata.Name);
+						write("]]>");
+
+						Nodes.pushBack(cdata);
+						afterText = false;
+					}
+				}
+
+				SExpectedNode end;
+				end.Type = EXNT_ELEMENT_END;
+				end.Name = node.Name;
+				end.IsEmpty = false;
+
+				write("</");
+				write(node.Name);
+				write(">");
+
+				Nodes.pushBack(end);
+			}
+
+		private:
+
+			tests::CTestRandom& Random;
+			u32 Budget;
+	};
+
+	//! Remembers string to check later that it is not changed
+	void remember(core::array<SReturnedString>& strings, const c8* pointer)
+	{
+		SReturnedString returned;
+		returned.Pointer = pointer;
+		returned.Value = pointer;
+
+		strings.pushBack(returned);
+	}
+
+	//! Compares current node of reader with expected one
+	s32 compareNode(IXMLReader* reader, const SExpectedNode& node,
+			core::array<SReturnedString>& strings)
+	{
+		s32 failures = reader->getNodeType() != node.Type ? 1 : 0;
+
+		if (node.Type == EXNT_ELEMENT || node.Type == EXNT_ELEMENT_END)
+		{
+			if (node.Name != reader->getNodeName())
+				++failures;
+
+			remember(strings, reader->getNodeName());
+		}
+		else if (node.Type != EXNT_UNKNOWN)
+		{
+			if (node.Name != reader->getNodeData())
+				++failures;
+
+			remember(strings, reader->getNodeData());
+		}
+
+		if (node.Type != EXNT_ELEMENT)
+			return failures;
+
+		if (reader->isEmptyElement() != node.IsEmpty
+				|| reader->getAttributeCount() != node.AttributeNames.size())
+			return failures + 1;
+
+		for (u32 i = 0; i < node.AttributeNames.size(); ++i)
+		{
+			const c8* name = node.AttributeNames[i].cStr();
+
+			const core::stringc& value = node.AttributeValues[i];
+
+			if (node.AttributeNames[i] != reader->getAttributeName(i)
+					|| value != reader->getAttributeValue(i)
+					|| value != reader->getAttributeValue(name)
+					|| reader->getAttributeValue(name)
+							!= reader->getAttributeValue(i))
+				++failures;
+
+			remember(strings, reader->getAttributeName(i));
+			remember(strings, reader->getAttributeValue(i));
+		}
+
+		// other lookups of missing attribute assert
+		if (strcmp(reader->getAttributeValueSafe("missing"), ""))
+			++failures;
+
+		return failures;
+	}
+
+	s32 checkDocument(u32 elements, tests::CTestRandom& random)
+	{
+		CDocumentGenerator generator(random);
+		generator.generate(elements);
+
+		const u32 size = generator.Text.size();
+		c8* memory = new c8[size];
+		memcpy(memory, generator.Text.pointer(), size);
+
+		IReadFile* file = createMemoryReadFile(memory, size, "test.xml", true);
+		IXMLReader* reader = createXMLReader(file);
+		file->drop();
+
+		core::array<SReturnedString> strings;
+
+		s32 failures = 0;
+		u32 count = 0;
+
+		while (reader->read())
+		{
+			if (count < generator.Nodes.size())
+			{
+				failures += compareNode(reader, generator.Nodes[count],
+						strings);
+			}
+
+			++count;
+		}
+
+		if (count != generator.Nodes.size())
+			++failures;
+
+		// strings point into text of reader
+		for (u32 i = 0; i < strings.size(); ++i)
+		{
+			if (strings[i].Value != strings[i].Pointer)
+			{
+				++failures;
+				break;
+			}
+		}
+
+		reader->drop();
+
+		return failures;
+	}
+
+	s32 checkNumbers()
+	{
+		const c8 text[] = "<item i=\"-42\" f=\"3.5\" e=\"2.5e3\" s=\"x\"/>";
+
+		c8* memory = new c8[sizeof(text) - 1];
+		memcpy(memory, text, sizeof(text) - 1);
+
+		IReadFile* file = createMemoryReadFile(memory, sizeof(text) - 1,
+				"numbers.xml", true);
+		IXMLReader* reader = createXMLReader(file);
+		file->drop();
+
+		s32 failures = reader->read() ? 0 : 1;
+
+		if (reader->getAttributeValueAsInt("i") != -42
+				|| reader->getAttributeValueAsInt(0) != -42
+				|| reader->getAttributeValueAsFloat("f") != 3.5f
+				|| reader->getAttributeValueAsFloat(2) != 2500.0f)
+			++failures;
+
+		if (reader->read())
+			++failures;
+
+		reader->drop();
+
+		return failures;
+	}
+}
+
+int main()
+{
+	tests::CTestRandom random;
+	s32 failures = 0;
+
+	failures += tests::report("xml attribute numbers", checkNumbers());
+
+	s32 result = 0;
+
+	for (u32 i = 0; i < 200; ++i)
+		result += checkDocument(1 + random.next(30), random);
+
+	failures += tests::report("xml small random documents", result);
+	failures += tests::report("xml large random document",
+			checkDocument(20000, random));
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,298 @@
+/*
+ * testSweepAndPrune.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Pairs reported by SweepAndPrune must keep the same set as brute force
+// test of all boxes after every update of random adds, removes and moves.
+// Boxes are random floats, or integers on grid, which often touch. Bulk
+// adds and removes go through rebuild, small ones are inserted one by one.
+
+#include "logic/SweepAndPrune.h"
+
+#include "testUtils.h"
+
+#include <set>
+#include <vector>
+
+using namespace irrgame;
+using namespace irrgame::core;
+using namespace irrgame::logic;
+
+namespace
+{
+	typedef std::pair<u32, u32> TPair;
+
+	//! State of handle in reference
+	enum EHandleState
+	{
+		EHS_FREE = 0,
+		EHS_ALIVE,
+		EHS_REMOVED
+	};
+
+	//! Overlap by axes, touching boxes overlap
+	bool overlaps(const aabbox3df& a, const aabbox3df& b)
+	{
+		return a.MinEdge.X <= b.MaxEdge.X && a.MinEdge.Y <= b.MaxEdge.Y
+				&& a.MinEdge.Z <= b.MaxEdge.Z && b.MinEdge.X <= a.MaxEdge.X
+				&& b.MinEdge.Y <= a.MaxEdge.Y && b.MinEdge.Z <= a.MaxEdge.Z;
+	}
+
+	aabbox3df createBox(bool grid, tests::CTestRandom& random)
+	{
+		if (grid)
+		{
+			const f32 x = (f32) random.next(12);
+			const f32 y = (f32) random.next(12);
+			const f32 z = (f32) random.next(12);
+
+			return aabbox3df(x, y, z, x + random.next(3), y + random.next(3),
+					z + random.next(3));
+		}
+
+		const vector3df center(random.nextFloat(-50.f, 50.f),
+				random.nextFloat(-50.f, 50.f), random.nextFloat(-50.f, 50.f));
+		const vector3df extent(random.nextFloat(.5f, 4.5f),
+				random.nextFloat(.5f, 4.5f), random.nextFloat(.5f, 4.5f));
+
+		return aabbox3df(center - extent, center + extent);
+	}
+
+	aabbox3df moveBox(aabbox3df box, bool grid, tests::CTestRandom& random)
+	{
+		if (grid)
+		{
+			const vector3df offset((f32) random.next(3) - 1.f,
+					(f32) random.next(3) - 1.f, (f32) random.next(3) - 1.f);
+
+			box.MinEdge += offset;
+			box.MaxEdge += offset;
+
+			if (!random.next(5))
+				box.MaxEdge.X = box.MinEdge.X + random.next(3);
+
+			return box;
+		}
+
+		// teleport
+		if (!random.next(50))
+			return createBox(false, random);
+
+		const vector3df offset(random.nextFloat(-.7f, .7f),
+				random.nextFloat(-.7f, .7f), random.nextFloat(-.7f, .7f));
+
+		box.MinEdge += offset;
+		box.MaxEdge += offset;
+
+		// resize
+		if (!random.next(4))
+			box.MinEdge.Y -= random.nextFloat(0.f, 1.f);
+
+		return box;
+	}
+
+	//! Applies reported pairs to tracked set
+	s32 applyPairs(const array<SOverlapPair>& begun,
+			const array<SOverlapPair>& ended, std::set<TPair>& tracked)
+	{
+		s32 failures = 0;
+
+		for (u32 i = 0; i < ended.size(); ++i)
+		{
+			const TPair pair(ended[i].First, ended[i].Second);
+
+			if (pair.first >= pair.second || !tracked.erase(pair))
+				++failures;
+		}
+
+		for (u32 i = 0; i < begun.size(); ++i)
+		{
+			const TPair pair(begun[i].First, begun[i].Second);
+
+			if (pair.first >= pair.second || !tracked.insert(pair).second)
+				++failures;
+		}
+
+		return failures;
+	}
+
+	s32 checkScenario(bool grid, u32 initial, tests::CTestRandom& random)
+	{
+		SweepAndPrune broadphase;
+
+		std::vector<aabbox3df> boxes;
+		std::vector<EHandleState> states;
+		std::set<TPair> tracked;
+
+		array<SOverlapPair> begun;
+		array<SOverlapPair> ended;
+
+		s32 failures = 0;
+
+		for (u32 frame = 0; frame < 150; ++frame)
+		{
+			// bulk changes exceed rebuild threshold
+			const u32 operation = random.next(10);
+			const u32 adds = !frame ? initial
+					: operation == 0 ? random.next(150)
+							: operation < 4 ? random.next(5) : 0;
+			const u32 removes = operation == 1 ? random.next(150)
+					: operation < 5 ? random.next(5) : 0;
+
+			for (u32 i = 0; i < adds; ++i)
+			{
+				const aabbox3df box = createBox(grid, random);
+				IGameObject* object = (IGameObject*) (size_t) (i + 1);
+				const u32 handle = broadphase.addObject(box, object);
+
+				if (handle >= boxes.size())
+				{
+					boxes.resize(handle + 1);
+					states.resize(handle + 1, EHS_FREE);
+				}
+
+				if (states[handle] != EHS_FREE
+						|| broadphase.getObject(handle) != object)
+					++failures;
+
+				boxes[handle] = box;
+				states[handle] = EHS_ALIVE;
+			}
+
+			for (u32 i = 0; i < removes; ++i)
+			{
+				const u32 handle = random.next(boxes.size() + 1);
+
+				if (handle < boxes.size() && states[handle] == EHS_ALIVE)
+				{
+					broadphase.removeObject(handle);
+					states[handle] = EHS_REMOVED;
+				}
+			}
+
+			for (u32 handle = 0; handle < boxes.size(); ++handle)
+			{
+				if (states[handle] != EHS_ALIVE || !random.next(3))
+					continue;
+
+				boxes[handle] = moveBox(boxes[handle], grid, random);
+				broadphase.setBox(handle, boxes[handle]);
+
+				// same box again
+				if (!random.next(4))
+					broadphase.setBox(handle, boxes[handle]);
+			}
+
+			broadphase.update(begun, ended);
+			failures += applyPairs(begun, ended, tracked);
+
+			std::set<TPair> expected;
+			u32 alive = 0;
+
+			for (u32 i = 0; i < boxes.size(); ++i)
+			{
+				if (states[i] == EHS_REMOVED)
+					states[i] = EHS_FREE;
+
+				if (states[i] != EHS_ALIVE)
+					continue;
+
+				++alive;
+
+				for (u32 j = i + 1; j < boxes.size(); ++j)
+				{
+					if (states[j] == EHS_ALIVE && overlaps(boxes[i], boxes[j]))
+						expected.insert(TPair(i, j));
+				}
+			}
+
+			if (tracked != expected)
+			{
+				++failures;
+				tracked = expected;
+			}
+
+			if (broadphase.getPairsCount() != expected.size()
+					|| broadphase.getObjectsCount() != alive)
+				++failures;
+
+			std::set<TPair>::const_iterator it = expected.begin();
+
+			for (u32 i = 0; i < 50 && it != expected.end(); ++i, ++it)
+			{
+				// order of handles does not matter
+				if (!broadphase.isOverlapping(it->second, it->first))
+					++failures;
+			}
+		}
+
+		return failures;
+	}
+
+	s32 checkScenarios(tests::CTestRandom& random)
+	{
+		s32 failures = 0;
+
+		for (u32 i = 0; i < 6; ++i)
+		{
+			failures += checkScenario(false, i < 3 ? 40 : 400, random);
+			failures += checkScenario(true, i < 3 ? 30 : 200, random);
+		}
+
+		return failures;
+	}
+
+	s32 checkRemoveAndClear()
+	{
+		s32 failures = 0;
+
+		SweepAndPrune broadphase;
+		array<SOverlapPair> begun;
+		array<SOverlapPair> ended;
+
+		broadphase.update(begun, ended);
+
+		broadphase.addObject(aabbox3df(0.f, 0.f, 0.f, 1.f, 1.f, 1.f));
+		u32 handle = broadphase.addObject(
+				aabbox3df(1.f, 1.f, 1.f, 2.f, 2.f, 2.f));
+
+		// object, which was never inserted, has no pairs
+		broadphase.removeObject(handle);
+		broadphase.update(begun, ended);
+
+		if (begun.size() || ended.size())
+			++failures;
+
+		handle = broadphase.addObject(aabbox3df(1.f, 0.f, 0.f, 2.f, 1.f, 1.f));
+		broadphase.update(begun, ended);
+
+		if (begun.size() != 1 || ended.size())
+			++failures;
+
+		// clear does not report pairs
+		broadphase.clear();
+		broadphase.update(begun, ended);
+
+		if (broadphase.getPairsCount() || broadphase.getObjectsCount()
+				|| begun.size() || ended.size())
+			++failures;
+
+		return failures;
+	}
+}
+
+int main()
+{
+	tests::CTestRandom random;
+	s32 failures = 0;
+
+	failures += tests::report("sweep and prune pairs match brute force",
+			checkScenarios(random));
+	failures += tests::report("sweep and prune remove and clear",
+			checkRemoveAndClear());
+
+	return failures ? 1 : 0;
+}
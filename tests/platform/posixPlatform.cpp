@@ -0,0 +1,243 @@
+/*
+ * posixPlatform.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Realization of platform dependent parts of the engine on POSIX threads.
+// Only tests and benchmarks link it, players provide their own.
+
+#include "threads/irrgameThread.h"
+#include "threads/irrgameMonitor.h"
+#include "threads/irrgameSemaphore.h"
+#include "utils/StaticByteSwap.h"
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdlib.h>
+
+namespace irrgame
+{
+	namespace threads
+	{
+
+		//! Thread which runs callback by pthread
+		class CPosixThread: public irrgameThread
+		{
+			public:
+
+				//! Default constructor
+				CPosixThread(delegateThreadCallback* callback, void* arg,
+						const core::stringc& name) :
+						Thread(), IsStarted(false)
+				{
+					Callback = callback;
+					CallbackArg = arg;
+					Name = name;
+				}
+
+				//! Destructor
+				virtual ~CPosixThread()
+				{
+					if (IsStarted)
+						pthread_detach(Thread);
+				}
+
+				virtual void start()
+				{
+					IRR_ASSERT(!IsStarted);
+
+					IsStarted = pthread_create(&Thread, 0, run, this) == 0;
+				}
+
+				virtual void join()
+				{
+					if (!IsStarted)
+						return;
+
+					pthread_join(Thread, 0);
+					IsStarted = false;
+				}
+
+			private:
+
+				//! Body of thread
+				static void* run(void* arg)
+				{
+					static_cast<CPosixThread*>(arg)->proceedCallback();
+
+					return 0;
+				}
+
+			private:
+
+				pthread_t Thread;
+				bool IsStarted;
+		};
+
+		//! Monitor on recursive pthread mutex
+		class CPosixMonitor: public irrgameMonitor
+		{
+			public:
+
+				//! Default constructor
+				CPosixMonitor()
+				{
+					pthread_mutexattr_t attributes;
+					pthread_mutexattr_init(&attributes);
+					pthread_mutexattr_settype(&attributes,
+							PTHREAD_MUTEX_RECURSIVE);
+
+					pthread_mutex_init(&Mutex, &attributes);
+
+					pthread_mutexattr_destroy(&attributes);
+				}
+
+				//! Destructor
+				virtual ~CPosixMonitor()
+				{
+					pthread_mutex_destroy(&Mutex);
+				}
+
+				virtual void enter()
+				{
+					pthread_mutex_lock(&Mutex);
+				}
+
+				virtual void exit()
+				{
+					pthread_mutex_unlock(&Mutex);
+				}
+
+			private:
+
+				pthread_mutex_t Mutex;
+		};
+
+		//! Counting semaphore on POSIX unnamed semaphore
+		class CPosixSemaphore: public irrgameSemaphore
+		{
+			public:
+
+				//! Default constructor
+				CPosixSemaphore(u32 initialCount)
+				{
+					sem_init(&Semaphore, 0, initialCount);
+				}
+
+				//! Destructor
+				virtual ~CPosixSemaphore()
+				{
+					sem_destroy(&Semaphore);
+				}
+
+				virtual void post(u32 count)
+				{
+					while (count--)
+						sem_post(&Semaphore);
+				}
+
+				virtual void wait()
+				{
+					// wait is interrupted by signals
+					while (sem_wait(&Semaphore) != 0 && errno == EINTR)
+						;
+				}
+
+			private:
+
+				sem_t Semaphore;
+		};
+
+		//! irrgameThread creator
+		irrgameThread* createIrrgameThread(delegateThreadCallback* callback,
+				void* callbackArg, EThreadPriority /* prior */,
+				core::stringc name)
+		{
+			return new CPosixThread(callback, callbackArg, name);
+		}
+
+		//! irrgameMonitor creator
+		irrgameMonitor* createIrrgameMonitor()
+		{
+			return new CPosixMonitor;
+		}
+
+		//! irrgameSemaphore creator
+		irrgameSemaphore* createIrrgameSemaphore(u32 initialCount)
+		{
+			return new CPosixSemaphore(initialCount);
+		}
+
+		//! Causes the operating system to sleep current thread.
+		void irrgameThread::sleep(s32 time)
+		{
+			usleep(time * 1000);
+		}
+
+		//! Returns count of hardware threads which can run concurrently.
+		//! IRRGAME_PROCESSORS environment variable overrides it, so parallel
+		//! code runs several workers on machines with one processor too.
+		u32 irrgameThread::getProcessorsCount()
+		{
+			const c8* forced = getenv("IRRGAME_PROCESSORS");
+
+			if (forced && atoi(forced) > 0)
+				return (u32) atoi(forced);
+
+			const long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+			return count > 0 ? (u32) count : 1;
+		}
+	}
+
+	namespace utils
+	{
+		u16 StaticByteSwap::byteswap(u16 num)
+		{
+			return (u16) ((num >> 8) | (num << 8));
+		}
+
+		s16 StaticByteSwap::byteswap(s16 num)
+		{
+			return (s16) byteswap((u16) num);
+		}
+
+		u32 StaticByteSwap::byteswap(u32 num)
+		{
+			return __builtin_bswap32(num);
+		}
+
+		s32 StaticByteSwap::byteswap(s32 num)
+		{
+			return (s32) byteswap((u32) num);
+		}
+
+		f32 StaticByteSwap::byteswap(f32 num)
+		{
+			union
+			{
+					f32 Float;
+					u32 Bits;
+			} value;
+
+			value.Float = num;
+			value.Bits = byteswap(value.Bits);
+
+			return value.Float;
+		}
+
+		u8 StaticByteSwap::byteswap(u8 num)
+		{
+			return num;
+		}
+
+		c8 StaticByteSwap::byteswap(c8 num)
+		{
+			return num;
+		}
+	}
+}
@@ -0,0 +1,90 @@
+/*
+ * testUtils.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+#ifndef TESTUTILS_H_
+#define TESTUTILS_H_
+
+#include "compileConfig.h"
+#include "threads/irrgameThread.h"
+
+#include <stdio.h>
+
+namespace irrgame
+{
+	namespace tests
+	{
+		//! Deterministic random numbers, so failed runs can be repeated
+		class CTestRandom
+		{
+			public:
+
+				//! Default constructor
+				CTestRandom(u32 seed = 12345) :
+						State(seed ? seed : 1)
+				{
+				}
+
+				//! Returns next random number (xorshift32)
+				u32 next()
+				{
+					State ^= State << 13;
+					State ^= State >> 17;
+					State ^= State << 5;
+
+					return State;
+				}
+
+				//! Returns random number in [0; range)
+				u32 next(u32 range)
+				{
+					return next() % range;
+				}
+
+				//! Returns random number in [min; max]
+				f32 nextFloat(f32 min, f32 max)
+				{
+					return min + (max - min) * (next() >> 8) * (1.0f / 16777215);
+				}
+
+			private:
+
+				u32 State;
+		};
+
+		//! Runs callback in count threads at once and waits for all of them
+		inline void runThreads(threads::delegateThreadCallback* callback,
+				u32 count, void* arg = 0)
+		{
+			threads::irrgameThread* workers[64];
+
+			IRR_ASSERT(count <= 64);
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				workers[i] = threads::createIrrgameThread(callback, arg);
+				workers[i]->start();
+			}
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				workers[i]->join();
+				workers[i]->drop();
+			}
+		}
+
+		//! Prints result of one case. Returns 1 if it has failures.
+		inline s32 report(const c8* name, s32 failures)
+		{
+			printf("%-56s %s\n", name, failures ? "FAILED" : "ok");
+
+			return failures ? 1 : 0;
+		}
+
+	}  // namespace tests
+}  // namespace irrgame
+
+#endif /* TESTUTILS_H_ */
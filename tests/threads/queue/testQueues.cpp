@@ -0,0 +1,228 @@
+/*
+ * testQueues.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// MPMCQueue and SPSCQueue must keep FIFO order and refuse elements when
+// full. Blocking queues over both rings must deliver every element
+// exactly once and in order of each producer with 1 to 16 producers and
+// consumers, while small capacity makes threads park.
+
+#include "threads/queue/BlockingQueue.h"
+#include "threads/queue/SPSCQueue.h"
+#include "threads/irrgameAtomic.h"
+#include "threads/irrgameThread.h"
+
+#include "testUtils.h"
+
+using namespace irrgame;
+
+namespace
+{
+	//! Elements of all producers, divisible by 1..4, 8 and 16 threads
+	const u32 Total = 48000;
+
+	//! Bits of element, which keep sequence number of producer
+	const u32 SequenceBits = 20;
+
+	template<class TQueue>
+	s32 checkRing(TQueue& queue)
+	{
+		s32 failures = 0;
+		s32 value = 0;
+
+		for (u32 lap = 0; lap < 3; ++lap)
+		{
+			for (u32 i = 0; i < queue.getCapacity(); ++i)
+			{
+				if (!queue.push(i))
+					++failures;
+			}
+
+			if (queue.push(-1) || queue.size() != queue.getCapacity())
+				++failures;
+
+			for (u32 i = 0; i < queue.getCapacity(); ++i)
+			{
+				if (!queue.pop(value) || value != (s32) i)
+					++failures;
+			}
+
+			if (queue.pop(value) || !queue.empty() || queue.size())
+				++failures;
+		}
+
+		return failures;
+	}
+
+	s32 checkRings()
+	{
+		threads::MPMCQueue<s32> mpmc(4);
+		threads::SPSCQueue<s32> spsc(8);
+
+		threads::BlockingQueue<s32> blocking(2);
+		s32 failures = 0;
+		s32 value = 0;
+
+		blocking.push(1);
+
+		if (!blocking.tryPush(2) || blocking.tryPush(3)
+				|| blocking.size() != 2)
+			++failures;
+
+		blocking.pop(value);
+
+		if (value != 1 || !blocking.tryPop(value) || value != 2
+				|| blocking.tryPop(value) || !blocking.empty())
+			++failures;
+
+		return failures + checkRing(mpmc) + checkRing(spsc);
+	}
+
+	//! Threads take roles of producers and consumers by start order
+	template<class TQueue>
+	class CExchange
+	{
+		public:
+
+			CExchange(u32 producers, u32 consumers, u32 capacity) :
+					Queue(capacity), Producers(producers),
+					Consumers(consumers), NextThread(0), Failures(0)
+			{
+				Received = new u32[Total];
+
+				for (u32 i = 0; i < Total; ++i)
+					Received[i] = 0;
+			}
+
+			~CExchange()
+			{
+				delete[] Received;
+			}
+
+			s32 run(void* /* arg */)
+			{
+				const u32 index = threads::irrgameAtomic::fetchAdd(
+						&NextThread, 1u);
+
+				if (index < Producers)
+				{
+					for (u32 i = 0; i < Total / Producers; ++i)
+						Queue.push((index << SequenceBits) | i);
+
+					return 0;
+				}
+
+				// sequence of each producer must grow for every consumer
+				s32 last[16];
+
+				for (u32 i = 0; i < 16; ++i)
+					last[i] = -1;
+
+				s32 failures = 0;
+
+				for (u32 i = 0; i < Total / Consumers; ++i)
+				{
+					u32 value = 0;
+					Queue.pop(value);
+
+					const u32 producer = value >> SequenceBits;
+					const s32 sequence = value & ((1 << SequenceBits) - 1);
+
+					if (producer >= Producers || sequence <= last[producer])
+					{
+						++failures;
+						continue;
+					}
+
+					last[producer] = sequence;
+
+					threads::irrgameAtomic::fetchAdd(
+							&Received[producer * (Total / Producers)
+									+ sequence], 1u);
+				}
+
+				threads::irrgameAtomic::fetchAdd(&Failures, failures);
+
+				return 0;
+			}
+
+			s32 check()
+			{
+				threads::delegateThreadCallback callback;
+				callback += NewDelegate(this, &CExchange::run);
+
+				tests::runThreads(&callback, Producers + Consumers);
+
+				s32 failures = Failures;
+
+				for (u32 i = 0; i < Total; ++i)
+				{
+					if (Received[i] != 1)
+						++failures;
+				}
+
+				return failures + (Queue.empty() ? 0 : 1);
+			}
+
+		private:
+
+			TQueue Queue;
+
+			u32 Producers;
+			u32 Consumers;
+
+			u32 NextThread;
+			s32 Failures;
+
+			u32* Received;
+	};
+
+	template<class TQueue>
+	s32 checkExchange(u32 producers, u32 consumers, u32 capacity)
+	{
+		CExchange<TQueue> exchange(producers, consumers, capacity);
+
+		return exchange.check();
+	}
+
+	s32 checkMPMC()
+	{
+		typedef threads::BlockingQueue<u32> TQueue;
+
+		const u32 counts[] =
+		{ 1, 2, 4, 16 };
+
+		s32 failures = 0;
+
+		for (u32 i = 0; i < 4; ++i)
+		{
+			failures += checkExchange<TQueue>(counts[i], counts[i], 16);
+			failures += checkExchange<TQueue>(1, counts[i], 16);
+			failures += checkExchange<TQueue>(counts[i], 1, 16);
+		}
+
+		return failures + checkExchange<TQueue>(4, 4, 1024);
+	}
+
+	s32 checkSPSC()
+	{
+		typedef threads::BlockingQueue<u32, threads::SPSCQueue<u32> > TQueue;
+
+		return checkExchange<TQueue>(1, 1, 2) + checkExchange<TQueue>(1, 1, 64);
+	}
+}
+
+int main()
+{
+	s32 failures = 0;
+
+	failures += tests::report("queues keep order and capacity", checkRings());
+	failures += tests::report("blocking MPMC queue with 1..16 threads",
+			checkMPMC());
+	failures += tests::report("blocking SPSC queue", checkSPSC());
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,229 @@
+/*
+ * testBlitBatch.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Dense blitter table must select the same blitter as linear search in
+// blitTable with -1 and -2 wildcards. Batched Blit must produce the same
+// image as one Blit call per sprite, with sprites clipped by source, dest
+// and dest clipping rectangle.
+
+#include "video/blit/blit.h"
+#include "video/image/CImage.h"
+#include "video/utils/SharedVideoUtils.h"
+#include "video/blit/blitSIMD.h"
+#include "video/blit/blitterTable.h"
+#include "core/collections/array.h"
+
+#include "testUtils.h"
+
+#include <string.h>
+
+using namespace irrgame;
+using namespace irrgame::video;
+
+namespace
+{
+	const s32 Sprites = 60;
+
+	//! Returns first entry of blitTable for formats, -1 format means no
+	//! image. Same search as was done on every Blit call.
+	const blitterTable* findEntry(eBlitter operation, s32 destFormat,
+			s32 sourceFormat)
+	{
+		for (const blitterTable* b = blitTable; b->operation != BLITTER_INVALID;
+				++b)
+		{
+			if (b->operation != operation)
+				continue;
+
+			if ((b->destFormat == -1 || b->destFormat == destFormat)
+					&& (b->sourceFormat == -1 || b->sourceFormat == sourceFormat))
+				return b;
+
+			if (b->destFormat == -2 && sourceFormat == destFormat)
+				return b;
+		}
+
+		return 0;
+	}
+
+	s32 checkTable()
+	{
+		const SBlitterDispatchTable& table = SBlitterDispatchTable::getInstance();
+
+		s32 failures = 0;
+
+		for (s32 operation = 0; operation < BLITTER_COUNT; ++operation)
+		{
+			for (s32 dest = 0; dest <= ECF_COUNT; ++dest)
+			{
+				for (s32 source = 0; source <= ECF_COUNT; ++source)
+				{
+					const blitterTable* entry = findEntry((eBlitter) operation,
+							dest == ECF_COUNT ? -1 : dest,
+							source == ECF_COUNT ? -1 : source);
+
+					const tExecuteBlit blitter =
+							table.Blitters[operation][dest][source];
+
+					// table may hold SIMD version of entry
+					if (!entry)
+					{
+						if (blitter)
+							++failures;
+					}
+					else if (blitter != entry->func
+							&& blitter != entry->funcSSE2
+							&& blitter != entry->funcAVX2)
+						++failures;
+				}
+			}
+		}
+
+		return failures;
+	}
+
+	//! Fills image with random bytes
+	void fillImage(IImage* image, tests::CTestRandom& random)
+	{
+		u8* data = (u8*) image->lock();
+
+		for (u32 i = 0; i < image->getImageDataSizeInBytes(); ++i)
+			data[i] = (u8) random.next();
+
+		image->unlock();
+	}
+
+	//! Blits random sprites one by one and in batch, compares images
+	s32 checkBatch(eBlitter operation, EColorFormat destFormat,
+			EColorFormat sourceFormat, bool clipped, tests::CTestRandom& random)
+	{
+		const bool color = operation == BLITTER_COLOR
+				|| operation == BLITTER_COLOR_ALPHA;
+
+		CImage* source = color ? 0 : new CImage(sourceFormat,
+				dimension2du(64, 48));
+		CImage* single = new CImage(destFormat, dimension2du(100, 80));
+		CImage* batch = new CImage(destFormat, dimension2du(100, 80));
+
+		if (source)
+			fillImage(source, random);
+
+		fillImage(single, random);
+		memcpy(batch->lock(), single->lock(),
+				single->getImageDataSizeInBytes());
+
+		const recti clipping(7, 5, 90, 71);
+		const recti* destClipping = clipped ? &clipping : 0;
+
+		core::array<SBlitJob> jobs;
+		jobs.setUsed(Sprites);
+
+		s32 expected = 0;
+
+		for (s32 i = 0; i < Sprites; ++i)
+		{
+			// sprites partly outside of source and dest
+			const s32 x = (s32) random.next(80) - 10;
+			const s32 y = (s32) random.next(60) - 10;
+
+			const recti rect(x, y, x + (s32) random.next(40),
+					y + (s32) random.next(40));
+			const vector2di position((s32) random.next(120) - 10,
+					(s32) random.next(100) - 10);
+			const u32 argb = random.next();
+
+			// color operations fill rectangle at its own position
+			const vector2di& destPos = color ? rect.UpperLeftCorner : position;
+
+			expected += Blit(operation, single, destClipping, &destPos, source,
+					&rect, argb);
+
+			SBlitJob& job = jobs[i];
+			memset(&job, 0, sizeof(job));
+
+			job.Source.x0 = rect.UpperLeftCorner.X;
+			job.Source.y0 = rect.UpperLeftCorner.Y;
+			job.Source.x1 = rect.LowerRightCorner.X;
+			job.Source.y1 = rect.LowerRightCorner.Y;
+			job.Dest.x0 = destPos.X;
+			job.Dest.y0 = destPos.Y;
+			job.argb = argb;
+		}
+
+		const s32 done = Blit(operation, batch, destClipping, source,
+				jobs.pointer(), jobs.size());
+
+		s32 failures = done != expected ? 1 : 0;
+
+		if (memcmp(single->lock(), batch->lock(),
+				single->getImageDataSizeInBytes()))
+			++failures;
+
+		single->unlock();
+		batch->unlock();
+
+		if (source)
+			source->drop();
+
+		single->drop();
+		batch->drop();
+
+		return failures;
+	}
+}
+
+int main()
+{
+	const EColorFormat formats[] =
+	{ ECF_A1R5G5B5, ECF_R5G6B5, ECF_R8G8B8, ECF_A8R8G8B8 };
+
+	const u32 count = sizeof(formats) / sizeof(formats[0]);
+
+	tests::CTestRandom random;
+	s32 failures = 0;
+	c8 name[128];
+
+	failures += tests::report("dense blitter table", checkTable());
+
+	for (s32 operation = BLITTER_COLOR; operation < BLITTER_COUNT; ++operation)
+	{
+		for (u32 d = 0; d < count; ++d)
+		{
+			for (u32 s = 0; s < count; ++s)
+			{
+				const bool color = operation == BLITTER_COLOR
+						|| operation == BLITTER_COLOR_ALPHA;
+
+				// color operations have no source
+				if (color && s)
+					continue;
+
+				if (!findEntry((eBlitter) operation, formats[d],
+						color ? -1 : formats[s]))
+					continue;
+
+				s32 result = 0;
+
+				result += checkBatch((eBlitter) operation, formats[d],
+						formats[s], false, random);
+				result += checkBatch((eBlitter) operation, formats[d],
+						formats[s], true, random);
+
+				if (color)
+					sprintf(name, "batched blitter %d, format %d", operation,
+							formats[d]);
+				else
+					sprintf(name, "batched blitter %d, format %d <- %d",
+							operation, formats[d], formats[s]);
+
+				failures += tests::report(name, result);
+			}
+		}
+	}
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,189 @@
+/*
+ * testBlitParallel.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Blit, copyToScaling and copyToScalingBoxFilter split into row bands must
+// produce the same bytes as in one thread, for sizes which are not
+// multiples of band size.
+
+#include "video/blit/blit.h"
+#include "video/image/CImage.h"
+
+#include "testUtils.h"
+
+#include <string.h>
+
+using namespace irrgame;
+using namespace irrgame::video;
+
+namespace
+{
+	const u32 Serial = 0xFFFFFFFF;
+
+	//! Fills image with random bytes
+	void fillImage(IImage* image, tests::CTestRandom& random)
+	{
+		u8* data = (u8*) image->lock();
+
+		for (u32 i = 0; i < image->getImageDataSizeInBytes(); ++i)
+			data[i] = (u8) random.next();
+
+		image->unlock();
+	}
+
+	//! Returns true if images have same bytes
+	bool isEqual(IImage* a, IImage* b)
+	{
+		const bool result = !memcmp(a->lock(), b->lock(),
+				a->getImageDataSizeInBytes());
+
+		a->unlock();
+		b->unlock();
+
+		return result;
+	}
+
+	//! Creates copy of image
+	CImage* createCopy(IImage* image)
+	{
+		CImage* result = new CImage(image->getColorFormat(),
+				image->getDimension());
+
+		memcpy(result->lock(), image->lock(), image->getImageDataSizeInBytes());
+
+		result->unlock();
+		image->unlock();
+
+		return result;
+	}
+
+	s32 checkBlit(eBlitter operation, EColorFormat format,
+			tests::CTestRandom& random)
+	{
+		const bool color = operation == BLITTER_COLOR
+				|| operation == BLITTER_COLOR_ALPHA;
+
+		CImage* source = color ? 0 : new CImage(format, dimension2du(701, 599));
+		CImage* serial = new CImage(format, dimension2du(803, 697));
+
+		if (source)
+			fillImage(source, random);
+
+		fillImage(serial, random);
+
+		CImage* parallel = createCopy(serial);
+
+		// partly outside of dest, color operations fill sourceClipping
+		const vector2di position(31, -17);
+		const recti rect(5, 3, 790, 650);
+		const recti* sourceClipping = color ? &rect : 0;
+
+		setParallelBlitThreshold(Serial);
+		Blit(operation, serial, 0, &position, source, sourceClipping, 0x80C08040);
+
+		setParallelBlitThreshold(0);
+		Blit(operation, parallel, 0, &position, source, sourceClipping,
+				0x80C08040);
+
+		s32 failures = isEqual(serial, parallel) ? 0 : 1;
+
+		if (source)
+			source->drop();
+
+		serial->drop();
+		parallel->drop();
+
+		return failures;
+	}
+
+	s32 checkScaling(EColorFormat format, const dimension2du& sourceSize,
+			const dimension2du& targetSize, tests::CTestRandom& random)
+	{
+		CImage* source = new CImage(format, sourceSize);
+		fillImage(source, random);
+
+		CImage* serial = new CImage(format, targetSize);
+		fillImage(serial, random);
+
+		CImage* parallel = createCopy(serial);
+
+		s32 failures = 0;
+
+		setParallelBlitThreshold(Serial);
+		source->copyToScaling(serial);
+
+		setParallelBlitThreshold(0);
+		source->copyToScaling(parallel);
+
+		if (!isEqual(serial, parallel))
+			++failures;
+
+		for (s32 blend = 0; blend < 2; ++blend)
+		{
+			setParallelBlitThreshold(Serial);
+			source->copyToScalingBoxFilter(serial, 3, blend);
+
+			setParallelBlitThreshold(0);
+			source->copyToScalingBoxFilter(parallel, 3, blend);
+
+			if (!isEqual(serial, parallel))
+				++failures;
+		}
+
+		source->drop();
+		serial->drop();
+		parallel->drop();
+
+		return failures;
+	}
+}
+
+int main()
+{
+	const u32 threshold = getParallelBlitThreshold();
+
+	const eBlitter operations[] =
+	{ BLITTER_COLOR, BLITTER_COLOR_ALPHA, BLITTER_TEXTURE,
+			BLITTER_TEXTURE_ALPHA_BLEND, BLITTER_TEXTURE_ALPHA_COLOR_BLEND };
+
+	const EColorFormat formats[] =
+	{ ECF_A1R5G5B5, ECF_R5G6B5, ECF_R8G8B8, ECF_A8R8G8B8 };
+
+	tests::CTestRandom random;
+	s32 failures = 0;
+	c8 name[128];
+
+	for (u32 i = 0; i < sizeof(operations) / sizeof(operations[0]); ++i)
+	{
+		for (u32 k = 0; k < sizeof(formats) / sizeof(formats[0]); ++k)
+		{
+			// unsupported pairs do nothing in both modes
+			sprintf(name, "parallel blitter %d, format %d", operations[i],
+					formats[k]);
+			failures += tests::report(name,
+					checkBlit(operations[i], formats[k], random));
+		}
+	}
+
+	for (u32 k = 0; k < sizeof(formats) / sizeof(formats[0]); ++k)
+	{
+		s32 result = 0;
+
+		result += checkScaling(formats[k], dimension2du(700, 600),
+				dimension2du(1234, 999), random);
+		result += checkScaling(formats[k], dimension2du(1234, 999),
+				dimension2du(333, 211), random);
+		result += checkScaling(formats[k], dimension2du(3, 1),
+				dimension2du(5, 7), random);
+
+		sprintf(name, "parallel scaling, format %d", formats[k]);
+		failures += tests::report(name, result);
+	}
+
+	setParallelBlitThreshold(threshold);
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * testBlitSIMD.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// Every SSE2 and AVX2 blitter of blitTable must produce exactly the same
+// bytes as its scalar reference, padding between rows included.
+
+#include "video/blit/blit.h"
+#include "video/image/IImage.h"
+#include "video/utils/SharedVideoUtils.h"
+#include "video/blit/blitSIMD.h"
+#include "video/blit/blitterTable.h"
+#include "core/utils/SharedCPUFeatures.h"
+#include "core/collections/array.h"
+
+#include "testUtils.h"
+
+#include <string.h>
+
+using namespace irrgame;
+using namespace irrgame::video;
+
+namespace
+{
+	//! Returns bytes per pixel of format, 0 for blits without image
+	u32 getPixelSize(s32 format)
+	{
+		if (format < 0)
+			return 0;
+
+		return SharedVideoUtils::getInstance().getBitsPerPixelFromFormat(
+				(EColorFormat) format) / 8;
+	}
+
+	//! Fills bytes, a quarter of them fully transparent, a quarter opaque
+	void fill(core::array<u8>& bytes, tests::CTestRandom& random)
+	{
+		for (u32 i = 0; i < bytes.size(); ++i)
+		{
+			const u32 r = random.next();
+
+			switch ((r >> 8) & 3)
+			{
+				case 0:
+					bytes[i] = 0;
+					break;
+				case 1:
+					bytes[i] = 0xFF;
+					break;
+				default:
+					bytes[i] = (u8) r;
+					break;
+			}
+		}
+	}
+
+	//! Runs blitter and its reference on random images
+	s32 check(const blitterTable& entry, tExecuteBlit simd)
+	{
+		tests::CTestRandom random(entry.operation * 977 + entry.destFormat);
+
+		const u32 dstPixel = getPixelSize(entry.destFormat);
+		const u32 srcPixel = getPixelSize(entry.sourceFormat);
+
+		s32 failures = 0;
+
+		for (s32 i = 0; i < 500; ++i)
+		{
+			// short rows hit every tail length, long rows the vector loops
+			const s32 width = i % 5 ? random.next(70) + 1 : random.next(600) + 1;
+			const s32 height = random.next(5) + 1;
+
+			SBlitJob job;
+			memset(&job, 0, sizeof(job));
+
+			job.width = width;
+			job.height = height;
+			job.srcPixelMul = srcPixel;
+			job.dstPixelMul = dstPixel;
+			job.srcPitch = width * srcPixel + random.next(3) * 4;
+			job.dstPitch = width * dstPixel + random.next(3) * 4;
+
+			// color operations take row size from srcPitch, as Blit sets it
+			if (!srcPixel)
+				job.srcPitch = width * dstPixel;
+
+			job.argb = random.next();
+
+			if (i % 7 == 0)
+				job.argb &= 0x00FFFFFF;
+			else if (i % 7 == 1)
+				job.argb |= 0xFF000000;
+
+			core::array<u8> source;
+			core::array<u8> reference;
+			core::array<u8> result;
+
+			source.setUsed(job.srcPitch * height + 16);
+			reference.setUsed(job.dstPitch * height + 16);
+
+			fill(source, random);
+			fill(reference, random);
+			result = reference;
+
+			job.src = source.pointer();
+
+			job.dst = reference.pointer();
+			entry.func(&job);
+
+			job.dst = result.pointer();
+			simd(&job);
+
+			if (memcmp(reference.pointer(), result.pointer(), reference.size()))
+				++failures;
+		}
+
+		return failures;
+	}
+}
+
+int main()
+{
+	const core::SharedCPUFeatures& cpu = core::SharedCPUFeatures::getInstance();
+
+	printf("SSE2 %d, AVX2 %d\n", cpu.hasSSE2(), cpu.hasAVX2());
+
+	s32 failures = 0;
+	c8 name[128];
+
+	for (const blitterTable* entry = blitTable;
+			entry->operation != BLITTER_INVALID; ++entry)
+	{
+		if (entry->funcSSE2 && cpu.hasSSE2())
+		{
+			sprintf(name, "blitter %d, format %d <- %d, SSE2", entry->operation,
+					entry->destFormat, entry->sourceFormat);
+
+			failures += tests::report(name, check(*entry, entry->funcSSE2));
+		}
+
+		if (entry->funcAVX2 && cpu.hasAVX2())
+		{
+			sprintf(name, "blitter %d, format %d <- %d, AVX2", entry->operation,
+					entry->destFormat, entry->sourceFormat);
+
+			failures += tests::report(name, check(*entry, entry->funcAVX2));
+		}
+	}
+
+	return failures ? 1 : 0;
+}
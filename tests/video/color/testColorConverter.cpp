@@ -0,0 +1,234 @@
+/*
+ * testColorConverter.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: gregorytkach
+ */
+
+// SSSE3 and AVX2 bulk color conversions must produce exactly the same bytes
+// as scalar conversions. 16 bit formats are checked on all 65536 inputs,
+// 24 and 32 bit formats on random pixels of every short length and random
+// long ones.
+
+#include "video/color/SharedColorConverter.h"
+#include "video/color/SColorConverterSIMD.h"
+#include "core/utils/SharedCPUFeatures.h"
+#include "core/collections/array.h"
+
+#include "testUtils.h"
+
+#include <string.h>
+
+using namespace irrgame;
+using namespace irrgame::video;
+
+namespace
+{
+	typedef void (SharedColorConverter::*tConvertColors)(const void* sP,
+			s32 sN, void* dP);
+
+	//! Bulk conversion and its SIMD part
+	struct SConversion
+	{
+			const c8* Name;
+			tConvertColors Convert;
+			tConvertColorsSIMD SColorConverterSIMD::*Kernel;
+			u32 SourceSize;
+			u32 DestSize;
+	};
+
+#define CONVERSION(name, sourceSize, destSize) \
+	{ #name, &SharedColorConverter::convert_##name, \
+			&SColorConverterSIMD::name, sourceSize, destSize }
+
+	const SConversion Conversions[] =
+	{
+	CONVERSION(A1R5G5B5toA8R8G8B8, 2, 4),
+	CONVERSION(A1R5G5B5toR5G6B5, 2, 2),
+	CONVERSION(A1R5G5B5toR5G5B5A1, 2, 2),
+	CONVERSION(A8R8G8B8toR8G8B8, 4, 3),
+	CONVERSION(A8R8G8B8toB8G8R8, 4, 3),
+	CONVERSION(A8R8G8B8toA1R5G5B5, 4, 2),
+	CONVERSION(A8R8G8B8toR5G6B5, 4, 2),
+	CONVERSION(A8R8G8B8toR8G8B8A8, 4, 4),
+	CONVERSION(A8R8G8B8toA8B8G8R8, 4, 4),
+	CONVERSION(R8G8B8toA8R8G8B8, 3, 4),
+	CONVERSION(R8G8B8toA1R5G5B5, 3, 2),
+	CONVERSION(R8G8B8toB8G8R8, 3, 3),
+	CONVERSION(R8G8B8toR5G6B5, 3, 2),
+	CONVERSION(B8G8R8toA8R8G8B8, 3, 4),
+	CONVERSION(B8G8R8A8toA8R8G8B8, 4, 4),
+	CONVERSION(R5G6B5toA8R8G8B8, 2, 4),
+	CONVERSION(R5G6B5toA1R5G5B5, 2, 2) };
+
+#undef CONVERSION
+
+	//! Bytes after converted pixels, they must stay untouched
+	const u32 GuardSize = 64;
+	const u8 GuardValue = 0xAB;
+
+	//! Converts pixel by pixel. Single pixel does not fill a register, so
+	//! it is always converted by scalar code.
+	void convertScalar(const SConversion& conversion, const u8* source,
+			s32 count, u8* dest)
+	{
+		SharedColorConverter& converter = SharedColorConverter::getInstance();
+
+		for (s32 i = 0; i < count; ++i)
+			(converter.*conversion.Convert)(source + i * conversion.SourceSize,
+					1, dest + i * conversion.DestSize);
+	}
+
+	//! Compares kernel, and whole bulk conversion if it uses the kernel,
+	//! with scalar conversion of count pixels. Returns count of mismatches.
+	s32 compare(const SConversion& conversion, tConvertColorsSIMD kernel,
+			bool checkBulk, const u8* source, s32 count)
+	{
+		const u32 destBytes = count * conversion.DestSize;
+
+		core::array<u8> reference;
+		core::array<u8> result;
+
+		reference.setUsed(destBytes + GuardSize);
+		memset(reference.pointer(), GuardValue, reference.size());
+		result = reference;
+
+		convertScalar(conversion, source, count, reference.pointer());
+
+		s32 failures = 0;
+
+		const s32 done = kernel(source, count, result.pointer());
+
+		if (done < 0 || done > count)
+			return 1;
+
+		if (memcmp(reference.pointer(), result.pointer(),
+				done * conversion.DestSize))
+			++failures;
+
+		// pixels after converted ones may be overwritten, end of row may not
+		for (u32 i = destBytes; i < result.size(); ++i)
+		{
+			if (result[i] != GuardValue)
+			{
+				++failures;
+				break;
+			}
+		}
+
+		if (checkBulk)
+		{
+			memset(result.pointer(), GuardValue, result.size());
+
+			(SharedColorConverter::getInstance().*conversion.Convert)(source,
+					count, result.pointer());
+
+			if (memcmp(reference.pointer(), result.pointer(), result.size()))
+				++failures;
+		}
+
+		return failures;
+	}
+
+	//! Checks kernel on all 16 bit inputs
+	s32 checkAllInputs(const SConversion& conversion,
+			tConvertColorsSIMD kernel, bool checkBulk)
+	{
+		core::array<u16> source;
+		source.setUsed(65536);
+
+		for (u32 i = 0; i < 65536; ++i)
+			source[i] = (u16) i;
+
+		s32 failures = compare(conversion, kernel, checkBulk,
+				(const u8*) source.pointer(), 65536);
+
+		// same inputs shifted against register boundaries
+		for (s32 offset = 1; offset < 4; ++offset)
+			failures += compare(conversion, kernel, checkBulk,
+					(const u8*) (source.pointer() + offset), 65536 - offset);
+
+		return failures;
+	}
+
+	//! Checks kernel on random pixels of every length up to 128, then on
+	//! random lengths up to 5000, at several offsets
+	s32 checkRandomInputs(const SConversion& conversion,
+			tConvertColorsSIMD kernel, bool checkBulk)
+	{
+		tests::CTestRandom random(conversion.SourceSize * 31
+				+ conversion.DestSize);
+
+		core::array<u8> source;
+		source.setUsed((5000 + 4) * conversion.SourceSize);
+
+		s32 failures = 0;
+
+		for (s32 i = 0; i < 400; ++i)
+		{
+			const s32 count = i < 128 ? i : (s32) random.next(5000);
+			const u32 offset = random.next(4) * conversion.SourceSize;
+
+			for (u32 k = 0; k < source.size(); ++k)
+				source[k] = (u8) random.next();
+
+			failures += compare(conversion, kernel, checkBulk,
+					source.pointer() + offset, count);
+		}
+
+		return failures;
+	}
+
+	//! Checks every conversion of one instruction set
+	s32 checkConversions(const c8* set, const SColorConverterSIMD* table)
+	{
+		// bulk conversions use kernels of the best supported set only
+		const bool checkBulk = table == getColorConverterSIMD();
+
+		s32 failures = 0;
+		c8 name[128];
+
+		for (u32 i = 0; i < sizeof(Conversions) / sizeof(Conversions[0]); ++i)
+		{
+			const SConversion& conversion = Conversions[i];
+			const tConvertColorsSIMD kernel = table->*conversion.Kernel;
+
+			sprintf(name, "%s, %s", conversion.Name, set);
+
+			s32 result = 0;
+
+			// scalar reference relies on it
+			const u8 pixel[4] = { 0 };
+			u8 converted[4];
+
+			if (kernel(pixel, 1, converted) != 0)
+				++result;
+
+			if (conversion.SourceSize == 2)
+				result += checkAllInputs(conversion, kernel, checkBulk);
+			else
+				result += checkRandomInputs(conversion, kernel, checkBulk);
+
+			failures += tests::report(name, result);
+		}
+
+		return failures;
+	}
+}
+
+int main()
+{
+	const core::SharedCPUFeatures& cpu = core::SharedCPUFeatures::getInstance();
+
+	printf("SSSE3 %d, AVX2 %d\n", cpu.hasSSSE3(), cpu.hasAVX2());
+
+	s32 failures = 0;
+
+	if (cpu.hasSSSE3() && getColorConverterSSSE3())
+		failures += checkConversions("SSSE3", getColorConverterSSSE3());
+
+	if (cpu.hasAVX2() && getColorConverterAVX2())
+		failures += checkConversions("AVX2", getColorConverterAVX2());
+
+	return failures ? 1 : 0;
+}